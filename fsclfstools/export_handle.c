@@ -0,0 +1,2234 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+#include <fcntl.h>
+#include <io.h>
+#include <windows.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libfsclfs.h"
+
+#define EXPORT_HANDLE_NOTIFY_STREAM	stderr
+
+/* The signature of the export file: "FSCLFSEX"
+ */
+const uint8_t export_handle_file_signature[ 8 ] = {
+	'F', 'S', 'C', 'L', 'F', 'S', 'E', 'X' };
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	( *export_handle )->buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * EXPORT_HANDLE_BUFFER_SIZE );
+
+	if( ( *export_handle )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->buffer_size = EXPORT_HANDLE_BUFFER_SIZE;
+
+	if( libfsclfs_store_initialize(
+	     &( ( *export_handle )->input_store ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input store.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_carver_initialize(
+	     &( ( *export_handle )->input_carver ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input carver.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->notify_stream = EXPORT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->input_store != NULL )
+		{
+			libfsclfs_store_free(
+			 &( ( *export_handle )->input_store ),
+			 NULL );
+		}
+		if( ( *export_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->buffer );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->output_stream_opened != 0 )
+		{
+			file_stream_close(
+			 ( *export_handle )->output_stream );
+		}
+		if( ( *export_handle )->metadata_stream != NULL )
+		{
+			file_stream_close(
+			 ( *export_handle )->metadata_stream );
+		}
+		if( libfsclfs_store_free(
+		     &( ( *export_handle )->input_store ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input store.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsclfs_carver_free(
+		     &( ( *export_handle )->input_carver ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input carver.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->buffer );
+		}
+		if( ( *export_handle )->stream_last_lsns != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->stream_last_lsns );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	if( export_handle->input_store != NULL )
+	{
+		if( libfsclfs_store_signal_abort(
+		     export_handle->input_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input store to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->input_carver != NULL )
+	{
+		if( libfsclfs_carver_signal_abort(
+		     export_handle->input_carver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input carver to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets if the input is read using direct (unbuffered) IO
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_direct_io(
+     export_handle_t *export_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_direct_io";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_set_direct_io(
+	     export_handle->input_store,
+	     use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set direct IO in input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsclfs_store_open_wide(
+	     export_handle->input_store,
+	     filename,
+	     LIBFSCLFS_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libfsclfs_store_open(
+	     export_handle->input_store,
+	     filename,
+	     LIBFSCLFS_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_open_containers(
+	     export_handle->input_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input store containers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_close(
+	     export_handle->input_store,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Opens the data output
+ * If filename is NULL the data is written to stdout
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - output stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+		if( _setmode(
+		     _fileno(
+		      stdout ),
+		     _O_BINARY ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to set stdout to binary mode.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		export_handle->output_stream        = stdout;
+		export_handle->output_stream_opened = 0;
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		export_handle->output_stream = file_stream_open_wide(
+		                                filename,
+		                                L"wb" );
+#else
+		export_handle->output_stream = file_stream_open(
+		                                filename,
+		                                FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+		if( export_handle->output_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output file.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->output_stream_opened = 1;
+	}
+	export_handle->buffer_offset = 0;
+	export_handle->output_offset = 0;
+
+	return( 1 );
+}
+
+/* Opens the metadata output
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_metadata_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_metadata_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->metadata_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - metadata stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	export_handle->metadata_stream = file_stream_open_wide(
+	                                  filename,
+	                                  L"w" );
+#else
+	export_handle->metadata_stream = file_stream_open(
+	                                  filename,
+	                                  FILE_STREAM_OPEN_WRITE );
+#endif
+	if( export_handle->metadata_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the data and metadata output
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_output";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream != NULL )
+	{
+		if( export_handle_flush_buffer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( export_handle->output_stream_opened != 0 )
+		{
+			if( file_stream_close(
+			     export_handle->output_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( fflush(
+		          export_handle->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output stream.",
+			 function );
+
+			result = -1;
+		}
+		export_handle->output_stream        = NULL;
+		export_handle->output_stream_opened = 0;
+	}
+	if( export_handle->metadata_stream != NULL )
+	{
+		if( file_stream_close(
+		     export_handle->metadata_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close metadata file.",
+			 function );
+
+			result = -1;
+		}
+		export_handle->metadata_stream = NULL;
+	}
+	return( result );
+}
+
+/* Writes the pending data in the output buffer to the data output stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_flush_buffer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_flush_buffer";
+	size_t write_count    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	write_count = file_stream_write(
+	               export_handle->output_stream,
+	               export_handle->buffer,
+	               export_handle->buffer_offset );
+
+	if( write_count != export_handle->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Writes data to the data output stream
+ * Data is gathered in the output buffer so that the output is written in large blocks,
+ * data that does not fit in the output buffer is written directly
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_data(
+     export_handle_t *export_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_data";
+	size_t write_count    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->buffer_offset > export_handle->buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( export_handle->buffer_size - export_handle->buffer_offset ) )
+	{
+		if( export_handle_flush_buffer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data_size > export_handle->buffer_size )
+	{
+		write_count = file_stream_write(
+		               export_handle->output_stream,
+		               data,
+		               data_size );
+
+		if( write_count != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( export_handle->buffer[ export_handle->buffer_offset ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->buffer_offset += data_size;
+	}
+	export_handle->output_offset += data_size;
+
+	return( 1 );
+}
+
+/* Writes the export file header
+ * The file header is only written when no metadata stream is used
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_file_header(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	uint8_t file_header[ EXPORT_HANDLE_FILE_HEADER_SIZE ];
+
+	static char *function = "export_handle_write_file_header";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->metadata_stream != NULL )
+	{
+		if( fprintf(
+		     export_handle->metadata_stream,
+		     "stream index,lsn,previous lsn,undo-next lsn,type,flags,data offset,data size\n" ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write metadata header.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( memory_copy(
+	     file_header,
+	     export_handle_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header[ 8 ] ),
+	 EXPORT_HANDLE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header[ 12 ] ),
+	 EXPORT_HANDLE_RECORD_HEADER_SIZE );
+
+	if( export_handle_write_data(
+	     export_handle,
+	     file_header,
+	     EXPORT_HANDLE_FILE_HEADER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports a record
+ * Without a metadata stream the record is written as a length-prefixed record:
+ * 0  - 4 record size, including the record header
+ * 4  - 4 stream index
+ * 8  - 8 LSN
+ * 16 - 8 previous LSN
+ * 24 - 8 undo-next LSN
+ * 32 - 4 record type
+ * 36 - 2 record flags
+ * 38 - 2 padding
+ * 40 - 8 data size
+ * 48 - ... data
+ * With a metadata stream the record values are written as a CSV line
+ * and only the record data is written to the data output stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record(
+     export_handle_t *export_handle,
+     int stream_index,
+     uint64_t record_lsn,
+     libfsclfs_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t record_header[ EXPORT_HANDLE_RECORD_HEADER_SIZE ];
+
+	uint8_t *record_data    = NULL;
+	static char *function   = "export_handle_export_record";
+	size_t record_data_size = 0;
+	uint64_t data_offset    = 0;
+	uint64_t previous_lsn   = 0;
+	uint64_t undo_next_lsn  = 0;
+	uint32_t record_type    = 0;
+	uint16_t record_flags   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_get_previous_lsn(
+	     record,
+	     &previous_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_get_undo_next_lsn(
+	     record,
+	     &undo_next_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve undo-next LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_get_type(
+	     record,
+	     &record_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_get_flags(
+	     record,
+	     &record_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_get_data(
+	     record,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data == NULL )
+	 && ( record_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > (size_t) ( UINT32_MAX - EXPORT_HANDLE_RECORD_HEADER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->metadata_stream != NULL )
+	{
+		data_offset = export_handle->output_offset;
+
+		if( fprintf(
+		     export_handle->metadata_stream,
+		     "%d,0x%016" PRIx64 ",0x%016" PRIx64 ",0x%016" PRIx64 ",0x%08" PRIx32 ",0x%04" PRIx16 ",%" PRIu64 ",%" PRIzd "\n",
+		     stream_index,
+		     record_lsn,
+		     previous_lsn,
+		     undo_next_lsn,
+		     record_type,
+		     record_flags,
+		     data_offset,
+		     record_data_size ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record metadata.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( record_header[ 0 ] ),
+		 (uint32_t) ( EXPORT_HANDLE_RECORD_HEADER_SIZE + record_data_size ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( record_header[ 4 ] ),
+		 (uint32_t) stream_index );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( record_header[ 8 ] ),
+		 record_lsn );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( record_header[ 16 ] ),
+		 previous_lsn );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( record_header[ 24 ] ),
+		 undo_next_lsn );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( record_header[ 32 ] ),
+		 record_type );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_header[ 36 ] ),
+		 record_flags );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( record_header[ 38 ] ),
+		 0 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( record_header[ 40 ] ),
+		 (uint64_t) record_data_size );
+
+		if( export_handle_write_data(
+		     export_handle,
+		     record_header,
+		     EXPORT_HANDLE_RECORD_HEADER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_data_size > 0 )
+	{
+		if( export_handle_write_data(
+		     export_handle,
+		     record_data,
+		     record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_handle->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Sets the last LSN of a stream when its records were exported
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_stream_last_lsn(
+     export_handle_t *export_handle,
+     int stream_index,
+     uint64_t last_lsn,
+     libcerror_error_t **error )
+{
+	uint64_t *stream_last_lsns = NULL;
+	static char *function      = "export_handle_set_stream_last_lsn";
+	int lsn_index              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream_index < 0 )
+	 || ( (size_t) stream_index >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_index >= export_handle->number_of_stream_last_lsns )
+	{
+		stream_last_lsns = (uint64_t *) memory_reallocate(
+		                                 export_handle->stream_last_lsns,
+		                                 sizeof( uint64_t ) * ( stream_index + 1 ) );
+
+		if( stream_last_lsns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize stream last LSNs.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->stream_last_lsns = stream_last_lsns;
+
+		/* Streams without exported records are marked with the undefined LSN
+		 */
+		for( lsn_index = export_handle->number_of_stream_last_lsns;
+		     lsn_index < stream_index;
+		     lsn_index++ )
+		{
+			export_handle->stream_last_lsns[ lsn_index ] = 0xffffffff00000000ULL;
+		}
+		export_handle->number_of_stream_last_lsns = stream_index + 1;
+	}
+	export_handle->stream_last_lsns[ stream_index ] = last_lsn;
+
+	return( 1 );
+}
+
+/* Exports the records in a stream
+ * The LSNs of the records are collected by following the previous LSN chain
+ * from the last LSN until the base LSN of the stream or, if the stream was
+ * exported before, until the highest LSN that was exported at that time.
+ * The records are then exported in LSN order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_stream(
+     export_handle_t *export_handle,
+     int stream_index,
+     libfsclfs_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libfsclfs_record_t *record      = NULL;
+	uint64_t *record_lsns           = NULL;
+	uint64_t *reallocation          = NULL;
+	static char *function           = "export_handle_export_stream";
+	size_t maximum_number_of_lsns   = 0;
+	size_t number_of_record_lsns    = 0;
+	size_t record_lsn_index         = 0;
+	uint64_t base_lsn               = 0;
+	uint64_t exported_lsn           = 0xffffffff00000000ULL;
+	uint64_t last_lsn               = 0;
+	uint64_t previous_lsn           = 0;
+	uint64_t record_lsn             = 0;
+	uint8_t chain_is_complete       = 0;
+	int result                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_stream_get_base_lsn(
+	     stream,
+	     &base_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream base LSN.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_stream_get_last_lsn(
+	     stream,
+	     &last_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream last LSN.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( stream_index >= 0 )
+	 && ( stream_index < export_handle->number_of_stream_last_lsns ) )
+	{
+		exported_lsn = export_handle->stream_last_lsns[ stream_index ];
+	}
+	record_lsn = last_lsn;
+
+	/* The chain is followed backwards, hence the LSNs are collected from high to low
+	 */
+	while( export_handle->abort == 0 )
+	{
+		/* The chain is complete at the base LSN of the stream
+		 * or at the records that were already exported
+		 */
+		if( ( record_lsn == 0xffffffff00000000ULL )
+		 || ( record_lsn < base_lsn ) )
+		{
+			chain_is_complete = 1;
+
+			break;
+		}
+		if( ( exported_lsn != 0xffffffff00000000ULL )
+		 && ( record_lsn <= exported_lsn ) )
+		{
+			chain_is_complete = 1;
+
+			break;
+		}
+		result = libfsclfs_stream_get_record_by_lsn(
+		          stream,
+		          record_lsn,
+		          &record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record by LSN: 0x%08" PRIx64 ".",
+			 function,
+			 record_lsn );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsclfs_record_get_previous_lsn(
+		     record,
+		     &previous_lsn,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous LSN.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsclfs_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_record_lsns >= maximum_number_of_lsns )
+		{
+			if( maximum_number_of_lsns == 0 )
+			{
+				maximum_number_of_lsns = 256;
+			}
+			else
+			{
+				maximum_number_of_lsns *= 2;
+			}
+			if( maximum_number_of_lsns > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid maximum number of record LSNs value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = (uint64_t *) memory_reallocate(
+			                             record_lsns,
+			                             sizeof( uint64_t ) * maximum_number_of_lsns );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize record LSNs.",
+				 function );
+
+				goto on_error;
+			}
+			record_lsns = reallocation;
+		}
+		record_lsns[ number_of_record_lsns++ ] = record_lsn;
+
+		/* Stop on a corrupted previous LSN chain that does not move backwards
+		 */
+		if( previous_lsn >= record_lsn )
+		{
+			break;
+		}
+		record_lsn = previous_lsn;
+	}
+	/* A chain that ends at a record that cannot be read yet, e.g. since it is
+	 * still being written, is exported by a next call in follow mode. Exporting
+	 * the newer records now would leave a gap before them. When the stream is
+	 * exported for the first time the records that can be read are exported
+	 */
+	if( ( export_handle->abort != 0 )
+	 || ( ( chain_is_complete == 0 )
+	  &&  ( exported_lsn != 0xffffffff00000000ULL ) ) )
+	{
+		number_of_record_lsns = 0;
+	}
+	for( record_lsn_index = number_of_record_lsns;
+	     record_lsn_index > 0;
+	     record_lsn_index-- )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		record_lsn = record_lsns[ record_lsn_index - 1 ];
+
+		result = libfsclfs_stream_get_record_by_lsn(
+		          stream,
+		          record_lsn,
+		          &record,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record by LSN: 0x%08" PRIx64 ".",
+			 function,
+			 record_lsn );
+
+			goto on_error;
+		}
+		if( export_handle_export_record(
+		     export_handle,
+		     stream_index,
+		     record_lsn,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: 0x%08" PRIx64 ".",
+			 function,
+			 record_lsn );
+
+			goto on_error;
+		}
+		if( libfsclfs_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+		/* Only record the LSN of a record that was actually exported,
+		 * so that an aborted export is continued by the next call
+		 */
+		if( export_handle_set_stream_last_lsn(
+		     export_handle,
+		     stream_index,
+		     record_lsn,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set last LSN of stream: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+	}
+	if( record_lsns != NULL )
+	{
+		memory_free(
+		 record_lsns );
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_lsns != NULL )
+	{
+		memory_free(
+		 record_lsns );
+	}
+	return( -1 );
+}
+
+/* Exports the records of all streams in the store
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_streams(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libfsclfs_stream_t *stream = NULL;
+	static char *function      = "export_handle_export_streams";
+	int number_of_streams      = 0;
+	int stream_index           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_get_number_of_streams(
+	     export_handle->input_store,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		goto on_error;
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfsclfs_store_get_stream(
+		     export_handle->input_store,
+		     stream_index,
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		if( export_handle_export_stream(
+		     export_handle,
+		     stream_index,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records of stream: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_stream_free(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_flush_buffer(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		libfsclfs_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the store
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_store(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_store";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_file_header(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_streams(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export streams.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Follows the store for records appended after the store was exported
+ * The input store is polled until abort is signalled
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_follow_store(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_follow_store";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing output stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( export_handle->abort == 0 )
+	{
+		/* Make the exported records available to the reader of the output
+		 */
+		if( fflush(
+		     export_handle->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output stream.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+		Sleep(
+		 EXPORT_HANDLE_FOLLOW_POLL_INTERVAL * 1000 );
+#else
+		sleep(
+		 EXPORT_HANDLE_FOLLOW_POLL_INTERVAL );
+#endif
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libfsclfs_store_refresh(
+		          export_handle->input_store,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to refresh input store.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( export_handle_export_streams(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export appended records.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Copies a 64-bit value from a decimal system string
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_handle_system_string_copy_from_64_bit_in_decimal";
+	size_t string_index       = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t digit             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string value empty.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		digit = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value_64bit > ( ( UINT64_MAX - digit ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value 64-bit value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value_64bit *= 10;
+		safe_value_64bit += digit;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the offset of the range of the source that is carved
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_carve_range_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_carve_range_offset";
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid carve range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->carve_range_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the size of the range of the source that is carved
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_carve_range_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_carve_range_size";
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->carve_range_size = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Carves the blocks and records from the input
+ * The input is a container or a storage media image, the base log file is not used
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_carve_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_carve_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsclfs_carver_carve_file_wide(
+	     export_handle->input_carver,
+	     filename,
+	     export_handle->carve_range_offset,
+	     export_handle->carve_range_size,
+	     error ) != 1 )
+#else
+	if( libfsclfs_carver_carve_file(
+	     export_handle->input_carver,
+	     filename,
+	     export_handle->carve_range_offset,
+	     export_handle->carve_range_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve input.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the carved streams
+ * The records are exported grouped by stream in virtual LSN order,
+ * the stream number from the block headers is exported as the stream index
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_carved_streams(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libfsclfs_record_t *record = NULL;
+	static char *function      = "export_handle_export_carved_streams";
+	uint64_t record_lsn        = 0;
+	uint8_t stream_number      = 0;
+	int number_of_records      = 0;
+	int number_of_streams      = 0;
+	int record_index           = 0;
+	int stream_index           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_file_header(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_carver_get_number_of_streams(
+	     export_handle->input_carver,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved streams.",
+		 function );
+
+		goto on_error;
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfsclfs_carver_get_stream_number(
+		     export_handle->input_carver,
+		     stream_index,
+		     &stream_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream number of carved stream: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_carver_get_number_of_records(
+		     export_handle->input_carver,
+		     stream_index,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records of carved stream: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( export_handle->abort != 0 )
+			{
+				break;
+			}
+			if( libfsclfs_carver_get_record(
+			     export_handle->input_carver,
+			     stream_index,
+			     record_index,
+			     &record_lsn,
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d of carved stream: %d.",
+				 function,
+				 record_index,
+				 stream_index );
+
+				goto on_error;
+			}
+			if( export_handle_export_record(
+			     export_handle,
+			     (int) stream_number,
+			     record_lsn,
+			     record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record: %d of carved stream: %d.",
+				 function,
+				 record_index,
+				 stream_index );
+
+				goto on_error;
+			}
+			if( libfsclfs_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( export_handle_flush_buffer(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
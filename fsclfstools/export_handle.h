@@ -0,0 +1,245 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libfsclfs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the output buffer
+ */
+#define EXPORT_HANDLE_BUFFER_SIZE			( 4 * 1024 * 1024 )
+
+/* The size of the export file header
+ */
+#define EXPORT_HANDLE_FILE_HEADER_SIZE			16
+
+/* The size of the export record header
+ */
+#define EXPORT_HANDLE_RECORD_HEADER_SIZE		48
+
+/* The format version of the export file
+ */
+#define EXPORT_HANDLE_FORMAT_VERSION			1
+
+/* The number of seconds between polls of the input store in follow mode
+ */
+#define EXPORT_HANDLE_FOLLOW_POLL_INTERVAL		1
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The libfsclfs input store
+	 */
+	libfsclfs_store_t *input_store;
+
+	/* The libfsclfs input carver
+	 * used instead of the input store in carve mode
+	 */
+	libfsclfs_carver_t *input_carver;
+
+	/* The offset of the range of the source that is carved
+	 */
+	off64_t carve_range_offset;
+
+	/* The size of the range of the source that is carved
+	 * 0 represents the remainder of the source
+	 */
+	size64_t carve_range_size;
+
+	/* The data output stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate if the data output stream was opened by the export handle
+	 */
+	uint8_t output_stream_opened;
+
+	/* The metadata output stream
+	 * If set the records are exported as CSV metadata and the data output stream
+	 * only contains the record data
+	 */
+	FILE *metadata_stream;
+
+	/* The output buffer
+	 */
+	uint8_t *buffer;
+
+	/* The output buffer size
+	 */
+	size_t buffer_size;
+
+	/* The output buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The number of bytes written to the data output stream
+	 * including the bytes pending in the output buffer
+	 */
+	uint64_t output_offset;
+
+	/* The number of exported records
+	 */
+	uint64_t number_of_records;
+
+	/* The highest exported LSN of every stream
+	 * used in follow mode to only export the records appended since
+	 */
+	uint64_t *stream_last_lsns;
+
+	/* The number of stream last LSNs
+	 */
+	int number_of_stream_last_lsns;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_direct_io(
+     export_handle_t *export_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_open_metadata_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_flush_buffer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_write_data(
+     export_handle_t *export_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int export_handle_write_file_header(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_record(
+     export_handle_t *export_handle,
+     int stream_index,
+     uint64_t record_lsn,
+     libfsclfs_record_t *record,
+     libcerror_error_t **error );
+
+int export_handle_set_stream_last_lsn(
+     export_handle_t *export_handle,
+     int stream_index,
+     uint64_t last_lsn,
+     libcerror_error_t **error );
+
+int export_handle_export_stream(
+     export_handle_t *export_handle,
+     int stream_index,
+     libfsclfs_stream_t *stream,
+     libcerror_error_t **error );
+
+int export_handle_export_streams(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_store(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_follow_store(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int export_handle_set_carve_range_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_carve_range_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_carve_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_export_carved_streams(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
@@ -0,0 +1,561 @@
+/*
+ * Exports the records from a Common Log File System (CLFS) store
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "fsclfstools_getopt.h"
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libclocale.h"
+#include "fsclfstools_libcnotify.h"
+#include "fsclfstools_libfsclfs.h"
+#include "fsclfstools_output.h"
+#include "fsclfstools_signal.h"
+#include "fsclfstools_unused.h"
+
+export_handle_t *fsclfsexport_export_handle = NULL;
+int fsclfsexport_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsclfsexport to export the records from a Common Log File System (CLFS)\n"
+	                 "store.\n\n" );
+
+	fprintf( stream, "Usage: fsclfsexport [ -m metadata_file ] [ -o offset ] [ -s size ]\n"
+	                 "                    [ -t target ] [ -cdfhvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source CLFS base log file or in carve mode\n"
+	                 "\t        the source container or storage media image\n\n" );
+
+	fprintf( stream, "\t-c:     carve mode, recover the records from the blocks in the source\n"
+	                 "\t        without using the base log file\n" );
+	fprintf( stream, "\t-d:     read the source using direct (unbuffered) IO\n" );
+	fprintf( stream, "\t-f:     follow mode, after the export keep exporting the records\n"
+	                 "\t        that are appended to the store until interrupted\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     write the record values as CSV to the metadata file\n"
+	                 "\t        and only the record data to the target\n" );
+	fprintf( stream, "\t-o:     specify the offset of the range of the source to carve\n"
+	                 "\t        in bytes, the default is 0\n" );
+	fprintf( stream, "\t-s:     specify the size of the range of the source to carve\n"
+	                 "\t        in bytes, by default the remainder of the source is carved\n" );
+	fprintf( stream, "\t-t:     specify the target file to export to, by default\n"
+	                 "\t        the records are written to stdout\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for fsclfsexport
+ */
+void fsclfsexport_signal_handler(
+      fsclfstools_signal_t signal FSCLFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fsclfsexport_signal_handler";
+
+	FSCLFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsclfsexport_abort = 1;
+
+	if( fsclfsexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     fsclfsexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libfsclfs_error_t *error                 = NULL;
+	system_character_t *option_metadata_file = NULL;
+	system_character_t *option_range_offset  = NULL;
+	system_character_t *option_range_size    = NULL;
+	system_character_t *option_target_file   = NULL;
+	system_character_t *source               = NULL;
+	char *program                            = "fsclfsexport";
+	system_integer_t option                  = 0;
+	uint64_t number_of_blocks                = 0;
+	uint8_t use_direct_io                    = 0;
+	int carve_mode                           = 0;
+	int follow_mode                          = 0;
+	int verbose                              = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsclfstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsclfstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The version is printed to stderr since stdout can contain the exported records
+	 */
+	fsclfstools_output_version_fprint(
+	 stderr,
+	 program );
+
+	while( ( option = fsclfstools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "cdfhm:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				carve_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'd':
+				use_direct_io = 1;
+
+				break;
+
+			case (system_integer_t) 'f':
+				follow_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stderr );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				option_metadata_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_range_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_range_size = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsclfstools_output_copyright_fprint(
+				 stderr );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( ( carve_mode != 0 )
+	 && ( follow_mode != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Follow mode is not supported in carve mode.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( carve_mode == 0 )
+	 && ( ( option_range_offset != NULL )
+	  || ( option_range_size != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "The range offset and size are only supported in carve mode.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libfsclfs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsclfs_notify_set_verbose(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &fsclfsexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+	if( fsclfstools_signal_attach(
+	     fsclfsexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( use_direct_io != 0 )
+	{
+		if( export_handle_set_direct_io(
+		     fsclfsexport_export_handle,
+		     use_direct_io,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set direct IO.\n" );
+
+			goto on_error;
+		}
+	}
+	if( carve_mode != 0 )
+	{
+		if( option_range_offset != NULL )
+		{
+			if( export_handle_set_carve_range_offset(
+			     fsclfsexport_export_handle,
+			     option_range_offset,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported range offset: %" PRIs_SYSTEM ".\n",
+				 option_range_offset );
+
+				goto on_error;
+			}
+		}
+		if( option_range_size != NULL )
+		{
+			if( export_handle_set_carve_range_size(
+			     fsclfsexport_export_handle,
+			     option_range_size,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported range size: %" PRIs_SYSTEM ".\n",
+				 option_range_size );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_carve_input(
+		     fsclfsexport_export_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to carve: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		if( libfsclfs_carver_get_number_of_blocks(
+		     fsclfsexport_export_handle->input_carver,
+		     &number_of_blocks,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of carved blocks.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stderr,
+		 "Carved %" PRIu64 " blocks.\n",
+		 number_of_blocks );
+	}
+	else
+	{
+		if( export_handle_open_input(
+		     fsclfsexport_export_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+	}
+	if( option_metadata_file != NULL )
+	{
+		if( export_handle_open_metadata_output(
+		     fsclfsexport_export_handle,
+		     option_metadata_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open metadata file: %" PRIs_SYSTEM ".\n",
+			 option_metadata_file );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_open_output(
+	     fsclfsexport_export_handle,
+	     option_target_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target.\n" );
+
+		goto on_error;
+	}
+	if( carve_mode != 0 )
+	{
+		if( export_handle_export_carved_streams(
+		     fsclfsexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export carved records.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( export_handle_export_store(
+		     fsclfsexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export records.\n" );
+
+			goto on_error;
+		}
+	}
+	if( follow_mode != 0 )
+	{
+		if( export_handle_follow_store(
+		     fsclfsexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to follow store.\n" );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_close_output(
+	     fsclfsexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	if( carve_mode == 0 )
+	{
+		if( export_handle_close_input(
+		     fsclfsexport_export_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close export handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fsclfstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	fprintf(
+	 stderr,
+	 "Exported %" PRIu64 " records.\n",
+	 fsclfsexport_export_handle->number_of_records );
+
+	if( export_handle_free(
+	     &fsclfsexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( ( fsclfsexport_abort != 0 )
+	 && ( follow_mode == 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Export aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fsclfsexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &fsclfsexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
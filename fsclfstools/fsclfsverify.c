@@ -0,0 +1,376 @@
+/*
+ * Verifies the blocks of a Common Log File System (CLFS) store
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fsclfstools_getopt.h"
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libclocale.h"
+#include "fsclfstools_libcnotify.h"
+#include "fsclfstools_libfsclfs.h"
+#include "fsclfstools_output.h"
+#include "fsclfstools_signal.h"
+#include "fsclfstools_unused.h"
+#include "verify_handle.h"
+
+verify_handle_t *fsclfsverify_verify_handle = NULL;
+int fsclfsverify_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsclfsverify to verify the blocks of a Common Log File System (CLFS)\n"
+	                 "store.\n\n" );
+
+	fprintf( stream, "Usage: fsclfsverify [ -j threads ] [ -dhvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source CLFS base log file\n\n" );
+
+	fprintf( stream, "\t-d:     read the source using direct (unbuffered) IO\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     specify the number of threads used to verify the regions,\n"
+	                 "\t        the default is the number of threads of the store\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for fsclfsverify
+ */
+void fsclfsverify_signal_handler(
+      fsclfstools_signal_t signal FSCLFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fsclfsverify_signal_handler";
+
+	FSCLFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsclfsverify_abort = 1;
+
+	if( fsclfsverify_verify_handle != NULL )
+	{
+		if( verify_handle_signal_abort(
+		     fsclfsverify_verify_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal verification handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libfsclfs_error_t *error                     = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "fsclfsverify";
+	system_integer_t option                      = 0;
+	uint8_t use_direct_io                        = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsclfstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsclfstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	fsclfstools_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = fsclfstools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "dhj:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'd':
+				use_direct_io = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsclfstools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfsclfs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsclfs_notify_set_verbose(
+	 verbose );
+
+	if( verify_handle_initialize(
+	     &fsclfsverify_verify_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize verification handle.\n" );
+
+		goto on_error;
+	}
+	if( fsclfstools_signal_attach(
+	     fsclfsverify_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( use_direct_io != 0 )
+	{
+		if( verify_handle_set_direct_io(
+		     fsclfsverify_verify_handle,
+		     use_direct_io,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set direct IO.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		if( verify_handle_set_number_of_threads(
+		     fsclfsverify_verify_handle,
+		     option_number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_number_of_threads );
+
+			goto on_error;
+		}
+	}
+	if( verify_handle_open_input(
+	     fsclfsverify_verify_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	result = verify_handle_store_fprint(
+	          fsclfsverify_verify_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to verify store.\n" );
+
+		goto on_error;
+	}
+	if( verify_handle_close_input(
+	     fsclfsverify_verify_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close verification handle.\n" );
+
+		goto on_error;
+	}
+	if( fsclfstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle_free(
+	     &fsclfsverify_verify_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free verification handle.\n" );
+
+		goto on_error;
+	}
+	if( fsclfsverify_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Verification aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fsclfsverify_verify_handle != NULL )
+	{
+		verify_handle_free(
+		 &fsclfsverify_verify_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2164 @@
+/*
+ * Statistics handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libfsclfs.h"
+#include "stat_handle.h"
+
+#define STAT_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a statistics handle
+ * Make sure the value stat_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_initialize(
+     stat_handle_t **stat_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "stat_handle_initialize";
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stat_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stat_handle = memory_allocate_structure(
+	                stat_handle_t );
+
+	if( *stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stat_handle,
+	     0,
+	     sizeof( stat_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics handle.",
+		 function );
+
+		memory_free(
+		 *stat_handle );
+
+		*stat_handle = NULL;
+
+		return( -1 );
+	}
+	if( libfsclfs_store_initialize(
+	     &( ( *stat_handle )->input_store ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input store.",
+		 function );
+
+		goto on_error;
+	}
+	( *stat_handle )->notify_stream = STAT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *stat_handle != NULL )
+	{
+		memory_free(
+		 *stat_handle );
+
+		*stat_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a statistics handle
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_free(
+     stat_handle_t **stat_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "stat_handle_free";
+	int result            = 1;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stat_handle != NULL )
+	{
+		if( stat_handle_free_workers(
+		     *stat_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsclfs_store_free(
+		     &( ( *stat_handle )->input_store ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input store.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *stat_handle )->container_first_region_indexes != NULL )
+		{
+			memory_free(
+			 ( *stat_handle )->container_first_region_indexes );
+		}
+		if( ( *stat_handle )->container_number_of_regions != NULL )
+		{
+			memory_free(
+			 ( *stat_handle )->container_number_of_regions );
+		}
+		memory_free(
+		 *stat_handle );
+
+		*stat_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the statistics handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_signal_abort(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "stat_handle_signal_abort";
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	stat_handle->abort = 1;
+
+	if( stat_handle->input_store != NULL )
+	{
+		if( libfsclfs_store_signal_abort(
+		     stat_handle->input_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input store to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets if the input is read using direct (unbuffered) IO
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_set_direct_io(
+     stat_handle_t *stat_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "stat_handle_set_direct_io";
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_set_direct_io(
+	     stat_handle->input_store,
+	     use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set direct IO in input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a 64-bit value from a decimal system string
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "stat_handle_system_string_copy_from_64_bit_in_decimal";
+	size_t string_index       = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t digit             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string value empty.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		digit = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value_64bit > ( ( UINT64_MAX - digit ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value 64-bit value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value_64bit *= 10;
+		safe_value_64bit += digit;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to scan the store
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_set_number_of_threads(
+     stat_handle_t *stat_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "stat_handle_set_number_of_threads";
+	uint64_t value_64bit  = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_set_number_of_threads(
+	     stat_handle->input_store,
+	     (int) value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_open_input(
+     stat_handle_t *stat_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libfsclfs_container_t *container = NULL;
+	static char *function            = "stat_handle_open_input";
+	size64_t container_size          = 0;
+	uint64_t number_of_regions       = 0;
+	int container_index              = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle->container_first_region_indexes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics handle - container first region indexes value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsclfs_store_open_wide(
+	     stat_handle->input_store,
+	     filename,
+	     LIBFSCLFS_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libfsclfs_store_open(
+	     stat_handle->input_store,
+	     filename,
+	     LIBFSCLFS_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input store.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_store_open_containers(
+	     stat_handle->input_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input store containers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_store_get_region_size(
+	     stat_handle->input_store,
+	     &( stat_handle->region_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve region size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_store_get_region_owner_page_offset(
+	     stat_handle->input_store,
+	     &( stat_handle->region_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve region owner page offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( stat_handle->region_size == 0 )
+	 || ( stat_handle->region_data_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_store_get_number_of_containers(
+	     stat_handle->input_store,
+	     &( stat_handle->number_of_containers ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of containers.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( stat_handle->number_of_containers < 0 )
+	 || ( (size_t) stat_handle->number_of_containers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of containers value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( stat_handle->number_of_containers == 0 )
+	{
+		return( 1 );
+	}
+	stat_handle->container_first_region_indexes = (int *) memory_allocate(
+	                                                       sizeof( int ) * stat_handle->number_of_containers );
+
+	if( stat_handle->container_first_region_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create container first region indexes.",
+		 function );
+
+		goto on_error;
+	}
+	stat_handle->container_number_of_regions = (int *) memory_allocate(
+	                                                    sizeof( int ) * stat_handle->number_of_containers );
+
+	if( stat_handle->container_number_of_regions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create container number of regions.",
+		 function );
+
+		goto on_error;
+	}
+	stat_handle->number_of_regions = 0;
+
+	for( container_index = 0;
+	     container_index < stat_handle->number_of_containers;
+	     container_index++ )
+	{
+		if( libfsclfs_store_get_container(
+		     stat_handle->input_store,
+		     container_index,
+		     &container,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container: %d.",
+			 function,
+			 container_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_container_get_size(
+		     container,
+		     &container_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of container: %d.",
+			 function,
+			 container_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_container_free(
+		     &container,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free container: %d.",
+			 function,
+			 container_index );
+
+			goto on_error;
+		}
+		number_of_regions = container_size / stat_handle->region_size;
+
+		if( number_of_regions > (uint64_t) ( INT_MAX - stat_handle->number_of_regions ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid container: %d - number of regions value out of bounds.",
+			 function,
+			 container_index );
+
+			goto on_error;
+		}
+		stat_handle->container_first_region_indexes[ container_index ] = stat_handle->number_of_regions;
+		stat_handle->container_number_of_regions[ container_index ]    = (int) number_of_regions;
+
+		stat_handle->number_of_regions += (int) number_of_regions;
+	}
+	return( 1 );
+
+on_error:
+	if( container != NULL )
+	{
+		libfsclfs_container_free(
+		 &container,
+		 NULL );
+	}
+	if( stat_handle->container_number_of_regions != NULL )
+	{
+		memory_free(
+		 stat_handle->container_number_of_regions );
+
+		stat_handle->container_number_of_regions = NULL;
+	}
+	if( stat_handle->container_first_region_indexes != NULL )
+	{
+		memory_free(
+		 stat_handle->container_first_region_indexes );
+
+		stat_handle->container_first_region_indexes = NULL;
+	}
+	stat_handle->number_of_containers = 0;
+	stat_handle->number_of_regions    = 0;
+
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int stat_handle_close_input(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "stat_handle_close_input";
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_close(
+	     stat_handle->input_store,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Frees the workers
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_free_workers(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	stat_handle_worker_t *worker = NULL;
+	static char *function        = "stat_handle_free_workers";
+	int worker_index             = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < stat_handle->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( stat_handle->workers[ worker_index ] );
+
+			if( worker->streams != NULL )
+			{
+				memory_free(
+				 worker->streams );
+			}
+			if( worker->containers != NULL )
+			{
+				memory_free(
+				 worker->containers );
+			}
+			if( worker->region_block_bytes != NULL )
+			{
+				memory_free(
+				 worker->region_block_bytes );
+			}
+			if( worker->chain_entries != NULL )
+			{
+				memory_free(
+				 worker->chain_entries );
+			}
+		}
+		memory_free(
+		 stat_handle->workers );
+
+		stat_handle->workers = NULL;
+	}
+	stat_handle->number_of_workers = 0;
+
+	return( 1 );
+}
+
+/* Creates the workers
+ * There is a worker for every thread used to scan the store
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_create_workers(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	stat_handle_worker_t *worker = NULL;
+	static char *function        = "stat_handle_create_workers";
+	int number_of_workers        = 0;
+	int worker_index             = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics handle - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_get_number_of_threads(
+	     stat_handle->input_store,
+	     &number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( (size_t) number_of_workers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( stat_handle_worker_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) stat_handle->number_of_containers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( stat_handle_container_statistics_t ) ) )
+	 || ( (size_t) stat_handle->number_of_regions > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of containers or regions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	stat_handle->workers = (stat_handle_worker_t *) memory_allocate(
+	                                                 sizeof( stat_handle_worker_t ) * number_of_workers );
+
+	if( stat_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     stat_handle->workers,
+	     0,
+	     sizeof( stat_handle_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 stat_handle->workers );
+
+		stat_handle->workers = NULL;
+
+		return( -1 );
+	}
+	stat_handle->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( stat_handle->workers[ worker_index ] );
+
+		worker->streams = (stat_handle_stream_statistics_t *) memory_allocate(
+		                                                       sizeof( stat_handle_stream_statistics_t ) * STAT_HANDLE_NUMBER_OF_STREAMS );
+
+		if( worker->streams == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create stream statistics of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     worker->streams,
+		     0,
+		     sizeof( stat_handle_stream_statistics_t ) * STAT_HANDLE_NUMBER_OF_STREAMS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear stream statistics of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( stat_handle->number_of_containers > 0 )
+		{
+			worker->containers = (stat_handle_container_statistics_t *) memory_allocate(
+			                                                             sizeof( stat_handle_container_statistics_t ) * stat_handle->number_of_containers );
+
+			if( worker->containers == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create container statistics of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     worker->containers,
+			     0,
+			     sizeof( stat_handle_container_statistics_t ) * stat_handle->number_of_containers ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear container statistics of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( stat_handle->number_of_regions > 0 )
+		{
+			worker->region_block_bytes = (uint64_t *) memory_allocate(
+			                                           sizeof( uint64_t ) * stat_handle->number_of_regions );
+
+			if( worker->region_block_bytes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create region block bytes of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     worker->region_block_bytes,
+			     0,
+			     sizeof( uint64_t ) * stat_handle->number_of_regions ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear region block bytes of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	stat_handle_free_workers(
+	 stat_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Appends a chain entry to a worker
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_append_chain_entry(
+     stat_handle_worker_t *worker,
+     uint8_t stream_number,
+     uint64_t lsn,
+     uint64_t previous_lsn,
+     libcerror_error_t **error )
+{
+	stat_handle_chain_entry_t *chain_entries = NULL;
+	static char *function                    = "stat_handle_append_chain_entry";
+	int number_of_allocated_chain_entries    = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->number_of_chain_entries >= worker->number_of_allocated_chain_entries )
+	{
+		if( worker->number_of_allocated_chain_entries == 0 )
+		{
+			number_of_allocated_chain_entries = 4096;
+		}
+		else
+		{
+			if( worker->number_of_allocated_chain_entries > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of chain entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_chain_entries = worker->number_of_allocated_chain_entries * 2;
+		}
+		if( (size_t) number_of_allocated_chain_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( stat_handle_chain_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated chain entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		chain_entries = (stat_handle_chain_entry_t *) memory_reallocate(
+		                                               worker->chain_entries,
+		                                               sizeof( stat_handle_chain_entry_t ) * number_of_allocated_chain_entries );
+
+		if( chain_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chain entries.",
+			 function );
+
+			return( -1 );
+		}
+		worker->chain_entries                     = chain_entries;
+		worker->number_of_allocated_chain_entries = number_of_allocated_chain_entries;
+	}
+	chain_entries = &( worker->chain_entries[ worker->number_of_chain_entries ] );
+
+	chain_entries->lsn              = lsn;
+	chain_entries->previous_lsn     = previous_lsn;
+	chain_entries->chain_head_index = worker->number_of_chain_entries;
+	chain_entries->chain_length     = 0;
+	chain_entries->stream_number    = stream_number;
+
+	worker->number_of_chain_entries += 1;
+
+	return( 1 );
+}
+
+/* Determines the index of the power of 2 bucket of a value
+ */
+static int stat_handle_get_size_bucket(
+            uint64_t value )
+{
+	int bucket_index = 0;
+
+	while( ( value > 1 )
+	    && ( bucket_index < ( STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS - 1 ) ) )
+	{
+		value >>= 1;
+
+		bucket_index++;
+	}
+	return( bucket_index );
+}
+
+/* Determines the index of the 10% bucket of a ratio
+ */
+static int stat_handle_get_fill_ratio_bucket(
+            uint64_t value,
+            uint64_t maximum_value )
+{
+	int bucket_index = 0;
+
+	if( maximum_value == 0 )
+	{
+		return( 0 );
+	}
+	bucket_index = (int) ( ( value * STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS ) / maximum_value );
+
+	if( bucket_index >= STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS )
+	{
+		bucket_index = STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS - 1;
+	}
+	return( bucket_index );
+}
+
+/* Updates the statistics of the worker with a block
+ * This function is called by libfsclfs_store_scan_blocks possibly from multiple threads,
+ * every thread only updates the statistics of its own worker
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_block_callback(
+     int worker_index,
+     int container_index,
+     int stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint32_t used_size,
+     libfsclfs_record_header_table_t *record_header_table,
+     void *callback_data )
+{
+	stat_handle_container_statistics_t *container_statistics = NULL;
+	stat_handle_stream_statistics_t *stream_statistics       = NULL;
+	stat_handle_t *stat_handle                               = NULL;
+	stat_handle_worker_t *worker                             = NULL;
+	const uint64_t *previous_lsns                            = NULL;
+	const uint64_t *virtual_lsns                             = NULL;
+	const uint32_t *sizes                                    = NULL;
+	uint32_t region_index                                    = 0;
+	int number_of_records                                    = 0;
+	int record_index                                         = 0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	stat_handle = (stat_handle_t *) callback_data;
+
+	if( ( stat_handle->workers == NULL )
+	 || ( worker_index < 0 )
+	 || ( worker_index >= stat_handle->number_of_workers ) )
+	{
+		return( -1 );
+	}
+	if( ( container_index < 0 )
+	 || ( container_index >= stat_handle->number_of_containers ) )
+	{
+		return( -1 );
+	}
+	if( ( stream_number < 0 )
+	 || ( stream_number >= STAT_HANDLE_NUMBER_OF_STREAMS ) )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_record_header_table_get_number_of_records(
+	     record_header_table,
+	     &number_of_records,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_record_header_table_get_virtual_lsns(
+	     record_header_table,
+	     &virtual_lsns,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_record_header_table_get_previous_lsns(
+	     record_header_table,
+	     &previous_lsns,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_record_header_table_get_sizes(
+	     record_header_table,
+	     &sizes,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	worker = &( stat_handle->workers[ worker_index ] );
+
+	stream_statistics = &( worker->streams[ stream_number ] );
+
+	stream_statistics->number_of_blocks  += 1;
+	stream_statistics->number_of_records += number_of_records;
+	stream_statistics->block_bytes       += block_size;
+	stream_statistics->used_bytes        += used_size;
+
+	stream_statistics->fill_ratio_histogram[ stat_handle_get_fill_ratio_bucket( used_size, block_size ) ] += 1;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		stream_statistics->record_bytes += sizes[ record_index ];
+
+		stream_statistics->record_size_histogram[ stat_handle_get_size_bucket( sizes[ record_index ] ) ] += 1;
+
+		if( stat_handle_append_chain_entry(
+		     worker,
+		     (uint8_t) stream_number,
+		     virtual_lsns[ record_index ],
+		     previous_lsns[ record_index ],
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	container_statistics = &( worker->containers[ container_index ] );
+
+	container_statistics->number_of_blocks += 1;
+	container_statistics->block_bytes      += block_size;
+	container_statistics->used_bytes       += used_size;
+
+	region_index = block_offset / stat_handle->region_size;
+
+	if( region_index < (uint32_t) stat_handle->container_number_of_regions[ container_index ] )
+	{
+		worker->region_block_bytes[ stat_handle->container_first_region_indexes[ container_index ] + region_index ] += block_size;
+	}
+	return( 1 );
+}
+
+/* Merges the statistics of all the workers into the first worker
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_merge_workers(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	stat_handle_chain_entry_t *chain_entries = NULL;
+	stat_handle_worker_t *first_worker       = NULL;
+	stat_handle_worker_t *worker             = NULL;
+	static char *function                    = "stat_handle_merge_workers";
+	int bucket_index                         = 0;
+	int chain_entry_index                    = 0;
+	int container_index                      = 0;
+	int number_of_chain_entries              = 0;
+	int region_index                         = 0;
+	int stream_number                        = 0;
+	int worker_index                         = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid statistics handle - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	first_worker = &( stat_handle->workers[ 0 ] );
+
+	number_of_chain_entries = first_worker->number_of_chain_entries;
+
+	for( worker_index = 1;
+	     worker_index < stat_handle->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( stat_handle->workers[ worker_index ] );
+
+		if( worker->number_of_chain_entries > ( INT_MAX - number_of_chain_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chain entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_chain_entries += worker->number_of_chain_entries;
+	}
+	if( number_of_chain_entries > first_worker->number_of_allocated_chain_entries )
+	{
+		if( (size_t) number_of_chain_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( stat_handle_chain_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chain entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		chain_entries = (stat_handle_chain_entry_t *) memory_reallocate(
+		                                               first_worker->chain_entries,
+		                                               sizeof( stat_handle_chain_entry_t ) * number_of_chain_entries );
+
+		if( chain_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chain entries.",
+			 function );
+
+			return( -1 );
+		}
+		first_worker->chain_entries                     = chain_entries;
+		first_worker->number_of_allocated_chain_entries = number_of_chain_entries;
+	}
+	for( worker_index = 1;
+	     worker_index < stat_handle->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( stat_handle->workers[ worker_index ] );
+
+		for( stream_number = 0;
+		     stream_number < STAT_HANDLE_NUMBER_OF_STREAMS;
+		     stream_number++ )
+		{
+			first_worker->streams[ stream_number ].number_of_blocks  += worker->streams[ stream_number ].number_of_blocks;
+			first_worker->streams[ stream_number ].number_of_records += worker->streams[ stream_number ].number_of_records;
+			first_worker->streams[ stream_number ].record_bytes      += worker->streams[ stream_number ].record_bytes;
+			first_worker->streams[ stream_number ].block_bytes       += worker->streams[ stream_number ].block_bytes;
+			first_worker->streams[ stream_number ].used_bytes        += worker->streams[ stream_number ].used_bytes;
+
+			for( bucket_index = 0;
+			     bucket_index < STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS;
+			     bucket_index++ )
+			{
+				first_worker->streams[ stream_number ].record_size_histogram[ bucket_index ] += worker->streams[ stream_number ].record_size_histogram[ bucket_index ];
+			}
+			for( bucket_index = 0;
+			     bucket_index < STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS;
+			     bucket_index++ )
+			{
+				first_worker->streams[ stream_number ].fill_ratio_histogram[ bucket_index ] += worker->streams[ stream_number ].fill_ratio_histogram[ bucket_index ];
+			}
+		}
+		for( container_index = 0;
+		     container_index < stat_handle->number_of_containers;
+		     container_index++ )
+		{
+			first_worker->containers[ container_index ].number_of_blocks += worker->containers[ container_index ].number_of_blocks;
+			first_worker->containers[ container_index ].block_bytes      += worker->containers[ container_index ].block_bytes;
+			first_worker->containers[ container_index ].used_bytes       += worker->containers[ container_index ].used_bytes;
+		}
+		for( region_index = 0;
+		     region_index < stat_handle->number_of_regions;
+		     region_index++ )
+		{
+			first_worker->region_block_bytes[ region_index ] += worker->region_block_bytes[ region_index ];
+		}
+		for( chain_entry_index = 0;
+		     chain_entry_index < worker->number_of_chain_entries;
+		     chain_entry_index++ )
+		{
+			first_worker->chain_entries[ first_worker->number_of_chain_entries ] = worker->chain_entries[ chain_entry_index ];
+
+			first_worker->number_of_chain_entries += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two chain entries by stream number and LSN
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
+ */
+int stat_handle_chain_entry_compare(
+     const stat_handle_chain_entry_t *first_chain_entry,
+     const stat_handle_chain_entry_t *second_chain_entry )
+{
+	if( first_chain_entry->stream_number < second_chain_entry->stream_number )
+	{
+		return( -1 );
+	}
+	else if( first_chain_entry->stream_number > second_chain_entry->stream_number )
+	{
+		return( 1 );
+	}
+	if( first_chain_entry->lsn < second_chain_entry->lsn )
+	{
+		return( -1 );
+	}
+	else if( first_chain_entry->lsn > second_chain_entry->lsn )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the chains the records form by their previous LSN
+ * The chain entries are sorted by stream number and LSN, since the previous LSN
+ * of a record is less than its LSN every record can be assigned to its chain
+ * in a single pass in ascending order
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_determine_chains(
+     stat_handle_worker_t *worker,
+     libcerror_error_t **error )
+{
+	stat_handle_chain_entry_t *chain_entry = NULL;
+	static char *function                  = "stat_handle_determine_chains";
+	int chain_entry_index                  = 0;
+	int lower_index                        = 0;
+	int middle_index                       = 0;
+	int upper_index                        = 0;
+	int result                             = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->number_of_chain_entries == 0 )
+	{
+		return( 1 );
+	}
+	qsort(
+	 worker->chain_entries,
+	 (size_t) worker->number_of_chain_entries,
+	 sizeof( stat_handle_chain_entry_t ),
+	 (int (*)(const void *, const void *)) &stat_handle_chain_entry_compare );
+
+	for( chain_entry_index = 0;
+	     chain_entry_index < worker->number_of_chain_entries;
+	     chain_entry_index++ )
+	{
+		chain_entry = &( worker->chain_entries[ chain_entry_index ] );
+
+		chain_entry->chain_head_index = chain_entry_index;
+		chain_entry->chain_length     = 0;
+
+		if( ( chain_entry->previous_lsn != 0 )
+		 && ( chain_entry->previous_lsn < chain_entry->lsn ) )
+		{
+			lower_index = 0;
+			upper_index = chain_entry_index;
+
+			while( lower_index < upper_index )
+			{
+				middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+				if( worker->chain_entries[ middle_index ].stream_number < chain_entry->stream_number )
+				{
+					result = -1;
+				}
+				else if( worker->chain_entries[ middle_index ].stream_number > chain_entry->stream_number )
+				{
+					result = 1;
+				}
+				else if( worker->chain_entries[ middle_index ].lsn < chain_entry->previous_lsn )
+				{
+					result = -1;
+				}
+				else if( worker->chain_entries[ middle_index ].lsn > chain_entry->previous_lsn )
+				{
+					result = 1;
+				}
+				else
+				{
+					chain_entry->chain_head_index = worker->chain_entries[ middle_index ].chain_head_index;
+
+					break;
+				}
+				if( result < 0 )
+				{
+					lower_index = middle_index + 1;
+				}
+				else
+				{
+					upper_index = middle_index;
+				}
+			}
+		}
+		worker->chain_entries[ chain_entry->chain_head_index ].chain_length += 1;
+	}
+	return( 1 );
+}
+
+/* Prints a power of 2 size histogram
+ */
+void stat_handle_size_histogram_fprint(
+      stat_handle_t *stat_handle,
+      const char *description,
+      const uint64_t *histogram )
+{
+	uint64_t bucket_first_value = 0;
+	uint64_t bucket_last_value  = 0;
+	int bucket_index            = 0;
+
+	if( ( stat_handle == NULL )
+	 || ( description == NULL )
+	 || ( histogram == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\t%s:\n",
+	 description );
+
+	for( bucket_index = 0;
+	     bucket_index < STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS;
+	     bucket_index++ )
+	{
+		if( histogram[ bucket_index ] == 0 )
+		{
+			continue;
+		}
+		bucket_first_value = ( bucket_index == 0 ) ? 0 : (uint64_t) 1 << bucket_index;
+
+		if( bucket_index == ( STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS - 1 ) )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\t\t%" PRIu64 " or more\t: %" PRIu64 "\n",
+			 bucket_first_value,
+			 histogram[ bucket_index ] );
+		}
+		else
+		{
+			bucket_last_value = ( (uint64_t) 1 << ( bucket_index + 1 ) ) - 1;
+
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\t\t%" PRIu64 " - %" PRIu64 "\t: %" PRIu64 "\n",
+			 bucket_first_value,
+			 bucket_last_value,
+			 histogram[ bucket_index ] );
+		}
+	}
+}
+
+/* Prints a 10% fill ratio histogram
+ */
+void stat_handle_fill_ratio_histogram_fprint(
+      stat_handle_t *stat_handle,
+      const char *description,
+      const uint64_t *histogram )
+{
+	int bucket_index = 0;
+
+	if( ( stat_handle == NULL )
+	 || ( description == NULL )
+	 || ( histogram == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\t%s:\n",
+	 description );
+
+	for( bucket_index = 0;
+	     bucket_index < STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS;
+	     bucket_index++ )
+	{
+		if( histogram[ bucket_index ] == 0 )
+		{
+			continue;
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\t\t%3d%% - %3d%%\t: %" PRIu64 "\n",
+		 bucket_index * 10,
+		 ( bucket_index + 1 ) * 10,
+		 histogram[ bucket_index ] );
+	}
+}
+
+/* Prints the stream statistics
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_streams_fprint(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	uint64_t chain_length_histogram[ STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS ];
+
+	stat_handle_chain_entry_t *chain_entry             = NULL;
+	stat_handle_stream_statistics_t *stream_statistics = NULL;
+	stat_handle_worker_t *worker                       = NULL;
+	static char *function                              = "stat_handle_streams_fprint";
+	uint64_t maximum_chain_length                      = 0;
+	uint64_t number_of_chains                          = 0;
+	uint64_t number_of_chained_records                 = 0;
+	int chain_entry_index                              = 0;
+	int stream_number                                  = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid statistics handle - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( stat_handle->workers[ 0 ] );
+
+	for( stream_number = 0;
+	     stream_number < STAT_HANDLE_NUMBER_OF_STREAMS;
+	     stream_number++ )
+	{
+		stream_statistics = &( worker->streams[ stream_number ] );
+
+		if( stream_statistics->number_of_blocks == 0 )
+		{
+			continue;
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "Stream number: %d\n",
+		 stream_number );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tNumber of blocks\t\t: %" PRIu64 "\n",
+		 stream_statistics->number_of_blocks );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tNumber of records\t\t: %" PRIu64 "\n",
+		 stream_statistics->number_of_records );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tRecord bytes\t\t\t: %" PRIu64 "\n",
+		 stream_statistics->record_bytes );
+
+		if( stream_statistics->number_of_records > 0 )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tAverage record size\t\t: %" PRIu64 "\n",
+			 stream_statistics->record_bytes / stream_statistics->number_of_records );
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tBlock bytes\t\t\t: %" PRIu64 "\n",
+		 stream_statistics->block_bytes );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tSlack bytes in blocks\t\t: %" PRIu64 "\n",
+		 stream_statistics->block_bytes - stream_statistics->used_bytes );
+
+		if( stream_statistics->block_bytes > 0 )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tAverage block fill ratio\t: %" PRIu64 "%%\n",
+			 ( stream_statistics->used_bytes * 100 ) / stream_statistics->block_bytes );
+		}
+		stat_handle_size_histogram_fprint(
+		 stat_handle,
+		 "Record sizes",
+		 stream_statistics->record_size_histogram );
+
+		stat_handle_fill_ratio_histogram_fprint(
+		 stat_handle,
+		 "Block fill ratios",
+		 stream_statistics->fill_ratio_histogram );
+
+		if( memory_set(
+		     chain_length_histogram,
+		     0,
+		     sizeof( uint64_t ) * STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chain length histogram.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_chain_length      = 0;
+		number_of_chains          = 0;
+		number_of_chained_records = 0;
+
+		/* The chain entries are sorted by stream number
+		 */
+		while( chain_entry_index < worker->number_of_chain_entries )
+		{
+			chain_entry = &( worker->chain_entries[ chain_entry_index ] );
+
+			if( chain_entry->stream_number > (uint8_t) stream_number )
+			{
+				break;
+			}
+			chain_entry_index++;
+
+			if( ( chain_entry->stream_number < (uint8_t) stream_number )
+			 || ( chain_entry->chain_length == 0 ) )
+			{
+				continue;
+			}
+			number_of_chains          += 1;
+			number_of_chained_records += chain_entry->chain_length;
+
+			if( chain_entry->chain_length > maximum_chain_length )
+			{
+				maximum_chain_length = chain_entry->chain_length;
+			}
+			chain_length_histogram[ stat_handle_get_size_bucket( chain_entry->chain_length ) ] += 1;
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tNumber of chains\t\t: %" PRIu64 "\n",
+		 number_of_chains );
+
+		if( number_of_chains > 0 )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tAverage chain length\t\t: %" PRIu64 "\n",
+			 number_of_chained_records / number_of_chains );
+
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tMaximum chain length\t\t: %" PRIu64 "\n",
+			 maximum_chain_length );
+
+			stat_handle_size_histogram_fprint(
+			 stat_handle,
+			 "Chain lengths",
+			 chain_length_histogram );
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Prints the container and region statistics
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_containers_fprint(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	uint64_t region_utilization_histogram[ STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS ];
+
+	stat_handle_container_statistics_t *container_statistics = NULL;
+	stat_handle_worker_t *worker                             = NULL;
+	static char *function                                    = "stat_handle_containers_fprint";
+	uint64_t container_data_size                             = 0;
+	uint64_t number_of_empty_regions                         = 0;
+	uint64_t region_block_bytes                              = 0;
+	uint64_t total_block_bytes                               = 0;
+	int container_index                                      = 0;
+	int region_index                                         = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid statistics handle - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( stat_handle->workers[ 0 ] );
+
+	for( container_index = 0;
+	     container_index < stat_handle->number_of_containers;
+	     container_index++ )
+	{
+		total_block_bytes += worker->containers[ container_index ].block_bytes;
+	}
+	for( container_index = 0;
+	     container_index < stat_handle->number_of_containers;
+	     container_index++ )
+	{
+		container_statistics = &( worker->containers[ container_index ] );
+
+		container_data_size = (uint64_t) stat_handle->container_number_of_regions[ container_index ]
+		                    * stat_handle->region_data_size;
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "Container: %d\n",
+		 container_index + 1 );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tNumber of regions\t\t: %d\n",
+		 stat_handle->container_number_of_regions[ container_index ] );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tNumber of blocks\t\t: %" PRIu64 "\n",
+		 container_statistics->number_of_blocks );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tBlock bytes\t\t\t: %" PRIu64 "",
+		 container_statistics->block_bytes );
+
+		if( total_block_bytes > 0 )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 " (%" PRIu64 "%% of the store)",
+			 ( container_statistics->block_bytes * 100 ) / total_block_bytes );
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\n" );
+
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tSlack bytes in blocks\t\t: %" PRIu64 "\n",
+		 container_statistics->block_bytes - container_statistics->used_bytes );
+
+		if( container_data_size >= container_statistics->block_bytes )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tUnused bytes in regions\t\t: %" PRIu64 "\n",
+			 container_data_size - container_statistics->block_bytes );
+		}
+		if( container_data_size > 0 )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tUtilization\t\t\t: %" PRIu64 "%%\n",
+			 ( container_statistics->block_bytes * 100 ) / container_data_size );
+		}
+		if( memory_set(
+		     region_utilization_histogram,
+		     0,
+		     sizeof( uint64_t ) * STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear region utilization histogram.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_empty_regions = 0;
+
+		for( region_index = 0;
+		     region_index < stat_handle->container_number_of_regions[ container_index ];
+		     region_index++ )
+		{
+			region_block_bytes = worker->region_block_bytes[ stat_handle->container_first_region_indexes[ container_index ] + region_index ];
+
+			if( region_block_bytes == 0 )
+			{
+				number_of_empty_regions += 1;
+			}
+			region_utilization_histogram[ stat_handle_get_fill_ratio_bucket( region_block_bytes, stat_handle->region_data_size ) ] += 1;
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\tNumber of empty regions\t\t: %" PRIu64 "\n",
+		 number_of_empty_regions );
+
+		stat_handle_fill_ratio_histogram_fprint(
+		 stat_handle,
+		 "Region utilization",
+		 region_utilization_histogram );
+
+		if( stat_handle->print_regions != 0 )
+		{
+			fprintf(
+			 stat_handle->notify_stream,
+			 "\tRegions:\n" );
+
+			for( region_index = 0;
+			     region_index < stat_handle->container_number_of_regions[ container_index ];
+			     region_index++ )
+			{
+				region_block_bytes = worker->region_block_bytes[ stat_handle->container_first_region_indexes[ container_index ] + region_index ];
+
+				fprintf(
+				 stat_handle->notify_stream,
+				 "\t\t%d\t: offset: 0x%08" PRIx64 ", block bytes: %" PRIu64 ", utilization: %" PRIu64 "%%\n",
+				 region_index,
+				 (uint64_t) region_index * stat_handle->region_size,
+				 region_block_bytes,
+				 ( region_block_bytes * 100 ) / stat_handle->region_data_size );
+			}
+		}
+		fprintf(
+		 stat_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Scans the store and prints the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int stat_handle_store_fprint(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error )
+{
+	stat_handle_worker_t *worker = NULL;
+	static char *function        = "stat_handle_store_fprint";
+	uint64_t block_bytes         = 0;
+	uint64_t number_of_blocks    = 0;
+	uint64_t number_of_records   = 0;
+	uint64_t record_bytes        = 0;
+	uint64_t used_bytes          = 0;
+	int stream_number            = 0;
+
+	if( stat_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stat_handle_create_workers(
+	     stat_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_store_scan_blocks(
+	     stat_handle->input_store,
+	     &stat_handle_block_callback,
+	     (void *) stat_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( stat_handle_merge_workers(
+	     stat_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to merge workers.",
+		 function );
+
+		goto on_error;
+	}
+	worker = &( stat_handle->workers[ 0 ] );
+
+	if( stat_handle_determine_chains(
+	     worker,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine chains.",
+		 function );
+
+		goto on_error;
+	}
+	for( stream_number = 0;
+	     stream_number < STAT_HANDLE_NUMBER_OF_STREAMS;
+	     stream_number++ )
+	{
+		number_of_blocks  += worker->streams[ stream_number ].number_of_blocks;
+		number_of_records += worker->streams[ stream_number ].number_of_records;
+		record_bytes      += worker->streams[ stream_number ].record_bytes;
+		block_bytes       += worker->streams[ stream_number ].block_bytes;
+		used_bytes        += worker->streams[ stream_number ].used_bytes;
+	}
+	fprintf(
+	 stat_handle->notify_stream,
+	 "Common Log File System (CLFS) store statistics:\n" );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tNumber of containers\t\t: %d\n",
+	 stat_handle->number_of_containers );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tRegion size\t\t\t: %" PRIu32 "\n",
+	 stat_handle->region_size );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tNumber of regions\t\t: %d\n",
+	 stat_handle->number_of_regions );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tNumber of blocks\t\t: %" PRIu64 "\n",
+	 number_of_blocks );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tNumber of records\t\t: %" PRIu64 "\n",
+	 number_of_records );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tRecord bytes\t\t\t: %" PRIu64 "\n",
+	 record_bytes );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tBlock bytes\t\t\t: %" PRIu64 "\n",
+	 block_bytes );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\tSlack bytes in blocks\t\t: %" PRIu64 "\n",
+	 block_bytes - used_bytes );
+
+	fprintf(
+	 stat_handle->notify_stream,
+	 "\n" );
+
+	if( stat_handle_streams_fprint(
+	     stat_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print stream statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( stat_handle_containers_fprint(
+	     stat_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print container statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( stat_handle_free_workers(
+	     stat_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	stat_handle_free_workers(
+	 stat_handle,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -0,0 +1,306 @@
+/*
+ * Statistics handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STAT_HANDLE_H )
+#define _STAT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libfsclfs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of stream numbers, a block stores its stream number in 8 bits
+ */
+#define STAT_HANDLE_NUMBER_OF_STREAMS			256
+
+/* The number of power of 2 buckets of the size histograms
+ */
+#define STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS		32
+
+/* The number of 10% buckets of the fill ratio histograms
+ */
+#define STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS	10
+
+typedef struct stat_handle_stream_statistics stat_handle_stream_statistics_t;
+
+struct stat_handle_stream_statistics
+{
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The number of records
+	 */
+	uint64_t number_of_records;
+
+	/* The number of record bytes including the record headers
+	 */
+	uint64_t record_bytes;
+
+	/* The number of block bytes
+	 */
+	uint64_t block_bytes;
+
+	/* The number of used block bytes
+	 */
+	uint64_t used_bytes;
+
+	/* The record size histogram
+	 */
+	uint64_t record_size_histogram[ STAT_HANDLE_NUMBER_OF_SIZE_BUCKETS ];
+
+	/* The block fill ratio histogram
+	 */
+	uint64_t fill_ratio_histogram[ STAT_HANDLE_NUMBER_OF_FILL_RATIO_BUCKETS ];
+};
+
+typedef struct stat_handle_container_statistics stat_handle_container_statistics_t;
+
+struct stat_handle_container_statistics
+{
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The number of block bytes
+	 */
+	uint64_t block_bytes;
+
+	/* The number of used block bytes
+	 */
+	uint64_t used_bytes;
+};
+
+typedef struct stat_handle_chain_entry stat_handle_chain_entry_t;
+
+struct stat_handle_chain_entry
+{
+	/* The LSN of the record
+	 */
+	uint64_t lsn;
+
+	/* The previous LSN of the record
+	 */
+	uint64_t previous_lsn;
+
+	/* The index of the first entry of the chain
+	 */
+	int chain_head_index;
+
+	/* The length of the chain, only set in the first entry of the chain
+	 */
+	uint32_t chain_length;
+
+	/* The stream number
+	 */
+	uint8_t stream_number;
+};
+
+typedef struct stat_handle_worker stat_handle_worker_t;
+
+struct stat_handle_worker
+{
+	/* The stream statistics, indexed by stream number
+	 */
+	stat_handle_stream_statistics_t *streams;
+
+	/* The container statistics, indexed by container
+	 */
+	stat_handle_container_statistics_t *containers;
+
+	/* The number of block bytes per region
+	 */
+	uint64_t *region_block_bytes;
+
+	/* The chain entries
+	 */
+	stat_handle_chain_entry_t *chain_entries;
+
+	/* The number of chain entries
+	 */
+	int number_of_chain_entries;
+
+	/* The number of allocated chain entries
+	 */
+	int number_of_allocated_chain_entries;
+};
+
+typedef struct stat_handle stat_handle_t;
+
+struct stat_handle
+{
+	/* The libfsclfs input store
+	 */
+	libfsclfs_store_t *input_store;
+
+	/* The region size
+	 */
+	uint32_t region_size;
+
+	/* The size of the part of a region that can contain blocks
+	 */
+	uint32_t region_data_size;
+
+	/* The number of containers
+	 */
+	int number_of_containers;
+
+	/* The index of the first region of every container
+	 */
+	int *container_first_region_indexes;
+
+	/* The number of regions of every container
+	 */
+	int *container_number_of_regions;
+
+	/* The total number of regions
+	 */
+	int number_of_regions;
+
+	/* The per thread statistics
+	 * every thread of the scan only updates its own statistics
+	 */
+	stat_handle_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* Value to indicate the utilization of every region should be printed
+	 */
+	uint8_t print_regions;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int stat_handle_initialize(
+     stat_handle_t **stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_free(
+     stat_handle_t **stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_signal_abort(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_set_direct_io(
+     stat_handle_t *stat_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int stat_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int stat_handle_set_number_of_threads(
+     stat_handle_t *stat_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int stat_handle_open_input(
+     stat_handle_t *stat_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int stat_handle_close_input(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_free_workers(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_create_workers(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_append_chain_entry(
+     stat_handle_worker_t *worker,
+     uint8_t stream_number,
+     uint64_t lsn,
+     uint64_t previous_lsn,
+     libcerror_error_t **error );
+
+int stat_handle_block_callback(
+     int worker_index,
+     int container_index,
+     int stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint32_t used_size,
+     libfsclfs_record_header_table_t *record_header_table,
+     void *callback_data );
+
+int stat_handle_merge_workers(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_chain_entry_compare(
+     const stat_handle_chain_entry_t *first_chain_entry,
+     const stat_handle_chain_entry_t *second_chain_entry );
+
+int stat_handle_determine_chains(
+     stat_handle_worker_t *worker,
+     libcerror_error_t **error );
+
+void stat_handle_size_histogram_fprint(
+      stat_handle_t *stat_handle,
+      const char *description,
+      const uint64_t *histogram );
+
+void stat_handle_fill_ratio_histogram_fprint(
+      stat_handle_t *stat_handle,
+      const char *description,
+      const uint64_t *histogram );
+
+int stat_handle_streams_fprint(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_containers_fprint(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+int stat_handle_store_fprint(
+     stat_handle_t *stat_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _STAT_HANDLE_H ) */
+
@@ -0,0 +1,704 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libfsclfs.h"
+#include "verify_handle.h"
+
+#define VERIFY_HANDLE_NOTIFY_STREAM	stdout
+
+/* Retrieves a description of a verification failure type
+ */
+const char *verify_handle_get_failure_type_description(
+             int failure_type )
+{
+	switch( failure_type )
+	{
+		case LIBFSCLFS_VERIFICATION_FAILURE_NONE:
+			return( "none" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_READ:
+			return( "unable to read block" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_SIGNATURE:
+			return( "invalid block signature" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_NUMBER_OF_SECTORS:
+			return( "invalid number of sectors" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_OFFSETS:
+			return( "invalid block offsets" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_CHECKSUM:
+			return( "mismatch in block checksum" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_FIXUP:
+			return( "invalid fix-up values" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_RECORD_HEADERS:
+			return( "invalid record headers" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_PREVIOUS_LSN:
+			return( "invalid previous LSN chain" );
+
+		case LIBFSCLFS_VERIFICATION_FAILURE_OWNER_PAGE:
+			return( "owner page mismatch" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Creates a verification handle
+ * Make sure the value verify_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_initialize";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*verify_handle = memory_allocate_structure(
+	                  verify_handle_t );
+
+	if( *verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *verify_handle,
+	     0,
+	     sizeof( verify_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verification handle.",
+		 function );
+
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+
+		return( -1 );
+	}
+	if( libfsclfs_store_initialize(
+	     &( ( *verify_handle )->input_store ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input store.",
+		 function );
+
+		goto on_error;
+	}
+	( *verify_handle )->notify_stream = VERIFY_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *verify_handle != NULL )
+	{
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_free";
+	int result            = 1;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+		if( libfsclfs_store_free(
+		     &( ( *verify_handle )->input_store ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input store.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the verification handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_signal_abort";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->abort = 1;
+
+	if( verify_handle->input_store != NULL )
+	{
+		if( libfsclfs_store_signal_abort(
+		     verify_handle->input_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input store to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets if the input is read using direct (unbuffered) IO
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_set_direct_io(
+     verify_handle_t *verify_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_set_direct_io";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_set_direct_io(
+	     verify_handle->input_store,
+	     use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set direct IO in input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a 64-bit value from a decimal system string
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "verify_handle_system_string_copy_from_64_bit_in_decimal";
+	size_t string_index       = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t digit             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string value empty.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		digit = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value_64bit > ( ( UINT64_MAX - digit ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value 64-bit value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value_64bit *= 10;
+		safe_value_64bit += digit;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to verify the store
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_set_number_of_threads(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_set_number_of_threads";
+	uint64_t value_64bit  = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_set_number_of_threads(
+	     verify_handle->input_store,
+	     (int) value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_open_input(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_open_input";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsclfs_store_open_wide(
+	     verify_handle->input_store,
+	     filename,
+	     LIBFSCLFS_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libfsclfs_store_open(
+	     verify_handle->input_store,
+	     filename,
+	     LIBFSCLFS_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_open_containers(
+	     verify_handle->input_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input store containers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int verify_handle_close_input(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_close_input";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_close(
+	     verify_handle->input_store,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Prints the first failure of a region
+ * Callback function for libfsclfs_store_verify
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_region_callback(
+     int container_index,
+     uint32_t region_offset,
+     int number_of_blocks,
+     int number_of_failed_blocks,
+     int failure_type,
+     uint32_t failure_offset,
+     void *callback_data )
+{
+	verify_handle_t *verify_handle = NULL;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	verify_handle = (verify_handle_t *) callback_data;
+
+	if( ( number_of_blocks < 0 )
+	 || ( number_of_failed_blocks < 0 )
+	 || ( number_of_failed_blocks > number_of_blocks ) )
+	{
+		return( -1 );
+	}
+	if( verify_handle->abort != 0 )
+	{
+		return( -1 );
+	}
+	verify_handle->number_of_regions       += 1;
+	verify_handle->number_of_blocks        += (uint64_t) number_of_blocks;
+	verify_handle->number_of_failed_blocks += (uint64_t) number_of_failed_blocks;
+
+	if( failure_type == LIBFSCLFS_VERIFICATION_FAILURE_NONE )
+	{
+		return( 1 );
+	}
+	verify_handle->number_of_failed_regions += 1;
+
+	if( container_index == -1 )
+	{
+		fprintf(
+		 verify_handle->notify_stream,
+		 "Base log: first failure at offset: 0x%08" PRIx32 ": %s (%d of %d blocks failed)\n",
+		 failure_offset,
+		 verify_handle_get_failure_type_description(
+		  failure_type ),
+		 number_of_failed_blocks,
+		 number_of_blocks );
+	}
+	else
+	{
+		fprintf(
+		 verify_handle->notify_stream,
+		 "Container: %d region at offset: 0x%08" PRIx32 ": first failure at offset: 0x%08" PRIx32 ": %s (%d of %d blocks failed)\n",
+		 container_index,
+		 region_offset,
+		 failure_offset,
+		 verify_handle_get_failure_type_description(
+		  failure_type ),
+		 number_of_failed_blocks,
+		 number_of_blocks );
+	}
+	return( 1 );
+}
+
+/* Verifies the store and prints the failures and a summary
+ * Returns 1 if the store was verified without failures, 0 if not or -1 on error
+ */
+int verify_handle_store_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_store_fprint";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->number_of_regions        = 0;
+	verify_handle->number_of_blocks         = 0;
+	verify_handle->number_of_failed_regions = 0;
+	verify_handle->number_of_failed_blocks  = 0;
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "Verifying Common Log File System (CLFS) store.\n" );
+
+	if( libfsclfs_store_verify(
+	     verify_handle->input_store,
+	     &verify_handle_region_callback,
+	     (void *) verify_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify store.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "Common Log File System (CLFS) store verification:\n" );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of regions\t\t: %d\n",
+	 verify_handle->number_of_regions );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of blocks\t\t: %" PRIu64 "\n",
+	 verify_handle->number_of_blocks );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of failed regions\t: %d\n",
+	 verify_handle->number_of_failed_regions );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of failed blocks\t\t: %" PRIu64 "\n",
+	 verify_handle->number_of_failed_blocks );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tResult\t\t\t\t: " );
+
+	if( verify_handle->number_of_failed_regions != 0 )
+	{
+		fprintf(
+		 verify_handle->notify_stream,
+		 "FAILURE\n" );
+	}
+	else
+	{
+		fprintf(
+		 verify_handle->notify_stream,
+		 "SUCCESS\n" );
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\n" );
+
+	if( verify_handle->number_of_failed_regions != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
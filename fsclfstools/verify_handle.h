@@ -0,0 +1,126 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFY_HANDLE_H )
+#define _VERIFY_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsclfstools_libcerror.h"
+#include "fsclfstools_libfsclfs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct verify_handle verify_handle_t;
+
+struct verify_handle
+{
+	/* The libfsclfs input store
+	 */
+	libfsclfs_store_t *input_store;
+
+	/* The number of verified regions
+	 */
+	int number_of_regions;
+
+	/* The number of verified blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The number of regions with a failure
+	 */
+	int number_of_failed_regions;
+
+	/* The number of blocks with a failure
+	 */
+	uint64_t number_of_failed_blocks;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+const char *verify_handle_get_failure_type_description(
+             int failure_type );
+
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_set_direct_io(
+     verify_handle_t *verify_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int verify_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int verify_handle_set_number_of_threads(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verify_handle_open_input(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verify_handle_close_input(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_region_callback(
+     int container_index,
+     uint32_t region_offset,
+     int number_of_blocks,
+     int number_of_failed_blocks,
+     int failure_type,
+     uint32_t failure_offset,
+     void *callback_data );
+
+int verify_handle_store_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFY_HANDLE_H ) */
+
@@ -0,0 +1,81 @@
+/*
+ * The scan cursor state definition
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSCLFS_SCAN_CURSOR_STATE_H )
+#define _FSCLFS_SCAN_CURSOR_STATE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsclfs_scan_cursor_state fsclfs_scan_cursor_state_t;
+
+struct fsclfs_scan_cursor_state
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "FSCLFSSC"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The store identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t store_identifier[ 16 ];
+
+	/* The stream number
+	 * Consists of 2 bytes
+	 */
+	uint8_t stream_number[ 2 ];
+
+	/* The current LSN
+	 * Consists of 8 bytes
+	 * Contains the container logical number, block offset and record number
+	 */
+	uint8_t current_lsn[ 8 ];
+
+	/* The number of records
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_records[ 8 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the preceding data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSCLFS_SCAN_CURSOR_STATE_H ) */
+
@@ -0,0 +1,588 @@
+/*
+ * Aligned buffer pool functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_aligned_pool.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+
+/* Creates an aligned buffer
+ * Make sure the value aligned_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_aligned_buffer_initialize(
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     size_t buffer_size,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_aligned_buffer_initialize";
+	size_t alignment_size = 0;
+
+	if( aligned_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aligned_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid aligned buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( alignment == 0 )
+	 || ( buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - alignment ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*aligned_buffer = memory_allocate_structure(
+	                   libfsclfs_aligned_buffer_t );
+
+	if( *aligned_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create aligned buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The allocation is over-sized so that the data can start at an aligned offset
+	 */
+	( *aligned_buffer )->allocation = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * ( buffer_size + alignment ) );
+
+	if( ( *aligned_buffer )->allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation.",
+		 function );
+
+		goto on_error;
+	}
+	alignment_size = (size_t) ( (intptr_t) ( *aligned_buffer )->allocation ) % alignment;
+
+	if( alignment_size != 0 )
+	{
+		alignment_size = alignment - alignment_size;
+	}
+	( *aligned_buffer )->data = &( ( ( *aligned_buffer )->allocation )[ alignment_size ] );
+
+	return( 1 );
+
+on_error:
+	if( *aligned_buffer != NULL )
+	{
+		memory_free(
+		 *aligned_buffer );
+
+		*aligned_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an aligned buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_aligned_buffer_free(
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_aligned_buffer_free";
+
+	if( aligned_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aligned_buffer != NULL )
+	{
+		if( ( *aligned_buffer )->allocation != NULL )
+		{
+			memory_free(
+			 ( *aligned_buffer )->allocation );
+		}
+		memory_free(
+		 *aligned_buffer );
+
+		*aligned_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an aligned pool
+ * Make sure the value aligned_pool is referencing, is set to NULL
+ * The alignment must be a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_aligned_pool_initialize(
+     libfsclfs_aligned_pool_t **aligned_pool,
+     size_t buffer_size,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_aligned_pool_initialize";
+
+	if( aligned_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aligned_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid aligned pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment == 0 )
+	 || ( ( alignment & ( alignment - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported alignment.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( ( buffer_size % alignment ) != 0 )
+	 || ( buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - alignment ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*aligned_pool = memory_allocate_structure(
+	                 libfsclfs_aligned_pool_t );
+
+	if( *aligned_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create aligned pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *aligned_pool,
+	     0,
+	     sizeof( libfsclfs_aligned_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear aligned pool.",
+		 function );
+
+		memory_free(
+		 *aligned_pool );
+
+		*aligned_pool = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *aligned_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *aligned_pool )->buffer_size = buffer_size;
+	( *aligned_pool )->alignment   = alignment;
+
+	return( 1 );
+
+on_error:
+	if( *aligned_pool != NULL )
+	{
+		memory_free(
+		 *aligned_pool );
+
+		*aligned_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an aligned pool
+ * The buffers that are still in use are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_aligned_pool_free(
+     libfsclfs_aligned_pool_t **aligned_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_aligned_pool_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( aligned_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aligned_pool != NULL )
+	{
+		if( ( *aligned_pool )->free_buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *aligned_pool )->number_of_free_buffers;
+			     buffer_index++ )
+			{
+				if( libfsclfs_aligned_buffer_free(
+				     &( ( ( *aligned_pool )->free_buffers )[ buffer_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free aligned buffer: %d.",
+					 function,
+					 buffer_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *aligned_pool )->free_buffers );
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *aligned_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *aligned_pool );
+
+		*aligned_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a buffer from the aligned pool
+ * A previously released buffer is reused, otherwise a new buffer is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_aligned_pool_get_buffer(
+     libfsclfs_aligned_pool_t *aligned_pool,
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_aligned_pool_get_buffer";
+
+	if( aligned_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( aligned_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aligned_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid aligned buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     aligned_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( aligned_pool->number_of_free_buffers > 0 )
+	{
+		aligned_pool->number_of_free_buffers -= 1;
+
+		*aligned_buffer = aligned_pool->free_buffers[ aligned_pool->number_of_free_buffers ];
+
+		aligned_pool->free_buffers[ aligned_pool->number_of_free_buffers ] = NULL;
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     aligned_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The allocation is done outside the mutex
+	 */
+	if( *aligned_buffer == NULL )
+	{
+		if( libfsclfs_aligned_buffer_initialize(
+		     aligned_buffer,
+		     aligned_pool->buffer_size,
+		     aligned_pool->alignment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create aligned buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *aligned_buffer != NULL )
+	{
+		libfsclfs_aligned_buffer_free(
+		 aligned_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases a buffer back to the aligned pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_aligned_pool_release_buffer(
+     libfsclfs_aligned_pool_t *aligned_pool,
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     libcerror_error_t **error )
+{
+	libfsclfs_aligned_buffer_t **free_buffers = NULL;
+	static char *function                     = "libfsclfs_aligned_pool_release_buffer";
+	size_t free_buffers_size                  = 0;
+	int maximum_number_of_free_buffers        = 0;
+	int result                                = 1;
+
+	if( aligned_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( aligned_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *aligned_buffer == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     aligned_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( aligned_pool->number_of_free_buffers >= aligned_pool->maximum_number_of_free_buffers )
+	{
+		maximum_number_of_free_buffers = aligned_pool->maximum_number_of_free_buffers + 4;
+		free_buffers_size              = sizeof( libfsclfs_aligned_buffer_t * ) * maximum_number_of_free_buffers;
+
+		free_buffers = (libfsclfs_aligned_buffer_t **) memory_reallocate(
+		                                                aligned_pool->free_buffers,
+		                                                free_buffers_size );
+
+		if( free_buffers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize free buffers.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			aligned_pool->free_buffers                   = free_buffers;
+			aligned_pool->maximum_number_of_free_buffers = maximum_number_of_free_buffers;
+		}
+	}
+	if( result == 1 )
+	{
+		aligned_pool->free_buffers[ aligned_pool->number_of_free_buffers ] = *aligned_buffer;
+
+		aligned_pool->number_of_free_buffers += 1;
+
+		*aligned_buffer = NULL;
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     aligned_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* If the buffer could not be returned to the pool it is freed instead
+	 */
+	if( result != 1 )
+	{
+		libfsclfs_aligned_buffer_free(
+		 aligned_buffer,
+		 NULL );
+	}
+	return( result );
+}
+
@@ -0,0 +1,120 @@
+/*
+ * Aligned buffer pool functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_ALIGNED_POOL_H )
+#define _LIBFSCLFS_ALIGNED_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default alignment of the buffers
+ * covers the sector size of 512 and 4096 bytes per sector devices
+ */
+#define LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT		4096
+
+typedef struct libfsclfs_aligned_buffer libfsclfs_aligned_buffer_t;
+
+struct libfsclfs_aligned_buffer
+{
+	/* The allocation
+	 */
+	uint8_t *allocation;
+
+	/* The data
+	 * points into the allocation at the first aligned offset
+	 */
+	uint8_t *data;
+};
+
+typedef struct libfsclfs_aligned_pool libfsclfs_aligned_pool_t;
+
+struct libfsclfs_aligned_pool
+{
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The alignment
+	 */
+	size_t alignment;
+
+	/* The buffers that are not in use
+	 */
+	libfsclfs_aligned_buffer_t **free_buffers;
+
+	/* The number of buffers that are not in use
+	 */
+	int number_of_free_buffers;
+
+	/* The maximum number of buffers that are not in use
+	 */
+	int maximum_number_of_free_buffers;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the free buffers
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsclfs_aligned_buffer_initialize(
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     size_t buffer_size,
+     size_t alignment,
+     libcerror_error_t **error );
+
+int libfsclfs_aligned_buffer_free(
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     libcerror_error_t **error );
+
+int libfsclfs_aligned_pool_initialize(
+     libfsclfs_aligned_pool_t **aligned_pool,
+     size_t buffer_size,
+     size_t alignment,
+     libcerror_error_t **error );
+
+int libfsclfs_aligned_pool_free(
+     libfsclfs_aligned_pool_t **aligned_pool,
+     libcerror_error_t **error );
+
+int libfsclfs_aligned_pool_get_buffer(
+     libfsclfs_aligned_pool_t *aligned_pool,
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     libcerror_error_t **error );
+
+int libfsclfs_aligned_pool_release_buffer(
+     libfsclfs_aligned_pool_t *aligned_pool,
+     libfsclfs_aligned_buffer_t **aligned_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_ALIGNED_POOL_H ) */
+
@@ -30,8 +30,11 @@
 #include "libfsclfs_libbfio.h"
 #include "libfsclfs_libcerror.h"
 #include "libfsclfs_libcnotify.h"
+#include "libfsclfs_statistics.h"
+#include "libfsclfs_trace.h"
 
 #include "fsclfs_block.h"
+#include "fsclfs_record.h"
 
 const uint8_t fsclfs_block_signature[ 2 ] = { 0x15, 0x00 };
 
@@ -143,6 +146,86 @@ int libfsclfs_block_free(
 	return( 1 );
 }
 
+/* Resizes the block data
+ * The data is only reallocated when data_size exceeds the allocated data size,
+ * otherwise the existing data is reused
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_resize_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     uint32_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_block_resize_data";
+	void *reallocation    = NULL;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( (size_t) data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block->data != NULL )
+	 && ( data_size <= block->allocated_data_size ) )
+	{
+		return( 1 );
+	}
+	reallocation = memory_reallocate(
+	                block->data,
+	                sizeof( uint8_t ) * data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	block->data                = (uint8_t *) reallocation;
+	block->allocated_data_size = data_size;
+
+	if( io_handle->statistics != NULL )
+	{
+		libfsclfs_statistics_counter_add(
+		 io_handle->statistics->number_of_allocations,
+		 1 );
+	}
+	return( 1 );
+}
+
 /* Reads the block
  * Returns 1 if successful or -1 on error
  */
@@ -153,26 +236,426 @@ int libfsclfs_block_read(
      uint32_t offset,
      libcerror_error_t **error )
 {
-	static char *function           = "libfsclfs_block_read";
-	void *reallocation              = NULL;
-	ssize_t read_count              = 0;
-	uint32_t block_data_offset      = 0;
+	return( libfsclfs_block_read_with_probe(
+	         block,
+	         io_handle,
+	         file_io_handle,
+	         offset,
+	         0,
+	         error ) );
+}
+
+/* Probes for a block
+ * Unlike libfsclfs_block_read no error is created when the data at the offset
+ * is not a valid block, which is the expected outcome for most probed offsets
+ * Returns 1 if successful, 0 if no valid block was found or -1 on error
+ */
+int libfsclfs_block_probe(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t offset,
+     libcerror_error_t **error )
+{
+	return( libfsclfs_block_read_with_probe(
+	         block,
+	         io_handle,
+	         file_io_handle,
+	         offset,
+	         1,
+	         error ) );
+}
+
+/* Reads the block
+ * If probe is set, validation failures are not set in error, since libcerror
+ * ignores a NULL error, and are reported by returning 0
+ * Returns 1 if successful, 0 if probe is set and no valid block was found or -1 on error
+ */
+int libfsclfs_block_read_with_probe(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t offset,
+     uint8_t probe,
+     libcerror_error_t **error )
+{
+	libcerror_error_t **validation_error = NULL;
+	static char *function                = "libfsclfs_block_read_with_probe";
+	ssize_t read_count                   = 0;
+	uint32_t block_data_offset           = 0;
+	uint32_t owner_page_offset           = 0;
+	uint32_t read_size                   = 0;
+	uint32_t region_offset               = 0;
+	uint32_t remaining_block_size        = 0;
+	int result                           = -1;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( probe == 0 )
+	{
+		validation_error = error;
+	}
+	if( io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_BLOCK,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+		 (uint64_t) offset );
+	}
+	if( libfsclfs_block_resize_data(
+	     block,
+	     io_handle,
+	     (uint32_t) sizeof( fsclfs_block_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading block at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 function,
+		 offset,
+		 offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              block->data,
+	              sizeof( fsclfs_block_header_t ),
+	              (off64_t) offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( fsclfs_block_header_t ) )
+	{
+		if( ( probe != 0 )
+		 && ( read_count >= 0 ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		goto on_error;
+	}
+	if( io_handle->statistics != NULL )
+	{
+		if( libfsclfs_statistics_add_read(
+		     io_handle->statistics,
+		     file_io_handle,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read to statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsclfs_block_read_header_data(
+	     block,
+	     io_handle,
+	     block->data,
+	     sizeof( fsclfs_block_header_t ),
+	     validation_error ) != 1 )
+	{
+		if( probe != 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header.",
+			 function );
+		}
+		goto on_error;
+	}
+	if( libfsclfs_block_resize_data(
+	     block,
+	     io_handle,
+	     block->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize block data.",
+		 function );
+
+		goto on_error;
+	}
+	remaining_block_size = block->size - sizeof( fsclfs_block_header_t );
+
+	if( io_handle->region_size_shift != 0 )
+	{
+		region_offset = ( offset >> io_handle->region_size_shift ) << io_handle->region_size_shift;
+	}
+	else
+	{
+		region_offset = ( offset / io_handle->region_size )
+		              * io_handle->region_size;
+	}
+
+	owner_page_offset = region_offset
+	                  + io_handle->region_owner_page_offset;
+
+	block_data_offset = sizeof( fsclfs_block_header_t );
+
+	/* The owner page itself is stored contiguously at the end of the region
+	 */
+	if( ( offset >= owner_page_offset )
+	 || ( ( offset + remaining_block_size ) <= owner_page_offset ) )
+	{
+		read_size = remaining_block_size;
+	}
+	else
+	{
+		read_size = owner_page_offset - offset;
+	}
+	read_count = libbfio_handle_read_buffer(
+		      file_io_handle,
+		      &( ( block->data )[ block_data_offset ] ),
+		      (size_t) read_size,
+		      error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		if( ( probe != 0 )
+		 && ( read_count >= 0 ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block data.",
+			 function );
+		}
+		goto on_error;
+	}
+	if( io_handle->statistics != NULL )
+	{
+		if( libfsclfs_statistics_add_read(
+		     io_handle->statistics,
+		     file_io_handle,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read to statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	remaining_block_size -= read_size;
+
+	if( remaining_block_size > 0 )
+	{
+		block_data_offset += read_size;
+		region_offset     += io_handle->region_size;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+			      file_io_handle,
+			      &( ( block->data )[ block_data_offset ] ),
+			      (size_t) remaining_block_size,
+			      (off64_t) region_offset,
+			      error );
+
+		if( read_count != (ssize_t) remaining_block_size )
+		{
+			if( ( probe != 0 )
+			 && ( read_count >= 0 ) )
+			{
+				result = 0;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 region_offset,
+				 region_offset );
+			}
+			goto on_error;
+		}
+		if( io_handle->statistics != NULL )
+		{
+			if( libfsclfs_statistics_add_read(
+			     io_handle->statistics,
+			     file_io_handle,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( block->record_data_offset > sizeof( fsclfs_block_header_t ) )
+		{
+			libcnotify_printf(
+			 "%s: block header trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( ( block->data )[ sizeof( fsclfs_block_header_t ) ] ),
+			 block->record_data_offset,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+		libcnotify_printf(
+		 "%s: fix-up values data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( ( block->data )[ block->fixup_values_offset ] ),
+		 block->size - block->fixup_values_offset,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfsclfs_block_apply_fixup_values(
+	     block,
+	     io_handle,
+	     validation_error ) != 1 )
+	{
+		if( probe != 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply fix-up values.",
+			 function );
+		}
+		goto on_error;
+	}
+	if( io_handle->statistics != NULL )
+	{
+		libfsclfs_statistics_counter_add(
+		 io_handle->statistics->number_of_blocks_read,
+		 1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_BLOCK,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+		 (uint64_t) offset );
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_BLOCK,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+		 (uint64_t) offset );
+	}
+	/* The data is kept for reuse by a subsequent read
+	 */
+	block->size               = 0;
+	block->record_data_offset = 0;
+
+	return( result );
+}
+
+/* Reads the block header
+ * The block header data is validated and the block size is determined from
+ * the number of sectors, the block data itself is not read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_read_header_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsclfs_block_read_header_data";
 	uint32_t block_format_version   = 0;
-	uint32_t fixup_offset           = 0;
-	uint32_t fixup_value_index      = 0;
-	uint32_t fixup_value_offset     = 0;
-	uint32_t owner_page_offset      = 0;
-	uint32_t read_size              = 0;
-	uint32_t region_offset          = 0;
-	uint32_t remaining_block_size   = 0;
 	uint32_t stored_checksum        = 0;
 	uint16_t number_of_sectors      = 0;
 	uint16_t number_of_sectors_copy = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit            = 0;
-	uint16_t fixup_value            = 0;
-	uint16_t value_16bit            = 0;
 #endif
 
 	if( block == NULL )
@@ -197,54 +680,28 @@ int libfsclfs_block_read(
 
 		return( -1 );
 	}
-	if( block->data != NULL )
-	{
-		memory_free(
-		 block->data );
-	}
-	block->data = (uint8_t *) memory_allocate(
-	                           sizeof( fsclfs_block_header_t ) );
-
-	if( block->data == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create block data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading block at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
-		 function,
-		 offset,
-		 offset );
+		return( -1 );
 	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              block->data,
-	              sizeof( fsclfs_block_header_t ),
-	              (off64_t) offset,
-	              error );
-
-	if( read_count != (ssize_t) sizeof( fsclfs_block_header_t ) )
+	if( ( data_size < sizeof( fsclfs_block_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block header data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-		 function,
-		 offset,
-		 offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -253,13 +710,13 @@ int libfsclfs_block_read(
 		 "%s: block header data:\n",
 		 function );
 		libcnotify_print_data(
-		 block->data,
+		 data,
 		 sizeof( fsclfs_block_header_t ),
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
 	if( memory_compare(
-	     ( (fsclfs_block_header_t *) block->data )->signature,
+	     ( (fsclfs_block_header_t *) data )->signature,
 	     fsclfs_block_signature,
 	     2 ) != 0 )
 	{
@@ -270,48 +727,48 @@ int libfsclfs_block_read(
 		 "%s: invalid block signature.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	block->stream_number = ( (fsclfs_block_header_t *) block->data )->stream_number;
+	block->stream_number = ( (fsclfs_block_header_t *) data )->stream_number;
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->number_of_sectors,
+	 ( (fsclfs_block_header_t *) data )->number_of_sectors,
 	 number_of_sectors );
 
 	byte_stream_copy_to_uint16_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->number_of_sectors_copy,
+	 ( (fsclfs_block_header_t *) data )->number_of_sectors_copy,
 	 number_of_sectors_copy );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->checksum,
+	 ( (fsclfs_block_header_t *) data )->checksum,
 	 stored_checksum );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->format_version,
+	 ( (fsclfs_block_header_t *) data )->format_version,
 	 block_format_version );
 
 	byte_stream_copy_to_uint64_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->physical_lsn,
+	 ( (fsclfs_block_header_t *) data )->physical_lsn,
 	 block->physical_lsn );
 
 	byte_stream_copy_to_uint64_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->next_block_lsn,
+	 ( (fsclfs_block_header_t *) data )->next_block_lsn,
 	 block->next_block_lsn );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->record_data_offset,
+	 ( (fsclfs_block_header_t *) data )->record_data_offset,
 	 block->record_data_offset );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->sector_mapping_array_offset,
+	 ( (fsclfs_block_header_t *) data )->sector_mapping_array_offset,
 	 block->sector_mapping_array_offset );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->virtual_log_range_array_offset,
+	 ( (fsclfs_block_header_t *) data )->virtual_log_range_array_offset,
 	 block->virtual_log_range_array_offset );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_block_header_t *) block->data )->fixup_values_offset,
+	 ( (fsclfs_block_header_t *) data )->fixup_values_offset,
 	 block->fixup_values_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -320,13 +777,13 @@ int libfsclfs_block_read(
 		libcnotify_printf(
 		 "%s: signature\t\t\t\t\t\t: 0x%02x 0x%02x\n",
 		 function,
-		 ( (fsclfs_block_header_t *) block->data )->signature[ 0 ],
-		 ( (fsclfs_block_header_t *) block->data )->signature[ 1 ] );
+		 ( (fsclfs_block_header_t *) data )->signature[ 0 ],
+		 ( (fsclfs_block_header_t *) data )->signature[ 1 ] );
 
 		libcnotify_printf(
 		 "%s: fixup place holder\t\t\t\t: 0x%02" PRIx8 "\n",
 		 function,
-		 ( (fsclfs_block_header_t *) block->data )->fixup_place_holder );
+		 ( (fsclfs_block_header_t *) data )->fixup_place_holder );
 
 		libcnotify_printf(
 		 "%s: stream number\t\t\t\t\t: %" PRIu8 "\n",
@@ -346,7 +803,7 @@ int libfsclfs_block_read(
 		 (uint32_t) number_of_sectors_copy * io_handle->bytes_per_sector );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_block_header_t *) block->data )->unknown1,
+		 ( (fsclfs_block_header_t *) data )->unknown1,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: unknown1\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
@@ -364,7 +821,7 @@ int libfsclfs_block_read(
 		 block_format_version );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_block_header_t *) block->data )->unknown2,
+		 ( (fsclfs_block_header_t *) data )->unknown2,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: unknown2\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
@@ -400,7 +857,7 @@ int libfsclfs_block_read(
 		 "%s: unknown4:\n",
 		 function );
 		libcnotify_print_data(
-		 ( (fsclfs_block_header_t *) block->data )->unknown4,
+		 ( (fsclfs_block_header_t *) data )->unknown4,
 		 8,
 		 0 );
 
@@ -408,7 +865,7 @@ int libfsclfs_block_read(
 		 "%s: unknown5:\n",
 		 function );
 		libcnotify_print_data(
-		 ( (fsclfs_block_header_t *) block->data )->unknown5,
+		 ( (fsclfs_block_header_t *) data )->unknown5,
 		 44,
 		 0 );
 
@@ -418,7 +875,7 @@ int libfsclfs_block_read(
 		 block->fixup_values_offset );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_block_header_t *) block->data )->unknown6,
+		 ( (fsclfs_block_header_t *) data )->unknown6,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: unknown6\t\t\t\t\t\t: 0x%08" PRIx32 "\n",
@@ -439,9 +896,16 @@ int libfsclfs_block_read(
 		 "%s: mismatch between number of sectors and copy.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( io_handle->bytes_per_sector_shift != 0 )
+	{
+		block->size = (uint32_t) number_of_sectors << io_handle->bytes_per_sector_shift;
+	}
+	else
+	{
+		block->size = (uint32_t) number_of_sectors * io_handle->bytes_per_sector;
 	}
-	block->size = (uint32_t) number_of_sectors * io_handle->bytes_per_sector;
 
 	if( block->size < sizeof( fsclfs_block_header_t ) )
 	{
@@ -452,7 +916,7 @@ int libfsclfs_block_read(
 		 "%s: invalid block size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if UINT32_MAX > SSIZE_MAX
 	if( (size_t) block->size > (size_t) SSIZE_MAX )
@@ -464,7 +928,7 @@ int libfsclfs_block_read(
 		 "%s: invalid block data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
 	if( ( block->fixup_values_offset < sizeof( fsclfs_block_header_t ) )
@@ -477,7 +941,7 @@ int libfsclfs_block_read(
 		 "%s: invalid fix-up values offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( ( block->record_data_offset != 0 )
 	 && ( ( block->record_data_offset < sizeof( fsclfs_block_header_t ) )
@@ -490,7 +954,7 @@ int libfsclfs_block_read(
 		 "%s: invalid record data offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( ( block->virtual_log_range_array_offset != 0 )
 	 && ( ( block->virtual_log_range_array_offset < sizeof( fsclfs_block_header_t ) )
@@ -503,7 +967,7 @@ int libfsclfs_block_read(
 		 "%s: invalid virtual log range array offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( ( block->sector_mapping_array_offset != 0 )
 	 && ( ( block->sector_mapping_array_offset < sizeof( fsclfs_block_header_t ) )
@@ -516,111 +980,82 @@ int libfsclfs_block_read(
 		 "%s: invalid sector mapping array offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	reallocation = memory_reallocate(
-	                block->data,
-	                sizeof( uint8_t ) * block->size );
+	return( 1 );
+}
 
-	if( reallocation == NULL )
+/* Applies the fix-up values to the block data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_apply_fixup_values(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsclfs_block_apply_fixup_values";
+	uint32_t fixup_offset       = 0;
+	uint32_t fixup_value_index  = 0;
+	uint32_t fixup_value_offset = 0;
+	uint32_t number_of_sectors  = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t fixup_value        = 0;
+	uint16_t value_16bit        = 0;
+#endif
+
+	if( block == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to resize block data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	block->data = (uint8_t *) reallocation;
-
-	remaining_block_size = block->size - sizeof( fsclfs_block_header_t );
-
-	region_offset = ( offset / io_handle->region_size )
-	              * io_handle->region_size;
-
-	owner_page_offset = region_offset
-	                  + io_handle->region_owner_page_offset;
-
-	block_data_offset = sizeof( fsclfs_block_header_t );
-
-	if( ( offset + remaining_block_size ) <= owner_page_offset )
+	if( block->data == NULL )
 	{
-		read_size = remaining_block_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block - missing data.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( io_handle == NULL )
 	{
-		read_size = owner_page_offset - offset;
-	}
-	read_count = libbfio_handle_read_buffer(
-		      file_io_handle,
-		      &( ( block->data )[ block_data_offset ] ),
-		      (size_t) read_size,
-		      error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-	if( read_count != (ssize_t) read_size )
+		return( -1 );
+	}
+	if( io_handle->bytes_per_sector < 2 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - bytes per sector value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	remaining_block_size -= read_size;
-
-	if( remaining_block_size > 0 )
+	if( io_handle->bytes_per_sector_shift != 0 )
 	{
-		block_data_offset += read_size;
-		region_offset     += io_handle->region_size;
-
-		read_count = libbfio_handle_read_buffer_at_offset(
-			      file_io_handle,
-			      &( ( block->data )[ block_data_offset ] ),
-			      (size_t) remaining_block_size,
-			      (off64_t) region_offset,
-			      error );
-
-		if( read_count != (ssize_t) remaining_block_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 region_offset,
-			 region_offset );
-
-			goto on_error;
-		}
+		number_of_sectors = block->size >> io_handle->bytes_per_sector_shift;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	else
 	{
-		if( block->record_data_offset > sizeof( fsclfs_block_header_t ) )
-		{
-			libcnotify_printf(
-			 "%s: block header trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( ( block->data )[ sizeof( fsclfs_block_header_t ) ] ),
-			 block->record_data_offset,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-		libcnotify_printf(
-		 "%s: fix-up values data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( ( block->data )[ block->fixup_values_offset ] ),
-		 block->size - block->fixup_values_offset,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		number_of_sectors = block->size / io_handle->bytes_per_sector;
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
 	if( ( ( number_of_sectors * 2 ) > block->size )
 	 || ( block->fixup_values_offset >= ( block->size - ( number_of_sectors * 2 ) ) ) )
 	{
@@ -631,7 +1066,7 @@ int libfsclfs_block_read(
 		 "%s: invalid fixup value offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	/* Apply the fix-up values
 	 */
@@ -671,7 +1106,7 @@ int libfsclfs_block_read(
 			 "%s: mismatch in fixup value.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( fixup_value_index == 0 )
 		{
@@ -684,74 +1119,252 @@ int libfsclfs_block_read(
 				 "%s: mismatch in fixup value.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			( block->data )[ fixup_offset ] ^= 0x40;
 		}
-		if( ( fixup_value_index + 1 ) == number_of_sectors )
+		if( ( fixup_value_index + 1 ) == number_of_sectors )
+		{
+			if( ( ( block->data )[ fixup_offset ] & 0x20 ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in fixup value.",
+				 function );
+
+				return( -1 );
+			}
+			( block->data )[ fixup_offset ] ^= 0x20;
+		}
+		if( ( ( block->data )[ fixup_offset ] != 0x00 )
+		 && ( ( block->data )[ fixup_offset ] != 0x04 )
+		 && ( ( block->data )[ fixup_offset ] != 0x08 )
+		 && ( ( block->data )[ fixup_offset ] != 0x10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in fixup value.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( block->data )[ fixup_offset + 1 ] != ( (fsclfs_block_header_t *) block->data )->fixup_place_holder )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in fixup value.",
+			 function );
+
+			return( -1 );
+		}
+		( block->data )[ fixup_offset ]     = ( block->data )[ fixup_value_offset ];
+		( block->data )[ fixup_offset + 1 ] = ( block->data )[ fixup_value_offset + 1 ];
+
+		fixup_value_offset += 2;
+		fixup_offset       += io_handle->bytes_per_sector;
+	}
+	if( io_handle->statistics != NULL )
+	{
+		libfsclfs_statistics_counter_add(
+		 io_handle->statistics->number_of_fixups_applied,
+		 number_of_sectors );
+	}
+	return( 1 );
+}
+
+/* Reads a block from data
+ * The data must contain the entire block, the fix-up values are applied
+ * to a copy of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_read_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	return( libfsclfs_block_read_data_with_probe(
+	         block,
+	         io_handle,
+	         data,
+	         data_size,
+	         0,
+	         error ) );
+}
+
+/* Probes for a block in data
+ * Unlike libfsclfs_block_read_data no error is created when the data
+ * does not contain a valid block
+ * Returns 1 if successful, 0 if no valid block was found or -1 on error
+ */
+int libfsclfs_block_probe_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	return( libfsclfs_block_read_data_with_probe(
+	         block,
+	         io_handle,
+	         data,
+	         data_size,
+	         1,
+	         error ) );
+}
+
+/* Reads a block from data
+ * If probe is set, validation failures are not set in error and are reported by returning 0
+ * Returns 1 if successful, 0 if probe is set and no valid block was found or -1 on error
+ */
+int libfsclfs_block_read_data_with_probe(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t probe,
+     libcerror_error_t **error )
+{
+	libcerror_error_t **validation_error = NULL;
+	static char *function                = "libfsclfs_block_read_data_with_probe";
+	int result                           = -1;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( probe == 0 )
+	{
+		validation_error = error;
+	}
+	if( libfsclfs_block_read_header_data(
+	     block,
+	     io_handle,
+	     data,
+	     data_size,
+	     validation_error ) != 1 )
+	{
+		if( probe != 0 )
+		{
+			result = 0;
+		}
+		else
 		{
-			if( ( ( block->data )[ fixup_offset ] & 0x20 ) == 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_INPUT,
-				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-				 "%s: mismatch in fixup value.",
-				 function );
-
-				goto on_error;
-			}
-			( block->data )[ fixup_offset ] ^= 0x20;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header.",
+			 function );
 		}
-		if( ( ( block->data )[ fixup_offset ] != 0x00 )
-		 && ( ( block->data )[ fixup_offset ] != 0x04 )
-		 && ( ( block->data )[ fixup_offset ] != 0x08 )
-		 && ( ( block->data )[ fixup_offset ] != 0x10 ) )
+		goto on_error;
+	}
+	if( (size_t) block->size > data_size )
+	{
+		if( probe != 0 )
+		{
+			result = 0;
+		}
+		else
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-			 "%s: mismatch in fixup value.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
 			 function );
+		}
+		goto on_error;
+	}
+	if( libfsclfs_block_resize_data(
+	     block,
+	     io_handle,
+	     block->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
 
-			goto on_error;
+		goto on_error;
+	}
+	if( memory_copy(
+	     block->data,
+	     data,
+	     (size_t) block->size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_apply_fixup_values(
+	     block,
+	     io_handle,
+	     validation_error ) != 1 )
+	{
+		if( probe != 0 )
+		{
+			result = 0;
 		}
-		if( ( block->data )[ fixup_offset + 1 ] != ( (fsclfs_block_header_t *) block->data )->fixup_place_holder )
+		else
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-			 "%s: mismatch in fixup value.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply fix-up values.",
 			 function );
-
-			goto on_error;
 		}
-		( block->data )[ fixup_offset ]     = ( block->data )[ fixup_value_offset ];
-		( block->data )[ fixup_offset + 1 ] = ( block->data )[ fixup_value_offset + 1 ];
-
-		fixup_value_offset += 2;
-		fixup_offset       += io_handle->bytes_per_sector;
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( io_handle->statistics != NULL )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libfsclfs_statistics_counter_add(
+		 io_handle->statistics->number_of_blocks_read,
+		 1 );
 	}
-#endif
 	return( 1 );
 
 on_error:
-	if( block->data != NULL )
-	{
-		memory_free(
-		 block->data );
+	/* The data is kept for reuse by a subsequent read
+	 */
+	block->size               = 0;
+	block->record_data_offset = 0;
 
-		block->data = NULL;
-	}
-	return( -1 );
+	return( result );
 }
 
 /* Retrieves the record data
@@ -808,6 +1421,172 @@ int libfsclfs_block_get_record_data(
 	return( 1 );
 }
 
+/* Retrieves the data of a specific record in the block
+ * Only the headers of the records that precede the record are read.
+ * The record data offset is relative to the start of the block
+ * Returns 1 if successful, 0 if the block does not contain the record or -1 on error
+ */
+int libfsclfs_block_get_record_data_by_number(
+     libfsclfs_block_t *block,
+     uint16_t record_number,
+     uint8_t **record_data,
+     size_t *record_data_size,
+     size_t *record_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_record_data      = NULL;
+	static char *function          = "libfsclfs_block_get_record_data_by_number";
+	size_t alignment_padding_size  = 0;
+	size_t safe_record_data_offset = 0;
+	size_t safe_record_data_size   = 0;
+	uint32_t record_size           = 0;
+	uint32_t record_type           = 0;
+	uint16_t current_record_number = 0;
+	int result                     = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_get_record_data(
+	     block,
+	     &safe_record_data,
+	     &safe_record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	safe_record_data_offset = block->record_data_offset;
+
+	while( safe_record_data_size > 0 )
+	{
+		if( safe_record_data_size < sizeof( fsclfs_container_record_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) safe_record_data )->size,
+		 record_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) safe_record_data )->record_type,
+		 record_type );
+
+		if( ( record_size < sizeof( fsclfs_container_record_header_t ) )
+		 || ( (size_t) record_size > safe_record_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu16 " size value out of bounds.",
+			 function,
+			 current_record_number );
+
+			return( -1 );
+		}
+		if( current_record_number == record_number )
+		{
+			result = 1;
+
+			break;
+		}
+		if( ( record_type & RECORD_TYPE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+		safe_record_data        += record_size;
+		safe_record_data_size   -= record_size;
+		safe_record_data_offset += record_size;
+
+		if( ( safe_record_data_offset % 8 ) != 0 )
+		{
+			alignment_padding_size = 8 - ( safe_record_data_offset % 8 );
+
+			if( alignment_padding_size > safe_record_data_size )
+			{
+				break;
+			}
+			safe_record_data        += alignment_padding_size;
+			safe_record_data_size   -= alignment_padding_size;
+			safe_record_data_offset += alignment_padding_size;
+		}
+		current_record_number++;
+	}
+	if( result != 0 )
+	{
+		*record_data        = safe_record_data;
+		*record_data_size   = safe_record_data_size;
+		*record_data_offset = safe_record_data_offset;
+	}
+	return( result );
+}
+
 /* Retrieves the sector mapping array data
  * Returns 1 if successful, 0 if the sector mapping array offset is empty or -1 on error
  */
@@ -916,3 +1695,141 @@ int libfsclfs_block_get_virtual_log_range_array_data(
 	return( 1 );
 }
 
+/* Scans data for block signatures
+ * A candidate is a sector aligned block header with the signature: 0x15 0x00
+ * and a non-zero number of sectors that matches the copy of the number of sectors.
+ * The first 8 bytes of a block header are compared as a single 64-bit value
+ * so that only a single comparison is needed per sector.
+ * The candidate offsets are relative to the start of the data and are stored in ascending order
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scan_signatures(
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *candidate_offsets,
+     int maximum_number_of_candidates,
+     int *number_of_candidates,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsclfs_block_scan_signatures";
+	size_t data_offset              = 0;
+	uint64_t header_value           = 0;
+	uint16_t number_of_sectors      = 0;
+	uint16_t number_of_sectors_copy = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_candidates < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of candidates value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_candidates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of candidates.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_candidates = 0;
+
+	while( ( data_offset < data_size )
+	    && ( ( data_size - data_offset ) >= sizeof( fsclfs_block_header_t ) ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 header_value );
+
+		if( ( header_value & 0xffffUL ) == 0x0015UL )
+		{
+			number_of_sectors      = (uint16_t) ( header_value >> 32 );
+			number_of_sectors_copy = (uint16_t) ( header_value >> 48 );
+
+			if( ( number_of_sectors != 0 )
+			 && ( number_of_sectors == number_of_sectors_copy ) )
+			{
+				if( *number_of_candidates >= maximum_number_of_candidates )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid number of candidates value exceeds maximum.",
+					 function );
+
+					return( -1 );
+				}
+				candidate_offsets[ *number_of_candidates ] = (uint32_t) data_offset;
+
+				*number_of_candidates += 1;
+			}
+		}
+		data_offset += io_handle->bytes_per_sector;
+	}
+	return( 1 );
+}
+
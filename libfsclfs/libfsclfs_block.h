@@ -33,6 +33,8 @@
 extern "C" {
 #endif
 
+extern const uint8_t fsclfs_block_signature[ 2 ];
+
 typedef struct libfsclfs_block libfsclfs_block_t;
 
 struct libfsclfs_block
@@ -45,6 +47,11 @@ struct libfsclfs_block
 	 */
 	uint32_t size;
 
+	/* The allocated data size
+	 * the data is reused by subsequent reads and only reallocated when it grows
+	 */
+	uint32_t allocated_data_size;
+
 	/* The stream number
 	 */
 	uint8_t stream_number;
@@ -82,6 +89,12 @@ int libfsclfs_block_free(
      libfsclfs_block_t **block,
      libcerror_error_t **error );
 
+int libfsclfs_block_resize_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     uint32_t data_size,
+     libcerror_error_t **error );
+
 int libfsclfs_block_read(
      libfsclfs_block_t *block,
      libfsclfs_io_handle_t *io_handle,
@@ -89,12 +102,69 @@ int libfsclfs_block_read(
      uint32_t offset,
      libcerror_error_t **error );
 
+int libfsclfs_block_probe(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t offset,
+     libcerror_error_t **error );
+
+int libfsclfs_block_read_with_probe(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t offset,
+     uint8_t probe,
+     libcerror_error_t **error );
+
+int libfsclfs_block_read_header_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsclfs_block_apply_fixup_values(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_block_read_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsclfs_block_probe_data(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsclfs_block_read_data_with_probe(
+     libfsclfs_block_t *block,
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t probe,
+     libcerror_error_t **error );
+
 int libfsclfs_block_get_record_data(
      libfsclfs_block_t *block,
      uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error );
 
+int libfsclfs_block_get_record_data_by_number(
+     libfsclfs_block_t *block,
+     uint16_t record_number,
+     uint8_t **record_data,
+     size_t *record_data_size,
+     size_t *record_data_offset,
+     libcerror_error_t **error );
+
 int libfsclfs_block_get_sector_mapping_array_data(
      libfsclfs_block_t *block,
      uint8_t **data,
@@ -107,6 +177,15 @@ int libfsclfs_block_get_virtual_log_range_array_data(
      size_t *data_size,
      libcerror_error_t **error );
 
+int libfsclfs_block_scan_signatures(
+     libfsclfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *candidate_offsets,
+     int maximum_number_of_candidates,
+     int *number_of_candidates,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
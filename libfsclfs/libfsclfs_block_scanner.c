@@ -0,0 +1,1484 @@
+/*
+ * Block scanner functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_block.h"
+#include "libfsclfs_block_scanner.h"
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcnotify.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_record_header_table.h"
+#include "libfsclfs_scheduler.h"
+#include "libfsclfs_statistics.h"
+#include "libfsclfs_unused.h"
+
+/* Creates a block scanner
+ * Make sure the value block_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_initialize(
+     libfsclfs_block_scanner_t **block_scanner,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_containers,
+     int (*callback)(
+            int worker_index,
+            int container_index,
+            int stream_number,
+            uint32_t block_offset,
+            uint32_t block_size,
+            uint32_t used_size,
+            libfsclfs_record_header_table_t *record_header_table,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_block_scanner_initialize";
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_containers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of containers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	*block_scanner = memory_allocate_structure(
+	                  libfsclfs_block_scanner_t );
+
+	if( *block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_scanner,
+	     0,
+	     sizeof( libfsclfs_block_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block scanner.",
+		 function );
+
+		memory_free(
+		 *block_scanner );
+
+		*block_scanner = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *block_scanner )->file_io_pool_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *block_scanner )->io_handle            = io_handle;
+	( *block_scanner )->file_io_pool         = file_io_pool;
+	( *block_scanner )->number_of_containers = number_of_containers;
+	( *block_scanner )->callback             = callback;
+	( *block_scanner )->callback_data        = callback_data;
+
+	return( 1 );
+
+on_error:
+	if( *block_scanner != NULL )
+	{
+		memory_free(
+		 *block_scanner );
+
+		*block_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_free(
+     libfsclfs_block_scanner_t **block_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_block_scanner_free";
+	int result            = 1;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_scanner != NULL )
+	{
+		if( libfsclfs_block_scanner_free_workers(
+		     *block_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *block_scanner )->file_io_pool_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *block_scanner )->blocks != NULL )
+		{
+			memory_free(
+			 ( *block_scanner )->blocks );
+		}
+		memory_free(
+		 *block_scanner );
+
+		*block_scanner = NULL;
+	}
+	return( result );
+}
+
+/* Appends a block to be scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_append_block(
+     libfsclfs_block_scanner_t *block_scanner,
+     int container_index,
+     int container_physical_number,
+     uint8_t stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint64_t block_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_scanner_block_t *blocks = NULL;
+	static char *function                   = "libfsclfs_block_scanner_append_block";
+	int number_of_allocated_blocks          = 0;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( container_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid container index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( container_physical_number < 0 )
+	 || ( container_physical_number >= block_scanner->number_of_containers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid container physical number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->number_of_blocks >= block_scanner->number_of_allocated_blocks )
+	{
+		if( block_scanner->number_of_allocated_blocks == 0 )
+		{
+			number_of_allocated_blocks = 256;
+		}
+		else
+		{
+			if( block_scanner->number_of_allocated_blocks > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of blocks value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_blocks = block_scanner->number_of_allocated_blocks * 2;
+		}
+		if( (size_t) number_of_allocated_blocks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_block_scanner_block_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated blocks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		blocks = (libfsclfs_block_scanner_block_t *) memory_reallocate(
+		                                              block_scanner->blocks,
+		                                              sizeof( libfsclfs_block_scanner_block_t ) * number_of_allocated_blocks );
+
+		if( blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize blocks.",
+			 function );
+
+			return( -1 );
+		}
+		block_scanner->blocks                     = blocks;
+		block_scanner->number_of_allocated_blocks = number_of_allocated_blocks;
+	}
+	blocks = &( block_scanner->blocks[ block_scanner->number_of_blocks ] );
+
+	blocks->block_scanner             = block_scanner;
+	blocks->container_index           = container_index;
+	blocks->container_physical_number = container_physical_number;
+	blocks->stream_number             = stream_number;
+	blocks->offset                    = block_offset;
+	blocks->size                      = block_size;
+	blocks->lsn                       = block_lsn;
+	blocks->result                    = 0;
+
+	block_scanner->number_of_blocks += 1;
+
+	return( 1 );
+}
+
+/* Creates the workers
+ * Every worker has its own block and record header table that are reused for every block it reads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_create_workers(
+     libfsclfs_block_scanner_t *block_scanner,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_scanner_worker_t *worker = NULL;
+	static char *function                    = "libfsclfs_block_scanner_create_workers";
+	int worker_index                         = 0;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block scanner - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( (size_t) number_of_workers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_block_scanner_worker_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_scanner->workers = (libfsclfs_block_scanner_worker_t *) memory_allocate(
+	                                                               sizeof( libfsclfs_block_scanner_worker_t ) * number_of_workers );
+
+	if( block_scanner->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     block_scanner->workers,
+	     0,
+	     sizeof( libfsclfs_block_scanner_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 block_scanner->workers );
+
+		block_scanner->workers = NULL;
+
+		return( -1 );
+	}
+	block_scanner->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( block_scanner->workers[ worker_index ] );
+
+		if( libfsclfs_block_initialize(
+		     &( worker->block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_record_header_table_initialize(
+		     &( worker->record_header_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record header table of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( ( number_of_workers > 1 )
+		 && ( block_scanner->number_of_containers > 0 ) )
+		{
+			if( (size_t) block_scanner->number_of_containers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of containers value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			worker->file_io_handles = (libbfio_handle_t **) memory_allocate(
+			                                                 sizeof( libbfio_handle_t * ) * block_scanner->number_of_containers );
+
+			if( worker->file_io_handles == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create file IO handles of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     worker->file_io_handles,
+			     0,
+			     sizeof( libbfio_handle_t * ) * block_scanner->number_of_containers ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear file IO handles of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	libfsclfs_block_scanner_free_workers(
+	 block_scanner,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the workers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_free_workers(
+     libfsclfs_block_scanner_t *block_scanner,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_scanner_worker_t *worker = NULL;
+	static char *function                    = "libfsclfs_block_scanner_free_workers";
+	int container_index                      = 0;
+	int result                               = 1;
+	int worker_index                         = 0;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < block_scanner->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( block_scanner->workers[ worker_index ] );
+
+			if( worker->file_io_handles != NULL )
+			{
+				for( container_index = 0;
+				     container_index < block_scanner->number_of_containers;
+				     container_index++ )
+				{
+					if( worker->file_io_handles[ container_index ] == NULL )
+					{
+						continue;
+					}
+					if( ( block_scanner->io_handle != NULL )
+					 && ( block_scanner->io_handle->statistics != NULL ) )
+					{
+						if( libfsclfs_statistics_remove_file_io_handle_clone(
+						     block_scanner->io_handle->statistics,
+						     worker->file_io_handles[ container_index ],
+						     error ) == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+							 "%s: unable to remove file IO handle: %d of worker: %d from statistics.",
+							 function,
+							 container_index,
+							 worker_index );
+
+							result = -1;
+						}
+					}
+					if( libbfio_handle_close(
+					     worker->file_io_handles[ container_index ],
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close file IO handle: %d of worker: %d.",
+						 function,
+						 container_index,
+						 worker_index );
+
+						result = -1;
+					}
+					if( libbfio_handle_free(
+					     &( worker->file_io_handles[ container_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free file IO handle: %d of worker: %d.",
+						 function,
+						 container_index,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+				memory_free(
+				 worker->file_io_handles );
+			}
+			if( worker->record_header_table != NULL )
+			{
+				if( libfsclfs_record_header_table_free(
+				     &( worker->record_header_table ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record header table of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( worker->block != NULL )
+			{
+				if( libfsclfs_block_free(
+				     &( worker->block ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free block of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 block_scanner->workers );
+
+		block_scanner->workers = NULL;
+	}
+	block_scanner->number_of_workers = 0;
+
+	return( result );
+}
+
+/* Retrieves the file IO handle of a specific container for a specific worker
+ * When the worker has its own file IO handles the file IO handle is cloned from
+ * the container file IO handle in the pool on first use, otherwise the file IO
+ * handle is retrieved from the pool
+ * Only the worker itself should retrieve its file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_get_worker_file_io_handle(
+     libfsclfs_block_scanner_t *block_scanner,
+     int worker_index,
+     int container_physical_number,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *pool_file_io_handle    = NULL;
+	libbfio_handle_t *worker_file_io_handle  = NULL;
+	libfsclfs_block_scanner_worker_t *worker = NULL;
+	static char *function                    = "libfsclfs_block_scanner_get_worker_file_io_handle";
+	int result                               = 0;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block scanner - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= block_scanner->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( container_physical_number < 0 )
+	 || ( container_physical_number >= block_scanner->number_of_containers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid container physical number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( block_scanner->workers[ worker_index ] );
+
+	if( worker->file_io_handles == NULL )
+	{
+		if( libbfio_pool_get_handle(
+		     block_scanner->file_io_pool,
+		     container_physical_number,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container file IO handle: %d from pool.",
+			 function,
+			 container_physical_number );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( worker->file_io_handles[ container_physical_number ] == NULL )
+	{
+		/* The file IO pool is shared by all the workers
+		 */
+		if( libcthreads_mutex_grab(
+		     block_scanner->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO pool mutex.",
+			 function );
+
+			return( -1 );
+		}
+		result = libbfio_pool_get_handle(
+		          block_scanner->file_io_pool,
+		          container_physical_number,
+		          &pool_file_io_handle,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libbfio_handle_clone(
+			          &worker_file_io_handle,
+			          pool_file_io_handle,
+			          error );
+		}
+		if( libcthreads_mutex_release(
+		     block_scanner->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO pool mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle: %d of worker: %d.",
+			 function,
+			 container_physical_number,
+			 worker_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          worker_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d of worker: %d is open.",
+			 function,
+			 container_physical_number,
+			 worker_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     worker_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d of worker: %d.",
+				 function,
+				 container_physical_number,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( ( block_scanner->io_handle != NULL )
+		 && ( block_scanner->io_handle->statistics != NULL ) )
+		{
+			if( libfsclfs_statistics_add_file_io_handle_clone(
+			     block_scanner->io_handle->statistics,
+			     pool_file_io_handle,
+			     worker_file_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add file IO handle: %d of worker: %d to statistics.",
+				 function,
+				 container_physical_number,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		worker->file_io_handles[ container_physical_number ] = worker_file_io_handle;
+	}
+	*file_io_handle = worker->file_io_handles[ container_physical_number ];
+
+	return( 1 );
+
+on_error:
+	if( worker_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &worker_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported worker file IO handles.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Determines the used size of a block
+ * The used size consists of the block header and the records including
+ * the alignment padding between them
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_get_used_size(
+     libfsclfs_block_t *block,
+     libfsclfs_record_header_table_t *record_header_table,
+     uint32_t *used_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_block_scanner_get_used_size";
+	uint64_t safe_used_size                                                = 0;
+	int record_index                                                       = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_used_size = (uint64_t) block->record_data_offset;
+
+	for( record_index = 0;
+	     record_index < internal_record_header_table->number_of_records;
+	     record_index++ )
+	{
+		/* The records are 8-byte aligned
+		 */
+		if( ( record_index > 0 )
+		 && ( ( safe_used_size % 8 ) != 0 ) )
+		{
+			safe_used_size += 8 - ( safe_used_size % 8 );
+		}
+		safe_used_size += internal_record_header_table->sizes[ record_index ];
+	}
+	if( safe_used_size > (uint64_t) block->size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid used size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*used_size = (uint32_t) safe_used_size;
+
+	return( 1 );
+}
+
+/* Scans a block
+ * Only the block header and the record headers are decoded
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_scan_block(
+     libfsclfs_block_scanner_t *block_scanner,
+     libfsclfs_block_scanner_block_t *scanner_block,
+     int worker_index,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libfsclfs_block_scanner_worker_t *worker = NULL;
+	uint8_t *record_data                     = NULL;
+	static char *function                    = "libfsclfs_block_scanner_scan_block";
+	size_t record_data_size                  = 0;
+	uint32_t used_size                       = 0;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block scanner - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block scanner - missing callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= block_scanner->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( block_scanner->workers[ worker_index ] );
+
+	scanner_block->result = -1;
+
+	if( libfsclfs_block_scanner_get_worker_file_io_handle(
+	     block_scanner,
+	     worker_index,
+	     scanner_block->container_physical_number,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle of worker: %d.",
+		 function,
+		 worker_index );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_read(
+	     worker->block,
+	     block_scanner->io_handle,
+	     file_io_handle,
+	     scanner_block->offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 scanner_block->offset );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_get_record_data(
+	     worker->block,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_header_table_read_data(
+	     (libfsclfs_internal_record_header_table_t *) worker->record_header_table,
+	     scanner_block->lsn & ~( (uint64_t) 0x01ff ),
+	     record_data,
+	     record_data_size,
+	     (size_t) worker->block->record_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record header table of block at offset: %" PRIu32 ".",
+		 function,
+		 scanner_block->offset );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_scanner_get_used_size(
+	     worker->block,
+	     worker->record_header_table,
+	     &used_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine used size of block at offset: %" PRIu32 ".",
+		 function,
+		 scanner_block->offset );
+
+		return( -1 );
+	}
+	if( block_scanner->callback(
+	     worker_index,
+	     scanner_block->container_index,
+	     (int) scanner_block->stream_number,
+	     scanner_block->offset,
+	     worker->block->size,
+	     used_size,
+	     worker->record_header_table,
+	     block_scanner->callback_data ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback failed for block at offset: %" PRIu32 ".",
+		 function,
+		 scanner_block->offset );
+
+		return( -1 );
+	}
+	scanner_block->result = 1;
+
+	return( 1 );
+}
+
+/* Scans a block as a task of the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_scan_block_task_callback(
+     libfsclfs_block_scanner_block_t *scanner_block,
+     int worker_index,
+     void *callback_data LIBFSCLFS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_scanner_t *block_scanner = NULL;
+	static char *function                    = "libfsclfs_block_scanner_scan_block_task_callback";
+
+	LIBFSCLFS_UNREFERENCED_PARAMETER( callback_data )
+
+	if( scanner_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner block.",
+		 function );
+
+		goto on_error;
+	}
+	block_scanner = scanner_block->block_scanner;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner block - missing block scanner.",
+		 function );
+
+		goto on_error;
+	}
+	/* Skip the remaining blocks if abort was signalled
+	 */
+	if( block_scanner->io_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( libfsclfs_block_scanner_scan_block(
+	     block_scanner,
+	     scanner_block,
+	     worker_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scanner_block != NULL )
+	{
+		scanner_block->result = -1;
+	}
+	return( -1 );
+}
+
+/* Scans all the blocks
+ * The blocks are scanned as tasks of a work-stealing scheduler. Every worker
+ * starts with a contiguous range of blocks, in the order they were appended,
+ * and steals blocks from the other workers when it runs out
+ * If multi-threading support is available and number_of_threads is larger than 1
+ * every worker runs on its own thread, otherwise the blocks are scanned sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_scanner_scan(
+     libfsclfs_block_scanner_t *block_scanner,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_t *scheduler = NULL;
+	static char *function            = "libfsclfs_block_scanner_scan";
+	int block_index                  = 0;
+	int number_of_tasks_per_worker   = 0;
+
+	if( block_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_scanner->number_of_blocks == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > block_scanner->number_of_blocks )
+	{
+		number_of_threads = block_scanner->number_of_blocks;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	number_of_tasks_per_worker = block_scanner->number_of_blocks / number_of_threads;
+
+	if( ( block_scanner->number_of_blocks % number_of_threads ) != 0 )
+	{
+		number_of_tasks_per_worker += 1;
+	}
+	if( libfsclfs_block_scanner_create_workers(
+	     block_scanner,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_scheduler_initialize(
+	     &scheduler,
+	     number_of_threads,
+	     number_of_tasks_per_worker,
+	     (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &libfsclfs_block_scanner_scan_block_task_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < block_scanner->number_of_blocks;
+	     block_index++ )
+	{
+		block_scanner->blocks[ block_index ].result = 0;
+
+		if( libfsclfs_scheduler_push_task(
+		     scheduler,
+		     block_index / number_of_tasks_per_worker,
+		     (intptr_t *) &( block_scanner->blocks[ block_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push block: %d onto scheduler.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsclfs_scheduler_run(
+	     scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_scheduler_free(
+	     &scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_scanner_free_workers(
+	     block_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( block_scanner->io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < block_scanner->number_of_blocks;
+	     block_index++ )
+	{
+		if( block_scanner->blocks[ block_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan block at offset: %" PRIu32 " of container: %d.",
+			 function,
+			 block_scanner->blocks[ block_index ].offset,
+			 block_scanner->blocks[ block_index ].container_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	libfsclfs_block_scanner_free_workers(
+	 block_scanner,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -0,0 +1,236 @@
+/*
+ * Block scanner functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSCLFS_BLOCK_SCANNER_H )
+#define _LIBFSCLFS_BLOCK_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_block.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_block_scanner libfsclfs_block_scanner_t;
+
+typedef struct libfsclfs_block_scanner_block libfsclfs_block_scanner_block_t;
+
+typedef struct libfsclfs_block_scanner_worker libfsclfs_block_scanner_worker_t;
+
+struct libfsclfs_block_scanner_block
+{
+	/* The block scanner
+	 */
+	libfsclfs_block_scanner_t *block_scanner;
+
+	/* The container index
+	 */
+	int container_index;
+
+	/* The container physical number
+	 * used as the index of the container in the file IO pool
+	 */
+	int container_physical_number;
+
+	/* The stream number
+	 */
+	uint8_t stream_number;
+
+	/* The block offset
+	 */
+	uint32_t offset;
+
+	/* The block size
+	 */
+	uint32_t size;
+
+	/* The virtual LSN of the block
+	 */
+	uint64_t lsn;
+
+	/* The scan result
+	 * 1 if the block was scanned, 0 if not or -1 on error
+	 */
+	int result;
+};
+
+struct libfsclfs_block_scanner_worker
+{
+	/* The block
+	 * the block data is reused by subsequent reads of the worker
+	 */
+	libfsclfs_block_t *block;
+
+	/* The record header table
+	 */
+	libfsclfs_record_header_table_t *record_header_table;
+
+	/* The container file IO handles
+	 * contains a clone of the file IO handle of every container when multi-threading
+	 * is used, which is created when the worker first reads a block of the container
+	 */
+	libbfio_handle_t **file_io_handles;
+};
+
+struct libfsclfs_block_scanner
+{
+	/* The IO handle
+	 */
+	libfsclfs_io_handle_t *io_handle;
+
+	/* The container file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The number of containers in the file IO pool
+	 */
+	int number_of_containers;
+
+	/* The blocks
+	 */
+	libfsclfs_block_scanner_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	int number_of_allocated_blocks;
+
+	/* The workers
+	 */
+	libfsclfs_block_scanner_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The callback function
+	 * called with the worker index, container index, stream number, block offset,
+	 * block size, used size, record header table and callback data
+	 * returns 1 if successful or -1 on error
+	 */
+	int (*callback)(
+	       int worker_index,
+	       int container_index,
+	       int stream_number,
+	       uint32_t block_offset,
+	       uint32_t block_size,
+	       uint32_t used_size,
+	       libfsclfs_record_header_table_t *record_header_table,
+	       void *callback_data );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the container file IO pool
+	 */
+	libcthreads_mutex_t *file_io_pool_mutex;
+#endif
+};
+
+int libfsclfs_block_scanner_initialize(
+     libfsclfs_block_scanner_t **block_scanner,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_containers,
+     int (*callback)(
+            int worker_index,
+            int container_index,
+            int stream_number,
+            uint32_t block_offset,
+            uint32_t block_size,
+            uint32_t used_size,
+            libfsclfs_record_header_table_t *record_header_table,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_free(
+     libfsclfs_block_scanner_t **block_scanner,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_append_block(
+     libfsclfs_block_scanner_t *block_scanner,
+     int container_index,
+     int container_physical_number,
+     uint8_t stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint64_t block_lsn,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_create_workers(
+     libfsclfs_block_scanner_t *block_scanner,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_free_workers(
+     libfsclfs_block_scanner_t *block_scanner,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_get_worker_file_io_handle(
+     libfsclfs_block_scanner_t *block_scanner,
+     int worker_index,
+     int container_physical_number,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_get_used_size(
+     libfsclfs_block_t *block,
+     libfsclfs_record_header_table_t *record_header_table,
+     uint32_t *used_size,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_scan_block(
+     libfsclfs_block_scanner_t *block_scanner,
+     libfsclfs_block_scanner_block_t *scanner_block,
+     int worker_index,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_scan_block_task_callback(
+     libfsclfs_block_scanner_block_t *scanner_block,
+     int worker_index,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsclfs_block_scanner_scan(
+     libfsclfs_block_scanner_t *block_scanner,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_BLOCK_SCANNER_H ) */
+
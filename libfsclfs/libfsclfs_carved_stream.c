@@ -0,0 +1,557 @@
+/*
+ * Carved stream functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsclfs_carved_stream.h"
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_value.h"
+
+/* Creates a carved stream
+ * Make sure the value carved_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carved_stream_initialize(
+     libfsclfs_carved_stream_t **carved_stream,
+     uint8_t stream_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_carved_stream_initialize";
+
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carved_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carved stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*carved_stream = memory_allocate_structure(
+	                  libfsclfs_carved_stream_t );
+
+	if( *carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carved stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *carved_stream,
+	     0,
+	     sizeof( libfsclfs_carved_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carved stream.",
+		 function );
+
+		memory_free(
+		 *carved_stream );
+
+		*carved_stream = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *carved_stream )->record_values_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values array.",
+		 function );
+
+		goto on_error;
+	}
+	( *carved_stream )->stream_number = stream_number;
+	( *carved_stream )->is_sorted     = 1;
+
+	return( 1 );
+
+on_error:
+	if( *carved_stream != NULL )
+	{
+		memory_free(
+		 *carved_stream );
+
+		*carved_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a carved stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carved_stream_free(
+     libfsclfs_carved_stream_t **carved_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_carved_stream_free";
+	int result            = 1;
+
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carved_stream != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *carved_stream )->record_values_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_record_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *carved_stream );
+
+		*carved_stream = NULL;
+	}
+	return( result );
+}
+
+/* Appends a record value to the carved stream
+ * The carved stream takes over management of the record value
+ * and updates its virtual LSN range
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carved_stream_append_record_value(
+     libfsclfs_carved_stream_t *carved_stream,
+     libfsclfs_record_value_t *record_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_carved_stream_append_record_value";
+	int entry_index       = 0;
+	int number_of_entries = 0;
+
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     carved_stream->record_values_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     carved_stream->record_values_array,
+	     &entry_index,
+	     (intptr_t *) record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record value to array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		carved_stream->first_virtual_lsn = record_value->virtual_lsn;
+		carved_stream->last_virtual_lsn  = record_value->virtual_lsn;
+	}
+	else
+	{
+		/* The blocks of a container are mostly carved in virtual LSN order
+		 * so the record values only need to be sorted when they are not
+		 */
+		if( record_value->virtual_lsn <= carved_stream->last_virtual_lsn )
+		{
+			carved_stream->is_sorted = 0;
+		}
+		if( record_value->virtual_lsn < carved_stream->first_virtual_lsn )
+		{
+			carved_stream->first_virtual_lsn = record_value->virtual_lsn;
+		}
+		if( record_value->virtual_lsn > carved_stream->last_virtual_lsn )
+		{
+			carved_stream->last_virtual_lsn = record_value->virtual_lsn;
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two record values by their virtual LSN
+ * Returns a negative value, 0 or a positive value, like qsort expects
+ */
+static int libfsclfs_carved_stream_compare_record_values(
+            const void *first_value,
+            const void *second_value )
+{
+	const libfsclfs_record_value_t *first_record_value  = NULL;
+	const libfsclfs_record_value_t *second_record_value = NULL;
+
+	first_record_value  = *( (libfsclfs_record_value_t * const *) first_value );
+	second_record_value = *( (libfsclfs_record_value_t * const *) second_value );
+
+	if( first_record_value->virtual_lsn < second_record_value->virtual_lsn )
+	{
+		return( -1 );
+	}
+	if( first_record_value->virtual_lsn > second_record_value->virtual_lsn )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the record values by virtual LSN
+ * Record values with the same virtual LSN, such as the records of a block
+ * that was carved more than once, are only retained once
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carved_stream_sort_record_values(
+     libfsclfs_carved_stream_t *carved_stream,
+     libcerror_error_t **error )
+{
+	libfsclfs_record_value_t **record_values = NULL;
+	libfsclfs_record_value_t *record_value   = NULL;
+	static char *function                    = "libfsclfs_carved_stream_sort_record_values";
+	int number_of_record_values              = 0;
+	int number_of_unique_record_values       = 0;
+	int record_value_index                   = 0;
+
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( carved_stream->is_sorted != 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     carved_stream->record_values_array,
+	     &number_of_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of record values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_record_values > 1 )
+	{
+		if( (size_t) number_of_record_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_record_value_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of record values value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		record_values = (libfsclfs_record_value_t **) memory_allocate(
+		                 sizeof( libfsclfs_record_value_t * ) * number_of_record_values );
+
+		if( record_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_value_index = 0;
+		     record_value_index < number_of_record_values;
+		     record_value_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     carved_stream->record_values_array,
+			     record_value_index,
+			     (intptr_t **) &( record_values[ record_value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record value: %d.",
+				 function,
+				 record_value_index );
+
+				goto on_error;
+			}
+			if( record_values[ record_value_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing record value: %d.",
+				 function,
+				 record_value_index );
+
+				goto on_error;
+			}
+		}
+		qsort(
+		 record_values,
+		 (size_t) number_of_record_values,
+		 sizeof( libfsclfs_record_value_t * ),
+		 &libfsclfs_carved_stream_compare_record_values );
+
+		/* Move the duplicate record values to the end so that they are freed when the array is resized
+		 */
+		for( record_value_index = 0;
+		     record_value_index < number_of_record_values;
+		     record_value_index++ )
+		{
+			record_value = record_values[ record_value_index ];
+
+			if( ( number_of_unique_record_values > 0 )
+			 && ( record_value->virtual_lsn == record_values[ number_of_unique_record_values - 1 ]->virtual_lsn ) )
+			{
+				continue;
+			}
+			record_values[ record_value_index ]             = record_values[ number_of_unique_record_values ];
+			record_values[ number_of_unique_record_values ] = record_value;
+
+			number_of_unique_record_values++;
+		}
+		for( record_value_index = 0;
+		     record_value_index < number_of_record_values;
+		     record_value_index++ )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     carved_stream->record_values_array,
+			     record_value_index,
+			     (intptr_t *) record_values[ record_value_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set record value: %d.",
+				 function,
+				 record_value_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 record_values );
+
+		record_values = NULL;
+
+		if( number_of_unique_record_values < number_of_record_values )
+		{
+			if( libcdata_array_resize(
+			     carved_stream->record_values_array,
+			     number_of_unique_record_values,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_record_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize record values array.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	carved_stream->is_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		memory_free(
+		 record_values );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of record values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carved_stream_get_number_of_record_values(
+     libfsclfs_carved_stream_t *carved_stream,
+     int *number_of_record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_carved_stream_get_number_of_record_values";
+
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     carved_stream->record_values_array,
+	     number_of_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of record values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record value
+ * The record values are ordered by virtual LSN once sorted
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carved_stream_get_record_value_by_index(
+     libfsclfs_carved_stream_t *carved_stream,
+     int record_value_index,
+     libfsclfs_record_value_t **record_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_carved_stream_get_record_value_by_index";
+
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     carved_stream->record_values_array,
+	     record_value_index,
+	     (intptr_t **) record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value: %d.",
+		 function,
+		 record_value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,96 @@
+/*
+ * Carved stream functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_CARVED_STREAM_H )
+#define _LIBFSCLFS_CARVED_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_carved_stream libfsclfs_carved_stream_t;
+
+struct libfsclfs_carved_stream
+{
+	/* The stream number
+	 * as stored in the block headers of the carved blocks
+	 */
+	uint8_t stream_number;
+
+	/* The first virtual LSN
+	 */
+	uint64_t first_virtual_lsn;
+
+	/* The last virtual LSN
+	 */
+	uint64_t last_virtual_lsn;
+
+	/* The record values array
+	 */
+	libcdata_array_t *record_values_array;
+
+	/* Value to indicate the record values are sorted by virtual LSN
+	 */
+	uint8_t is_sorted;
+};
+
+int libfsclfs_carved_stream_initialize(
+     libfsclfs_carved_stream_t **carved_stream,
+     uint8_t stream_number,
+     libcerror_error_t **error );
+
+int libfsclfs_carved_stream_free(
+     libfsclfs_carved_stream_t **carved_stream,
+     libcerror_error_t **error );
+
+int libfsclfs_carved_stream_append_record_value(
+     libfsclfs_carved_stream_t *carved_stream,
+     libfsclfs_record_value_t *record_value,
+     libcerror_error_t **error );
+
+int libfsclfs_carved_stream_sort_record_values(
+     libfsclfs_carved_stream_t *carved_stream,
+     libcerror_error_t **error );
+
+int libfsclfs_carved_stream_get_number_of_record_values(
+     libfsclfs_carved_stream_t *carved_stream,
+     int *number_of_record_values,
+     libcerror_error_t **error );
+
+int libfsclfs_carved_stream_get_record_value_by_index(
+     libfsclfs_carved_stream_t *carved_stream,
+     int record_value_index,
+     libfsclfs_record_value_t **record_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_CARVED_STREAM_H ) */
+
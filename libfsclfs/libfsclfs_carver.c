@@ -0,0 +1,1798 @@
+/*
+ * Carver functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libfsclfs_block.h"
+#include "libfsclfs_carved_stream.h"
+#include "libfsclfs_carver.h"
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record.h"
+#include "libfsclfs_record_value.h"
+#include "libfsclfs_statistics.h"
+#include "libfsclfs_types.h"
+
+#include "fsclfs_block.h"
+#include "fsclfs_record.h"
+
+/* Creates a carver
+ * Make sure the value carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_initialize(
+     libfsclfs_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_initialize";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = memory_allocate_structure(
+	                   libfsclfs_internal_carver_t );
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver,
+	     0,
+	     sizeof( libfsclfs_internal_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carver.",
+		 function );
+
+		memory_free(
+		 internal_carver );
+
+		return( -1 );
+	}
+	if( libfsclfs_io_handle_initialize(
+	     &( internal_carver->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_carver->carved_streams_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create carved streams array.",
+		 function );
+
+		goto on_error;
+	}
+	*carver = (libfsclfs_carver_t *) internal_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_carver != NULL )
+	{
+		if( internal_carver->io_handle != NULL )
+		{
+			libfsclfs_io_handle_free(
+			 &( internal_carver->io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 internal_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a carver
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_free(
+     libfsclfs_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_free";
+	int result                                   = 1;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		internal_carver = (libfsclfs_internal_carver_t *) *carver;
+		*carver         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_carver->carved_streams_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_carved_stream_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free carved streams array.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsclfs_io_handle_free(
+		     &( internal_carver->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_carver );
+	}
+	return( result );
+}
+
+/* Signals the carver to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_signal_abort(
+     libfsclfs_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_signal_abort";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Carves blocks and records from a file
+ * The file can be a container or a storage media image
+ * A range size of 0 represents the remainder of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_carve_file(
+     libfsclfs_carver_t *carver,
+     const char *filename,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfsclfs_carver_carve_file";
+	size_t filename_length           = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_carver_carve_file_io_handle(
+	     carver,
+	     file_io_handle,
+	     range_offset,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Carves blocks and records from a file
+ * The file can be a container or a storage media image
+ * A range size of 0 represents the remainder of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_carve_file_wide(
+     libfsclfs_carver_t *carver,
+     const wchar_t *filename,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfsclfs_carver_carve_file_wide";
+	size_t filename_length           = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_carver_carve_file_io_handle(
+	     carver,
+	     file_io_handle,
+	     range_offset,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Carves blocks and records from a file IO handle
+ * The data is read sequentially in large buffers that are scanned for block signatures,
+ * so that no base log or owner page is needed to locate the blocks. The carved records
+ * are grouped by the stream number in their block header and sorted by virtual LSN.
+ * A range size of 0 represents the remainder of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_carve_file_io_handle(
+     libfsclfs_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_carved_stream_t *carved_stream     = NULL;
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	uint32_t *candidate_offsets                  = NULL;
+	uint8_t *block_data                          = NULL;
+	uint8_t *buffer                              = NULL;
+	static char *function                        = "libfsclfs_carver_carve_file_io_handle";
+	size64_t file_size                           = 0;
+	size_t block_data_size                       = 0;
+	size_t buffer_size                           = 0;
+	ssize_t read_count                           = 0;
+	off64_t block_offset                         = 0;
+	off64_t next_block_offset                    = 0;
+	off64_t range_end_offset                     = 0;
+	off64_t read_offset                          = 0;
+	uint32_t block_size                          = 0;
+	uint32_t read_size                           = 0;
+	uint16_t number_of_sectors                   = 0;
+	uint8_t file_io_handle_opened_in_library     = 0;
+	int candidate_index                          = 0;
+	int carved_stream_index                      = 0;
+	int file_io_handle_is_open                   = 0;
+	int maximum_number_of_candidates             = 0;
+	int number_of_candidates                     = 0;
+	int number_of_carved_streams                 = 0;
+	int result                                   = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_carver->io_handle->bytes_per_sector == 0 )
+	 || ( internal_carver->io_handle->bytes_per_sector > LIBFSCLFS_CARVER_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid carver - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->abort = 0;
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size64_t) range_offset > file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( range_size == 0 )
+	 || ( range_size > ( file_size - (size64_t) range_offset ) ) )
+	{
+		range_size = file_size - (size64_t) range_offset;
+	}
+	range_end_offset = range_offset + (off64_t) range_size;
+
+	/* Keep the buffer a multiple of the sector size so that every buffer
+	 * starts at a sector boundary relative to the range offset
+	 */
+	buffer_size = LIBFSCLFS_CARVER_READ_BUFFER_SIZE
+	            - ( LIBFSCLFS_CARVER_READ_BUFFER_SIZE % internal_carver->io_handle->bytes_per_sector );
+
+	maximum_number_of_candidates = (int) ( buffer_size / internal_carver->io_handle->bytes_per_sector );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	candidate_offsets = (uint32_t *) memory_allocate(
+	                                  sizeof( uint32_t ) * maximum_number_of_candidates );
+
+	if( candidate_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create candidate offsets.",
+		 function );
+
+		goto on_error;
+	}
+	read_offset       = range_offset;
+	next_block_offset = range_offset;
+
+	while( read_offset < range_end_offset )
+	{
+		if( internal_carver->io_handle->abort != 0 )
+		{
+			break;
+		}
+		read_size = (uint32_t) buffer_size;
+
+		if( (off64_t) read_size > ( range_end_offset - read_offset ) )
+		{
+			read_size = (uint32_t) ( range_end_offset - read_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              (size_t) read_size,
+		              read_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		if( internal_carver->io_handle->statistics != NULL )
+		{
+			if( libfsclfs_statistics_add_read(
+			     internal_carver->io_handle->statistics,
+			     file_io_handle,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to statistics.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsclfs_block_scan_signatures(
+		     internal_carver->io_handle,
+		     buffer,
+		     (size_t) read_size,
+		     candidate_offsets,
+		     maximum_number_of_candidates,
+		     &number_of_candidates,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan data at offset: %" PRIi64 " (0x%08" PRIx64 ") for block signatures.",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			goto on_error;
+		}
+		for( candidate_index = 0;
+		     candidate_index < number_of_candidates;
+		     candidate_index++ )
+		{
+			block_offset = read_offset + candidate_offsets[ candidate_index ];
+
+			/* Skip the candidates inside a block that was already carved
+			 */
+			if( block_offset < next_block_offset )
+			{
+				continue;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (fsclfs_block_header_t *) &( buffer[ candidate_offsets[ candidate_index ] ] ) )->number_of_sectors,
+			 number_of_sectors );
+
+			if( internal_carver->io_handle->bytes_per_sector_shift != 0 )
+			{
+				block_size = (uint32_t) number_of_sectors << internal_carver->io_handle->bytes_per_sector_shift;
+			}
+			else
+			{
+				block_size = (uint32_t) number_of_sectors * internal_carver->io_handle->bytes_per_sector;
+			}
+			if( (off64_t) block_size > ( range_end_offset - block_offset ) )
+			{
+				continue;
+			}
+			if( ( candidate_offsets[ candidate_index ] + block_size ) <= read_size )
+			{
+				result = libfsclfs_carver_read_block(
+				          internal_carver,
+				          &( buffer[ candidate_offsets[ candidate_index ] ] ),
+				          (size_t) block_size,
+				          error );
+			}
+			else
+			{
+				/* The block continues beyond the end of the buffer
+				 */
+				if( (size_t) block_size > block_data_size )
+				{
+					if( block_data != NULL )
+					{
+						memory_free(
+						 block_data );
+					}
+					block_data_size = (size_t) block_size;
+
+					block_data = (uint8_t *) memory_allocate(
+					                          sizeof( uint8_t ) * block_data_size );
+
+					if( block_data == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create block data.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              block_data,
+				              (size_t) block_size,
+				              block_offset,
+				              error );
+
+				if( read_count != (ssize_t) block_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 block_offset,
+					 block_offset );
+
+					goto on_error;
+				}
+				result = libfsclfs_carver_read_block(
+				          internal_carver,
+				          block_data,
+				          (size_t) block_size,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				next_block_offset = block_offset + block_size;
+			}
+		}
+		read_offset += read_size;
+	}
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+
+		block_data = NULL;
+	}
+	memory_free(
+	 candidate_offsets );
+
+	candidate_offsets = NULL;
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_carver->carved_streams_array,
+	     &number_of_carved_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved streams.",
+		 function );
+
+		goto on_error;
+	}
+	for( carved_stream_index = 0;
+	     carved_stream_index < number_of_carved_streams;
+	     carved_stream_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_carver->carved_streams_array,
+		     carved_stream_index,
+		     (intptr_t **) &carved_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve carved stream: %d.",
+			 function,
+			 carved_stream_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_carved_stream_sort_record_values(
+		     carved_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort record values of carved stream: %d.",
+			 function,
+			 carved_stream_index );
+
+			goto on_error;
+		}
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	if( candidate_offsets != NULL )
+	{
+		memory_free(
+		 candidate_offsets );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a carved block and its records
+ * Data that does not contain a valid block is skipped
+ * Returns 1 if successful, 0 if the data does not contain a valid block or -1 on error
+ */
+int libfsclfs_carver_read_block(
+     libfsclfs_internal_carver_t *internal_carver,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_t *block                 = NULL;
+	libfsclfs_carved_stream_t *carved_stream = NULL;
+	libfsclfs_record_value_t *record_value   = NULL;
+	uint8_t *record_data                     = NULL;
+	static char *function                    = "libfsclfs_carver_read_block";
+	size_t alignment_padding_size            = 0;
+	size_t record_data_offset                = 0;
+	size_t record_data_size                  = 0;
+	uint32_t record_size                     = 0;
+	uint32_t record_type                     = 0;
+	int result                               = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsclfs_block_probe_data(
+	          block,
+	          internal_carver->io_handle,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( internal_carver->io_handle->statistics != NULL )
+		{
+			libfsclfs_statistics_counter_add(
+			 internal_carver->io_handle->statistics->number_of_failed_block_probes,
+			 1 );
+		}
+		if( libfsclfs_block_free(
+		     &block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	internal_carver->number_of_blocks += 1;
+
+	result = libfsclfs_block_get_record_data(
+	          block,
+	          &record_data,
+	          &record_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( record_data != NULL ) )
+	{
+		if( libfsclfs_carver_get_carved_stream_by_stream_number(
+		     internal_carver,
+		     block->stream_number,
+		     &carved_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve carved stream: %" PRIu8 ".",
+			 function,
+			 block->stream_number );
+
+			goto on_error;
+		}
+		record_data_offset = block->record_data_offset;
+
+		/* A carved block can be partially overwritten, stop at the first record
+		 * that is not valid and retain the records that precede it
+		 */
+		while( record_data_size >= sizeof( fsclfs_container_record_header_t ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (fsclfs_container_record_header_t *) record_data )->size,
+			 record_size );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (fsclfs_container_record_header_t *) record_data )->record_type,
+			 record_type );
+
+			if( ( record_size < sizeof( fsclfs_container_record_header_t ) )
+			 || ( (size_t) record_size > record_data_size ) )
+			{
+				break;
+			}
+			if( libfsclfs_record_value_initialize(
+			     &record_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsclfs_record_value_read_data(
+			     record_value,
+			     record_data,
+			     (size_t) record_size,
+			     error ) != 1 )
+			{
+				libcerror_error_free(
+				 error );
+
+				libfsclfs_record_value_free(
+				 &record_value,
+				 NULL );
+
+				break;
+			}
+			if( libfsclfs_carved_stream_append_record_value(
+			     carved_stream,
+			     record_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record value to carved stream.",
+				 function );
+
+				goto on_error;
+			}
+			record_value = NULL;
+
+			if( internal_carver->io_handle->statistics != NULL )
+			{
+				libfsclfs_statistics_counter_add(
+				 internal_carver->io_handle->statistics->number_of_records_read,
+				 1 );
+			}
+			if( ( record_type & RECORD_TYPE_FLAG_IS_LAST ) != 0 )
+			{
+				break;
+			}
+			record_data        += record_size;
+			record_data_size   -= record_size;
+			record_data_offset += record_size;
+
+			if( ( record_data_offset % 8 ) != 0 )
+			{
+				alignment_padding_size = 8 - ( record_data_offset % 8 );
+
+				if( alignment_padding_size > record_data_size )
+				{
+					break;
+				}
+				record_data        += alignment_padding_size;
+				record_data_size   -= alignment_padding_size;
+				record_data_offset += alignment_padding_size;
+			}
+		}
+	}
+	if( libfsclfs_block_free(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the carved stream of a specific stream number
+ * The carved stream is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_carved_stream_by_stream_number(
+     libfsclfs_internal_carver_t *internal_carver,
+     uint8_t stream_number,
+     libfsclfs_carved_stream_t **carved_stream,
+     libcerror_error_t **error )
+{
+	libfsclfs_carved_stream_t *safe_carved_stream = NULL;
+	static char *function                         = "libfsclfs_carver_get_carved_stream_by_stream_number";
+	int carved_stream_index                       = 0;
+	int entry_index                               = 0;
+	int number_of_carved_streams                  = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carved stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_carver->carved_streams_array,
+	     &number_of_carved_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved streams.",
+		 function );
+
+		goto on_error;
+	}
+	for( carved_stream_index = 0;
+	     carved_stream_index < number_of_carved_streams;
+	     carved_stream_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_carver->carved_streams_array,
+		     carved_stream_index,
+		     (intptr_t **) &safe_carved_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve carved stream: %d.",
+			 function,
+			 carved_stream_index );
+
+			goto on_error;
+		}
+		if( ( safe_carved_stream != NULL )
+		 && ( safe_carved_stream->stream_number == stream_number ) )
+		{
+			*carved_stream = safe_carved_stream;
+
+			return( 1 );
+		}
+	}
+	safe_carved_stream = NULL;
+
+	if( libfsclfs_carved_stream_initialize(
+	     &safe_carved_stream,
+	     stream_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create carved stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_carver->carved_streams_array,
+	     &entry_index,
+	     (intptr_t *) safe_carved_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append carved stream to array.",
+		 function );
+
+		goto on_error;
+	}
+	*carved_stream = safe_carved_stream;
+
+	return( 1 );
+
+on_error:
+	if( safe_carved_stream != NULL )
+	{
+		libfsclfs_carved_stream_free(
+		 &safe_carved_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of carved blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_number_of_blocks(
+     libfsclfs_carver_t *carver,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_get_number_of_blocks";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_blocks = internal_carver->number_of_blocks;
+
+	return( 1 );
+}
+
+/* Retrieves the number of carved streams
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_number_of_streams(
+     libfsclfs_carver_t *carver,
+     int *number_of_streams,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_get_number_of_streams";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_carver->carved_streams_array,
+	     number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of carved streams.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the stream number of a specific carved stream
+ * The stream number is the stream number stored in the block headers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_stream_number(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     uint8_t *stream_number,
+     libcerror_error_t **error )
+{
+	libfsclfs_carved_stream_t *carved_stream     = NULL;
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_get_stream_number";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( stream_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_carver->carved_streams_array,
+	     stream_index,
+	     (intptr_t **) &carved_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve carved stream: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing carved stream: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	*stream_number = carved_stream->stream_number;
+
+	return( 1 );
+}
+
+/* Retrieves the virtual LSN range of a specific carved stream
+ * The range is reconstructed from the virtual LSNs of the carved records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_stream_virtual_lsn_range(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     uint64_t *first_virtual_lsn,
+     uint64_t *last_virtual_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_carved_stream_t *carved_stream     = NULL;
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_get_stream_virtual_lsn_range";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( first_virtual_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first virtual LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_virtual_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last virtual LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_carver->carved_streams_array,
+	     stream_index,
+	     (intptr_t **) &carved_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve carved stream: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( carved_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing carved stream: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	*first_virtual_lsn = carved_stream->first_virtual_lsn;
+	*last_virtual_lsn  = carved_stream->last_virtual_lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records of a specific carved stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_number_of_records(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libfsclfs_carved_stream_t *carved_stream     = NULL;
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	static char *function                        = "libfsclfs_carver_get_number_of_records";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_carver->carved_streams_array,
+	     stream_index,
+	     (intptr_t **) &carved_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve carved stream: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( libfsclfs_carved_stream_get_number_of_record_values(
+	     carved_stream,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records of carved stream: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record of a carved stream
+ * The records of a carved stream are ordered by virtual LSN
+ * The record is a copy of the carved record and is not associated with a stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_carver_get_record(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     int record_index,
+     uint64_t *record_lsn,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error )
+{
+	libfsclfs_carved_stream_t *carved_stream     = NULL;
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	libfsclfs_record_value_t *record_value       = NULL;
+	libfsclfs_record_value_t *safe_record_value  = NULL;
+	static char *function                        = "libfsclfs_carver_get_record";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	if( record_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_carver->carved_streams_array,
+	     stream_index,
+	     (intptr_t **) &carved_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve carved stream: %d.",
+		 function,
+		 stream_index );
+
+		goto on_error;
+	}
+	if( libfsclfs_carved_stream_get_record_value_by_index(
+	     carved_stream,
+	     record_index,
+	     &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d of carved stream: %d.",
+		 function,
+		 record_index,
+		 stream_index );
+
+		goto on_error;
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record: %d of carved stream: %d.",
+		 function,
+		 record_index,
+		 stream_index );
+
+		goto on_error;
+	}
+	if( libfsclfs_record_value_clone(
+	     &safe_record_value,
+	     record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_record_initialize(
+	     record,
+	     NULL,
+	     safe_record_value,
+	     LIBFSCLFS_RECORD_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	*record_lsn = record_value->virtual_lsn;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,164 @@
+/*
+ * Carver functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_INTERNAL_CARVER_H )
+#define _LIBFSCLFS_INTERNAL_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_carved_stream.h"
+#include "libfsclfs_extern.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to read the data that is carved
+ */
+#define LIBFSCLFS_CARVER_READ_BUFFER_SIZE	( 4 * 1024 * 1024 )
+
+typedef struct libfsclfs_internal_carver libfsclfs_internal_carver_t;
+
+struct libfsclfs_internal_carver
+{
+	/* The IO handle
+	 */
+	libfsclfs_io_handle_t *io_handle;
+
+	/* The carved streams array
+	 */
+	libcdata_array_t *carved_streams_array;
+
+	/* The number of carved blocks
+	 */
+	uint64_t number_of_blocks;
+};
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_initialize(
+     libfsclfs_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_free(
+     libfsclfs_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_signal_abort(
+     libfsclfs_carver_t *carver,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_carve_file(
+     libfsclfs_carver_t *carver,
+     const char *filename,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_carve_file_wide(
+     libfsclfs_carver_t *carver,
+     const wchar_t *filename,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_carve_file_io_handle(
+     libfsclfs_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+int libfsclfs_carver_read_block(
+     libfsclfs_internal_carver_t *internal_carver,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsclfs_carver_get_carved_stream_by_stream_number(
+     libfsclfs_internal_carver_t *internal_carver,
+     uint8_t stream_number,
+     libfsclfs_carved_stream_t **carved_stream,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_get_number_of_blocks(
+     libfsclfs_carver_t *carver,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_get_number_of_streams(
+     libfsclfs_carver_t *carver,
+     int *number_of_streams,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_get_stream_number(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     uint8_t *stream_number,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_get_stream_virtual_lsn_range(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     uint64_t *first_virtual_lsn,
+     uint64_t *last_virtual_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_get_number_of_records(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_carver_get_record(
+     libfsclfs_carver_t *carver,
+     int stream_index,
+     int record_index,
+     uint64_t *record_lsn,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_INTERNAL_CARVER_H ) */
+
@@ -25,7 +25,9 @@
 
 #include "libfsclfs_container.h"
 #include "libfsclfs_container_descriptor.h"
+#include "libfsclfs_io_handle.h"
 #include "libfsclfs_libcerror.h"
+#include "libfsclfs_statistics.h"
 #include "libfsclfs_store.h"
 #include "libfsclfs_types.h"
 
@@ -317,6 +319,85 @@ int libfsclfs_container_get_size(
 	return( 1 );
 }
 
+/* Retrieves the read statistics of the container file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_container_get_read_statistics(
+     libfsclfs_container_t *container,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsclfs_container_get_read_statistics";
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsclfs_internal_container_t *) container;
+
+	if( internal_container->internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - invalid internal store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->container_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing container descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	/* The container files are stored in the statistics after the base log file
+	 */
+	if( libfsclfs_statistics_get_file_values(
+	     internal_container->internal_store->io_handle->statistics,
+	     1 + (int) internal_container->container_descriptor->physical_number,
+	     number_of_reads,
+	     number_of_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container file statistics values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
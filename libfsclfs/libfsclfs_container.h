@@ -81,6 +81,13 @@ int libfsclfs_container_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBFSCLFS_EXTERN \
+int libfsclfs_container_get_read_statistics(
+     libfsclfs_container_t *container,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error );
+
 LIBFSCLFS_EXTERN \
 int libfsclfs_container_get_utf8_name_size(
      libfsclfs_container_t *container,
@@ -0,0 +1,1082 @@
+/*
+ * Direct (unbuffered) file IO functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfsclfs_aligned_pool.h"
+#include "libfsclfs_direct_file.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_unused.h"
+
+/* Creates a direct file
+ * Make sure the value direct_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_initialize(
+     libfsclfs_direct_file_t **direct_file,
+     libfsclfs_aligned_pool_t *aligned_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_initialize";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( aligned_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned pool.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_file = memory_allocate_structure(
+	                libfsclfs_direct_file_t );
+
+	if( *direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *direct_file,
+	     0,
+	     sizeof( libfsclfs_direct_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear direct file.",
+		 function );
+
+		goto on_error;
+	}
+	( *direct_file )->aligned_pool = aligned_pool;
+	( *direct_file )->descriptor   = -1;
+
+	return( 1 );
+
+on_error:
+	if( *direct_file != NULL )
+	{
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_free(
+     libfsclfs_direct_file_t **direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_free";
+	int result            = 1;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file != NULL )
+	{
+		if( ( *direct_file )->descriptor != -1 )
+		{
+			if( libfsclfs_direct_file_close(
+			     *direct_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close direct file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *direct_file )->name != NULL )
+		{
+			memory_free(
+			 ( *direct_file )->name );
+		}
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct file
+ * The clone shares the aligned pool but is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_clone(
+     libfsclfs_direct_file_t **destination_direct_file,
+     libfsclfs_direct_file_t *source_direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_clone";
+
+	if( destination_direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_direct_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination direct file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_direct_file == NULL )
+	{
+		*destination_direct_file = NULL;
+
+		return( 1 );
+	}
+	if( libfsclfs_direct_file_initialize(
+	     destination_direct_file,
+	     source_direct_file->aligned_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination direct file.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_direct_file->name != NULL )
+	{
+		if( libfsclfs_direct_file_set_name(
+		     *destination_direct_file,
+		     source_direct_file->name,
+		     source_direct_file->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination direct file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_direct_file != NULL )
+	{
+		libfsclfs_direct_file_free(
+		 destination_direct_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_set_name(
+     libfsclfs_direct_file_t *direct_file,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_set_name";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->name != NULL )
+	{
+		memory_free(
+		 direct_file->name );
+
+		direct_file->name      = NULL;
+		direct_file->name_size = 0;
+	}
+	direct_file->name = narrow_string_allocate(
+	                     name_length + 1 );
+
+	if( direct_file->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     direct_file->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 direct_file->name );
+
+		direct_file->name = NULL;
+
+		return( -1 );
+	}
+	direct_file->name[ name_length ] = 0;
+
+	direct_file->name_size = name_length + 1;
+
+	return( 1 );
+}
+
+/* Opens the direct file
+ * Only read access is supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_open(
+     libfsclfs_direct_file_t *direct_file,
+     int access_flags,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSCLFS_DIRECT_IO )
+	struct stat file_statistics;
+
+	int open_flags        = 0;
+#endif
+	static char *function = "libfsclfs_direct_file_open";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_DIRECT_IO )
+	open_flags = O_RDONLY;
+
+#if defined( O_DIRECT )
+	open_flags |= O_DIRECT;
+#endif
+	direct_file->descriptor = open(
+	                           direct_file->name,
+	                           open_flags );
+
+	if( direct_file->descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 direct_file->name );
+
+		goto on_error;
+	}
+#if !defined( O_DIRECT ) && defined( F_NOCACHE )
+	if( fcntl(
+	     direct_file->descriptor,
+	     F_NOCACHE,
+	     1 ) == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to disable caching of file: %s.",
+		 function,
+		 direct_file->name );
+
+		goto on_error;
+	}
+#endif
+	if( fstat(
+	     direct_file->descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_aligned_pool_get_buffer(
+	     direct_file->aligned_pool,
+	     &( direct_file->buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read buffer from aligned pool.",
+		 function );
+
+		goto on_error;
+	}
+	direct_file->access_flags     = access_flags;
+	direct_file->size             = (size64_t) file_statistics.st_size;
+	direct_file->current_offset   = 0;
+	direct_file->buffer_offset    = 0;
+	direct_file->buffer_data_size = 0;
+
+	return( 1 );
+
+on_error:
+	if( direct_file->descriptor != -1 )
+	{
+		close(
+		 direct_file->descriptor );
+
+		direct_file->descriptor = -1;
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFSCLFS_DIRECT_IO ) */
+}
+
+/* Closes the direct file
+ * The read buffer is released back to the aligned pool
+ * Returns 0 if successful or -1 on error
+ */
+int libfsclfs_direct_file_close(
+     libfsclfs_direct_file_t *direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_close";
+	int result            = 0;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_DIRECT_IO )
+	if( close(
+	     direct_file->descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	direct_file->descriptor = -1;
+
+	if( libfsclfs_aligned_pool_release_buffer(
+	     direct_file->aligned_pool,
+	     &( direct_file->buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read buffer to aligned pool.",
+		 function );
+
+		result = -1;
+	}
+	direct_file->access_flags     = 0;
+	direct_file->size             = 0;
+	direct_file->current_offset   = 0;
+	direct_file->buffer_offset    = 0;
+	direct_file->buffer_data_size = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the direct file
+ * The data is read in aligned ranges of the buffer size of the aligned pool
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsclfs_direct_file_read(
+         libfsclfs_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function  = "libfsclfs_direct_file_read";
+	size_t buffer_offset   = 0;
+	size_t data_offset     = 0;
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+	off64_t aligned_offset = 0;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( direct_file->descriptor == -1 )
+	 || ( direct_file->buffer == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		if( (size64_t) direct_file->current_offset >= direct_file->size )
+		{
+			break;
+		}
+		if( ( direct_file->current_offset < direct_file->buffer_offset )
+		 || ( direct_file->current_offset >= ( direct_file->buffer_offset + (off64_t) direct_file->buffer_data_size ) ) )
+		{
+			aligned_offset = direct_file->current_offset
+			               - ( direct_file->current_offset % (off64_t) direct_file->aligned_pool->buffer_size );
+
+#if defined( HAVE_LIBFSCLFS_DIRECT_IO )
+			if( lseek(
+			     direct_file->descriptor,
+			     (off_t) aligned_offset,
+			     SEEK_SET ) == -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 errno,
+				 "%s: unable to seek offset: %" PRIi64 ".",
+				 function,
+				 aligned_offset );
+
+				return( -1 );
+			}
+			read_count = read(
+			              direct_file->descriptor,
+			              direct_file->buffer->data,
+			              direct_file->aligned_pool->buffer_size );
+
+			if( read_count < 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file.",
+				 function );
+
+				direct_file->buffer_data_size = 0;
+
+				return( -1 );
+			}
+#else
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: direct IO not supported on this platform.",
+			 function );
+
+			return( -1 );
+#endif
+			direct_file->buffer_offset    = aligned_offset;
+			direct_file->buffer_data_size = (size_t) read_count;
+
+			if( direct_file->current_offset >= ( direct_file->buffer_offset + (off64_t) direct_file->buffer_data_size ) )
+			{
+				break;
+			}
+		}
+		data_offset = (size_t) ( direct_file->current_offset - direct_file->buffer_offset );
+		read_size   = direct_file->buffer_data_size - data_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( ( direct_file->buffer->data )[ data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset               += read_size;
+		direct_file->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the direct file
+ * Write access is not supported
+ * Returns -1 on error
+ */
+ssize_t libfsclfs_direct_file_write(
+         libfsclfs_direct_file_t *direct_file LIBFSCLFS_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer LIBFSCLFS_ATTRIBUTE_UNUSED,
+         size_t size LIBFSCLFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_write";
+
+	LIBFSCLFS_UNREFERENCED_PARAMETER( direct_file )
+	LIBFSCLFS_UNREFERENCED_PARAMETER( buffer )
+	LIBFSCLFS_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the direct file
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libfsclfs_direct_file_seek_offset(
+         libfsclfs_direct_file_t *direct_file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_seek_offset";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += direct_file->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) direct_file->size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file offset is only changed when the read buffer is refilled
+	 */
+	direct_file->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a direct file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libfsclfs_direct_file_exists(
+     libfsclfs_direct_file_t *direct_file,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSCLFS_DIRECT_IO )
+	struct stat file_statistics;
+#endif
+	static char *function = "libfsclfs_direct_file_exists";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_DIRECT_IO )
+	if( stat(
+	     direct_file->name,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Check if the direct file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libfsclfs_direct_file_is_open(
+     libfsclfs_direct_file_t *direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_is_open";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the direct file size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_get_size(
+     libfsclfs_direct_file_t *direct_file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_direct_file_get_size";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = direct_file->size;
+
+	return( 1 );
+}
+
+/* Creates a file IO handle that reads a file using direct IO
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_direct_file_io_handle_initialize(
+     libbfio_handle_t **file_io_handle,
+     libfsclfs_aligned_pool_t *aligned_pool,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libfsclfs_direct_file_t *direct_file = NULL;
+	static char *function                = "libfsclfs_direct_file_io_handle_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_direct_file_initialize(
+	     &direct_file,
+	     aligned_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_direct_file_set_name(
+	     direct_file,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in direct file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) direct_file,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libfsclfs_direct_file_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libfsclfs_direct_file_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libfsclfs_direct_file_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfsclfs_direct_file_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libfsclfs_direct_file_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libfsclfs_direct_file_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libfsclfs_direct_file_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfsclfs_direct_file_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfsclfs_direct_file_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libfsclfs_direct_file_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( direct_file != NULL )
+	{
+		libfsclfs_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,165 @@
+/*
+ * Direct (unbuffered) file IO functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_DIRECT_FILE_H )
+#define _LIBFSCLFS_DIRECT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#include "libfsclfs_aligned_pool.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Direct IO is supported on platforms that can bypass the page cache
+ * using O_DIRECT or F_NOCACHE
+ */
+#if !defined( WINAPI ) && ( defined( O_DIRECT ) || defined( F_NOCACHE ) )
+#define HAVE_LIBFSCLFS_DIRECT_IO	1
+#endif
+
+typedef struct libfsclfs_direct_file libfsclfs_direct_file_t;
+
+struct libfsclfs_direct_file
+{
+	/* The aligned pool the read buffer is retrieved from
+	 */
+	libfsclfs_aligned_pool_t *aligned_pool;
+
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The file descriptor
+	 */
+	int descriptor;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The read buffer
+	 * contains the data of the aligned range read last
+	 */
+	libfsclfs_aligned_buffer_t *buffer;
+
+	/* The offset of the data in the read buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The size of the data in the read buffer
+	 */
+	size_t buffer_data_size;
+};
+
+int libfsclfs_direct_file_initialize(
+     libfsclfs_direct_file_t **direct_file,
+     libfsclfs_aligned_pool_t *aligned_pool,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_free(
+     libfsclfs_direct_file_t **direct_file,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_clone(
+     libfsclfs_direct_file_t **destination_direct_file,
+     libfsclfs_direct_file_t *source_direct_file,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_set_name(
+     libfsclfs_direct_file_t *direct_file,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_open(
+     libfsclfs_direct_file_t *direct_file,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_close(
+     libfsclfs_direct_file_t *direct_file,
+     libcerror_error_t **error );
+
+ssize_t libfsclfs_direct_file_read(
+         libfsclfs_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libfsclfs_direct_file_write(
+         libfsclfs_direct_file_t *direct_file,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libfsclfs_direct_file_seek_offset(
+         libfsclfs_direct_file_t *direct_file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libfsclfs_direct_file_exists(
+     libfsclfs_direct_file_t *direct_file,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_is_open(
+     libfsclfs_direct_file_t *direct_file,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_get_size(
+     libfsclfs_direct_file_t *direct_file,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libfsclfs_direct_file_io_handle_initialize(
+     libbfio_handle_t **file_io_handle,
+     libfsclfs_aligned_pool_t *aligned_pool,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_DIRECT_FILE_H ) */
+
@@ -25,6 +25,7 @@
 
 #include "libfsclfs_io_handle.h"
 #include "libfsclfs_libcerror.h"
+#include "libfsclfs_statistics.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -86,16 +87,38 @@ int libfsclfs_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *io_handle )->bytes_per_sector = 512;
-
-	/* A region is an area of 512 KiB
+	/* A region is an area of 512 KiB and the owner page is the last 4 KiB page of a region
 	 */
-	( *io_handle )->region_size = 512 * 1024;
+	if( libfsclfs_io_handle_set_geometry(
+	     *io_handle,
+	     512,
+	     512 * 1024,
+	     ( 512 - 4 ) * 1024,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set geometry.",
+		 function );
 
-	/* The owner page is the last 4 KiB page of a region
-	 */
-	( *io_handle )->region_owner_page_offset = ( 512 - 4 ) * 1024;
+		goto on_error;
+	}
 
+	if( libfsclfs_statistics_initialize(
+	     &( ( *io_handle )->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -117,6 +140,7 @@ int libfsclfs_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsclfs_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -131,12 +155,25 @@ int libfsclfs_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libfsclfs_statistics_free(
+		     &( ( *io_handle )->statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
@@ -146,7 +183,11 @@ int libfsclfs_io_handle_clear(
      libfsclfs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsclfs_io_handle_clear";
+	void (*trace_callback)( int event_type, int event_phase, uint64_t timestamp, uint64_t value, void *callback_data ) = NULL;
+
+	libfsclfs_statistics_t *statistics = NULL;
+	static char *function              = "libfsclfs_io_handle_clear";
+	void *trace_callback_data          = NULL;
 
 	if( io_handle == NULL )
 	{
@@ -159,6 +200,12 @@ int libfsclfs_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The statistics and trace callback are retained when the IO handle is cleared
+	 */
+	statistics          = io_handle->statistics;
+	trace_callback      = io_handle->trace_callback;
+	trace_callback_data = io_handle->trace_callback_data;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -173,16 +220,118 @@ int libfsclfs_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->bytes_per_sector = 512;
+	io_handle->statistics          = statistics;
+	io_handle->trace_callback      = trace_callback;
+	io_handle->trace_callback_data = trace_callback_data;
 
-	/* A region is an area of 512 KiB
+	/* A region is an area of 512 KiB and the owner page is the last 4 KiB page of a region
 	 */
-	io_handle->region_size = 512 * 1024;
+	if( libfsclfs_io_handle_set_geometry(
+	     io_handle,
+	     512,
+	     512 * 1024,
+	     ( 512 - 4 ) * 1024,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set geometry.",
+		 function );
 
-	/* The owner page is the last 4 KiB page of a region
-	 */
-	io_handle->region_owner_page_offset = ( 512 - 4 ) * 1024;
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the geometry
+ * When the number of bytes per sector and the region size are a power of 2,
+ * which is the case for the standard 512 bytes per sector and 512 KiB regions,
+ * their exponents are set so that offsets can be mapped with shifts and masks
+ * instead of divisions
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_io_handle_set_geometry(
+     libfsclfs_io_handle_t *io_handle,
+     uint32_t bytes_per_sector,
+     uint32_t region_size,
+     uint32_t region_owner_page_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_io_handle_set_geometry";
+	uint8_t shift         = 0;
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region_size < bytes_per_sector )
+	 || ( ( region_size % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region_owner_page_offset >= region_size )
+	 || ( ( region_owner_page_offset % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region owner page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->bytes_per_sector         = bytes_per_sector;
+	io_handle->region_size              = region_size;
+	io_handle->region_owner_page_offset = region_owner_page_offset;
+	io_handle->bytes_per_sector_shift   = 0;
+	io_handle->region_size_shift        = 0;
+
+	if( ( bytes_per_sector & ( bytes_per_sector - 1 ) ) == 0 )
+	{
+		for( shift = 0;
+		     ( (uint32_t) 1 << shift ) < bytes_per_sector;
+		     shift++ )
+		{
+		}
+		io_handle->bytes_per_sector_shift = shift;
+	}
+	if( ( region_size & ( region_size - 1 ) ) == 0 )
+	{
+		for( shift = 0;
+		     ( (uint32_t) 1 << shift ) < region_size;
+		     shift++ )
+		{
+		}
+		io_handle->region_size_shift = shift;
+	}
 	return( 1 );
 }
 
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfsclfs_libcerror.h"
+#include "libfsclfs_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -47,6 +48,33 @@ struct libfsclfs_io_handle
 	 */
 	uint32_t region_owner_page_offset;
 
+	/* The number of bytes per sector as a power of 2 exponent
+	 * or 0 if the number of bytes per sector is not a power of 2
+	 */
+	uint8_t bytes_per_sector_shift;
+
+	/* The region size as a power of 2 exponent
+	 * or 0 if the region size is not a power of 2
+	 */
+	uint8_t region_size_shift;
+
+	/* The statistics
+	 */
+	libfsclfs_statistics_t *statistics;
+
+	/* The trace callback function
+	 */
+	void (*trace_callback)(
+	       int event_type,
+	       int event_phase,
+	       uint64_t timestamp,
+	       uint64_t value,
+	       void *callback_data );
+
+	/* The trace callback data
+	 */
+	void *trace_callback_data;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -64,6 +92,13 @@ int libfsclfs_io_handle_clear(
      libfsclfs_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libfsclfs_io_handle_set_geometry(
+     libfsclfs_io_handle_t *io_handle,
+     uint32_t bytes_per_sector,
+     uint32_t region_size,
+     uint32_t region_owner_page_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,656 @@
+/*
+ * Logical record functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_logical_record.h"
+#include "libfsclfs_record_value.h"
+#include "libfsclfs_types.h"
+
+/* Creates a logical record
+ * Make sure the value logical_record is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_initialize(
+     libfsclfs_logical_record_t **logical_record,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	static char *function                                        = "libfsclfs_logical_record_initialize";
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = memory_allocate_structure(
+	                           libfsclfs_internal_logical_record_t );
+
+	if( internal_logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create logical record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_logical_record,
+	     0,
+	     sizeof( libfsclfs_internal_logical_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear logical record.",
+		 function );
+
+		memory_free(
+		 internal_logical_record );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_logical_record->fragments_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fragments array.",
+		 function );
+
+		goto on_error;
+	}
+	*logical_record = (libfsclfs_logical_record_t *) internal_logical_record;
+
+	return( 1 );
+
+on_error:
+	if( internal_logical_record != NULL )
+	{
+		memory_free(
+		 internal_logical_record );
+	}
+	return( -1 );
+}
+
+/* Frees a logical record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_free(
+     libfsclfs_logical_record_t **logical_record,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	static char *function                                        = "libfsclfs_logical_record_free";
+	int result                                                   = 1;
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_record != NULL )
+	{
+		internal_logical_record = (libfsclfs_internal_logical_record_t *) *logical_record;
+		*logical_record         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_logical_record->fragments_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_record_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free fragments array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_logical_record );
+	}
+	return( result );
+}
+
+/* Prepends a fragment to the logical record
+ * The fragments are read backwards following the previous LSN, hence the last fragment
+ * is added first. The logical record takes over management of the record value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_prepend_fragment(
+     libfsclfs_internal_logical_record_t *internal_logical_record,
+     uint64_t lsn,
+     libfsclfs_record_value_t *record_value,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsclfs_logical_record_prepend_fragment";
+	int entry_index         = 0;
+	int number_of_fragments = 0;
+
+	if( internal_logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_logical_record->data_size > (size_t) LIBFSCLFS_MAXIMUM_LOGICAL_RECORD_DATA_SIZE )
+	 || ( (size_t) record_value->data_size > ( (size_t) LIBFSCLFS_MAXIMUM_LOGICAL_RECORD_DATA_SIZE - internal_logical_record->data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid logical record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_record->fragments_array,
+	     &number_of_fragments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of fragments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_fragments >= LIBFSCLFS_MAXIMUM_NUMBER_OF_LOGICAL_RECORD_FRAGMENTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of fragments value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_logical_record->fragments_array,
+	     &entry_index,
+	     (intptr_t *) record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fragment to array.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record->data_size   += (size_t) record_value->data_size;
+	internal_logical_record->lsn          = lsn;
+	internal_logical_record->previous_lsn = record_value->previous_lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the log sequence number (LSN) of the first fragment
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_get_lsn(
+     libfsclfs_logical_record_t *logical_record,
+     uint64_t *lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	static char *function                                        = "libfsclfs_logical_record_get_lsn";
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = (libfsclfs_internal_logical_record_t *) logical_record;
+
+	if( lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LSN.",
+		 function );
+
+		return( -1 );
+	}
+	*lsn = internal_logical_record->lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the previous log sequence number (LSN) of the first fragment
+ * This is the LSN of the record that precedes the logical record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_get_previous_lsn(
+     libfsclfs_logical_record_t *logical_record,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	static char *function                                        = "libfsclfs_logical_record_get_previous_lsn";
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = (libfsclfs_internal_logical_record_t *) logical_record;
+
+	if( previous_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous LSN.",
+		 function );
+
+		return( -1 );
+	}
+	*previous_lsn = internal_logical_record->previous_lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the number of segments
+ * Every fragment of the logical record is a segment
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_get_number_of_segments(
+     libfsclfs_logical_record_t *logical_record,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	static char *function                                        = "libfsclfs_logical_record_get_number_of_segments";
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = (libfsclfs_internal_logical_record_t *) logical_record;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_record->fragments_array,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of fragments.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific segment
+ * The segment data references the data of the fragment and is valid
+ * as long as the logical record is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_get_segment_by_index(
+     libfsclfs_logical_record_t *logical_record,
+     int segment_index,
+     uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	libfsclfs_record_value_t *record_value                       = NULL;
+	static char *function                                        = "libfsclfs_logical_record_get_segment_by_index";
+	int number_of_fragments                                      = 0;
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = (libfsclfs_internal_logical_record_t *) logical_record;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_record->fragments_array,
+	     &number_of_fragments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of fragments.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= number_of_fragments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_logical_record->fragments_array,
+	     number_of_fragments - 1 - segment_index,
+	     (intptr_t **) &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve fragment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_get_data(
+	     record_value,
+	     segment_data,
+	     segment_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve fragment: %d data.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data size
+ * The data size is the sum of the data sizes of the segments
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_get_data_size(
+     libfsclfs_logical_record_t *logical_record,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	static char *function                                        = "libfsclfs_logical_record_get_data_size";
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = (libfsclfs_internal_logical_record_t *) logical_record;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_logical_record->data_size;
+
+	return( 1 );
+}
+
+/* Copies the data of the segments into a single contiguous buffer
+ * The size of the buffer should be at least the data size of the logical record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_logical_record_copy_data(
+     libfsclfs_logical_record_t *logical_record,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_logical_record_t *internal_logical_record = NULL;
+	libfsclfs_record_value_t *record_value                       = NULL;
+	static char *function                                        = "libfsclfs_logical_record_copy_data";
+	size_t data_offset                                           = 0;
+	int fragment_index                                           = 0;
+	int number_of_fragments                                      = 0;
+
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_record = (libfsclfs_internal_logical_record_t *) logical_record;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < internal_logical_record->data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_logical_record->fragments_array,
+	     &number_of_fragments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of fragments.",
+		 function );
+
+		return( -1 );
+	}
+	for( fragment_index = number_of_fragments - 1;
+	     fragment_index >= 0;
+	     fragment_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_logical_record->fragments_array,
+		     fragment_index,
+		     (intptr_t **) &record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fragment: %d.",
+			 function,
+			 fragment_index );
+
+			return( -1 );
+		}
+		if( record_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing fragment: %d.",
+			 function,
+			 fragment_index );
+
+			return( -1 );
+		}
+		if( record_value->data_size == 0 )
+		{
+			continue;
+		}
+		if( (size_t) record_value->data_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid fragment: %d data size value out of bounds.",
+			 function,
+			 fragment_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     record_value->data,
+		     (size_t) record_value->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy fragment: %d data.",
+			 function,
+			 fragment_index );
+
+			return( -1 );
+		}
+		data_offset += (size_t) record_value->data_size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,119 @@
+/*
+ * Logical record functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_INTERNAL_LOGICAL_RECORD_H )
+#define _LIBFSCLFS_INTERNAL_LOGICAL_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_extern.h"
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_value.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_internal_logical_record libfsclfs_internal_logical_record_t;
+
+struct libfsclfs_internal_logical_record
+{
+	/* The fragment record values array
+	 * the fragments are stored in reverse order, the last fragment first
+	 */
+	libcdata_array_t *fragments_array;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The LSN of the first fragment
+	 */
+	uint64_t lsn;
+
+	/* The previous LSN of the first fragment
+	 */
+	uint64_t previous_lsn;
+};
+
+int libfsclfs_logical_record_initialize(
+     libfsclfs_logical_record_t **logical_record,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_free(
+     libfsclfs_logical_record_t **logical_record,
+     libcerror_error_t **error );
+
+int libfsclfs_logical_record_prepend_fragment(
+     libfsclfs_internal_logical_record_t *internal_logical_record,
+     uint64_t lsn,
+     libfsclfs_record_value_t *record_value,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_get_lsn(
+     libfsclfs_logical_record_t *logical_record,
+     uint64_t *lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_get_previous_lsn(
+     libfsclfs_logical_record_t *logical_record,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_get_number_of_segments(
+     libfsclfs_logical_record_t *logical_record,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_get_segment_by_index(
+     libfsclfs_logical_record_t *logical_record,
+     int segment_index,
+     uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_get_data_size(
+     libfsclfs_logical_record_t *logical_record,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_logical_record_copy_data(
+     libfsclfs_logical_record_t *logical_record,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_INTERNAL_LOGICAL_RECORD_H ) */
+
@@ -24,6 +24,10 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libfsclfs_block.h"
 #include "libfsclfs_libbfio.h"
 #include "libfsclfs_libcdata.h"
@@ -31,6 +35,7 @@
 #include "libfsclfs_libcnotify.h"
 #include "libfsclfs_log_range.h"
 #include "libfsclfs_owner_page.h"
+#include "libfsclfs_statistics.h"
 
 /* Creates an owner page
  * Make sure the value owner_page is referencing, is set to NULL
@@ -212,7 +217,10 @@ int libfsclfs_owner_page_free(
 }
 
 /* Reads the owner page
- * Returns 1 if successful or -1 on error
+ * The owner page is the last block of a region and maps every sector of the region
+ * to a stream and block, which allows the blocks of the region to be determined
+ * without reading them
+ * Returns 1 if successful, 0 if the owner page is not valid or -1 on error
  */
 int libfsclfs_owner_page_read(
      libfsclfs_owner_page_t *owner_page,
@@ -229,6 +237,7 @@ int libfsclfs_owner_page_read(
 	static char *function                      = "libfsclfs_owner_page_read";
 	size_t sector_mapping_array_data_size      = 0;
 	size_t virtual_log_range_array_data_size   = 0;
+	int result                                 = 0;
 
 	if( owner_page == NULL )
 	{
@@ -241,144 +250,195 @@ int libfsclfs_owner_page_read(
 
 		return( -1 );
 	}
-	if( libfsclfs_block_initialize(
-	     &block,
-	     error ) != 1 )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
-	}
-	if( libfsclfs_block_read(
-	     block,
-	     io_handle,
-	     file_io_handle,
-	     offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block at offset: %" PRIu32 ".",
-		 function,
-		 offset );
-
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsclfs_block_get_virtual_log_range_array_data(
-	     block,
-	     &virtual_log_range_array_data,
-	     &virtual_log_range_array_data_size,
-	     error ) != 1 )
+	if( number_of_streams <= 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve virtual log range array data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of streams.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &virtual_log_ranges_array,
-	     0,
+	owner_page->is_sorted  = 0;
+	owner_page->is_scanned = 0;
+
+	if( libfsclfs_block_initialize(
+	     &block,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create virtual log ranges array.",
+		 "%s: unable to create block.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsclfs_owner_page_read_virtual_log_range_array(
-	     owner_page,
-	     virtual_log_ranges_array,
-	     number_of_streams,
-	     virtual_log_range_array_data,
-	     virtual_log_range_array_data_size,
-	     error ) != 1 )
+	/* The owner page of a region that has not been written yet is not a valid block
+	 */
+	result = libfsclfs_block_probe(
+	          block,
+	          io_handle,
+	          file_io_handle,
+	          offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read virtual log range array.",
-		 function );
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 offset );
 
 		goto on_error;
 	}
-	if( libfsclfs_block_get_sector_mapping_array_data(
-	     block,
-	     &sector_mapping_array_data,
-	     &sector_mapping_array_data_size,
-	     error ) != 1 )
+	if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve sector mapping array data.",
-		 function );
+		result = libfsclfs_block_get_virtual_log_range_array_data(
+		          block,
+		          &virtual_log_range_array_data,
+		          &virtual_log_range_array_data_size,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable retrieve virtual log range array data.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( libfsclfs_owner_page_read_sector_mapping_array(
-	     owner_page,
-	     io_handle,
-	     virtual_log_ranges_array,
-	     number_of_streams,
-	     offset,
-	     sector_mapping_array_data,
-	     sector_mapping_array_data_size,
-	     error ) != 1 )
+	if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read sector mapping array.",
-		 function );
+		if( virtual_log_range_array_data_size < (size_t) ( number_of_streams * 16 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libfsclfs_block_get_sector_mapping_array_data(
+		          block,
+		          &sector_mapping_array_data,
+		          &sector_mapping_array_data_size,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable retrieve sector mapping array data.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( libfsclfs_block_free(
-	     &block,
-	     error ) != 1 )
+	if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free block.",
-		 function );
+		if( libcdata_array_initialize(
+		     &virtual_log_ranges_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create virtual log ranges array.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libfsclfs_owner_page_read_virtual_log_range_array(
+		     owner_page,
+		     virtual_log_ranges_array,
+		     number_of_streams,
+		     virtual_log_range_array_data,
+		     virtual_log_range_array_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read virtual log range array.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfsclfs_owner_page_read_sector_mapping_array(
+		          owner_page,
+		          io_handle,
+		          virtual_log_ranges_array,
+		          number_of_streams,
+		          offset,
+		          sector_mapping_array_data,
+		          sector_mapping_array_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector mapping array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_free(
+		     &virtual_log_ranges_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free virtual log ranges array.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( libcdata_array_free(
-	     &virtual_log_ranges_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+	if( libfsclfs_block_free(
+	     &block,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free virtual log ranges array.",
+		 "%s: unable to free block.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
+	return( result );
 
 on_error:
 	if( virtual_log_ranges_array != NULL )
@@ -512,6 +572,9 @@ int libfsclfs_owner_page_read_virtual_log_range_array(
 
 		virtual_log_range_array_data += 8;
 
+		log_range->stream_number = (uint8_t) stream_index;
+		log_range->current_lsn   = log_range->start_lsn;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -567,7 +630,12 @@ on_error:
 }
 
 /* Reads the owner page sector mapping array
- * Returns 1 if successful or -1 on error
+ * Every sector of the region is mapped by 2 bytes that contain the stream number
+ * and the number of the sector in its block. The sectors of the owner page itself
+ * are mapped by 0xff 0xff and the sectors that are not used by a block by stream 0.
+ * The blocks of a stream are stored in the region in order of their virtual LSN,
+ * starting at the virtual LSN of the stream in the virtual log range array
+ * Returns 1 if successful, 0 if the sector mapping array is not valid or -1 on error
  */
 int libfsclfs_owner_page_read_sector_mapping_array(
      libfsclfs_owner_page_t *owner_page,
@@ -583,14 +651,15 @@ int libfsclfs_owner_page_read_sector_mapping_array(
 	libfsclfs_log_range_t *virtual_log_range      = NULL;
 	libfsclfs_log_range_t *virtual_full_log_range = NULL;
 	static char *function                         = "libfsclfs_owner_page_read_sector_mapping_array";
+	size_t first_sector_index                     = 0;
+	size_t number_of_sectors                      = 0;
+	size_t sector_index                           = 0;
+	uint32_t block_offset                         = 0;
+	uint32_t block_size                           = 0;
 	uint32_t region_offset                        = 0;
-	uint8_t first_block_sector_number             = 0;
-	uint8_t last_block_sector_number              = 0;
 	uint8_t stream_number                         = 0;
 	int entry_index                               = 0;
-	int first_sector                              = 0;
-	int new_log_range                             = 0;
-	int sector_index                              = 0;
+	int result                                    = 1;
 
 	if( owner_page == NULL )
 	{
@@ -614,6 +683,18 @@ int libfsclfs_owner_page_read_sector_mapping_array(
 
 		return( -1 );
 	}
+	if( ( io_handle->bytes_per_sector == 0 )
+	 || ( io_handle->region_owner_page_offset == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - region owner page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( sector_mapping_array_data == NULL )
 	{
 		libcerror_error_set(
@@ -625,13 +706,13 @@ int libfsclfs_owner_page_read_sector_mapping_array(
 
 		return( -1 );
 	}
-	if( sector_mapping_array_data_size > ( 1024 * 2 ) )
+	if( sector_mapping_array_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
-		 "%s: invalid sector mapping array data size value too large.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sector mapping array data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -647,6 +728,17 @@ int libfsclfs_owner_page_read_sector_mapping_array(
 
 		return( -1 );
 	}
+	if( offset < io_handle->region_owner_page_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -659,214 +751,233 @@ int libfsclfs_owner_page_read_sector_mapping_array(
 		 0 );
 	}
 #endif
-	region_offset             = offset - io_handle->region_owner_page_offset;
-	stream_number             = sector_mapping_array_data[ 0 ];
-	first_block_sector_number = sector_mapping_array_data[ 1 ];
-	last_block_sector_number  = sector_mapping_array_data[ 1 ];
-	sector_index              = 1;
-
-fprintf( stderr, "X: 0x%08" PRIx32 ": 0x%02" PRIx8 ", 0x%02" PRIx8 "\n",
- region_offset,
- sector_mapping_array_data[ 0 ], sector_mapping_array_data[ 1 ] );
+	region_offset     = offset - io_handle->region_owner_page_offset;
+	number_of_sectors = sector_mapping_array_data_size / 2;
 
-	sector_mapping_array_data      += 2;
-	sector_mapping_array_data_size -= 2;
-
-	while( sector_mapping_array_data_size > 0 )
+	if( ( ( sector_mapping_array_data_size % 2 ) != 0 )
+	 || ( ( number_of_sectors * io_handle->bytes_per_sector ) > (size_t) io_handle->region_size ) )
 	{
-		/* The range of the owner page itself is represented by 0xff 0xff
-		 */
-		if( ( sector_mapping_array_data[ 0 ] == 0xff )
-		 && ( sector_mapping_array_data[ 1 ] == 0xff ) )
+		return( 0 );
+	}
+	while( sector_index < number_of_sectors )
+	{
+		stream_number = sector_mapping_array_data[ sector_index * 2 ];
+
+		if( ( stream_number == 0 )
+		 || ( ( stream_number == 0xff )
+		  &&  ( sector_mapping_array_data[ ( sector_index * 2 ) + 1 ] == 0xff ) ) )
 		{
+			sector_index++;
+
+			continue;
 		}
-		else if( sector_mapping_array_data[ 0 ] != stream_number )
+		if( ( (int) stream_number >= number_of_streams )
+		 || ( sector_mapping_array_data[ ( sector_index * 2 ) + 1 ] != 0 ) )
 		{
-			new_log_range = 1;
+			result = 0;
+
+			break;
 		}
-		else if( sector_mapping_array_data[ 1 ] <= last_block_sector_number )
+		first_sector_index = sector_index;
+
+		sector_index++;
+
+		/* The number of the sector in its block is stored in 8 bits
+		 */
+		while( ( sector_index < number_of_sectors )
+		    && ( ( sector_index - first_sector_index ) < 256 )
+		    && ( sector_mapping_array_data[ sector_index * 2 ] == stream_number )
+		    && ( sector_mapping_array_data[ ( sector_index * 2 ) + 1 ] == (uint8_t) ( sector_index - first_sector_index ) ) )
 		{
-			new_log_range = 1;
+			sector_index++;
 		}
-		if( new_log_range != 0 )
+		/* A block of more than 256 sectors cannot be distinguished from
+		 * a subsequent block of the same stream
+		 */
+		if( ( ( sector_index - first_sector_index ) >= 256 )
+		 && ( sector_index < number_of_sectors )
+		 && ( sector_mapping_array_data[ sector_index * 2 ] == stream_number ) )
 		{
-			if( ( stream_number == 0 )
-			 || ( (int) stream_number >= number_of_streams ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid stream number value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_array_get_entry_by_index(
-			     virtual_log_ranges_array,
-			     stream_number,
-			     (intptr_t **) &virtual_full_log_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve virtual full log range: %d.",
-				 function,
-				 stream_number );
+			result = 0;
 
-				goto on_error;
-			}
-			if( virtual_full_log_range == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing virtual full log range: %d.",
-				 function,
-				 stream_number );
+			break;
+		}
+		block_offset = region_offset + (uint32_t) ( first_sector_index * io_handle->bytes_per_sector );
+		block_size   = (uint32_t) ( ( sector_index - first_sector_index ) * io_handle->bytes_per_sector );
 
-				goto on_error;
-			}
-			if( libfsclfs_log_range_initialize(
-			     &physical_log_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create physical log range.",
-				 function );
+		if( block_size > ( offset - block_offset ) )
+		{
+			result = 0;
 
-				goto on_error;
-			}
-			if( libfsclfs_log_range_initialize(
-			     &virtual_log_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create virtual log range.",
-				 function );
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     virtual_log_ranges_array,
+		     (int) stream_number,
+		     (intptr_t **) &virtual_full_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve virtual full log range: %" PRIu8 ".",
+			 function,
+			 stream_number );
 
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: stream: %02" PRIu8 " range\t: %02" PRIu8 " - %02" PRIu8 "\n",
-				 function,
-				 stream_number,
-				 first_block_sector_number,
-				 last_block_sector_number );
-
-				libcnotify_printf(
-				 "\t\t\t\t\t\t\t\t\t: physical: 0x%08" PRIx64 " - 0x%08" PRIx64 "\n",
-				 region_offset + ( first_sector * io_handle->bytes_per_sector ),
-				 region_offset + ( sector_index * io_handle->bytes_per_sector ) - 1 );
-			}
-#endif
-			if( virtual_full_log_range->current_lsn == 0 )
-			{
-				if( first_block_sector_number == 0 )
-				{
-					virtual_full_log_range->current_lsn = virtual_full_log_range->start_lsn;
-				}
-			}
-			if( virtual_full_log_range->current_lsn != 0 )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "\t\t\t\t\t\t\t\t\t: virtual:  0x%08" PRIx64 " - 0x%08" PRIx64 "\n",
-					 virtual_full_log_range->current_lsn,
-					 virtual_full_log_range->current_lsn + ( ( sector_index - first_sector ) * io_handle->bytes_per_sector ) - 1 );
-				}
-#endif
-				virtual_full_log_range->current_lsn = region_offset + ( sector_index * io_handle->bytes_per_sector );
-			}
-			stream_number             = sector_mapping_array_data[ 0 ];
-			first_block_sector_number = sector_mapping_array_data[ 1 ];
+			goto on_error;
+		}
+		if( virtual_full_log_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing virtual full log range: %" PRIu8 ".",
+			 function,
+			 stream_number );
 
-			first_sector = sector_index;
+			goto on_error;
+		}
+		/* A stream without a virtual log range has no blocks in the region
+		 * and the blocks of a stream must fit in its virtual log range
+		 */
+		if( ( ( virtual_full_log_range->start_lsn == 0 )
+		  &&  ( virtual_full_log_range->end_lsn == 0 ) )
+		 || ( virtual_full_log_range->current_lsn > virtual_full_log_range->end_lsn )
+		 || ( (uint64_t) block_size > ( virtual_full_log_range->end_lsn - virtual_full_log_range->current_lsn ) ) )
+		{
+			result = 0;
 
-			if( libcdata_array_append_entry(
-			     owner_page->physical_log_ranges_array,
-			     &entry_index,
-			     (intptr_t *) physical_log_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable append physical log range.",
-				 function );
+			break;
+		}
+		if( libfsclfs_log_range_initialize(
+		     &physical_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create physical log range.",
+			 function );
 
-				goto on_error;
-			}
-			physical_log_range = NULL;
+			goto on_error;
+		}
+		if( libfsclfs_log_range_initialize(
+		     &virtual_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create virtual log range.",
+			 function );
 
-			if( libcdata_array_append_entry(
-			     owner_page->virtual_log_ranges_array,
-			     &entry_index,
-			     (intptr_t *) virtual_log_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable append virtual log range.",
-				 function );
+			goto on_error;
+		}
+		physical_log_range->stream_number = 0;
+		physical_log_range->start_lsn     = block_offset;
+		physical_log_range->end_lsn       = (uint64_t) block_offset + block_size;
 
-				goto on_error;
-			}
-			virtual_log_range = NULL;
+		virtual_log_range->stream_number  = stream_number;
+		virtual_log_range->start_lsn      = virtual_full_log_range->current_lsn;
+		virtual_log_range->end_lsn        = virtual_full_log_range->current_lsn + block_size;
+
+		virtual_full_log_range->current_lsn += block_size;
 
-			new_log_range = 0;
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: physical log range: 0x%08" PRIx64 " - 0x%08" PRIx64 " stream: %02" PRIu8 " virtual log range: 0x%08" PRIx64 " - 0x%08" PRIx64 "\n",
+			 function,
+			 physical_log_range->start_lsn,
+			 physical_log_range->end_lsn,
+			 virtual_log_range->stream_number,
+			 virtual_log_range->start_lsn,
+			 virtual_log_range->end_lsn );
 		}
-		last_block_sector_number = sector_mapping_array_data[ 1 ];
+#endif
+		if( libcdata_array_append_entry(
+		     owner_page->physical_log_ranges_array,
+		     &entry_index,
+		     (intptr_t *) physical_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable append physical log range.",
+			 function );
 
-fprintf( stderr, "X: 0x%08" PRIx32 ": 0x%02" PRIx8 ", 0x%02" PRIx8 "\n",
- region_offset + ( sector_index * io_handle->bytes_per_sector ),
- sector_mapping_array_data[ 0 ], sector_mapping_array_data[ 1 ] );
+			goto on_error;
+		}
+		physical_log_range = NULL;
 
-		sector_index++;
+		if( libcdata_array_append_entry(
+		     owner_page->virtual_log_ranges_array,
+		     &entry_index,
+		     (intptr_t *) virtual_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable append virtual log range.",
+			 function );
 
-		sector_mapping_array_data      += 2;
-		sector_mapping_array_data_size -= 2;
+			goto on_error;
+		}
+		virtual_log_range = NULL;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: owner page range\t: 0x%08" PRIx64 " - 0x%08" PRIx64 "\n",
-		 function,
-		 region_offset + ( first_sector * io_handle->bytes_per_sector ),
-		 region_offset + ( sector_index * io_handle->bytes_per_sector ) - 1 );
-
 		libcnotify_printf(
 		 "\n" );
 	}
 #endif
-	/* TODO determine physical block offset */
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result == 0 )
 	{
-		libcnotify_printf(
-		 "\n" );
+		/* Remove the log ranges of an invalid sector mapping array
+		 * so that the region can be scanned instead
+		 */
+		if( libcdata_array_resize(
+		     owner_page->physical_log_ranges_array,
+		     0,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable resize physical log ranges array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_resize(
+		     owner_page->virtual_log_ranges_array,
+		     0,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable resize virtual log ranges array.",
+			 function );
+
+			goto on_error;
+		}
 	}
-#endif
-	return( 1 );
+	return( result );
 
 on_error:
 	libcdata_array_resize(
@@ -910,12 +1021,20 @@ int libfsclfs_owner_page_read_scan_region(
 	libfsclfs_log_range_t *physical_log_range = NULL;
 	libfsclfs_log_range_t *virtual_log_range  = NULL;
 	libfsclfs_block_t *block                  = NULL;
+	uint32_t *candidate_offsets               = NULL;
 	uint8_t *record_data                      = NULL;
+	uint8_t *region_data                      = NULL;
 	static char *function                     = "libfsclfs_owner_page_read";
 	size_t record_data_size                   = 0;
+	ssize_t read_count                        = 0;
 	uint64_t record_virtual_lsn               = 0;
 	uint32_t block_offset                     = 0;
+	uint32_t region_offset                    = 0;
+	int candidate_index                       = 0;
 	int entry_index                           = 0;
+	int maximum_number_of_candidates          = 0;
+	int number_of_candidates                  = 0;
+	int result                                = 0;
 
 	if( owner_page == NULL )
 	{
@@ -939,6 +1058,30 @@ int libfsclfs_owner_page_read_scan_region(
 
 		return( -1 );
 	}
+	if( ( io_handle->bytes_per_sector == 0 )
+	 || ( io_handle->region_owner_page_offset == 0 )
+	 || ( (size_t) io_handle->region_owner_page_offset > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - region owner page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < io_handle->region_owner_page_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfsclfs_block_initialize(
 	     &block,
 	     error ) != 1 )
@@ -952,17 +1095,131 @@ int libfsclfs_owner_page_read_scan_region(
 
 		goto on_error;
 	}
-	block_offset = offset - io_handle->region_owner_page_offset;
+	owner_page->is_sorted  = 0;
+	owner_page->is_scanned = 1;
 
-	while( block_offset < offset )
+	region_offset = offset - io_handle->region_owner_page_offset;
+
+	/* Read the blocks area of the region at once and scan it for block signatures
+	 * so that only the candidate offsets need to be read as a block
+	 */
+	region_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * io_handle->region_owner_page_offset );
+
+	if( region_data == NULL )
 	{
-/* TODO handle non-block data */
-		if( libfsclfs_block_read(
-		     block,
-		     io_handle,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create region data.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_candidates = (int) ( io_handle->region_owner_page_offset / io_handle->bytes_per_sector );
+
+	candidate_offsets = (uint32_t *) memory_allocate(
+	                                  sizeof( uint32_t ) * maximum_number_of_candidates );
+
+	if( candidate_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create candidate offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* A region at the end of a truncated container can be shorter than the blocks area
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              region_data,
+	              (size_t) io_handle->region_owner_page_offset,
+	              (off64_t) region_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read region data at offset: %" PRIu32 ".",
+		 function,
+		 region_offset );
+
+		goto on_error;
+	}
+	if( io_handle->statistics != NULL )
+	{
+		if( libfsclfs_statistics_add_read(
+		     io_handle->statistics,
 		     file_io_handle,
-		     block_offset,
+		     (size_t) read_count,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read to statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsclfs_block_scan_signatures(
+	     io_handle,
+	     region_data,
+	     (size_t) read_count,
+	     candidate_offsets,
+	     maximum_number_of_candidates,
+	     &number_of_candidates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan region data for block signatures.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 region_data );
+
+	region_data = NULL;
+
+	block_offset = region_offset;
+
+	while( block_offset < offset )
+	{
+		/* Skip to the next block signature candidate
+		 */
+		while( ( candidate_index < number_of_candidates )
+		    && ( ( region_offset + candidate_offsets[ candidate_index ] ) < block_offset ) )
+		{
+			candidate_index++;
+		}
+		if( candidate_index >= number_of_candidates )
+		{
+			break;
+		}
+		block_offset = region_offset + candidate_offsets[ candidate_index ];
+
+		result = libfsclfs_block_probe(
+		          block,
+		          io_handle,
+		          file_io_handle,
+		          block_offset,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -970,22 +1227,18 @@ int libfsclfs_owner_page_read_scan_region(
 			 LIBCERROR_IO_ERROR_READ_FAILED,
 			 "%s: unable to read block at offset: %" PRIu32 ".",
 			 function,
-			 offset );
+			 block_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( io_handle->statistics != NULL )
 			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
+				libfsclfs_statistics_counter_add(
+				 io_handle->statistics->number_of_failed_block_probes,
+				 1 );
 			}
-#endif
-			libcerror_error_free(
-			 error );
-
 			block_offset += io_handle->bytes_per_sector;
 
 			continue;
@@ -1139,6 +1392,9 @@ int libfsclfs_owner_page_read_scan_region(
 
 		goto on_error;
 	}
+	memory_free(
+	 candidate_offsets );
+
 	return( 1 );
 
 on_error:
@@ -1172,22 +1428,31 @@ on_error:
 		 &block,
 		 NULL );
 	}
+	if( candidate_offsets != NULL )
+	{
+		memory_free(
+		 candidate_offsets );
+	}
+	if( region_data != NULL )
+	{
+		memory_free(
+		 region_data );
+	}
 	return( -1 );
 }
 
-/* Retrieves the physical block offset for a certain virtual block LSN
- * Returns 1 if successful, 0 if no such virtual block LSN or -1 on error
+/* Moves the log ranges of a source owner page to the end of the owner page
+ * Returns 1 if successful or -1 on error
  */
-int libfsclfs_owner_page_get_physical_block_offset(
+int libfsclfs_owner_page_append_log_ranges(
      libfsclfs_owner_page_t *owner_page,
-     uint32_t container_logical_number,
-     uint32_t virtual_block_offset,
-     uint32_t *physical_block_offset,
+     libfsclfs_owner_page_t *source_owner_page,
      libcerror_error_t **error )
 {
 	libfsclfs_log_range_t *physical_log_range = NULL;
 	libfsclfs_log_range_t *virtual_log_range  = NULL;
-	static char *function                     = "libfsclfs_owner_page_get_physical_block_offset";
+	static char *function                     = "libfsclfs_owner_page_append_log_ranges";
+	int entry_index                           = 0;
 	int log_range_index                       = 0;
 	int number_of_physical_log_ranges         = 0;
 	int number_of_virtual_log_ranges          = 0;
@@ -1203,19 +1468,19 @@ int libfsclfs_owner_page_get_physical_block_offset(
 
 		return( -1 );
 	}
-	if( physical_block_offset == NULL )
+	if( source_owner_page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid physical block offset.",
+		 "%s: invalid source owner page.",
 		 function );
 
 		return( -1 );
 	}
 	if( libcdata_array_get_number_of_entries(
-	     owner_page->physical_log_ranges_array,
+	     source_owner_page->physical_log_ranges_array,
 	     &number_of_physical_log_ranges,
 	     error ) != 1 )
 	{
@@ -1223,13 +1488,13 @@ int libfsclfs_owner_page_get_physical_block_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of physical log ranges array entries.",
+		 "%s: unable to retrieve number of source physical log ranges array entries.",
 		 function );
 
 		return( -1 );
 	}
 	if( libcdata_array_get_number_of_entries(
-	     owner_page->virtual_log_ranges_array,
+	     source_owner_page->virtual_log_ranges_array,
 	     &number_of_virtual_log_ranges,
 	     error ) != 1 )
 	{
@@ -1237,7 +1502,7 @@ int libfsclfs_owner_page_get_physical_block_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of virtual log ranges array entries.",
+		 "%s: unable to retrieve number of source virtual log ranges array entries.",
 		 function );
 
 		return( -1 );
@@ -1248,7 +1513,7 @@ int libfsclfs_owner_page_get_physical_block_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: mismatch in number of physical and virtual log ranges.",
+		 "%s: mismatch in number of source physical and virtual log ranges.",
 		 function );
 
 		return( -1 );
@@ -1258,69 +1523,601 @@ int libfsclfs_owner_page_get_physical_block_offset(
 	     log_range_index++ )
 	{
 		if( libcdata_array_get_entry_by_index(
-		     owner_page->virtual_log_ranges_array,
+		     source_owner_page->physical_log_ranges_array,
 		     log_range_index,
-		     (intptr_t **) &virtual_log_range,
+		     (intptr_t **) &physical_log_range,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve virtual log range: %d.",
+			 "%s: unable to retrieve source physical log range: %d.",
 			 function,
 			 log_range_index );
 
 			return( -1 );
 		}
-		if( virtual_log_range == NULL )
+		if( libcdata_array_get_entry_by_index(
+		     source_owner_page->virtual_log_ranges_array,
+		     log_range_index,
+		     (intptr_t **) &virtual_log_range,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing virtual log range: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source virtual log range: %d.",
 			 function,
 			 log_range_index );
 
 			return( -1 );
 		}
-		if( ( (uint32_t) ( virtual_log_range->start_lsn >> 32 ) == container_logical_number )
-		 && ( (uint32_t) ( virtual_log_range->start_lsn & 0xffffffffUL ) == virtual_block_offset ) )
+		if( libcdata_array_append_entry(
+		     owner_page->physical_log_ranges_array,
+		     &entry_index,
+		     (intptr_t *) physical_log_range,
+		     error ) != 1 )
 		{
-			if( libcdata_array_get_entry_by_index(
-			     owner_page->physical_log_ranges_array,
-			     log_range_index,
-			     (intptr_t **) &physical_log_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve physical log range: %d.",
-				 function,
-				 log_range_index );
-
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable append physical log range.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     source_owner_page->physical_log_ranges_array,
+		     log_range_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set source physical log range: %d.",
+			 function,
+			 log_range_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_append_entry(
+		     owner_page->virtual_log_ranges_array,
+		     &entry_index,
+		     (intptr_t *) virtual_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable append virtual log range.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     source_owner_page->virtual_log_ranges_array,
+		     log_range_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set source virtual log range: %d.",
+			 function,
+			 log_range_index );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_empty(
+	     source_owner_page->physical_log_ranges_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty source physical log ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     source_owner_page->virtual_log_ranges_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty source virtual log ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	owner_page->is_sorted = 0;
+
+	return( 1 );
+}
+
+/* Compares two log range pairs by their virtual LSN
+ * Returns a negative value, 0 or a positive value, like qsort expects
+ */
+static int libfsclfs_owner_page_compare_log_range_pairs(
+            const void *first_value,
+            const void *second_value )
+{
+	const libfsclfs_owner_page_log_range_pair_t *first_pair  = NULL;
+	const libfsclfs_owner_page_log_range_pair_t *second_pair = NULL;
+
+	first_pair  = (const libfsclfs_owner_page_log_range_pair_t *) first_value;
+	second_pair = (const libfsclfs_owner_page_log_range_pair_t *) second_value;
+
+	if( first_pair->virtual_log_range->start_lsn < second_pair->virtual_log_range->start_lsn )
+	{
+		return( -1 );
+	}
+	if( first_pair->virtual_log_range->start_lsn > second_pair->virtual_log_range->start_lsn )
+	{
+		return( 1 );
+	}
+	/* Use the physical LSN to make the order deterministic
+	 */
+	if( first_pair->physical_log_range->start_lsn < second_pair->physical_log_range->start_lsn )
+	{
+		return( -1 );
+	}
+	if( first_pair->physical_log_range->start_lsn > second_pair->physical_log_range->start_lsn )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the log ranges by virtual LSN
+ * The physical log ranges are kept at the same index as their virtual log range
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_owner_page_sort_log_ranges(
+     libfsclfs_owner_page_t *owner_page,
+     libcerror_error_t **error )
+{
+	libfsclfs_owner_page_log_range_pair_t *log_range_pairs = NULL;
+	static char *function                                  = "libfsclfs_owner_page_sort_log_ranges";
+	int log_range_index                                    = 0;
+	int number_of_physical_log_ranges                      = 0;
+	int number_of_virtual_log_ranges                       = 0;
+
+	if( owner_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     owner_page->physical_log_ranges_array,
+	     &number_of_physical_log_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical log ranges array entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     owner_page->virtual_log_ranges_array,
+	     &number_of_virtual_log_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of virtual log ranges array entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_physical_log_ranges != number_of_virtual_log_ranges )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in number of physical and virtual log ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_virtual_log_ranges > 1 )
+	{
+		if( (size_t) number_of_virtual_log_ranges > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_owner_page_log_range_pair_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of log ranges value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		log_range_pairs = (libfsclfs_owner_page_log_range_pair_t *) memory_allocate(
+		                   sizeof( libfsclfs_owner_page_log_range_pair_t ) * number_of_virtual_log_ranges );
+
+		if( log_range_pairs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create log range pairs.",
+			 function );
+
+			goto on_error;
+		}
+		for( log_range_index = 0;
+		     log_range_index < number_of_virtual_log_ranges;
+		     log_range_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     owner_page->physical_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &( log_range_pairs[ log_range_index ].physical_log_range ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical log range: %d.",
+				 function,
+				 log_range_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     owner_page->virtual_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &( log_range_pairs[ log_range_index ].virtual_log_range ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve virtual log range: %d.",
+				 function,
+				 log_range_index );
+
+				goto on_error;
+			}
+			if( ( log_range_pairs[ log_range_index ].physical_log_range == NULL )
+			 || ( log_range_pairs[ log_range_index ].virtual_log_range == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing log range: %d.",
+				 function,
+				 log_range_index );
+
+				goto on_error;
+			}
+		}
+		qsort(
+		 log_range_pairs,
+		 (size_t) number_of_virtual_log_ranges,
+		 sizeof( libfsclfs_owner_page_log_range_pair_t ),
+		 &libfsclfs_owner_page_compare_log_range_pairs );
+
+		for( log_range_index = 0;
+		     log_range_index < number_of_virtual_log_ranges;
+		     log_range_index++ )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     owner_page->physical_log_ranges_array,
+			     log_range_index,
+			     (intptr_t *) log_range_pairs[ log_range_index ].physical_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set physical log range: %d.",
+				 function,
+				 log_range_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     owner_page->virtual_log_ranges_array,
+			     log_range_index,
+			     (intptr_t *) log_range_pairs[ log_range_index ].virtual_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set virtual log range: %d.",
+				 function,
+				 log_range_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 log_range_pairs );
+	}
+	owner_page->is_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( log_range_pairs != NULL )
+	{
+		memory_free(
+		 log_range_pairs );
+	}
+	return( -1 );
+}
+
+/* Retrieves the physical block offset for a certain virtual block LSN
+ * Returns 1 if successful, 0 if no such virtual block LSN or -1 on error
+ */
+int libfsclfs_owner_page_get_physical_block_offset(
+     libfsclfs_owner_page_t *owner_page,
+     uint32_t container_logical_number,
+     uint32_t virtual_block_offset,
+     uint32_t *physical_block_offset,
+     libcerror_error_t **error )
+{
+	libfsclfs_log_range_t *physical_log_range = NULL;
+	libfsclfs_log_range_t *virtual_log_range  = NULL;
+	static char *function                     = "libfsclfs_owner_page_get_physical_block_offset";
+	uint64_t virtual_lsn                      = 0;
+	int log_range_index                       = 0;
+	int lower_log_range_index                 = 0;
+	int number_of_physical_log_ranges         = 0;
+	int number_of_virtual_log_ranges          = 0;
+	int upper_log_range_index                 = 0;
+
+	if( owner_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner page.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_block_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical block offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     owner_page->physical_log_ranges_array,
+	     &number_of_physical_log_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical log ranges array entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     owner_page->virtual_log_ranges_array,
+	     &number_of_virtual_log_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of virtual log ranges array entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_physical_log_ranges != number_of_virtual_log_ranges )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in number of physical and virtual log ranges.",
+		 function );
+
+		return( -1 );
+	}
+	virtual_lsn = ( (uint64_t) container_logical_number << 32 ) | virtual_block_offset;
+
+	if( owner_page->is_sorted != 0 )
+	{
+		/* Search for the first virtual log range that does not start before the virtual LSN
+		 */
+		lower_log_range_index = 0;
+		upper_log_range_index = number_of_virtual_log_ranges;
+
+		while( lower_log_range_index < upper_log_range_index )
+		{
+			log_range_index = lower_log_range_index
+			                + ( ( upper_log_range_index - lower_log_range_index ) / 2 );
+
+			if( libcdata_array_get_entry_by_index(
+			     owner_page->virtual_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &virtual_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve virtual log range: %d.",
+				 function,
+				 log_range_index );
+
 				return( -1 );
 			}
-			if( physical_log_range == NULL )
+			if( virtual_log_range == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing physical log range: %d.",
+				 "%s: missing virtual log range: %d.",
 				 function,
 				 log_range_index );
 
 				return( -1 );
 			}
-			*physical_block_offset = (uint32_t) ( physical_log_range->start_lsn & 0xffffffffUL );
+			if( virtual_log_range->start_lsn < virtual_lsn )
+			{
+				lower_log_range_index = log_range_index + 1;
+			}
+			else
+			{
+				upper_log_range_index = log_range_index;
+			}
+		}
+		log_range_index = lower_log_range_index;
+
+		if( log_range_index >= number_of_virtual_log_ranges )
+		{
+			return( 0 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     owner_page->virtual_log_ranges_array,
+		     log_range_index,
+		     (intptr_t **) &virtual_log_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve virtual log range: %d.",
+			 function,
+			 log_range_index );
 
-			return( 1 );
+			return( -1 );
+		}
+		if( ( virtual_log_range == NULL )
+		 || ( virtual_log_range->start_lsn != virtual_lsn ) )
+		{
+			return( 0 );
 		}
 	}
-	return( 0 );
+	else
+	{
+		for( log_range_index = 0;
+		     log_range_index < number_of_virtual_log_ranges;
+		     log_range_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     owner_page->virtual_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &virtual_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve virtual log range: %d.",
+				 function,
+				 log_range_index );
+
+				return( -1 );
+			}
+			if( virtual_log_range == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing virtual log range: %d.",
+				 function,
+				 log_range_index );
+
+				return( -1 );
+			}
+			if( virtual_log_range->start_lsn == virtual_lsn )
+			{
+				break;
+			}
+		}
+		if( log_range_index >= number_of_virtual_log_ranges )
+		{
+			return( 0 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     owner_page->physical_log_ranges_array,
+	     log_range_index,
+	     (intptr_t **) &physical_log_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical log range: %d.",
+		 function,
+		 log_range_index );
+
+		return( -1 );
+	}
+	if( physical_log_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing physical log range: %d.",
+		 function,
+		 log_range_index );
+
+		return( -1 );
+	}
+	*physical_block_offset = (uint32_t) ( physical_log_range->start_lsn & 0xffffffffUL );
+
+	return( 1 );
 }
 
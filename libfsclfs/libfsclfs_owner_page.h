@@ -29,11 +29,25 @@
 #include "libfsclfs_libbfio.h"
 #include "libfsclfs_libcdata.h"
 #include "libfsclfs_libcerror.h"
+#include "libfsclfs_log_range.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libfsclfs_owner_page_log_range_pair libfsclfs_owner_page_log_range_pair_t;
+
+struct libfsclfs_owner_page_log_range_pair
+{
+	/* The physical log range
+	 */
+	libfsclfs_log_range_t *physical_log_range;
+
+	/* The virtual log range
+	 */
+	libfsclfs_log_range_t *virtual_log_range;
+};
+
 typedef struct libfsclfs_owner_page libfsclfs_owner_page_t;
 
 struct libfsclfs_owner_page
@@ -45,6 +59,14 @@ struct libfsclfs_owner_page
 	/* The virtual log ranges array
 	 */
 	libcdata_array_t *virtual_log_ranges_array;
+
+	/* Value to indicate the log ranges are sorted by virtual LSN
+	 */
+	uint8_t is_sorted;
+
+	/* Value to indicate the log ranges were determined by scanning the region
+	 */
+	uint8_t is_scanned;
 };
 
 int libfsclfs_owner_page_initialize(
@@ -89,6 +111,15 @@ int libfsclfs_owner_page_read_scan_region(
      uint32_t offset,
      libcerror_error_t **error );
 
+int libfsclfs_owner_page_append_log_ranges(
+     libfsclfs_owner_page_t *owner_page,
+     libfsclfs_owner_page_t *source_owner_page,
+     libcerror_error_t **error );
+
+int libfsclfs_owner_page_sort_log_ranges(
+     libfsclfs_owner_page_t *owner_page,
+     libcerror_error_t **error );
+
 int libfsclfs_owner_page_get_physical_block_offset(
      libfsclfs_owner_page_t *owner_page,
      uint32_t container_logical_number,
@@ -33,6 +33,7 @@
 
 /* Creates a record
  * Make sure the value record is referencing, is set to NULL
+ * The internal stream is NULL for a record that was carved without a store
  * Returns 1 if successful or -1 on error
  */
 int libfsclfs_record_initialize(
@@ -67,17 +68,6 @@ int libfsclfs_record_initialize(
 
 		return( -1 );
 	}
-	if( internal_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal stream.",
-		 function );
-
-		return( -1 );
-	}
 	if( ( flags & ~( LIBFSCLFS_RECORD_FLAG_IO_HANDLE_MANAGED ) ) != 0 )
 	{
 		libcerror_error_set(
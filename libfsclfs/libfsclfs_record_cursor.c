@@ -0,0 +1,649 @@
+/*
+ * Record cursor functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_block.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_cursor.h"
+#include "libfsclfs_record_value.h"
+#include "libfsclfs_store.h"
+#include "libfsclfs_stream.h"
+#include "libfsclfs_stream_descriptor.h"
+#include "libfsclfs_types.h"
+
+/* Creates a record cursor
+ * Make sure the value record_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_initialize(
+     libfsclfs_record_cursor_t **record_cursor,
+     libfsclfs_internal_stream_t *internal_stream,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_initialize";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal stream - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = memory_allocate_structure(
+	                          libfsclfs_internal_record_cursor_t );
+
+	if( internal_record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_cursor,
+	     0,
+	     sizeof( libfsclfs_internal_record_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record cursor.",
+		 function );
+
+		memory_free(
+		 internal_record_cursor );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &( internal_record_cursor->block ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_record_value_initialize(
+	     &( internal_record_cursor->record_value ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_cursor->internal_stream = internal_stream;
+
+	*record_cursor = (libfsclfs_record_cursor_t *) internal_record_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_cursor != NULL )
+	{
+		if( internal_record_cursor->block != NULL )
+		{
+			libfsclfs_block_free(
+			 &( internal_record_cursor->block ),
+			 NULL );
+		}
+		memory_free(
+		 internal_record_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a record cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_free(
+     libfsclfs_record_cursor_t **record_cursor,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_free";
+	int result                                                 = 1;
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_cursor != NULL )
+	{
+		internal_record_cursor = (libfsclfs_internal_record_cursor_t *) *record_cursor;
+		*record_cursor         = NULL;
+
+		/* The internal_stream reference is freed elsewhere
+		 */
+		if( libfsclfs_record_value_free(
+		     &( internal_record_cursor->record_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record value.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsclfs_block_free(
+		     &( internal_record_cursor->block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_record_cursor );
+	}
+	return( result );
+}
+
+/* Reads a specific record into the record cursor using its LSN
+ * The block and record data of a previous read are reused and only
+ * reallocated when they grow, data retrieved from the record cursor
+ * is only valid until the next read
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsclfs_record_cursor_read_record_by_lsn(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint64_t record_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_read_record_by_lsn";
+	uint32_t block_offset                                      = 0;
+	uint32_t container_logical_number                          = 0;
+	uint16_t record_number                                     = 0;
+	int result                                                 = 0;
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_cursor->internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == (uint64_t) 0xffffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record LSN.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor->has_record = 0;
+
+	if( record_lsn == 0 )
+	{
+		return( 0 );
+	}
+	block_offset             = (uint32_t) ( record_lsn & 0xfffffe00UL );
+	container_logical_number = (uint32_t) ( record_lsn >> 32 );
+	record_number            = (uint16_t) ( record_lsn & 0x01ff );
+
+	result = libfsclfs_store_fill_record_value_by_logical_lsn(
+	          internal_record_cursor->internal_stream->internal_store,
+	          internal_record_cursor->internal_stream->stream_descriptor->number,
+	          container_logical_number,
+	          block_offset,
+	          record_number,
+	          internal_record_cursor->block,
+	          internal_record_cursor->record_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read logical LSN: %" PRIx32 ".%" PRIx32 ".%" PRIx32 ".",
+		 function,
+		 container_logical_number,
+		 block_offset,
+		 record_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_record_cursor->record_lsn = record_lsn;
+		internal_record_cursor->has_record = 1;
+	}
+	return( result );
+}
+
+/* Retrieves the LSN of the record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_get_lsn(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint64_t *record_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_get_lsn";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->has_record == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record LSN.",
+		 function );
+
+		return( -1 );
+	}
+	*record_lsn = internal_record_cursor->record_lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the record type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_get_type(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint32_t *record_type,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_get_type";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->has_record == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_get_type(
+	     internal_record_cursor->record_value,
+	     record_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record type from record value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the record flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_get_flags(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint16_t *record_flags,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_get_flags";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->has_record == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_get_flags(
+	     internal_record_cursor->record_value,
+	     record_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record flags from record value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the previous log sequence number (LSN)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_get_previous_lsn(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_get_previous_lsn";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->has_record == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_get_previous_lsn(
+	     internal_record_cursor->record_value,
+	     previous_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous LSN from record value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the undo-next log sequence number (LSN)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_get_undo_next_lsn(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint64_t *undo_next_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_get_undo_next_lsn";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->has_record == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_get_undo_next_lsn(
+	     internal_record_cursor->record_value,
+	     undo_next_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve undo-next LSN from record value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the record data
+ * The data is owned by the record cursor and only valid until the next read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_cursor_get_data(
+     libfsclfs_record_cursor_t *record_cursor,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	static char *function                                      = "libfsclfs_record_cursor_get_data";
+
+	if( record_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	if( internal_record_cursor->has_record == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record cursor - missing record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_get_data(
+	     internal_record_cursor->record_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data from record value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,1691 @@
+/*
+ * Record fetcher functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcnotify.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_record.h"
+#include "libfsclfs_record_fetcher.h"
+#include "libfsclfs_record_value.h"
+#include "libfsclfs_statistics.h"
+#include "libfsclfs_store.h"
+#include "libfsclfs_stream.h"
+#include "libfsclfs_types.h"
+#include "libfsclfs_unused.h"
+
+/* Creates a record fetcher
+ * Make sure the value record_fetcher is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_initialize(
+     libfsclfs_record_fetcher_t **record_fetcher,
+     libfsclfs_internal_stream_t *internal_stream,
+     void (*callback)(
+            uint64_t record_lsn,
+            int result,
+            libfsclfs_record_t *record,
+            libcerror_error_t *error,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_fetcher_t *internal_record_fetcher = NULL;
+	static char *function                                        = "libfsclfs_record_fetcher_initialize";
+
+	if( record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_fetcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record fetcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal stream - missing internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_fetcher = memory_allocate_structure(
+	                           libfsclfs_internal_record_fetcher_t );
+
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record fetcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_fetcher,
+	     0,
+	     sizeof( libfsclfs_internal_record_fetcher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record fetcher.",
+		 function );
+
+		memory_free(
+		 internal_record_fetcher );
+
+		return( -1 );
+	}
+	internal_record_fetcher->internal_stream = internal_stream;
+	internal_record_fetcher->callback        = callback;
+	internal_record_fetcher->callback_data   = callback_data;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_record_fetcher->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_record_fetcher->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_record_fetcher->file_io_pool_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every thread of the thread pool reads using its own worker
+	 */
+	internal_record_fetcher->number_of_workers = internal_stream->internal_store->number_of_threads;
+
+	if( ( internal_record_fetcher->number_of_workers <= 0 )
+	 || ( internal_record_fetcher->number_of_workers > LIBFSCLFS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid internal stream - internal store number of threads value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_fetcher->workers = (libfsclfs_record_fetcher_worker_t *) memory_allocate(
+	                                    sizeof( libfsclfs_record_fetcher_worker_t ) * internal_record_fetcher->number_of_workers );
+
+	if( internal_record_fetcher->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_fetcher->workers,
+	     0,
+	     sizeof( libfsclfs_record_fetcher_worker_t ) * internal_record_fetcher->number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( internal_record_fetcher->thread_pool ),
+	     NULL,
+	     internal_record_fetcher->number_of_workers,
+	     LIBFSCLFS_RECORD_FETCHER_MAXIMUM_NUMBER_OF_REQUESTS,
+	     (int (*)(intptr_t *, void *)) &libfsclfs_record_fetcher_request_callback,
+	     (void *) internal_record_fetcher,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*record_fetcher = (libfsclfs_record_fetcher_t *) internal_record_fetcher;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_fetcher != NULL )
+	{
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( internal_record_fetcher->workers != NULL )
+		{
+			memory_free(
+			 internal_record_fetcher->workers );
+		}
+		if( internal_record_fetcher->file_io_pool_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_record_fetcher->file_io_pool_mutex ),
+			 NULL );
+		}
+		if( internal_record_fetcher->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_record_fetcher->condition ),
+			 NULL );
+		}
+		if( internal_record_fetcher->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_record_fetcher->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_record_fetcher );
+	}
+	return( -1 );
+}
+
+/* Frees a record fetcher
+ * Waits for the outstanding requests to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_free(
+     libfsclfs_record_fetcher_t **record_fetcher,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_fetcher_t *internal_record_fetcher = NULL;
+	static char *function                                        = "libfsclfs_record_fetcher_free";
+	int result                                                   = 1;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	int worker_index                                             = 0;
+#endif
+
+	if( record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_fetcher != NULL )
+	{
+		internal_record_fetcher = (libfsclfs_internal_record_fetcher_t *) *record_fetcher;
+		*record_fetcher         = NULL;
+
+		/* The internal_stream reference is freed elsewhere
+		 */
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( internal_record_fetcher->thread_pool != NULL )
+		{
+			/* Joining the thread pool completes the requests that are still queued
+			 */
+			if( libcthreads_thread_pool_join(
+			     &( internal_record_fetcher->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record_fetcher->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < internal_record_fetcher->number_of_workers;
+			     worker_index++ )
+			{
+				if( libfsclfs_record_fetcher_free_worker_file_io_handles(
+				     internal_record_fetcher,
+				     &( internal_record_fetcher->workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d file IO handles.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 internal_record_fetcher->workers );
+		}
+		if( libcthreads_condition_free(
+		     &( internal_record_fetcher->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_record_fetcher->file_io_pool_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_record_fetcher->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_record_fetcher );
+	}
+	return( result );
+}
+
+/* Submits a request to fetch a specific record by its LSN
+ * The completion callback is called from the worker thread once the record was read.
+ * Without multi-thread support the record is read and the completion callback is
+ * called before this function returns
+ * Returns 1 if successful, 0 if the maximum number of outstanding requests was reached or -1 on error
+ */
+int libfsclfs_record_fetcher_submit(
+     libfsclfs_record_fetcher_t *record_fetcher,
+     uint64_t record_lsn,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	libfsclfs_record_fetcher_request_t *request                = NULL;
+#endif
+	libfsclfs_internal_record_fetcher_t *internal_record_fetcher = NULL;
+	static char *function                                        = "libfsclfs_record_fetcher_submit";
+
+	if( record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_fetcher = (libfsclfs_internal_record_fetcher_t *) record_fetcher;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_fetcher->number_of_outstanding_requests >= LIBFSCLFS_RECORD_FETCHER_MAXIMUM_NUMBER_OF_REQUESTS )
+	{
+		libcthreads_mutex_release(
+		 internal_record_fetcher->mutex,
+		 NULL );
+
+		return( 0 );
+	}
+	internal_record_fetcher->number_of_outstanding_requests += 1;
+
+	if( libcthreads_mutex_release(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	request = memory_allocate_structure(
+	           libfsclfs_record_fetcher_request_t );
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create request.",
+		 function );
+
+		goto on_error;
+	}
+	request->internal_record_fetcher = internal_record_fetcher;
+	request->record_lsn              = record_lsn;
+
+	if( libcthreads_thread_pool_push(
+	     internal_record_fetcher->thread_pool,
+	     (intptr_t *) request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push request onto thread pool queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( request != NULL )
+	{
+		memory_free(
+		 request );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_record_fetcher->mutex,
+	     NULL ) == 1 )
+	{
+		internal_record_fetcher->number_of_outstanding_requests -= 1;
+
+		libcthreads_mutex_release(
+		 internal_record_fetcher->mutex,
+		 NULL );
+	}
+	return( -1 );
+#else
+	if( libfsclfs_record_fetcher_fetch_record(
+	     internal_record_fetcher,
+	     -1,
+	     record_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to fetch record: 0x%08" PRIx64 ".",
+		 function,
+		 record_lsn );
+
+		return( -1 );
+	}
+	return( 1 );
+#endif
+}
+
+/* Waits until the outstanding requests have completed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_wait(
+     libfsclfs_record_fetcher_t *record_fetcher,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_fetcher_t *internal_record_fetcher = NULL;
+	static char *function                                        = "libfsclfs_record_fetcher_wait";
+
+	if( record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_fetcher = (libfsclfs_internal_record_fetcher_t *) record_fetcher;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_record_fetcher->number_of_outstanding_requests > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     internal_record_fetcher->condition,
+		     internal_record_fetcher->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 internal_record_fetcher->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of outstanding requests
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_get_number_of_outstanding_requests(
+     libfsclfs_record_fetcher_t *record_fetcher,
+     int *number_of_outstanding_requests,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_fetcher_t *internal_record_fetcher = NULL;
+	static char *function                                        = "libfsclfs_record_fetcher_get_number_of_outstanding_requests";
+
+	if( record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_fetcher = (libfsclfs_internal_record_fetcher_t *) record_fetcher;
+
+	if( number_of_outstanding_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of outstanding requests.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_outstanding_requests = internal_record_fetcher->number_of_outstanding_requests;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Fetches a specific record by its LSN and calls the completion callback
+ * The record is read using the container file IO handles of the worker
+ * or of the store if the worker index is -1
+ * A failed lookup is reported to the completion callback, together with its error, and not as an error
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_fetch_record(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int worker_index,
+     uint64_t record_lsn,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *lookup_error = NULL;
+	libfsclfs_record_t *record      = NULL;
+	static char *function           = "libfsclfs_record_fetcher_fetch_record";
+	int result                      = 0;
+
+#if !defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	LIBFSCLFS_UNREFERENCED_PARAMETER( worker_index )
+#endif
+
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_fetcher->callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - missing callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( worker_index != -1 )
+	{
+		result = libfsclfs_record_fetcher_read_record(
+		          internal_record_fetcher,
+		          worker_index,
+		          record_lsn,
+		          &record,
+		          &lookup_error );
+	}
+	else
+#endif
+	{
+		result = libfsclfs_stream_get_record_by_lsn(
+		          (libfsclfs_stream_t *) internal_record_fetcher->internal_stream,
+		          record_lsn,
+		          &record,
+		          &lookup_error );
+	}
+
+	if( result == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to retrieve record: 0x%08" PRIx64 ".\n",
+			 function,
+			 record_lsn );
+
+			libcnotify_print_error_backtrace(
+			 lookup_error );
+		}
+#endif
+		if( record != NULL )
+		{
+			libfsclfs_record_free(
+			 &record,
+			 NULL );
+		}
+	}
+	/* The record is owned by the callback function
+	 */
+	internal_record_fetcher->callback(
+	 record_lsn,
+	 result,
+	 record,
+	 lookup_error,
+	 internal_record_fetcher->callback_data );
+
+	if( lookup_error != NULL )
+	{
+		libcerror_error_free(
+		 &lookup_error );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+/* Frees the container file IO handles of a worker
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_free_worker_file_io_handles(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     libfsclfs_record_fetcher_worker_t *worker,
+     libcerror_error_t **error )
+{
+	libfsclfs_io_handle_t *io_handle = NULL;
+	static char *function            = "libfsclfs_record_fetcher_free_worker_file_io_handles";
+	int file_io_handle_index         = 0;
+	int result                       = 1;
+
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record_fetcher->internal_stream != NULL )
+	 && ( internal_record_fetcher->internal_stream->internal_store != NULL ) )
+	{
+		io_handle = internal_record_fetcher->internal_stream->internal_store->io_handle;
+	}
+	if( worker->container_file_io_handles != NULL )
+	{
+		for( file_io_handle_index = 0;
+		     file_io_handle_index < worker->number_of_container_file_io_handles;
+		     file_io_handle_index++ )
+		{
+			if( worker->container_file_io_handles[ file_io_handle_index ] == NULL )
+			{
+				continue;
+			}
+			if( ( io_handle != NULL )
+			 && ( io_handle->statistics != NULL ) )
+			{
+				if( libfsclfs_statistics_remove_file_io_handle_clone(
+				     io_handle->statistics,
+				     worker->container_file_io_handles[ file_io_handle_index ],
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove container file IO handle: %d from statistics.",
+					 function,
+					 file_io_handle_index );
+
+					result = -1;
+				}
+			}
+			if( libbfio_handle_close(
+			     worker->container_file_io_handles[ file_io_handle_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close container file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( worker->container_file_io_handles[ file_io_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free container file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 worker->container_file_io_handles );
+
+		worker->container_file_io_handles = NULL;
+	}
+	worker->number_of_container_file_io_handles = 0;
+
+	return( result );
+}
+
+/* Retrieves the container file IO handle of a specific worker
+ * The file IO handle is cloned from the container file IO handle of the store on first use
+ * Only the worker itself should retrieve its file IO handles
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsclfs_record_fetcher_get_worker_file_io_handle(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int worker_index,
+     uint32_t container_physical_number,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t **container_file_io_handles = NULL;
+	libbfio_handle_t *source_file_io_handle      = NULL;
+	libbfio_handle_t *worker_file_io_handle      = NULL;
+	libfsclfs_internal_store_t *internal_store   = NULL;
+	libfsclfs_record_fetcher_worker_t *worker    = NULL;
+	static char *function                        = "libfsclfs_record_fetcher_get_worker_file_io_handle";
+	int number_of_file_io_handles                = 0;
+	int result                                   = 0;
+
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_fetcher->internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - missing internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = internal_record_fetcher->internal_stream->internal_store;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - invalid internal stream - missing internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_fetcher->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= internal_record_fetcher->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle = NULL;
+
+	if( internal_store->container_file_io_pool == NULL )
+	{
+		return( 0 );
+	}
+	worker = &( internal_record_fetcher->workers[ worker_index ] );
+
+	/* The container file IO pool of the store grows when containers are added
+	 */
+	if( container_physical_number >= (uint32_t) worker->number_of_container_file_io_handles )
+	{
+		/* The container file IO pool is shared by all the workers
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_record_fetcher->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO pool mutex.",
+			 function );
+
+			return( -1 );
+		}
+		result = libbfio_pool_get_number_of_handles(
+		          internal_store->container_file_io_pool,
+		          &number_of_file_io_handles,
+		          error );
+
+		if( libcthreads_mutex_release(
+		     internal_record_fetcher->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO pool mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of handles in container file IO pool.",
+			 function );
+
+			return( -1 );
+		}
+		if( container_physical_number >= (uint32_t) number_of_file_io_handles )
+		{
+			return( 0 );
+		}
+		container_file_io_handles = (libbfio_handle_t **) memory_reallocate(
+		                                                   worker->container_file_io_handles,
+		                                                   sizeof( libbfio_handle_t * ) * number_of_file_io_handles );
+
+		if( container_file_io_handles == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize worker: %d container file IO handles.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     &( container_file_io_handles[ worker->number_of_container_file_io_handles ] ),
+		     0,
+		     sizeof( libbfio_handle_t * ) * ( number_of_file_io_handles - worker->number_of_container_file_io_handles ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear worker: %d container file IO handles.",
+			 function,
+			 worker_index );
+
+			worker->container_file_io_handles = container_file_io_handles;
+
+			return( -1 );
+		}
+		worker->container_file_io_handles           = container_file_io_handles;
+		worker->number_of_container_file_io_handles = number_of_file_io_handles;
+	}
+	if( worker->container_file_io_handles[ container_physical_number ] == NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_record_fetcher->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO pool mutex.",
+			 function );
+
+			return( -1 );
+		}
+		result = libbfio_pool_get_handle(
+		          internal_store->container_file_io_pool,
+		          (int) container_physical_number,
+		          &source_file_io_handle,
+		          error );
+
+		if( ( result == 1 )
+		 && ( source_file_io_handle != NULL ) )
+		{
+			result = libbfio_handle_clone(
+			          &worker_file_io_handle,
+			          source_file_io_handle,
+			          error );
+		}
+		if( libcthreads_mutex_release(
+		     internal_record_fetcher->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO pool mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d container file IO handle: %" PRIu32 ".",
+			 function,
+			 worker_index,
+			 container_physical_number );
+
+			goto on_error;
+		}
+		if( source_file_io_handle == NULL )
+		{
+			return( 0 );
+		}
+		result = libbfio_handle_is_open(
+		          worker_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if worker: %d container file IO handle: %" PRIu32 " is open.",
+			 function,
+			 worker_index,
+			 container_physical_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     worker_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open worker: %d container file IO handle: %" PRIu32 ".",
+				 function,
+				 worker_index,
+				 container_physical_number );
+
+				goto on_error;
+			}
+		}
+		if( ( internal_store->io_handle != NULL )
+		 && ( internal_store->io_handle->statistics != NULL ) )
+		{
+			if( libfsclfs_statistics_add_file_io_handle_clone(
+			     internal_store->io_handle->statistics,
+			     source_file_io_handle,
+			     worker_file_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add worker: %d container file IO handle: %" PRIu32 " to statistics.",
+				 function,
+				 worker_index,
+				 container_physical_number );
+
+				goto on_error;
+			}
+		}
+		worker->container_file_io_handles[ container_physical_number ] = worker_file_io_handle;
+	}
+	*file_io_handle = worker->container_file_io_handles[ container_physical_number ];
+
+	return( 1 );
+
+on_error:
+	if( worker_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &worker_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a specific record by its LSN using the container file IO handles of a worker
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfsclfs_record_fetcher_read_record(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int worker_index,
+     uint64_t record_lsn,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *container_file_io_handle   = NULL;
+	libfsclfs_internal_stream_t *internal_stream = NULL;
+	libfsclfs_record_value_t *record_value       = NULL;
+	static char *function                        = "libfsclfs_record_fetcher_read_record";
+	uint64_t previous_lsn                        = 0;
+	uint32_t block_offset                        = 0;
+	uint32_t container_logical_number            = 0;
+	uint32_t container_physical_number           = 0;
+	uint32_t physical_block_offset               = 0;
+	uint16_t record_number                       = 0;
+	int result                                   = 0;
+
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = internal_record_fetcher->internal_stream;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - missing internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - invalid internal stream - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == (uint64_t) 0xffffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == 0 )
+	{
+		return( 0 );
+	}
+	block_offset             = (uint32_t) ( record_lsn & 0xfffffe00UL );
+	container_logical_number = (uint32_t) ( record_lsn >> 32 );
+	record_number            = (uint16_t) ( record_lsn & 0x01ff );
+
+	result = libfsclfs_store_get_container_physical_number(
+	          internal_stream->internal_store,
+	          container_logical_number,
+	          &container_physical_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container physical number.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+		          internal_record_fetcher,
+		          worker_index,
+		          container_physical_number,
+		          &container_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve worker: %d container file IO handle: %" PRIu32 ".",
+			 function,
+			 worker_index,
+			 container_physical_number );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libfsclfs_store_get_physical_block_offset(
+		          internal_stream->internal_store,
+		          internal_stream->stream_descriptor->number,
+		          container_physical_number,
+		          container_logical_number,
+		          block_offset,
+		          container_file_io_handle,
+		          &physical_block_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical block offset.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libfsclfs_block_read_record_value(
+		     internal_stream->internal_store,
+		     container_file_io_handle,
+		     physical_block_offset,
+		     record_number,
+		     NULL,
+		     &record_value,
+		     &previous_lsn,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block record value: %" PRIu16 ".",
+			 function,
+			 record_number );
+
+			goto on_error;
+		}
+		if( record_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsclfs_record_initialize(
+		     record,
+		     internal_stream,
+		     record_value,
+		     LIBFSCLFS_RECORD_FLAGS_DEFAULT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Acquires a worker that is not fetching a record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_acquire_worker(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int *worker_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsclfs_record_fetcher_acquire_worker";
+	int available_worker_index = -1;
+	int index                  = 0;
+
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_fetcher->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record fetcher - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( index = 0;
+	     index < internal_record_fetcher->number_of_workers;
+	     index++ )
+	{
+		if( internal_record_fetcher->workers[ index ].is_busy == 0 )
+		{
+			internal_record_fetcher->workers[ index ].is_busy = 1;
+
+			available_worker_index = index;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_record_fetcher->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The thread pool runs at most one request per worker at the same time
+	 */
+	if( available_worker_index == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing available worker.",
+		 function );
+
+		return( -1 );
+	}
+	*worker_index = available_worker_index;
+
+	return( 1 );
+}
+
+/* Callback function to fetch a record of a request in a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_fetcher_request_callback(
+     libfsclfs_record_fetcher_request_t *request,
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfsclfs_record_fetcher_request_callback";
+	int result               = 1;
+	int worker_index         = -1;
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_record_fetcher == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record fetcher.",
+		 function );
+
+		memory_free(
+		 request );
+
+		goto on_error;
+	}
+	if( libfsclfs_record_fetcher_acquire_worker(
+	     internal_record_fetcher,
+	     &worker_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to acquire worker.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsclfs_record_fetcher_fetch_record(
+	          internal_record_fetcher,
+	          worker_index,
+	          request->record_lsn,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to fetch record: 0x%08" PRIx64 ".",
+		 function,
+		 request->record_lsn );
+
+		result = -1;
+	}
+	memory_free(
+	 request );
+
+	if( libcthreads_mutex_grab(
+	     internal_record_fetcher->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( worker_index != -1 )
+	{
+		internal_record_fetcher->workers[ worker_index ].is_busy = 0;
+	}
+	internal_record_fetcher->number_of_outstanding_requests -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     internal_record_fetcher->condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_record_fetcher->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,209 @@
+/*
+ * Record fetcher functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_INTERNAL_RECORD_FETCHER_H )
+#define _LIBFSCLFS_INTERNAL_RECORD_FETCHER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_extern.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_stream.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of outstanding requests of a record fetcher
+ */
+#define LIBFSCLFS_RECORD_FETCHER_MAXIMUM_NUMBER_OF_REQUESTS	256
+
+typedef struct libfsclfs_internal_record_fetcher libfsclfs_internal_record_fetcher_t;
+
+typedef struct libfsclfs_record_fetcher_request libfsclfs_record_fetcher_request_t;
+
+typedef struct libfsclfs_record_fetcher_worker libfsclfs_record_fetcher_worker_t;
+
+struct libfsclfs_record_fetcher_request
+{
+	/* The record fetcher
+	 */
+	libfsclfs_internal_record_fetcher_t *internal_record_fetcher;
+
+	/* The LSN of the record
+	 */
+	uint64_t record_lsn;
+};
+
+struct libfsclfs_record_fetcher_worker
+{
+	/* The container file IO handles
+	 * the worker reads from its own clones of the container file IO handles of the store
+	 * which are created when the worker first reads from the container
+	 * the entry index corresponds with the container physical number
+	 */
+	libbfio_handle_t **container_file_io_handles;
+
+	/* The number of container file IO handles
+	 */
+	int number_of_container_file_io_handles;
+
+	/* Value to indicate the worker is fetching a record
+	 */
+	uint8_t is_busy;
+};
+
+struct libfsclfs_internal_record_fetcher
+{
+	/* The internal stream
+	 */
+	libfsclfs_internal_stream_t *internal_stream;
+
+	/* The completion callback function
+	 * called with the record LSN, the lookup result, the record, the lookup error and the callback data
+	 * the record is owned by the callback function and NULL if the lookup result is not 1
+	 * the lookup error is owned by the record fetcher and NULL if the lookup result is not -1
+	 */
+	void (*callback)(
+	       uint64_t record_lsn,
+	       int result,
+	       libfsclfs_record_t *record,
+	       libcerror_error_t *error,
+	       void *callback_data );
+
+	/* The completion callback data
+	 */
+	void *callback_data;
+
+	/* The number of outstanding requests
+	 */
+	int number_of_outstanding_requests;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The worker thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The workers
+	 * one for every thread of the thread pool
+	 */
+	libfsclfs_record_fetcher_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The mutex that protects the number of outstanding requests and the busy workers
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a request completed
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The mutex that protects the container file IO pool of the store
+	 */
+	libcthreads_mutex_t *file_io_pool_mutex;
+#endif
+};
+
+int libfsclfs_record_fetcher_initialize(
+     libfsclfs_record_fetcher_t **record_fetcher,
+     libfsclfs_internal_stream_t *internal_stream,
+     void (*callback)(
+            uint64_t record_lsn,
+            int result,
+            libfsclfs_record_t *record,
+            libcerror_error_t *error,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_fetcher_free(
+     libfsclfs_record_fetcher_t **record_fetcher,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_fetcher_submit(
+     libfsclfs_record_fetcher_t *record_fetcher,
+     uint64_t record_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_fetcher_wait(
+     libfsclfs_record_fetcher_t *record_fetcher,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_fetcher_get_number_of_outstanding_requests(
+     libfsclfs_record_fetcher_t *record_fetcher,
+     int *number_of_outstanding_requests,
+     libcerror_error_t **error );
+
+int libfsclfs_record_fetcher_fetch_record(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int worker_index,
+     uint64_t record_lsn,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+int libfsclfs_record_fetcher_free_worker_file_io_handles(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     libfsclfs_record_fetcher_worker_t *worker,
+     libcerror_error_t **error );
+
+int libfsclfs_record_fetcher_get_worker_file_io_handle(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int worker_index,
+     uint32_t container_physical_number,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_record_fetcher_read_record(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int worker_index,
+     uint64_t record_lsn,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error );
+
+int libfsclfs_record_fetcher_acquire_worker(
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher,
+     int *worker_index,
+     libcerror_error_t **error );
+
+int libfsclfs_record_fetcher_request_callback(
+     libfsclfs_record_fetcher_request_t *request,
+     libfsclfs_internal_record_fetcher_t *internal_record_fetcher );
+
+#endif
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_INTERNAL_RECORD_FETCHER_H ) */
+
@@ -0,0 +1,333 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_filter.h"
+#include "libfsclfs_types.h"
+
+#include "fsclfs_record.h"
+
+/* Creates a record filter
+ * Make sure the value record_filter is referencing, is set to NULL
+ * A new record filter matches every record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_filter_initialize(
+     libfsclfs_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                      = "libfsclfs_record_filter_initialize";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = memory_allocate_structure(
+	                          libfsclfs_internal_record_filter_t );
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_filter,
+	     0,
+	     sizeof( libfsclfs_internal_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record filter.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_filter->stream_index = -1;
+
+	*record_filter = (libfsclfs_record_filter_t *) internal_record_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_filter != NULL )
+	{
+		memory_free(
+		 internal_record_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a record filter
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_filter_free(
+     libfsclfs_record_filter_t **record_filter,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                      = "libfsclfs_record_filter_free";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_filter != NULL )
+	{
+		internal_record_filter = (libfsclfs_internal_record_filter_t *) *record_filter;
+		*record_filter         = NULL;
+
+		memory_free(
+		 internal_record_filter );
+	}
+	return( 1 );
+}
+
+/* Sets the record types that match the filter
+ * A record matches if its record type has any of the record type flags set
+ * The record type flags are a combination of LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA
+ * and LIBFSCLFS_RECORD_TYPE_FLAG_IS_RESTART or 0 to match any record type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_filter_set_record_types(
+     libfsclfs_record_filter_t *record_filter,
+     uint32_t record_type_flags,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                      = "libfsclfs_record_filter_set_record_types";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	internal_record_filter->record_type_flags = record_type_flags;
+
+	return( 1 );
+}
+
+/* Sets the record flags that match the filter
+ * A record matches if its flags masked with the record flags mask equal the record flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_filter_set_record_flags(
+     libfsclfs_record_filter_t *record_filter,
+     uint16_t record_flags_mask,
+     uint16_t record_flags,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                      = "libfsclfs_record_filter_set_record_flags";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	if( ( record_flags & ~( record_flags_mask ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record flags: 0x%04" PRIx16 " not within mask: 0x%04" PRIx16 ".",
+		 function,
+		 record_flags,
+		 record_flags_mask );
+
+		return( -1 );
+	}
+	internal_record_filter->record_flags_mask = record_flags_mask;
+	internal_record_filter->record_flags      = record_flags;
+
+	return( 1 );
+}
+
+/* Sets the index of the stream that matches the filter
+ * Use -1 to match any stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_filter_set_stream_index(
+     libfsclfs_record_filter_t *record_filter,
+     int stream_index,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	static char *function                                      = "libfsclfs_record_filter_set_stream_index";
+
+	if( record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	if( stream_index < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid stream index value less than -1.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_filter->stream_index = stream_index;
+
+	return( 1 );
+}
+
+/* Determines if a record header matches the filter
+ * The record type and flags are read directly from the record header data
+ * so that records that do not match can be skipped without reading them
+ * Returns 1 if the record header matches, 0 if not or -1 on error
+ */
+int libfsclfs_record_filter_match_record_header(
+     libfsclfs_internal_record_filter_t *internal_record_filter,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_record_filter_match_record_header";
+	uint32_t record_type  = 0;
+	uint16_t record_flags = 0;
+
+	if( internal_record_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsclfs_container_record_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_filter->record_type_flags != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->record_type,
+		 record_type );
+
+		if( ( record_type & internal_record_filter->record_type_flags ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_record_filter->record_flags_mask != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->flags,
+		 record_flags );
+
+		if( ( record_flags & internal_record_filter->record_flags_mask ) != internal_record_filter->record_flags )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
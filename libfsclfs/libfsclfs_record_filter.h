@@ -0,0 +1,101 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_INTERNAL_RECORD_FILTER_H )
+#define _LIBFSCLFS_INTERNAL_RECORD_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_extern.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_internal_record_filter libfsclfs_internal_record_filter_t;
+
+struct libfsclfs_internal_record_filter
+{
+	/* The record type flags
+	 * a record matches if its record type has any of these flags set
+	 * or 0 if any record type matches
+	 */
+	uint32_t record_type_flags;
+
+	/* The record flags mask
+	 */
+	uint16_t record_flags_mask;
+
+	/* The record flags
+	 * a record matches if its flags masked with the record flags mask equal these flags
+	 */
+	uint16_t record_flags;
+
+	/* The stream index
+	 * or -1 if any stream matches
+	 */
+	int stream_index;
+};
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_filter_initialize(
+     libfsclfs_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_filter_free(
+     libfsclfs_record_filter_t **record_filter,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_filter_set_record_types(
+     libfsclfs_record_filter_t *record_filter,
+     uint32_t record_type_flags,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_filter_set_record_flags(
+     libfsclfs_record_filter_t *record_filter,
+     uint16_t record_flags_mask,
+     uint16_t record_flags,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_filter_set_stream_index(
+     libfsclfs_record_filter_t *record_filter,
+     int stream_index,
+     libcerror_error_t **error );
+
+int libfsclfs_record_filter_match_record_header(
+     libfsclfs_internal_record_filter_t *internal_record_filter,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_INTERNAL_RECORD_FILTER_H ) */
+
@@ -0,0 +1,783 @@
+/*
+ * Record header table functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_header_table.h"
+#include "libfsclfs_types.h"
+
+#include "fsclfs_record.h"
+
+/* Creates a record header table
+ * Make sure the value record_header_table is referencing, is set to NULL
+ * The same record header table can be used to read the record headers of multiple blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_initialize(
+     libfsclfs_record_header_table_t **record_header_table,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_initialize";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_header_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record header table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = memory_allocate_structure(
+	                                libfsclfs_internal_record_header_table_t );
+
+	if( internal_record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record header table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_header_table,
+	     0,
+	     sizeof( libfsclfs_internal_record_header_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record header table.",
+		 function );
+
+		memory_free(
+		 internal_record_header_table );
+
+		return( -1 );
+	}
+	internal_record_header_table->virtual_lsns = (uint64_t *) memory_allocate(
+	                                                           sizeof( uint64_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
+
+	if( internal_record_header_table->virtual_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create virtual LSNs array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_header_table->previous_lsns = (uint64_t *) memory_allocate(
+	                                                            sizeof( uint64_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
+
+	if( internal_record_header_table->previous_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create previous LSNs array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_header_table->undo_next_lsns = (uint64_t *) memory_allocate(
+	                                                             sizeof( uint64_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
+
+	if( internal_record_header_table->undo_next_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create undo-next LSNs array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_header_table->sizes = (uint32_t *) memory_allocate(
+	                                                    sizeof( uint32_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
+
+	if( internal_record_header_table->sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record sizes array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_header_table->record_types = (uint32_t *) memory_allocate(
+	                                                           sizeof( uint32_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
+
+	if( internal_record_header_table->record_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record types array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_header_table->flags = (uint16_t *) memory_allocate(
+	                                                    sizeof( uint16_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
+
+	if( internal_record_header_table->flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record flags array.",
+		 function );
+
+		goto on_error;
+	}
+	*record_header_table = (libfsclfs_record_header_table_t *) internal_record_header_table;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_header_table != NULL )
+	{
+		if( internal_record_header_table->virtual_lsns != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->virtual_lsns );
+		}
+		if( internal_record_header_table->previous_lsns != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->previous_lsns );
+		}
+		if( internal_record_header_table->undo_next_lsns != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->undo_next_lsns );
+		}
+		if( internal_record_header_table->sizes != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->sizes );
+		}
+		if( internal_record_header_table->record_types != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->record_types );
+		}
+		if( internal_record_header_table->flags != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->flags );
+		}
+		memory_free(
+		 internal_record_header_table );
+	}
+	return( -1 );
+}
+
+/* Frees a record header table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_free(
+     libfsclfs_record_header_table_t **record_header_table,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_free";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_header_table != NULL )
+	{
+		internal_record_header_table = (libfsclfs_internal_record_header_table_t *) *record_header_table;
+		*record_header_table         = NULL;
+
+		if( internal_record_header_table->virtual_lsns != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->virtual_lsns );
+		}
+		if( internal_record_header_table->previous_lsns != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->previous_lsns );
+		}
+		if( internal_record_header_table->undo_next_lsns != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->undo_next_lsns );
+		}
+		if( internal_record_header_table->sizes != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->sizes );
+		}
+		if( internal_record_header_table->record_types != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->record_types );
+		}
+		if( internal_record_header_table->flags != NULL )
+		{
+			memory_free(
+			 internal_record_header_table->flags );
+		}
+		memory_free(
+		 internal_record_header_table );
+	}
+	return( 1 );
+}
+
+/* Reads the record headers of the records in the record data of a block
+ * The data offset is the offset of the record data relative to the start of the block
+ * and is used to determine the 8-byte alignment of the records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_read_data(
+     libfsclfs_internal_record_header_table_t *internal_record_header_table,
+     uint64_t block_lsn,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsclfs_record_header_table_read_data";
+	size_t alignment_padding_size = 0;
+	uint32_t record_size          = 0;
+	uint32_t record_type          = 0;
+	int record_index              = 0;
+
+	if( internal_record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_lsn & 0x01ff ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block LSN: 0x%08" PRIx64 ".",
+		 function,
+		 block_lsn );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table->block_lsn         = block_lsn;
+	internal_record_header_table->number_of_records = 0;
+
+	while( data_size > 0 )
+	{
+		if( record_index >= LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of records value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( data_size < sizeof( fsclfs_container_record_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->size,
+		 record_size );
+
+		if( ( record_size < sizeof( fsclfs_container_record_header_t ) )
+		 || ( (size_t) record_size > data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %d size value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->virtual_lsn,
+		 internal_record_header_table->virtual_lsns[ record_index ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->undo_next_lsn,
+		 internal_record_header_table->undo_next_lsns[ record_index ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->previous_lsn,
+		 internal_record_header_table->previous_lsns[ record_index ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->flags,
+		 internal_record_header_table->flags[ record_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) data )->record_type,
+		 record_type );
+
+		internal_record_header_table->sizes[ record_index ]        = record_size;
+		internal_record_header_table->record_types[ record_index ] = record_type;
+
+		record_index++;
+
+		if( ( record_type & RECORD_TYPE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+		data        += record_size;
+		data_size   -= record_size;
+		data_offset += record_size;
+
+		if( ( data_offset % 8 ) != 0 )
+		{
+			alignment_padding_size = 8 - ( data_offset % 8 );
+
+			if( alignment_padding_size > data_size )
+			{
+				break;
+			}
+			data        += alignment_padding_size;
+			data_size   -= alignment_padding_size;
+			data_offset += alignment_padding_size;
+		}
+	}
+	internal_record_header_table->number_of_records = record_index;
+
+	return( 1 );
+
+on_error:
+	internal_record_header_table->number_of_records = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the log sequence number (LSN) of the block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_block_lsn(
+     libfsclfs_record_header_table_t *record_header_table,
+     uint64_t *block_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_block_lsn";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( block_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block LSN.",
+		 function );
+
+		return( -1 );
+	}
+	*block_lsn = internal_record_header_table->block_lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_number_of_records(
+     libfsclfs_record_header_table_t *record_header_table,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_number_of_records";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_record_header_table->number_of_records;
+
+	return( 1 );
+}
+
+/* Retrieves the virtual log sequence numbers (LSNs) array
+ * The array contains a value per record and remains owned by the record header table
+ * until the next read or the record header table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_virtual_lsns(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint64_t **virtual_lsns,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_virtual_lsns";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( virtual_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid virtual LSNs array.",
+		 function );
+
+		return( -1 );
+	}
+	*virtual_lsns = internal_record_header_table->virtual_lsns;
+
+	return( 1 );
+}
+
+/* Retrieves the previous log sequence numbers (LSNs) array
+ * The array contains a value per record and remains owned by the record header table
+ * until the next read or the record header table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_previous_lsns(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint64_t **previous_lsns,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_previous_lsns";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( previous_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous LSNs array.",
+		 function );
+
+		return( -1 );
+	}
+	*previous_lsns = internal_record_header_table->previous_lsns;
+
+	return( 1 );
+}
+
+/* Retrieves the undo-next log sequence numbers (LSNs) array
+ * The array contains a value per record and remains owned by the record header table
+ * until the next read or the record header table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_undo_next_lsns(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint64_t **undo_next_lsns,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_undo_next_lsns";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( undo_next_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid undo-next LSNs array.",
+		 function );
+
+		return( -1 );
+	}
+	*undo_next_lsns = internal_record_header_table->undo_next_lsns;
+
+	return( 1 );
+}
+
+/* Retrieves the record sizes array
+ * The array contains a value per record and remains owned by the record header table
+ * until the next read or the record header table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_sizes(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint32_t **sizes,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_sizes";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	*sizes = internal_record_header_table->sizes;
+
+	return( 1 );
+}
+
+/* Retrieves the record types array
+ * The array contains a value per record and remains owned by the record header table
+ * until the next read or the record header table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_record_types(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint32_t **record_types,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_record_types";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( record_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record types array.",
+		 function );
+
+		return( -1 );
+	}
+	*record_types = internal_record_header_table->record_types;
+
+	return( 1 );
+}
+
+/* Retrieves the record flags array
+ * The array contains a value per record and remains owned by the record header table
+ * until the next read or the record header table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_header_table_get_flags(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint16_t **flags,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	static char *function                                                  = "libfsclfs_record_header_table_get_flags";
+
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) record_header_table;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record flags array.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_record_header_table->flags;
+
+	return( 1 );
+}
+
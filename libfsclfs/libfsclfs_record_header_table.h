@@ -0,0 +1,148 @@
+/*
+ * Record header table functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_INTERNAL_RECORD_HEADER_TABLE_H )
+#define _LIBFSCLFS_INTERNAL_RECORD_HEADER_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_extern.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_internal_record_header_table libfsclfs_internal_record_header_table_t;
+
+/* The record header table contains the record header values of the records
+ * in a block stored as separate contiguous arrays, one per value.
+ * The arrays can contain LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS values
+ */
+struct libfsclfs_internal_record_header_table
+{
+	/* The LSN of the block
+	 */
+	uint64_t block_lsn;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The virtual LSNs
+	 */
+	uint64_t *virtual_lsns;
+
+	/* The previous LSNs
+	 */
+	uint64_t *previous_lsns;
+
+	/* The undo-next LSNs
+	 */
+	uint64_t *undo_next_lsns;
+
+	/* The record sizes
+	 */
+	uint32_t *sizes;
+
+	/* The record types
+	 */
+	uint32_t *record_types;
+
+	/* The record flags
+	 */
+	uint16_t *flags;
+};
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_initialize(
+     libfsclfs_record_header_table_t **record_header_table,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_free(
+     libfsclfs_record_header_table_t **record_header_table,
+     libcerror_error_t **error );
+
+int libfsclfs_record_header_table_read_data(
+     libfsclfs_internal_record_header_table_t *internal_record_header_table,
+     uint64_t block_lsn,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_block_lsn(
+     libfsclfs_record_header_table_t *record_header_table,
+     uint64_t *block_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_number_of_records(
+     libfsclfs_record_header_table_t *record_header_table,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_virtual_lsns(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint64_t **virtual_lsns,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_previous_lsns(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint64_t **previous_lsns,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_undo_next_lsns(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint64_t **undo_next_lsns,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_sizes(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint32_t **sizes,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_record_types(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint32_t **record_types,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_record_header_table_get_flags(
+     libfsclfs_record_header_table_t *record_header_table,
+     const uint16_t **flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_INTERNAL_RECORD_HEADER_TABLE_H ) */
+
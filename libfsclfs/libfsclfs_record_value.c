@@ -139,17 +139,139 @@ int libfsclfs_record_value_free(
 	return( 1 );
 }
 
-/* Reads the record value data
+/* Clones a record value
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_record_value_read_data(
+int libfsclfs_record_value_clone(
+     libfsclfs_record_value_t **destination_record_value,
+     libfsclfs_record_value_t *source_record_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_record_value_clone";
+
+	if( destination_record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination record value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_record_value == NULL )
+	{
+		*destination_record_value = NULL;
+
+		return( 1 );
+	}
+	*destination_record_value = memory_allocate_structure(
+	                             libfsclfs_record_value_t );
+
+	if( *destination_record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination record value.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_record_value,
+	     source_record_value,
+	     sizeof( libfsclfs_record_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination record value.",
+		 function );
+
+		( *destination_record_value )->data = NULL;
+
+		goto on_error;
+	}
+	( *destination_record_value )->data                = NULL;
+	( *destination_record_value )->allocated_data_size = 0;
+
+	if( source_record_value->data != NULL )
+	{
+		( *destination_record_value )->data = (uint8_t *) memory_allocate(
+		                                                   sizeof( uint8_t ) * source_record_value->data_size );
+
+		if( ( *destination_record_value )->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination record value data.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_record_value )->allocated_data_size = source_record_value->data_size;
+
+		if( memory_copy(
+		     ( *destination_record_value )->data,
+		     source_record_value->data,
+		     source_record_value->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination record value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_record_value != NULL )
+	{
+		if( ( *destination_record_value )->data != NULL )
+		{
+			memory_free(
+			 ( *destination_record_value )->data );
+		}
+		memory_free(
+		 *destination_record_value );
+
+		*destination_record_value = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the record value header
+ * The record data is not copied, use libfsclfs_record_value_read_data for that
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_value_read_header(
      libfsclfs_record_value_t *record_value,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfsclfs_record_value_read_data";
-	uint16_t data_offset  = 0;
+	static char *function = "libfsclfs_record_value_read_header";
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit  = 0;
@@ -223,7 +345,7 @@ int libfsclfs_record_value_read_data(
 
 	byte_stream_copy_to_uint16_little_endian(
 	 ( (fsclfs_container_record_header_t *) data )->data_offset,
-	 data_offset );
+	 record_value->data_offset );
 
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (fsclfs_container_record_header_t *) data )->record_type,
@@ -268,7 +390,7 @@ int libfsclfs_record_value_read_data(
 		libcnotify_printf(
 		 "%s: data offset\t\t\t\t: 0x%04" PRIx16 "\n",
 		 function,
-		 data_offset );
+		 record_value->data_offset );
 
 		libcnotify_printf(
 		 "%s: record type\t\t\t\t: 0x%08" PRIx32 "\n",
@@ -293,8 +415,9 @@ int libfsclfs_record_value_read_data(
 
 		goto on_error;
 	}
-	if( ( data_offset < sizeof( fsclfs_container_record_header_t ) )
-	 || ( (size_t) data_offset >= data_size ) )
+	if( ( record_value->data_offset < sizeof( fsclfs_container_record_header_t ) )
+	 || ( (size_t) record_value->data_offset >= data_size )
+	 || ( record_value->data_offset > record_value->size ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -308,21 +431,77 @@ int libfsclfs_record_value_read_data(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( data_offset > sizeof( fsclfs_container_record_header_t ) )
+		if( record_value->data_offset > sizeof( fsclfs_container_record_header_t ) )
 		{
 			libcnotify_printf(
 			 "%s: record header trailing data:\n",
 			 function );
 			libcnotify_print_data(
 			 &( data[ sizeof( fsclfs_container_record_header_t ) ] ),
-			 data_offset - sizeof( fsclfs_container_record_header_t ),
+			 record_value->data_offset - sizeof( fsclfs_container_record_header_t ),
 			 0 );
 		}
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	record_value->data_size = record_value->size - data_offset;
+	record_value->data_size = record_value->size - record_value->data_offset;
+
+	return( 1 );
+
+on_error:
+	record_value->data_size = 0;
+
+	return( -1 );
+}
 
+/* Reads the record value data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_value_read_data(
+     libfsclfs_record_value_t *record_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_record_value_read_data";
+
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_read_header(
+	     record_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record header.",
+		 function );
+
+		return( -1 );
+	}
 	record_value->data = (uint8_t *) memory_allocate(
 	                                  sizeof( uint8_t ) * record_value->data_size );
 
@@ -337,9 +516,11 @@ int libfsclfs_record_value_read_data(
 
 		goto on_error;
 	}
+	record_value->allocated_data_size = record_value->data_size;
+
 	if( memory_copy(
 	     record_value->data,
-	     &( data[ data_offset ] ),
+	     &( data[ record_value->data_offset ] ),
 	     record_value->data_size ) == NULL )
 	{
 		libcerror_error_set(
@@ -373,6 +554,94 @@ on_error:
 
 		record_value->data = NULL;
 	}
+	record_value->data_size           = 0;
+	record_value->allocated_data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the record value data into an existing record value
+ * Unlike libfsclfs_record_value_read_data the data of a previous read is
+ * reused and only reallocated when it is too small
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_record_value_fill_data(
+     libfsclfs_record_value_t *record_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_record_value_fill_data";
+	void *reallocation    = NULL;
+
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_value_read_header(
+	     record_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record header.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_value->data_size > record_value->allocated_data_size )
+	{
+		reallocation = memory_reallocate(
+		                record_value->data,
+		                sizeof( uint8_t ) * record_value->data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record value data.",
+			 function );
+
+			goto on_error;
+		}
+		record_value->data                = (uint8_t *) reallocation;
+		record_value->allocated_data_size = record_value->data_size;
+	}
+	if( record_value->data_size > 0 )
+	{
+		if( memory_copy(
+		     record_value->data,
+		     &( data[ record_value->data_offset ] ),
+		     record_value->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* The data is kept for reuse by a subsequent read
+	 */
 	record_value->data_size = 0;
 
 	return( -1 );
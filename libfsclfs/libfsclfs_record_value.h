@@ -59,6 +59,10 @@ struct libfsclfs_record_value
 	 */
 	uint32_t type;
 
+	/* The data offset
+	 */
+	uint16_t data_offset;
+
 	/* The data
 	 */
 	uint8_t *data;
@@ -66,6 +70,10 @@ struct libfsclfs_record_value
 	/* The data size
 	 */
 	uint32_t data_size;
+
+	/* The allocated data size
+	 */
+	uint32_t allocated_data_size;
 };
 
 int libfsclfs_record_value_initialize(
@@ -76,12 +84,29 @@ int libfsclfs_record_value_free(
      libfsclfs_record_value_t **record_value,
      libcerror_error_t **error );
 
+int libfsclfs_record_value_clone(
+     libfsclfs_record_value_t **destination_record_value,
+     libfsclfs_record_value_t *source_record_value,
+     libcerror_error_t **error );
+
+int libfsclfs_record_value_read_header(
+     libfsclfs_record_value_t *record_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsclfs_record_value_read_data(
      libfsclfs_record_value_t *record_value,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsclfs_record_value_fill_data(
+     libfsclfs_record_value_t *record_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsclfs_record_value_get_type(
      libfsclfs_record_value_t *record_value,
      uint32_t *record_type,
@@ -0,0 +1,1272 @@
+/*
+ * Region scanner functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcnotify.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_owner_page.h"
+#include "libfsclfs_region_scanner.h"
+#include "libfsclfs_scheduler.h"
+#include "libfsclfs_statistics.h"
+#include "libfsclfs_trace.h"
+#include "libfsclfs_unused.h"
+
+/* Creates a region scanner
+ * Make sure the value region_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_initialize(
+     libfsclfs_region_scanner_t **region_scanner,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_streams,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsclfs_region_scanner_initialize";
+	size64_t file_size         = 0;
+	uint64_t number_of_regions = 0;
+	uint64_t region_index      = 0;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *region_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid region scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->region_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - region size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_streams < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of streams value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container file size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block offsets in a container are 32-bit
+	 */
+	if( file_size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported container file size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_regions = file_size / io_handle->region_size;
+
+	if( ( number_of_regions > (uint64_t) INT_MAX )
+	 || ( (size_t) number_of_regions > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_region_scanner_region_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of regions value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*region_scanner = memory_allocate_structure(
+	                   libfsclfs_region_scanner_t );
+
+	if( *region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create region scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *region_scanner,
+	     0,
+	     sizeof( libfsclfs_region_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear region scanner.",
+		 function );
+
+		memory_free(
+		 *region_scanner );
+
+		*region_scanner = NULL;
+
+		return( -1 );
+	}
+	if( number_of_regions > 0 )
+	{
+		( *region_scanner )->regions = (libfsclfs_region_scanner_region_t *) memory_allocate(
+		                                sizeof( libfsclfs_region_scanner_region_t ) * (size_t) number_of_regions );
+
+		if( ( *region_scanner )->regions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create regions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *region_scanner )->regions,
+		     0,
+		     sizeof( libfsclfs_region_scanner_region_t ) * (size_t) number_of_regions ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear regions.",
+			 function );
+
+			goto on_error;
+		}
+		for( region_index = 0;
+		     region_index < number_of_regions;
+		     region_index++ )
+		{
+			( *region_scanner )->regions[ region_index ].region_scanner = *region_scanner;
+			( *region_scanner )->regions[ region_index ].offset         = (uint32_t) ( region_index * io_handle->region_size );
+		}
+	}
+	( *region_scanner )->io_handle         = io_handle;
+	( *region_scanner )->file_io_handle    = file_io_handle;
+	( *region_scanner )->number_of_streams = number_of_streams;
+	( *region_scanner )->number_of_regions = (int) number_of_regions;
+
+	return( 1 );
+
+on_error:
+	if( *region_scanner != NULL )
+	{
+		if( ( *region_scanner )->regions != NULL )
+		{
+			memory_free(
+			 ( *region_scanner )->regions );
+		}
+		memory_free(
+		 *region_scanner );
+
+		*region_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a region scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_free(
+     libfsclfs_region_scanner_t **region_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_region_scanner_free";
+	int region_index      = 0;
+	int result            = 1;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *region_scanner != NULL )
+	{
+		/* The io_handle and file_io_handle references are freed elsewhere
+		 */
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( ( *region_scanner )->worker_file_io_handles != NULL )
+		{
+			if( libfsclfs_region_scanner_free_worker_file_io_handles(
+			     *region_scanner,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker file IO handles.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *region_scanner )->regions != NULL )
+		{
+			for( region_index = 0;
+			     region_index < ( *region_scanner )->number_of_regions;
+			     region_index++ )
+			{
+				if( ( *region_scanner )->regions[ region_index ].owner_page != NULL )
+				{
+					if( libfsclfs_owner_page_free(
+					     &( ( *region_scanner )->regions[ region_index ].owner_page ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free owner page of region: %d.",
+						 function,
+						 region_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *region_scanner )->regions );
+		}
+		memory_free(
+		 *region_scanner );
+
+		*region_scanner = NULL;
+	}
+	return( result );
+}
+
+/* Scans a region for blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_scan_region(
+     libfsclfs_region_scanner_t *region_scanner,
+     libfsclfs_region_scanner_region_t *region,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsclfs_region_scanner_scan_region";
+	uint32_t owner_page_offset = 0;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid region scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region.",
+		 function );
+
+		return( -1 );
+	}
+	region->result = -1;
+
+	if( region->owner_page == NULL )
+	{
+		if( libfsclfs_owner_page_initialize(
+		     &( region->owner_page ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create owner page.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	owner_page_offset = region->offset
+	                  + region_scanner->io_handle->region_owner_page_offset;
+
+	if( region_scanner->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 region_scanner->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_OWNER_PAGE,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+		 (uint64_t) owner_page_offset );
+	}
+	if( libfsclfs_owner_page_read_scan_region(
+	     region->owner_page,
+	     region_scanner->io_handle,
+	     file_io_handle,
+	     region_scanner->number_of_streams,
+	     owner_page_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan region at offset: %" PRIu32 ".",
+		 function,
+		 region->offset );
+
+		if( region_scanner->io_handle->trace_callback != NULL )
+		{
+			libfsclfs_trace_event(
+			 region_scanner->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_READ_OWNER_PAGE,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+			 (uint64_t) owner_page_offset );
+		}
+		return( -1 );
+	}
+	if( region_scanner->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 region_scanner->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_OWNER_PAGE,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+		 (uint64_t) owner_page_offset );
+	}
+	if( region_scanner->io_handle->statistics != NULL )
+	{
+		libfsclfs_statistics_counter_add(
+		 region_scanner->io_handle->statistics->number_of_owner_pages_read,
+		 1 );
+	}
+	region->result = 1;
+
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+/* Creates the worker file IO handles
+ * The worker file IO handles are cloned from the container file IO handle on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_create_worker_file_io_handles(
+     libfsclfs_region_scanner_t *region_scanner,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_region_scanner_create_worker_file_io_handles";
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_scanner->worker_file_io_handles != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid region scanner - worker file IO handles value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( (size_t) number_of_workers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	region_scanner->worker_file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                          sizeof( libbfio_handle_t * ) * number_of_workers );
+
+	if( region_scanner->worker_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     region_scanner->worker_file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker file IO handles.",
+		 function );
+
+		memory_free(
+		 region_scanner->worker_file_io_handles );
+
+		region_scanner->worker_file_io_handles = NULL;
+
+		return( -1 );
+	}
+	region_scanner->number_of_worker_file_io_handles = number_of_workers;
+
+	return( 1 );
+}
+
+/* Frees the worker file IO handles
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_free_worker_file_io_handles(
+     libfsclfs_region_scanner_t *region_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_region_scanner_free_worker_file_io_handles";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_scanner->worker_file_io_handles != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < region_scanner->number_of_worker_file_io_handles;
+		     worker_index++ )
+		{
+			if( region_scanner->worker_file_io_handles[ worker_index ] == NULL )
+			{
+				continue;
+			}
+			if( ( region_scanner->io_handle != NULL )
+			 && ( region_scanner->io_handle->statistics != NULL ) )
+			{
+				if( libfsclfs_statistics_remove_file_io_handle_clone(
+				     region_scanner->io_handle->statistics,
+				     region_scanner->worker_file_io_handles[ worker_index ],
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove worker file IO handle: %d from statistics.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( libbfio_handle_close(
+			     region_scanner->worker_file_io_handles[ worker_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close worker file IO handle: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( region_scanner->worker_file_io_handles[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker file IO handle: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 region_scanner->worker_file_io_handles );
+
+		region_scanner->worker_file_io_handles = NULL;
+	}
+	region_scanner->number_of_worker_file_io_handles = 0;
+
+	return( result );
+}
+
+/* Retrieves the file IO handle of a specific worker
+ * The file IO handle is cloned from the container file IO handle on first use
+ * Only the worker itself should retrieve its file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_get_worker_file_io_handle(
+     libfsclfs_region_scanner_t *region_scanner,
+     int worker_index,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *worker_file_io_handle = NULL;
+	static char *function                   = "libfsclfs_region_scanner_get_worker_file_io_handle";
+	int result                              = 0;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_scanner->worker_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid region scanner - missing worker file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= region_scanner->number_of_worker_file_io_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( region_scanner->worker_file_io_handles[ worker_index ] == NULL )
+	{
+		if( libbfio_handle_clone(
+		     &worker_file_io_handle,
+		     region_scanner->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker file IO handle: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          worker_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if worker file IO handle: %d is open.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     worker_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open worker file IO handle: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( ( region_scanner->io_handle != NULL )
+		 && ( region_scanner->io_handle->statistics != NULL ) )
+		{
+			if( libfsclfs_statistics_add_file_io_handle_clone(
+			     region_scanner->io_handle->statistics,
+			     region_scanner->file_io_handle,
+			     worker_file_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add worker file IO handle: %d to statistics.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		region_scanner->worker_file_io_handles[ worker_index ] = worker_file_io_handle;
+	}
+	*file_io_handle = region_scanner->worker_file_io_handles[ worker_index ];
+
+	return( 1 );
+
+on_error:
+	if( worker_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &worker_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+
+/* Scans a region as a task of the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_scan_region_task_callback(
+     libfsclfs_region_scanner_region_t *region,
+     int worker_index,
+     void *callback_data LIBFSCLFS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libfsclfs_region_scanner_t *region_scanner = NULL;
+	static char *function                      = "libfsclfs_region_scanner_scan_region_task_callback";
+
+	LIBFSCLFS_UNREFERENCED_PARAMETER( callback_data )
+
+	if( region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region.",
+		 function );
+
+		goto on_error;
+	}
+	region_scanner = region->region_scanner;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid region - missing region scanner.",
+		 function );
+
+		goto on_error;
+	}
+	/* Skip the remaining regions if abort was signalled
+	 */
+	if( region_scanner->io_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	file_io_handle = region_scanner->file_io_handle;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( region_scanner->worker_file_io_handles != NULL )
+	{
+		if( libfsclfs_region_scanner_get_worker_file_io_handle(
+		     region_scanner,
+		     worker_index,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( libfsclfs_region_scanner_scan_region(
+	     region_scanner,
+	     region,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan region.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( region != NULL )
+	{
+		region->result = -1;
+	}
+	return( -1 );
+}
+
+/* Scans all the regions of multiple region scanners
+ * The regions are scanned as tasks of a work-stealing scheduler. Every worker
+ * starts with a contiguous range of regions and steals regions from the other
+ * workers when it runs out, so that containers with many or slow regions do not
+ * leave the other workers idle
+ * If multi-threading support is available and number_of_threads is larger than 1
+ * every worker runs on its own thread, otherwise the regions are scanned sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_scan_multiple(
+     libfsclfs_region_scanner_t **region_scanners,
+     int number_of_region_scanners,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsclfs_region_scanner_t *region_scanner = NULL;
+	libfsclfs_scheduler_t *scheduler           = NULL;
+	static char *function                      = "libfsclfs_region_scanner_scan_multiple";
+	int abort                                  = 0;
+	int number_of_regions                      = 0;
+	int number_of_tasks_per_worker             = 0;
+	int region_index                           = 0;
+	int region_scanner_index                   = 0;
+	int task_index                             = 0;
+
+	if( region_scanners == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanners.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_region_scanners < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of region scanners value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_scanner_index = 0;
+	     region_scanner_index < number_of_region_scanners;
+	     region_scanner_index++ )
+	{
+		region_scanner = region_scanners[ region_scanner_index ];
+
+		if( region_scanner == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing region scanner: %d.",
+			 function,
+			 region_scanner_index );
+
+			return( -1 );
+		}
+		if( region_scanner->io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid region scanner: %d - missing IO handle.",
+			 function,
+			 region_scanner_index );
+
+			return( -1 );
+		}
+		if( region_scanner->number_of_regions > ( INT_MAX - number_of_regions ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of regions value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_regions += region_scanner->number_of_regions;
+	}
+	if( number_of_regions == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > number_of_regions )
+	{
+		number_of_threads = number_of_regions;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	number_of_tasks_per_worker = number_of_regions / number_of_threads;
+
+	if( ( number_of_regions % number_of_threads ) != 0 )
+	{
+		number_of_tasks_per_worker += 1;
+	}
+	if( libfsclfs_scheduler_initialize(
+	     &scheduler,
+	     number_of_threads,
+	     number_of_tasks_per_worker,
+	     (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &libfsclfs_region_scanner_scan_region_task_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( region_scanner_index = 0;
+	     region_scanner_index < number_of_region_scanners;
+	     region_scanner_index++ )
+	{
+		region_scanner = region_scanners[ region_scanner_index ];
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			if( libfsclfs_region_scanner_create_worker_file_io_handles(
+			     region_scanner,
+			     number_of_threads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker file IO handles of region scanner: %d.",
+				 function,
+				 region_scanner_index );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* The regions are distributed in contiguous ranges so that every worker
+		 * starts reading sequentially
+		 */
+		for( region_index = 0;
+		     region_index < region_scanner->number_of_regions;
+		     region_index++ )
+		{
+			region_scanner->regions[ region_index ].result = 0;
+
+			if( libfsclfs_scheduler_push_task(
+			     scheduler,
+			     task_index / number_of_tasks_per_worker,
+			     (intptr_t *) &( region_scanner->regions[ region_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push region: %d of region scanner: %d onto scheduler.",
+				 function,
+				 region_index,
+				 region_scanner_index );
+
+				goto on_error;
+			}
+			task_index++;
+		}
+	}
+	if( libfsclfs_scheduler_run(
+	     scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_scheduler_free(
+	     &scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( region_scanner_index = 0;
+	     region_scanner_index < number_of_region_scanners;
+	     region_scanner_index++ )
+	{
+		region_scanner = region_scanners[ region_scanner_index ];
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( region_scanner->worker_file_io_handles != NULL )
+		{
+			if( libfsclfs_region_scanner_free_worker_file_io_handles(
+			     region_scanner,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker file IO handles of region scanner: %d.",
+				 function,
+				 region_scanner_index );
+
+				goto on_error;
+			}
+		}
+#endif
+		if( region_scanner->io_handle->abort != 0 )
+		{
+			abort = 1;
+		}
+	}
+	if( abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_scanner_index = 0;
+	     region_scanner_index < number_of_region_scanners;
+	     region_scanner_index++ )
+	{
+		region_scanner = region_scanners[ region_scanner_index ];
+
+		for( region_index = 0;
+		     region_index < region_scanner->number_of_regions;
+		     region_index++ )
+		{
+			if( region_scanner->regions[ region_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to scan region at offset: %" PRIu32 " of region scanner: %d.",
+				 function,
+				 region_scanner->regions[ region_index ].offset,
+				 region_scanner_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	for( region_scanner_index = 0;
+	     region_scanner_index < number_of_region_scanners;
+	     region_scanner_index++ )
+	{
+		region_scanner = region_scanners[ region_scanner_index ];
+
+		if( region_scanner->worker_file_io_handles != NULL )
+		{
+			libfsclfs_region_scanner_free_worker_file_io_handles(
+			 region_scanner,
+			 NULL );
+		}
+	}
+#endif
+	return( -1 );
+}
+
+/* Scans all the regions
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_scan(
+     libfsclfs_region_scanner_t *region_scanner,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_region_scanner_scan";
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_region_scanner_scan_multiple(
+	     &region_scanner,
+	     1,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan regions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Moves the log ranges of all the scanned regions to an owner page
+ * The log ranges are merged in region order and then sorted by virtual LSN
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_region_scanner_merge_log_ranges(
+     libfsclfs_region_scanner_t *region_scanner,
+     libfsclfs_owner_page_t *owner_page,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_region_scanner_merge_log_ranges";
+	int region_index      = 0;
+
+	if( region_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region scanner.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_index = 0;
+	     region_index < region_scanner->number_of_regions;
+	     region_index++ )
+	{
+		if( region_scanner->regions[ region_index ].owner_page == NULL )
+		{
+			continue;
+		}
+		if( libfsclfs_owner_page_append_log_ranges(
+		     owner_page,
+		     region_scanner->regions[ region_index ].owner_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append log ranges of region: %d.",
+			 function,
+			 region_index );
+
+			return( -1 );
+		}
+	}
+	if( libfsclfs_owner_page_sort_log_ranges(
+	     owner_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort log ranges.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,163 @@
+/*
+ * Region scanner functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSCLFS_REGION_SCANNER_H )
+#define _LIBFSCLFS_REGION_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_owner_page.h"
+#include "libfsclfs_scheduler.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_region_scanner libfsclfs_region_scanner_t;
+
+typedef struct libfsclfs_region_scanner_region libfsclfs_region_scanner_region_t;
+
+struct libfsclfs_region_scanner_region
+{
+	/* The region scanner
+	 */
+	libfsclfs_region_scanner_t *region_scanner;
+
+	/* The region offset
+	 */
+	uint32_t offset;
+
+	/* The owner page
+	 * contains the log ranges of the blocks found in the region
+	 */
+	libfsclfs_owner_page_t *owner_page;
+
+	/* The scan result
+	 * 1 if the region was scanned, 0 if not or -1 on error
+	 */
+	int result;
+};
+
+struct libfsclfs_region_scanner
+{
+	/* The IO handle
+	 */
+	libfsclfs_io_handle_t *io_handle;
+
+	/* The container file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The number of streams
+	 */
+	int number_of_streams;
+
+	/* The regions
+	 */
+	libfsclfs_region_scanner_region_t *regions;
+
+	/* The number of regions
+	 */
+	int number_of_regions;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The worker file IO handles
+	 * every worker thread reads from its own clone of the container file IO handle
+	 * which is created when the worker first scans a region of the container
+	 */
+	libbfio_handle_t **worker_file_io_handles;
+
+	/* The number of worker file IO handles
+	 */
+	int number_of_worker_file_io_handles;
+#endif
+};
+
+int libfsclfs_region_scanner_initialize(
+     libfsclfs_region_scanner_t **region_scanner,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_streams,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_free(
+     libfsclfs_region_scanner_t **region_scanner,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_scan_region(
+     libfsclfs_region_scanner_t *region_scanner,
+     libfsclfs_region_scanner_region_t *region,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+int libfsclfs_region_scanner_create_worker_file_io_handles(
+     libfsclfs_region_scanner_t *region_scanner,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_free_worker_file_io_handles(
+     libfsclfs_region_scanner_t *region_scanner,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_get_worker_file_io_handle(
+     libfsclfs_region_scanner_t *region_scanner,
+     int worker_index,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsclfs_region_scanner_scan_region_task_callback(
+     libfsclfs_region_scanner_region_t *region,
+     int worker_index,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_scan_multiple(
+     libfsclfs_region_scanner_t **region_scanners,
+     int number_of_region_scanners,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_scan(
+     libfsclfs_region_scanner_t *region_scanner,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsclfs_region_scanner_merge_log_ranges(
+     libfsclfs_region_scanner_t *region_scanner,
+     libfsclfs_owner_page_t *owner_page,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_REGION_SCANNER_H ) */
+
@@ -0,0 +1,889 @@
+/*
+ * Scan cursor functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_checksum.h"
+#include "libfsclfs_libcdata.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record.h"
+#include "libfsclfs_record_filter.h"
+#include "libfsclfs_scan_cursor.h"
+#include "libfsclfs_store.h"
+#include "libfsclfs_stream.h"
+#include "libfsclfs_stream_descriptor.h"
+#include "libfsclfs_types.h"
+
+#include "fsclfs_scan_cursor_state.h"
+
+/* The signature of the scan cursor state: "FSCLFSSC"
+ */
+const uint8_t libfsclfs_scan_cursor_state_signature[ 8 ] = {
+	'F', 'S', 'C', 'L', 'F', 'S', 'S', 'C' };
+
+/* Creates a scan cursor
+ * Make sure the value scan_cursor is referencing, is set to NULL
+ * The scan cursor is positioned at the last record of the stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_initialize(
+     libfsclfs_scan_cursor_t **scan_cursor,
+     libfsclfs_internal_stream_t *internal_stream,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_initialize";
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal stream - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = memory_allocate_structure(
+	                        libfsclfs_internal_scan_cursor_t );
+
+	if( internal_scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scan_cursor,
+	     0,
+	     sizeof( libfsclfs_internal_scan_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan cursor.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scan_cursor->internal_stream = internal_stream;
+	internal_scan_cursor->current_lsn     = internal_stream->stream_descriptor->last_lsn;
+
+	*scan_cursor = (libfsclfs_scan_cursor_t *) internal_scan_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_scan_cursor != NULL )
+	{
+		memory_free(
+		 internal_scan_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a scan cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_free(
+     libfsclfs_scan_cursor_t **scan_cursor,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_free";
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_cursor != NULL )
+	{
+		internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) *scan_cursor;
+		*scan_cursor         = NULL;
+
+		/* The internal_stream reference is freed elsewhere
+		 */
+		memory_free(
+		 internal_scan_cursor );
+	}
+	return( 1 );
+}
+
+/* Retrieves the LSN of the record the scan cursor is positioned at
+ * Returns 1 if successful, 0 if the scan cursor is at the end of the stream or -1 on error
+ */
+int libfsclfs_scan_cursor_get_current_lsn(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     uint64_t *current_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_get_current_lsn";
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	if( current_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_cursor->current_lsn == LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN )
+	{
+		return( 0 );
+	}
+	*current_lsn = internal_scan_cursor->current_lsn;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_get_number_of_records(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     uint64_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_get_number_of_records";
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = internal_scan_cursor->number_of_records;
+
+	return( 1 );
+}
+
+/* Sets the record filter of the scan cursor
+ * The values of the record filter are copied, a NULL record filter removes the filter.
+ * Records that do not match the record filter are skipped by libfsclfs_scan_cursor_get_next_record
+ * without reading their data.
+ * The record filter is not part of the scan cursor state
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_set_record_filter(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     libfsclfs_record_filter_t *record_filter,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor     = NULL;
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor           = NULL;
+	static char *function                                      = "libfsclfs_scan_cursor_set_record_filter";
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	if( internal_scan_cursor->internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan cursor - missing internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_cursor->internal_stream->internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan cursor - invalid internal stream - missing internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_filter == NULL )
+	{
+		internal_scan_cursor->has_record_filter  = 0;
+		internal_scan_cursor->stream_is_excluded = 0;
+
+		return( 1 );
+	}
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	if( internal_record_filter->stream_index != -1 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_scan_cursor->internal_stream->internal_store->stream_descriptors_array,
+		     internal_record_filter->stream_index,
+		     (intptr_t **) &stream_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream descriptor: %d.",
+			 function,
+			 internal_record_filter->stream_index );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     &( internal_scan_cursor->record_filter ),
+	     internal_record_filter,
+	     sizeof( libfsclfs_internal_record_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record filter.",
+		 function );
+
+		internal_scan_cursor->has_record_filter = 0;
+
+		return( -1 );
+	}
+	internal_scan_cursor->has_record_filter  = 1;
+	internal_scan_cursor->stream_is_excluded = 0;
+
+	/* The stream predicate is evaluated once since all records of the scan cursor
+	 * are in the same stream
+	 */
+	if( ( stream_descriptor != NULL )
+	 && ( stream_descriptor != internal_scan_cursor->internal_stream->stream_descriptor ) )
+	{
+		internal_scan_cursor->stream_is_excluded = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the record the scan cursor is positioned at and moves the scan cursor
+ * to the previous record in the stream, following the previous LSN chain
+ * If a record filter is set the records that do not match are skipped
+ * Returns 1 if successful, 0 if the scan cursor is at the end of the stream or -1 on error
+ */
+int libfsclfs_scan_cursor_get_next_record(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_filter_t *record_filter      = NULL;
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_get_next_record";
+	uint64_t previous_lsn                                  = 0;
+	int result                                             = 0;
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	if( internal_scan_cursor->internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan cursor - missing internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_cursor->internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan cursor - invalid internal stream - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_cursor->has_record_filter != 0 )
+	{
+		if( internal_scan_cursor->stream_is_excluded != 0 )
+		{
+			return( 0 );
+		}
+		record_filter = &( internal_scan_cursor->record_filter );
+	}
+	do
+	{
+		if( ( internal_scan_cursor->current_lsn == LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN )
+		 || ( internal_scan_cursor->current_lsn < internal_scan_cursor->internal_stream->stream_descriptor->base_lsn ) )
+		{
+			return( 0 );
+		}
+		result = libfsclfs_stream_get_filtered_record_by_lsn(
+		          internal_scan_cursor->internal_stream,
+		          internal_scan_cursor->current_lsn,
+		          record_filter,
+		          record,
+		          &previous_lsn,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record by LSN: 0x%08" PRIx64 ".",
+			 function,
+			 internal_scan_cursor->current_lsn );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			internal_scan_cursor->current_lsn = LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN;
+
+			return( 0 );
+		}
+		/* Stop on a corrupted previous LSN chain that does not move backwards
+		 */
+		if( previous_lsn >= internal_scan_cursor->current_lsn )
+		{
+			internal_scan_cursor->current_lsn = LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN;
+		}
+		else
+		{
+			internal_scan_cursor->current_lsn = previous_lsn;
+		}
+	}
+	while( *record == NULL );
+
+	internal_scan_cursor->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the scan cursor state
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_get_state_size(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     size_t *state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_scan_cursor_get_state_size";
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state size.",
+		 function );
+
+		return( -1 );
+	}
+	*state_size = sizeof( fsclfs_scan_cursor_state_t );
+
+	return( 1 );
+}
+
+/* Retrieves the scan cursor state
+ * The state can be used to resume the scan on a reopened store
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_get_state(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_get_state";
+	uint32_t checksum                                      = 0;
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	if( ( internal_scan_cursor->internal_stream == NULL )
+	 || ( internal_scan_cursor->internal_stream->stream_descriptor == NULL )
+	 || ( internal_scan_cursor->internal_stream->internal_store == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan cursor - invalid internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = internal_scan_cursor->internal_stream->internal_store;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size < sizeof( fsclfs_scan_cursor_state_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     state,
+	     0,
+	     sizeof( fsclfs_scan_cursor_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (fsclfs_scan_cursor_state_t *) state )->signature,
+	     libfsclfs_scan_cursor_state_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->format_version,
+	 LIBFSCLFS_SCAN_CURSOR_STATE_FORMAT_VERSION );
+
+	if( memory_copy(
+	     ( (fsclfs_scan_cursor_state_t *) state )->store_identifier,
+	     internal_store->store_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy store identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->stream_number,
+	 internal_scan_cursor->internal_stream->stream_descriptor->number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->current_lsn,
+	 internal_scan_cursor->current_lsn );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->number_of_records,
+	 internal_scan_cursor->number_of_records );
+
+	if( libfsclfs_checksum_calculate_crc32(
+	     &checksum,
+	     state,
+	     sizeof( fsclfs_scan_cursor_state_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->checksum,
+	 checksum );
+
+	return( 1 );
+}
+
+/* Sets the scan cursor state
+ * The state must have been retrieved from a scan cursor of the same stream of the same store
+ * The scan cursor is positioned at the saved LSN without following the previous LSN chain
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scan_cursor_set_state(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor       = NULL;
+	static char *function                                  = "libfsclfs_scan_cursor_set_state";
+	uint64_t current_lsn                                   = 0;
+	uint64_t number_of_records                             = 0;
+	uint32_t calculated_checksum                           = 0;
+	uint32_t format_version                                = 0;
+	uint32_t stored_checksum                               = 0;
+	uint16_t stream_number                                 = 0;
+
+	if( scan_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	if( ( internal_scan_cursor->internal_stream == NULL )
+	 || ( internal_scan_cursor->internal_stream->stream_descriptor == NULL )
+	 || ( internal_scan_cursor->internal_stream->internal_store == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan cursor - invalid internal stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store    = internal_scan_cursor->internal_stream->internal_store;
+	stream_descriptor = internal_scan_cursor->internal_stream->stream_descriptor;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_size != sizeof( fsclfs_scan_cursor_state_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (fsclfs_scan_cursor_state_t *) state )->signature,
+	     libfsclfs_scan_cursor_state_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported state signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->format_version,
+	 format_version );
+
+	if( format_version != LIBFSCLFS_SCAN_CURSOR_STATE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported state format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->checksum,
+	 stored_checksum );
+
+	if( libfsclfs_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     state,
+	     sizeof( fsclfs_scan_cursor_state_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in state checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	/* The store identifier and stream number form the validation stamp
+	 */
+	if( memory_compare(
+	     ( (fsclfs_scan_cursor_state_t *) state )->store_identifier,
+	     internal_store->store_identifier,
+	     16 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in store identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->stream_number,
+	 stream_number );
+
+	if( stream_number != stream_descriptor->number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in stream number ( %" PRIu16 " != %" PRIu16 " ).",
+		 function,
+		 stream_number,
+		 stream_descriptor->number );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->current_lsn,
+	 current_lsn );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsclfs_scan_cursor_state_t *) state )->number_of_records,
+	 number_of_records );
+
+	if( current_lsn != LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN )
+	{
+		/* The records before the base LSN are no longer part of the stream
+		 */
+		if( ( current_lsn < stream_descriptor->base_lsn )
+		 || ( current_lsn > stream_descriptor->last_lsn ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current LSN: 0x%08" PRIx64 " value out of bounds.",
+			 function,
+			 current_lsn );
+
+			return( -1 );
+		}
+	}
+	internal_scan_cursor->current_lsn       = current_lsn;
+	internal_scan_cursor->number_of_records = number_of_records;
+
+	return( 1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Scan cursor functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_INTERNAL_SCAN_CURSOR_H )
+#define _LIBFSCLFS_INTERNAL_SCAN_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_extern.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_filter.h"
+#include "libfsclfs_stream.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The format version of the scan cursor state
+ */
+#define LIBFSCLFS_SCAN_CURSOR_STATE_FORMAT_VERSION	1
+
+/* The LSN that indicates the scan cursor is at the end of the stream
+ */
+#define LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN		0xffffffff00000000ULL
+
+typedef struct libfsclfs_internal_scan_cursor libfsclfs_internal_scan_cursor_t;
+
+struct libfsclfs_internal_scan_cursor
+{
+	/* The internal stream
+	 */
+	libfsclfs_internal_stream_t *internal_stream;
+
+	/* The LSN of the record the cursor is positioned at
+	 */
+	uint64_t current_lsn;
+
+	/* The number of records scanned
+	 */
+	uint64_t number_of_records;
+
+	/* The record filter
+	 */
+	libfsclfs_internal_record_filter_t record_filter;
+
+	/* Value to indicate the record filter is set
+	 */
+	uint8_t has_record_filter;
+
+	/* Value to indicate the record filter excludes the stream
+	 */
+	uint8_t stream_is_excluded;
+};
+
+int libfsclfs_scan_cursor_initialize(
+     libfsclfs_scan_cursor_t **scan_cursor,
+     libfsclfs_internal_stream_t *internal_stream,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_free(
+     libfsclfs_scan_cursor_t **scan_cursor,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_get_current_lsn(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     uint64_t *current_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_get_number_of_records(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     uint64_t *number_of_records,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_set_record_filter(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     libfsclfs_record_filter_t *record_filter,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_get_next_record(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_get_state_size(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     size_t *state_size,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_get_state(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_scan_cursor_set_state(
+     libfsclfs_scan_cursor_t *scan_cursor,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_INTERNAL_SCAN_CURSOR_H ) */
+
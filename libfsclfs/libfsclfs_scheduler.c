@@ -0,0 +1,1041 @@
+/*
+ * Work-stealing task scheduler functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcnotify.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_scheduler.h"
+
+/* Creates a scheduler
+ * Make sure the value scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_initialize(
+     libfsclfs_scheduler_t **scheduler,
+     int number_of_workers,
+     int maximum_number_of_tasks,
+     int (*task_callback)(
+            intptr_t *task,
+            int worker_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_worker_t *worker = NULL;
+	static char *function                = "libfsclfs_scheduler_initialize";
+	size_t tasks_size                    = 0;
+	int worker_index                     = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( (size_t) number_of_workers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_scheduler_worker_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_tasks <= 0 )
+	 || ( (size_t) maximum_number_of_tasks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( intptr_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of tasks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task callback.",
+		 function );
+
+		return( -1 );
+	}
+	*scheduler = memory_allocate_structure(
+	              libfsclfs_scheduler_t );
+
+	if( *scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scheduler,
+	     0,
+	     sizeof( libfsclfs_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scheduler.",
+		 function );
+
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+
+		return( -1 );
+	}
+	( *scheduler )->workers = (libfsclfs_scheduler_worker_t *) memory_allocate(
+	                                                            sizeof( libfsclfs_scheduler_worker_t ) * number_of_workers );
+
+	if( ( *scheduler )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scheduler )->workers,
+	     0,
+	     sizeof( libfsclfs_scheduler_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 ( *scheduler )->workers );
+
+		( *scheduler )->workers = NULL;
+
+		goto on_error;
+	}
+	( *scheduler )->number_of_workers       = number_of_workers;
+	( *scheduler )->maximum_number_of_tasks = maximum_number_of_tasks;
+	( *scheduler )->task_callback           = task_callback;
+	( *scheduler )->callback_data           = callback_data;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	tasks_size = sizeof( intptr_t * ) * maximum_number_of_tasks;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( ( *scheduler )->workers[ worker_index ] );
+
+		worker->scheduler    = *scheduler;
+		worker->worker_index = worker_index;
+
+		worker->tasks = (intptr_t **) memory_allocate(
+		                               tasks_size );
+
+		if( worker->tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( worker->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 scheduler,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_free(
+     libfsclfs_scheduler_t **scheduler,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_worker_t *worker = NULL;
+	static char *function                = "libfsclfs_scheduler_free";
+	int result                           = 1;
+	int worker_index                     = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scheduler != NULL )
+	{
+		/* The tasks and callback data are freed elsewhere
+		 */
+		if( ( *scheduler )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *scheduler )->number_of_workers;
+			     worker_index++ )
+			{
+				worker = &( ( *scheduler )->workers[ worker_index ] );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+				if( worker->mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( worker->mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free mutex of worker: %d.",
+						 function,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+#endif
+				if( worker->tasks != NULL )
+				{
+					memory_free(
+					 worker->tasks );
+				}
+			}
+			memory_free(
+			 ( *scheduler )->workers );
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( ( *scheduler )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *scheduler )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *scheduler )->task_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *scheduler )->task_error ) );
+		}
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a task onto the back of the deque of a specific worker
+ * Tasks are pushed before the scheduler is run
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_push_task(
+     libfsclfs_scheduler_t *scheduler,
+     int worker_index,
+     intptr_t *task,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_worker_t *worker = NULL;
+	static char *function                = "libfsclfs_scheduler_push_task";
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= scheduler->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( scheduler->workers[ worker_index ] );
+
+	if( worker->last_task_index >= scheduler->maximum_number_of_tasks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid worker: %d - number of tasks value exceeds maximum.",
+		 function,
+		 worker_index );
+
+		return( -1 );
+	}
+	worker->tasks[ worker->last_task_index ] = task;
+
+	worker->last_task_index += 1;
+
+	return( 1 );
+}
+
+/* Pops a task from the front of the deque of a specific worker
+ * Returns 1 if successful, 0 if the deque is empty or -1 on error
+ */
+int libfsclfs_scheduler_pop_task(
+     libfsclfs_scheduler_t *scheduler,
+     int worker_index,
+     intptr_t **task,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_worker_t *worker = NULL;
+	static char *function                = "libfsclfs_scheduler_pop_task";
+	int result                           = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= scheduler->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( scheduler->workers[ worker_index ] );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex of worker: %d.",
+		 function,
+		 worker_index );
+
+		return( -1 );
+	}
+#endif
+	if( worker->first_task_index < worker->last_task_index )
+	{
+		*task = worker->tasks[ worker->first_task_index ];
+
+		worker->first_task_index += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex of worker: %d.",
+		 function,
+		 worker_index );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Steals a task from the back of the deque of another worker
+ * The other workers are tried in order starting after the worker that is stealing
+ * Returns 1 if successful, 0 if the deques of the other workers are empty or -1 on error
+ */
+int libfsclfs_scheduler_steal_task(
+     libfsclfs_scheduler_t *scheduler,
+     int worker_index,
+     intptr_t **task,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_worker_t *victim = NULL;
+	static char *function                = "libfsclfs_scheduler_steal_task";
+	int result                           = 0;
+	int victim_index                     = 0;
+	int victim_iterator                  = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= scheduler->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	for( victim_iterator = 1;
+	     victim_iterator < scheduler->number_of_workers;
+	     victim_iterator++ )
+	{
+		victim_index = ( worker_index + victim_iterator ) % scheduler->number_of_workers;
+		victim       = &( scheduler->workers[ victim_index ] );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     victim->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex of worker: %d.",
+			 function,
+			 victim_index );
+
+			return( -1 );
+		}
+#endif
+		if( victim->first_task_index < victim->last_task_index )
+		{
+			victim->last_task_index -= 1;
+
+			*task = victim->tasks[ victim->last_task_index ];
+
+			result = 1;
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     victim->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex of worker: %d.",
+			 function,
+			 victim_index );
+
+			return( -1 );
+		}
+#endif
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Determines if a task failed
+ * Returns 1 if a task failed, 0 if not or -1 on error
+ */
+int libfsclfs_scheduler_has_task_failed(
+     libfsclfs_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_scheduler_has_task_failed";
+	int task_failed       = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	task_failed = scheduler->task_failed;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( task_failed != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the task failed value, which makes the workers skip the remaining tasks
+ * If task_error is set the scheduler takes over the error of the first task that
+ * failed, which is returned by libfsclfs_scheduler_run, the errors of the tasks
+ * that failed later are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_set_task_failed(
+     libfsclfs_scheduler_t *scheduler,
+     libcerror_error_t **task_error,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_scheduler_set_task_failed";
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	scheduler->task_failed = 1;
+
+	if( ( task_error != NULL )
+	 && ( *task_error != NULL ) )
+	{
+		if( scheduler->task_error == NULL )
+		{
+			scheduler->task_error = *task_error;
+			*task_error           = NULL;
+		}
+		else
+		{
+			libcerror_error_free(
+			 task_error );
+		}
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Runs the tasks of a worker
+ * When the deque of the worker is empty tasks are stolen from the other workers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_worker_run(
+     libfsclfs_scheduler_worker_t *worker,
+     libcerror_error_t **error )
+{
+	libfsclfs_scheduler_t *scheduler = NULL;
+	intptr_t *task                   = NULL;
+	static char *function            = "libfsclfs_scheduler_worker_run";
+	int result                       = 0;
+	int task_failed                  = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	scheduler = worker->scheduler;
+
+	task_failed = libfsclfs_scheduler_has_task_failed(
+	               scheduler,
+	               error );
+
+	while( task_failed == 0 )
+	{
+		result = libfsclfs_scheduler_pop_task(
+		          scheduler,
+		          worker->worker_index,
+		          &task,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libfsclfs_scheduler_steal_task(
+			          scheduler,
+			          worker->worker_index,
+			          &task,
+			          error );
+
+			if( result == 1 )
+			{
+				worker->number_of_tasks_stolen += 1;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve task of worker: %d.",
+			 function,
+			 worker->worker_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( scheduler->task_callback(
+		     task,
+		     worker->worker_index,
+		     scheduler->callback_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run task on worker: %d.",
+			 function,
+			 worker->worker_index );
+
+			return( -1 );
+		}
+		worker->number_of_tasks_run += 1;
+
+		task_failed = libfsclfs_scheduler_has_task_failed(
+		               scheduler,
+		               error );
+	}
+	if( task_failed == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if a task failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+/* Runs the tasks of a worker on a worker thread
+ * If the worker fails the other workers are stopped and its error is retained
+ * by the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_worker_thread_callback(
+     libfsclfs_scheduler_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfsclfs_scheduler_worker_thread_callback";
+
+	if( libfsclfs_scheduler_worker_run(
+	     worker,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run worker.",
+		 function );
+
+		if( worker != NULL )
+		{
+			libfsclfs_scheduler_set_task_failed(
+			 worker->scheduler,
+			 &error,
+			 NULL );
+		}
+		if( error != NULL )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+
+/* Runs all the tasks
+ * If multi-threading support is available and there is more than 1 worker
+ * every worker runs on its own thread, otherwise the tasks are run sequentially
+ * on the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_scheduler_run(
+     libfsclfs_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_scheduler_run";
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	int number_of_threads = 0;
+	int worker_index      = 0;
+#endif
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	scheduler->task_failed = 0;
+
+	if( scheduler->task_error != NULL )
+	{
+		libcerror_error_free(
+		 &( scheduler->task_error ) );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( scheduler->number_of_workers > 1 )
+	{
+		for( number_of_threads = 0;
+		     number_of_threads < scheduler->number_of_workers;
+		     number_of_threads++ )
+		{
+			if( libcthreads_thread_create(
+			     &( scheduler->workers[ number_of_threads ].thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsclfs_scheduler_worker_thread_callback,
+			     (void *) &( scheduler->workers[ number_of_threads ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 number_of_threads );
+
+				/* Make the threads that are already running stop
+				 */
+				libfsclfs_scheduler_set_task_failed(
+				 scheduler,
+				 NULL,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( scheduler->workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				worker_index++;
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+	{
+		/* The first worker steals the tasks of the other workers
+		 */
+		if( libfsclfs_scheduler_worker_run(
+		     &( scheduler->workers[ 0 ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run worker: 0.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The worker threads have been joined, so the task failed value
+	 * and the task error are no longer accessed concurrently
+	 */
+	if( scheduler->task_failed != 0 )
+	{
+		/* Return the error of the first task that failed
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error                = scheduler->task_error;
+			scheduler->task_error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run tasks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+on_error:
+	while( worker_index < number_of_threads )
+	{
+		libcthreads_thread_join(
+		 &( scheduler->workers[ worker_index ].thread ),
+		 NULL );
+
+		worker_index++;
+	}
+	return( -1 );
+#endif
+}
+
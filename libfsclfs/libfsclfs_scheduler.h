@@ -0,0 +1,188 @@
+/*
+ * Work-stealing task scheduler functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_SCHEDULER_H )
+#define _LIBFSCLFS_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_scheduler libfsclfs_scheduler_t;
+
+typedef struct libfsclfs_scheduler_worker libfsclfs_scheduler_worker_t;
+
+struct libfsclfs_scheduler_worker
+{
+	/* The scheduler
+	 */
+	libfsclfs_scheduler_t *scheduler;
+
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The task deque
+	 * the worker takes tasks from the front, other workers steal tasks from the back
+	 */
+	intptr_t **tasks;
+
+	/* The index of the first task in the deque
+	 */
+	int first_task_index;
+
+	/* The index of the last task in the deque, exclusive
+	 */
+	int last_task_index;
+
+	/* The number of tasks run by the worker
+	 */
+	int number_of_tasks_run;
+
+	/* The number of tasks stolen by the worker from other workers
+	 */
+	int number_of_tasks_stolen;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the task deque
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct libfsclfs_scheduler
+{
+	/* The workers
+	 */
+	libfsclfs_scheduler_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The maximum number of tasks per worker
+	 */
+	int maximum_number_of_tasks;
+
+	/* The task callback function
+	 * called with the task, the index of the worker running it, the callback data and an error
+	 * returns 1 if successful or -1 on error
+	 */
+	int (*task_callback)(
+	       intptr_t *task,
+	       int worker_index,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The task callback data
+	 */
+	void *callback_data;
+
+	/* Value to indicate a task failed
+	 * the remaining tasks are skipped when set
+	 */
+	int task_failed;
+
+	/* The error of the first task that failed
+	 */
+	libcerror_error_t *task_error;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the task failed value and the task error
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsclfs_scheduler_initialize(
+     libfsclfs_scheduler_t **scheduler,
+     int number_of_workers,
+     int maximum_number_of_tasks,
+     int (*task_callback)(
+            intptr_t *task,
+            int worker_index,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_free(
+     libfsclfs_scheduler_t **scheduler,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_push_task(
+     libfsclfs_scheduler_t *scheduler,
+     int worker_index,
+     intptr_t *task,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_pop_task(
+     libfsclfs_scheduler_t *scheduler,
+     int worker_index,
+     intptr_t **task,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_steal_task(
+     libfsclfs_scheduler_t *scheduler,
+     int worker_index,
+     intptr_t **task,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_has_task_failed(
+     libfsclfs_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_set_task_failed(
+     libfsclfs_scheduler_t *scheduler,
+     libcerror_error_t **task_error,
+     libcerror_error_t **error );
+
+int libfsclfs_scheduler_worker_run(
+     libfsclfs_scheduler_worker_t *worker,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+int libfsclfs_scheduler_worker_thread_callback(
+     libfsclfs_scheduler_worker_t *worker );
+
+#endif
+
+int libfsclfs_scheduler_run(
+     libfsclfs_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_SCHEDULER_H ) */
+
@@ -0,0 +1,1193 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_statistics.h"
+
+/* Creates statistics
+ * Make sure the value statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_initialize(
+     libfsclfs_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_statistics_initialize";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*statistics = memory_allocate_structure(
+	               libfsclfs_statistics_t );
+
+	if( *statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *statistics,
+	     0,
+	     sizeof( libfsclfs_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *statistics )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *statistics != NULL )
+	{
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_free(
+     libfsclfs_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *next_slot = NULL;
+	static char *function                      = "libfsclfs_statistics_free";
+	int file_index                             = 0;
+	int result                                 = 1;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *statistics )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		while( ( *statistics )->slots != NULL )
+		{
+			next_slot = ( *statistics )->slots->next_slot;
+
+			memory_free(
+			 ( *statistics )->slots );
+
+			( *statistics )->slots = next_slot;
+		}
+		if( ( *statistics )->files != NULL )
+		{
+			for( file_index = 0;
+			     file_index < ( *statistics )->number_of_files;
+			     file_index++ )
+			{
+				if( ( *statistics )->files[ file_index ] != NULL )
+				{
+					memory_free(
+					 ( *statistics )->files[ file_index ] );
+				}
+			}
+			memory_free(
+			 ( *statistics )->files );
+		}
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( result );
+}
+
+/* Resets the statistics counters
+ * The file IO handles associated with the file statistics are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_reset(
+     libfsclfs_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_statistics_reset";
+	int file_index        = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( file_index = 0;
+	     file_index < statistics->number_of_files;
+	     file_index++ )
+	{
+		if( statistics->files[ file_index ] != NULL )
+		{
+			libfsclfs_statistics_counter_reset(
+			 statistics->files[ file_index ]->number_of_reads );
+
+			libfsclfs_statistics_counter_reset(
+			 statistics->files[ file_index ]->number_of_bytes_read );
+		}
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_reads );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_bytes_read );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_blocks_read );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_fixups_applied );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_failed_block_probes );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_owner_pages_read );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_records_read );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_allocations );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_records_skipped );
+
+	libfsclfs_statistics_counter_reset(
+	 statistics->number_of_region_scans );
+
+	return( 1 );
+}
+
+/* Sets the file IO handle of specific file statistics
+ * The file statistics are resized if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_set_file_io_handle(
+     libfsclfs_statistics_t *statistics,
+     int file_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *slot        = NULL;
+	libfsclfs_file_statistics_t **reallocation   = NULL;
+	libfsclfs_file_statistics_t *file_statistics = NULL;
+	static char *function                        = "libfsclfs_statistics_set_file_io_handle";
+	size_t files_size                            = 0;
+	int number_of_files                          = 0;
+	int result                                   = 1;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( file_index >= (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_file_statistics_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( file_index >= statistics->number_of_files )
+	{
+		number_of_files = file_index + 1;
+		files_size      = sizeof( libfsclfs_file_statistics_t * ) * number_of_files;
+
+		reallocation = (libfsclfs_file_statistics_t **) memory_reallocate(
+		                                                 statistics->files,
+		                                                 files_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize file statistics.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			statistics->files = reallocation;
+
+			if( memory_set(
+			     &( statistics->files[ statistics->number_of_files ] ),
+			     0,
+			     sizeof( libfsclfs_file_statistics_t * ) * ( number_of_files - statistics->number_of_files ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear file statistics.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				statistics->number_of_files = number_of_files;
+			}
+		}
+	}
+	if( ( result == 1 )
+	 && ( statistics->files[ file_index ] == NULL ) )
+	{
+		file_statistics = memory_allocate_structure(
+		                   libfsclfs_file_statistics_t );
+
+		if( file_statistics == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file statistics.",
+			 function );
+
+			result = -1;
+		}
+		else if( memory_set(
+		          file_statistics,
+		          0,
+		          sizeof( libfsclfs_file_statistics_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file statistics.",
+			 function );
+
+			memory_free(
+			 file_statistics );
+
+			result = -1;
+		}
+		else
+		{
+			statistics->files[ file_index ] = file_statistics;
+		}
+	}
+	if( result == 1 )
+	{
+		file_statistics = statistics->files[ file_index ];
+
+		for( slot = statistics->slots;
+		     slot != NULL;
+		     slot = slot->next_slot )
+		{
+			if( ( slot->is_clone == 0 )
+			 && ( slot->file_statistics == file_statistics )
+			 && ( slot->file_io_handle != NULL ) )
+			{
+				break;
+			}
+		}
+		if( slot != NULL )
+		{
+			libfsclfs_statistics_pointer_set(
+			 slot->file_io_handle,
+			 file_io_handle );
+		}
+		else if( file_io_handle != NULL )
+		{
+			if( libfsclfs_statistics_set_slot(
+			     statistics,
+			     file_io_handle,
+			     file_statistics,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set slot of file: %d.",
+				 function,
+				 file_index );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Adds a clone of a file IO handle to the statistics
+ * The reads of the clone are added to the file statistics of the source file IO handle,
+ * which can be a file IO handle with file statistics or another clone
+ * Returns 1 if successful, 0 if the source file IO handle has no file statistics or -1 on error
+ */
+int libfsclfs_statistics_add_file_io_handle_clone(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *source_file_io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *source_slot = NULL;
+	static char *function                        = "libfsclfs_statistics_add_file_io_handle_clone";
+	int result                                   = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsclfs_statistics_get_slot(
+	          statistics,
+	          source_file_io_handle,
+	          &source_slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot of source file IO handle.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		/* The clone refers to the file statistics of the source file IO handle
+		 * so a clone of a clone is not resolved when reads are added
+		 */
+		if( libfsclfs_statistics_set_slot(
+		     statistics,
+		     file_io_handle,
+		     source_slot->file_statistics,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set slot of clone.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes a clone of a file IO handle from the statistics
+ * The clone should be removed before it is freed, since its address can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_remove_file_io_handle_clone(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *slot = NULL;
+	static char *function                 = "libfsclfs_statistics_remove_file_io_handle_clone";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( slot = statistics->slots;
+	     slot != NULL;
+	     slot = slot->next_slot )
+	{
+		if( ( slot->is_clone != 0 )
+		 && ( slot->file_io_handle == file_io_handle ) )
+		{
+			libfsclfs_statistics_pointer_set(
+			 slot->file_io_handle,
+			 NULL );
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the file IO handles associated with the file statistics
+ * The file statistics counters are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_release_file_io_handles(
+     libfsclfs_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *slot = NULL;
+	static char *function                 = "libfsclfs_statistics_release_file_io_handles";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( slot = statistics->slots;
+	     slot != NULL;
+	     slot = slot->next_slot )
+	{
+		libfsclfs_statistics_pointer_set(
+		 slot->file_io_handle,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the slot of a specific file IO handle
+ * The file IO handle can be a file IO handle with file statistics or a clone
+ * The slots can be retrieved without the read/write lock
+ * Returns 1 if successful, 0 if the file IO handle has no slot or -1 on error
+ */
+int libfsclfs_statistics_get_slot(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     libfsclfs_file_io_handle_slot_t **slot,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *safe_slot = NULL;
+	static char *function                      = "libfsclfs_statistics_get_slot";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	*slot = NULL;
+
+	if( file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	safe_slot = libfsclfs_statistics_pointer_get(
+	             statistics->slots );
+
+	while( safe_slot != NULL )
+	{
+		if( libfsclfs_statistics_pointer_get(
+		     safe_slot->file_io_handle ) == file_io_handle )
+		{
+			*slot = safe_slot;
+
+			return( 1 );
+		}
+		safe_slot = safe_slot->next_slot;
+	}
+	return( 0 );
+}
+
+/* Sets the slot of a specific file IO handle
+ * A slot that is not in use is reused otherwise a slot is prepended
+ * The read/write lock should be held for writing by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_set_slot(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     libfsclfs_file_statistics_t *file_statistics,
+     uint8_t is_clone,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *slot = NULL;
+	static char *function                 = "libfsclfs_statistics_set_slot";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot = statistics->slots;
+	     slot != NULL;
+	     slot = slot->next_slot )
+	{
+		if( slot->file_io_handle == NULL )
+		{
+			break;
+		}
+	}
+	if( slot == NULL )
+	{
+		slot = memory_allocate_structure(
+		        libfsclfs_file_io_handle_slot_t );
+
+		if( slot == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slot.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     slot,
+		     0,
+		     sizeof( libfsclfs_file_io_handle_slot_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slot.",
+			 function );
+
+			memory_free(
+			 slot );
+
+			return( -1 );
+		}
+		slot->file_statistics = file_statistics;
+		slot->is_clone        = is_clone;
+		slot->file_io_handle  = file_io_handle;
+		slot->next_slot       = statistics->slots;
+
+		libfsclfs_statistics_pointer_set(
+		 statistics->slots,
+		 slot );
+	}
+	else
+	{
+		/* The file IO handle is set last so the slot is not used before it is complete
+		 */
+		slot->file_statistics = file_statistics;
+		slot->is_clone        = is_clone;
+
+		libfsclfs_statistics_pointer_set(
+		 slot->file_io_handle,
+		 file_io_handle );
+	}
+	return( 1 );
+}
+
+/* Adds a read of a specific file IO handle to the statistics
+ * Reads of file IO handles without file statistics are only added to the totals
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_add_read(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_file_io_handle_slot_t *slot = NULL;
+	static char *function                 = "libfsclfs_statistics_add_read";
+	int result                            = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsclfs_statistics_get_slot(
+	          statistics,
+	          file_io_handle,
+	          &slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot of file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libfsclfs_statistics_counter_add(
+		 slot->file_statistics->number_of_reads,
+		 1 );
+
+		libfsclfs_statistics_counter_add(
+		 slot->file_statistics->number_of_bytes_read,
+		 read_size );
+	}
+	libfsclfs_statistics_counter_add(
+	 statistics->number_of_reads,
+	 1 );
+
+	libfsclfs_statistics_counter_add(
+	 statistics->number_of_bytes_read,
+	 read_size );
+
+	return( 1 );
+}
+
+/* Retrieves a specific statistics value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_get_value(
+     libfsclfs_statistics_t *statistics,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_statistics_get_value";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( value_type )
+	{
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_READS:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_reads );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_BYTES_READ:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_bytes_read );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_BLOCKS_READ:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_blocks_read );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_FIXUPS_APPLIED:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_fixups_applied );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_FAILED_BLOCK_PROBES:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_failed_block_probes );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_OWNER_PAGES_READ:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_owner_pages_read );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_RECORDS_READ:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_records_read );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_ALLOCATIONS:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_allocations );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_RECORDS_SKIPPED:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_records_skipped );
+			break;
+
+		case LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_REGION_SCANS:
+			*value = libfsclfs_statistics_counter_get(
+			          statistics->number_of_region_scans );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: %d.",
+			 function,
+			 value_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the read statistics values of a specific file
+ * Files that were not read from have values of 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_statistics_get_file_values(
+     libfsclfs_statistics_t *statistics,
+     int file_index,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_statistics_get_file_values";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes read.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( file_index >= statistics->number_of_files )
+	 || ( statistics->files[ file_index ] == NULL ) )
+	{
+		*number_of_reads      = 0;
+		*number_of_bytes_read = 0;
+	}
+	else
+	{
+		*number_of_reads = libfsclfs_statistics_counter_get(
+		                    statistics->files[ file_index ]->number_of_reads );
+
+		*number_of_bytes_read = libfsclfs_statistics_counter_get(
+		                         statistics->files[ file_index ]->number_of_bytes_read );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,266 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_STATISTICS_H )
+#define _LIBFSCLFS_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The counters are updated with relaxed atomic operations where available
+ * so they can be read while other threads are reading from the store
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define libfsclfs_statistics_counter_add( counter, value ) \
+	__atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define libfsclfs_statistics_counter_get( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#define libfsclfs_statistics_counter_reset( counter ) \
+	__atomic_store_n( &( counter ), 0, __ATOMIC_RELAXED )
+
+#define libfsclfs_statistics_pointer_get( pointer ) \
+	__atomic_load_n( &( pointer ), __ATOMIC_ACQUIRE )
+
+#define libfsclfs_statistics_pointer_set( pointer, value ) \
+	__atomic_store_n( &( pointer ), ( value ), __ATOMIC_RELEASE )
+
+#elif defined( WINAPI ) && !defined( __BORLANDC__ )
+#define libfsclfs_statistics_counter_add( counter, value ) \
+	InterlockedExchangeAdd64( (LONGLONG volatile *) &( counter ), (LONGLONG) ( value ) )
+
+#define libfsclfs_statistics_counter_get( counter ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) &( counter ), 0, 0 )
+
+#define libfsclfs_statistics_counter_reset( counter ) \
+	InterlockedExchange64( (LONGLONG volatile *) &( counter ), 0 )
+
+#define libfsclfs_statistics_pointer_get( pointer ) \
+	InterlockedCompareExchangePointer( (PVOID volatile *) &( pointer ), NULL, NULL )
+
+#define libfsclfs_statistics_pointer_set( pointer, value ) \
+	InterlockedExchangePointer( (PVOID volatile *) &( pointer ), (PVOID) ( value ) )
+
+#else
+#define libfsclfs_statistics_counter_add( counter, value ) \
+	( counter ) += (uint64_t) ( value )
+
+#define libfsclfs_statistics_counter_get( counter ) \
+	( counter )
+
+#define libfsclfs_statistics_counter_reset( counter ) \
+	( counter ) = 0
+
+#define libfsclfs_statistics_pointer_get( pointer ) \
+	( pointer )
+
+#define libfsclfs_statistics_pointer_set( pointer, value ) \
+	( pointer ) = ( value )
+
+#endif /* defined( __GNUC__ ) || defined( __clang__ ) */
+
+typedef struct libfsclfs_file_statistics libfsclfs_file_statistics_t;
+
+struct libfsclfs_file_statistics
+{
+	/* The number of read calls
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+};
+
+typedef struct libfsclfs_file_io_handle_slot libfsclfs_file_io_handle_slot_t;
+
+struct libfsclfs_file_io_handle_slot
+{
+	/* The file IO handle
+	 * NULL if the slot is not in use
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file statistics the reads of the file IO handle are added to
+	 */
+	libfsclfs_file_statistics_t *file_statistics;
+
+	/* Value to indicate the file IO handle is a clone
+	 */
+	uint8_t is_clone;
+
+	/* The next slot
+	 */
+	libfsclfs_file_io_handle_slot_t *next_slot;
+};
+
+typedef struct libfsclfs_statistics libfsclfs_statistics_t;
+
+struct libfsclfs_statistics
+{
+	/* The file statistics
+	 * file index 0 contains the base log file
+	 * file index 1 + N contains the container file with physical number N
+	 * the file statistics are allocated individually so they are not moved when the array is resized
+	 */
+	libfsclfs_file_statistics_t **files;
+
+	/* The number of file statistics
+	 */
+	int number_of_files;
+
+	/* The file IO handle slots
+	 * the slot of a file IO handle or a clone refers directly to the file statistics
+	 * slots are only prepended or reused and freed with the statistics,
+	 * hence reads are added without the read/write lock
+	 */
+	libfsclfs_file_io_handle_slot_t *slots;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * serializes changes to the file statistics and slots
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+
+	/* The number of read calls
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of blocks read
+	 */
+	uint64_t number_of_blocks_read;
+
+	/* The number of fix-up values applied
+	 */
+	uint64_t number_of_fixups_applied;
+
+	/* The number of failed block probes
+	 */
+	uint64_t number_of_failed_block_probes;
+
+	/* The number of owner pages read
+	 */
+	uint64_t number_of_owner_pages_read;
+
+	/* The number of records read
+	 */
+	uint64_t number_of_records_read;
+
+	/* The number of allocations
+	 * only the allocations of block data are counted, a block that is read
+	 * into a block of sufficient size does not allocate
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of records skipped by a record filter
+	 */
+	uint64_t number_of_records_skipped;
+
+	/* The number of regions scanned since their owner page was not valid
+	 */
+	uint64_t number_of_region_scans;
+};
+
+int libfsclfs_statistics_initialize(
+     libfsclfs_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_free(
+     libfsclfs_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_reset(
+     libfsclfs_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_set_file_io_handle(
+     libfsclfs_statistics_t *statistics,
+     int file_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_add_file_io_handle_clone(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *source_file_io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_remove_file_io_handle_clone(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_release_file_io_handles(
+     libfsclfs_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_get_slot(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     libfsclfs_file_io_handle_slot_t **slot,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_set_slot(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     libfsclfs_file_statistics_t *file_statistics,
+     uint8_t is_clone,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_add_read(
+     libfsclfs_statistics_t *statistics,
+     libbfio_handle_t *file_io_handle,
+     size_t read_size,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_get_value(
+     libfsclfs_statistics_t *statistics,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libfsclfs_statistics_get_file_values(
+     libfsclfs_statistics_t *statistics,
+     int file_index,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_STATISTICS_H ) */
+
@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -26,12 +27,15 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfsclfs_aligned_pool.h"
 #include "libfsclfs_block.h"
+#include "libfsclfs_block_scanner.h"
 #include "libfsclfs_block_descriptor.h"
 #include "libfsclfs_container.h"
 #include "libfsclfs_container_descriptor.h"
 #include "libfsclfs_debug.h"
 #include "libfsclfs_definitions.h"
+#include "libfsclfs_direct_file.h"
 #include "libfsclfs_io_handle.h"
 #include "libfsclfs_libbfio.h"
 #include "libfsclfs_libcdata.h"
@@ -40,13 +44,24 @@
 #include "libfsclfs_libcnotify.h"
 #include "libfsclfs_libfguid.h"
 #include "libfsclfs_libuna.h"
+#include "libfsclfs_log_range.h"
 #include "libfsclfs_owner_page.h"
+#include "libfsclfs_record_filter.h"
+#include "libfsclfs_record_header_table.h"
+#include "libfsclfs_region_scanner.h"
+#include "libfsclfs_scheduler.h"
+#include "libfsclfs_statistics.h"
 #include "libfsclfs_store.h"
 #include "libfsclfs_stream.h"
 #include "libfsclfs_stream_descriptor.h"
+#include "libfsclfs_trace.h"
 #include "libfsclfs_types.h"
+#include "libfsclfs_unused.h"
+#include "libfsclfs_verifier.h"
 
 #include "fsclfs_base_log_record.h"
+#include "fsclfs_block.h"
+#include "fsclfs_record.h"
 
 /* Creates a store
  * Make sure the value store is referencing, is set to NULL
@@ -140,6 +155,20 @@ int libfsclfs_store_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( internal_store->container_block_maps_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container block maps array.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfsclfs_io_handle_initialize(
 	     &( internal_store->io_handle ),
 	     error ) != 1 )
@@ -154,6 +183,7 @@ int libfsclfs_store_initialize(
 		goto on_error;
 	}
 	internal_store->maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	internal_store->number_of_threads              = LIBFSCLFS_DEFAULT_NUMBER_OF_THREADS;
 
 	*store = (libfsclfs_store_t *) internal_store;
 
@@ -162,6 +192,13 @@ int libfsclfs_store_initialize(
 on_error:
 	if( internal_store != NULL )
 	{
+		if( internal_store->container_block_maps_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_store->container_block_maps_array ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_owner_page_free,
+			 NULL );
+		}
 		if( internal_store->stream_descriptors_array != NULL )
 		{
 			libcdata_array_free(
@@ -255,6 +292,36 @@ int libfsclfs_store_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( internal_store->container_block_maps_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_owner_page_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free container block maps array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_store->aligned_pool != NULL )
+		{
+			if( libfsclfs_aligned_pool_free(
+			     &( internal_store->aligned_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free aligned pool.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_store->basename != NULL )
 		{
 			memory_free(
@@ -411,18 +478,55 @@ int libfsclfs_store_open(
 			goto on_error;
 		}
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( internal_store->use_direct_io != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
+		if( libfsclfs_store_initialize_direct_io_file_io_handle(
+		     internal_store,
+		     &file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO file IO handle.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
@@ -440,21 +544,6 @@ int libfsclfs_store_open(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
 	if( libfsclfs_store_open_file_io_handle(
 	     store,
 	     file_io_handle,
@@ -550,6 +639,17 @@ int libfsclfs_store_open_wide(
 
 		return( -1 );
 	}
+	if( internal_store->use_direct_io != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO not supported with wide character filenames.",
+		 function );
+
+		return( -1 );
+	}
 	filename_length = wide_string_length(
 	                   filename );
 
@@ -685,6 +785,17 @@ int libfsclfs_store_open_file_io_handle(
 	}
 	internal_store = (libfsclfs_internal_store_t *) store;
 
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_store->base_log_file_io_handle != NULL )
 	{
 		libcerror_error_set(
@@ -730,6 +841,14 @@ int libfsclfs_store_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_OPEN,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+		 0 );
+	}
 	if( ( access_flags & LIBFSCLFS_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
@@ -767,6 +886,21 @@ int libfsclfs_store_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
+	if( libfsclfs_statistics_set_file_io_handle(
+	     internal_store->io_handle->statistics,
+	     0,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set base log file IO handle in statistics.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfsclfs_store_open_read(
 	     internal_store,
 	     file_io_handle,
@@ -781,13 +915,42 @@ int libfsclfs_store_open_file_io_handle(
 
 		goto on_error;
 	}
+	if( libfsclfs_store_determine_log_type(
+	     internal_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine log type.",
+		 function );
+
+		goto on_error;
+	}
 	internal_store->base_log_file_io_handle                   = file_io_handle;
 	internal_store->base_log_file_io_handle_opened_in_library = file_io_handle_opened_in_library;
 	internal_store->access_flags                              = access_flags;
 
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_OPEN,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+		 0 );
+	}
 	return( 1 );
 
 on_error:
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_OPEN,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+		 0 );
+	}
 	if( file_io_handle_opened_in_library != 0 )
 	{
 		libbfio_handle_close(
@@ -799,6 +962,12 @@ on_error:
 
 /* Opens the containers
  * This function assumes the container files are in the same location as the base log file
+ * The containers are opened and their first block header is read as tasks of the scheduler
+ * so that opening many containers, for example on a network share, is not serialized
+ * The opened containers are added to the container file IO pool in container order
+ * and if multiple containers fail to open the error of the first one is reported
+ * Containers that were opened by a previous call are not opened again, hence
+ * after a refresh only the containers that were added are opened
  * Returns 1 if successful or -1 on error
  */
 int libfsclfs_store_open_containers(
@@ -807,15 +976,16 @@ int libfsclfs_store_open_containers(
 {
 	libfsclfs_container_descriptor_t *container_descriptor = NULL;
 	libfsclfs_internal_store_t *internal_store             = NULL;
-	system_character_t *container_location                 = NULL;
-	system_character_t *container_name                     = NULL;
-	system_character_t *container_name_start               = NULL;
+	libfsclfs_scheduler_t *scheduler                       = NULL;
+	libfsclfs_store_container_open_task_t *tasks           = NULL;
 	static char *function                                  = "libfsclfs_store_open_containers";
-	size_t container_location_size                         = 0;
-	size_t container_name_size                             = 0;
-	int container_descriptor_index                         = 0;
+	size_t tasks_size                                      = 0;
+	int first_container_descriptor_index                   = 0;
 	int number_of_container_descriptors                    = 0;
-	int result                                             = 1;
+	int number_of_tasks                                    = 0;
+	int number_of_tasks_per_worker                         = 0;
+	int number_of_threads                                  = 0;
+	int task_index                                         = 0;
 
 	if( store == NULL )
 	{
@@ -841,6 +1011,28 @@ int libfsclfs_store_open_containers(
 
 		return( -1 );
  	}
+	if( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_store->container_descriptors_array,
 	     &number_of_container_descriptors,
@@ -855,13 +1047,69 @@ int libfsclfs_store_open_containers(
 
 		return( -1 );
 	}
-	for( container_descriptor_index = 0;
-	     container_descriptor_index < number_of_container_descriptors;
-	     container_descriptor_index++ )
+	/* Only the containers added since the previous call are opened
+	 * the container descriptors of a refresh are appended
+	 */
+	first_container_descriptor_index = internal_store->number_of_opened_container_descriptors;
+
+	if( first_container_descriptor_index >= number_of_container_descriptors )
+	{
+		internal_store->containers_opened_in_library = 1;
+
+		return( 1 );
+	}
+	number_of_tasks = number_of_container_descriptors - first_container_descriptor_index;
+	tasks_size      = sizeof( libfsclfs_store_container_open_task_t ) * number_of_tasks;
+
+	if( tasks_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid tasks size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	tasks = (libfsclfs_store_container_open_task_t *) memory_allocate(
+	                                                   tasks_size );
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     tasks,
+	     0,
+	     tasks_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tasks.",
+		 function );
+
+		memory_free(
+		 tasks );
+
+		return( -1 );
+	}
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     internal_store->container_descriptors_array,
-		     container_descriptor_index,
+		     first_container_descriptor_index + task_index,
 		     (intptr_t **) &container_descriptor,
 		     error ) != 1 )
 		{
@@ -871,9 +1119,9 @@ int libfsclfs_store_open_containers(
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve container descriptor: %d.",
 			 function,
-			 container_descriptor_index );
+			 first_container_descriptor_index + task_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( container_descriptor == NULL )
 		{
@@ -883,9 +1131,9 @@ int libfsclfs_store_open_containers(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing container descriptor: %d.",
 			 function,
-			 container_descriptor_index );
+			 first_container_descriptor_index + task_index );
 
-			return( -1 );
+			goto on_error;
 		}
 /* TODO determine what unknown2 contains
 		if( container_descriptor->unknown2 == 0 )
@@ -893,239 +1141,256 @@ int libfsclfs_store_open_containers(
 			continue;
 		}
 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfsclfs_container_descriptor_get_utf16_name_size(
-		          container_descriptor,
-		          &container_name_size,
-		          error );
-#else
-		result = libfsclfs_container_descriptor_get_utf8_name_size(
-		          container_descriptor,
-		          &container_name_size,
-		          error );
-#endif
-		if( result != 1 )
+		tasks[ task_index ].internal_store  = internal_store;
+		tasks[ task_index ].container_index = (int) container_descriptor->physical_number;
+
+		if( libfsclfs_store_get_container_location(
+		     internal_store,
+		     container_descriptor,
+		     &( tasks[ task_index ].container_location ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine container name size.",
-			 function );
+			 "%s: unable to retrieve location of container: %d.",
+			 function,
+			 first_container_descriptor_index + task_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		container_name = system_string_allocate(
-		                  container_name_size );
-
-		if( container_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create container name.",
-			 function );
+	}
+	number_of_threads = internal_store->number_of_threads;
 
-			return( -1 );
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfsclfs_container_descriptor_get_utf16_name(
-		          container_descriptor,
-		          (libuna_utf16_character_t *) container_name,
-		          container_name_size,
-		          error );
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > number_of_tasks )
+	{
+		number_of_threads = number_of_tasks;
+	}
 #else
-		result = libfsclfs_container_descriptor_get_utf8_name(
-		          container_descriptor,
-		          (libuna_utf8_character_t *) container_name,
-		          container_name_size,
-		          error );
+	number_of_threads = 1;
 #endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy container name.",
-			 function );
-
-			memory_free(
-			 container_name );
+	number_of_tasks_per_worker = number_of_tasks / number_of_threads;
 
-			return( -1 );
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		container_name_start = wide_string_search_character_reverse(
-		                        container_name,
-		                        (wint_t) '\\',
-		                        container_name_size );
-#else
-		container_name_start = narrow_string_search_character_reverse(
-		                        container_name,
-		                        (int) '\\',
-		                        container_name_size );
-#endif
+	if( ( number_of_tasks % number_of_threads ) != 0 )
+	{
+		number_of_tasks_per_worker += 1;
+	}
+	if( libfsclfs_scheduler_initialize(
+	     &scheduler,
+	     number_of_threads,
+	     number_of_tasks_per_worker,
+	     (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &libfsclfs_store_open_container_task_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scheduler.",
+		 function );
 
-		if( container_name_start != NULL )
+		goto on_error;
+	}
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( libfsclfs_scheduler_push_task(
+		     scheduler,
+		     task_index / number_of_tasks_per_worker,
+		     (intptr_t *) &( tasks[ task_index ] ),
+		     error ) != 1 )
 		{
-			/* Ignore the path separator itself
-			 */
-			container_name_start++;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push container: %d onto scheduler.",
+			 function,
+			 first_container_descriptor_index + task_index );
 
-/* TODO does this work for UTF-16 ? */
-			container_name_size -= (size_t) ( container_name_start - container_name );
-		}
-		else
-		{
-			container_name_start = container_name;
+			goto on_error;
 		}
-		if( internal_store->basename != NULL )
-		{
-			container_location_size = internal_store->basename_size + container_name_size - 1;
-
-			container_location = system_string_allocate(
-			                      container_location_size );
-
-			if( container_location == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create container location.",
-				 function );
-
-				memory_free(
-				 container_name );
-
-				return( -1 );
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( wide_string_copy(
-			     container_location,
-			     internal_store->basename,
-			     internal_store->basename_size - 1 ) == NULL )
-#else
-			if( narrow_string_copy(
-			     container_location,
-			     internal_store->basename,
-			     internal_store->basename_size - 1 ) == NULL )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy basename to container location.",
-				 function );
-
-				memory_free(
-				 container_location );
-				memory_free(
-				 container_name );
-
-				return( -1 );
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( wide_string_copy(
-			     &( container_location[ internal_store->basename_size - 1 ] ),
-			     container_name_start,
-			     container_name_size - 1 ) == NULL )
-#else
-			if( narrow_string_copy(
-			     &( container_location[ internal_store->basename_size - 1 ] ),
-			     container_name_start,
-			     container_name_size - 1 ) == NULL )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy container name to container location.",
-				 function );
+	}
+	if( libfsclfs_scheduler_run(
+	     scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run scheduler.",
+		 function );
 
-				memory_free(
-				 container_location );
-				memory_free(
-				 container_name );
+		goto on_error;
+	}
+	if( libfsclfs_scheduler_free(
+	     &scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scheduler.",
+		 function );
 
-				return( -1 );
-			}
-			memory_free(
-			 container_name );
+		goto on_error;
+	}
+	if( internal_store->io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
 
-			container_location[ container_location_size - 1 ] = 0;
-		}
-		else
-		{
-			container_location      = container_name_start;
-			container_location_size = container_name_size;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		goto on_error;
+	}
+	/* The results are checked in container order so that the reported error
+	 * does not depend on the order in which the tasks finished
+	 */
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].result == 0 )
 		{
-			libcnotify_printf(
-			 "%s: opening container: %" PRIs_SYSTEM "\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: container: %" PRIs_SYSTEM " was not opened.",
 			 function,
-			 container_location );
+			 tasks[ task_index ].container_location );
+
+			goto on_error;
 		}
-#endif
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfsclfs_store_open_container_wide(
-		          internal_store,
-		          container_descriptor->physical_number,
-		          container_location,
-		          error );
-#else
-		result = libfsclfs_store_open_container(
-		          internal_store,
-		          container_descriptor->physical_number,
-		          container_location,
-		          error );
-#endif
-		if( result != 1 )
+		else if( tasks[ task_index ].result != 1 )
 		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = tasks[ task_index ].error;
+
+				tasks[ task_index ].error = NULL;
+			}
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_OPEN_FAILED,
 			 "%s: unable to open container: %" PRIs_SYSTEM ".",
 			 function,
-			 container_location );
-		}
-		if( container_location != container_name_start )
-		{
-			memory_free(
-			 container_location );
+			 tasks[ task_index ].container_location );
+
+			goto on_error;
 		}
-		else
+	}
+	/* The container file IO pool is not thread-safe hence the containers
+	 * are added after all the tasks have finished
+	 */
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( libfsclfs_store_set_container_file_io_handle(
+		     internal_store,
+		     tasks[ task_index ].container_index,
+		     tasks[ task_index ].file_io_handle,
+		     error ) != 1 )
 		{
-			memory_free(
-			 container_name );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO handle of container: %" PRIs_SYSTEM ".",
+			 function,
+			 tasks[ task_index ].container_location );
+
+			goto on_error;
 		}
-		if( result != 1 )
+		/* The container file IO pool now manages the file IO handle
+		 */
+		tasks[ task_index ].file_io_handle = NULL;
+
+		internal_store->number_of_opened_container_descriptors = first_container_descriptor_index + task_index + 1;
+	}
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		memory_free(
+		 tasks[ task_index ].container_location );
+	}
+	memory_free(
+	 tasks );
+
+	internal_store->containers_opened_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
 		{
-			break;
+			if( tasks[ task_index ].file_io_handle != NULL )
+			{
+				libbfio_handle_close(
+				 tasks[ task_index ].file_io_handle,
+				 NULL );
+				libbfio_handle_free(
+				 &( tasks[ task_index ].file_io_handle ),
+				 NULL );
+			}
+			if( tasks[ task_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( tasks[ task_index ].error ) );
+			}
+			if( tasks[ task_index ].container_location != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].container_location );
+			}
 		}
+		memory_free(
+		 tasks );
 	}
-	return( result );
+	return( -1 );
 }
 
-/* Opens a specific container
+/* Retrieves the location of a container
+ * The location consists of the basename of the base log file and the name of the container
+ * without its path
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_open_container(
+int libfsclfs_store_get_container_location(
      libfsclfs_internal_store_t *internal_store,
-     int container_index,
-     const char *filename,
+     libfsclfs_container_descriptor_t *container_descriptor,
+     system_character_t **container_location,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libfsclfs_store_open_container";
-	size_t filename_length           = 0;
+	system_character_t *container_name       = NULL;
+	system_character_t *container_name_start = NULL;
+	static char *function                    = "libfsclfs_store_get_container_location";
+	size_t basename_length                   = 0;
+	size_t container_location_size           = 0;
+	size_t container_name_size               = 0;
+	int result                               = 0;
 
 	if( internal_store == NULL )
 	{
@@ -1138,240 +1403,356 @@ int libfsclfs_store_open_container(
 
 		return( -1 );
 	}
-	if( internal_store->base_log_file_io_handle == NULL )
+	if( container_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid store - missing base log file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container descriptor.",
 		 function );
 
 		return( -1 );
- 	}
-	if( filename == NULL )
+	}
+	if( container_location == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid container location.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( *container_location != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container location value already set.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-                goto on_error;
+		return( -1 );
 	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsclfs_container_descriptor_get_utf16_name_size(
+	          container_descriptor,
+	          &container_name_size,
+	          error );
+#else
+	result = libfsclfs_container_descriptor_get_utf8_name_size(
+	          container_descriptor,
+	          &container_name_size,
+	          error );
 #endif
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	if( result != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine container name size.",
+		 function );
 
-                goto on_error;
+		goto on_error;
 	}
-	if( libfsclfs_store_open_container_file_io_handle(
-	     internal_store,
-	     container_index,
-	     file_io_handle,
-	     error ) != 1 )
+	container_name = system_string_allocate(
+	                  container_name_size );
+
+	if( container_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open container: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create container name.",
+		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsclfs_container_descriptor_get_utf16_name(
+	          container_descriptor,
+	          (libuna_utf16_character_t *) container_name,
+	          container_name_size,
+	          error );
+#else
+	result = libfsclfs_container_descriptor_get_utf8_name(
+	          container_descriptor,
+	          (libuna_utf8_character_t *) container_name,
+	          container_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy container name.",
+		 function );
+
+		goto on_error;
 	}
-	return( -1 );
-}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	container_name_start = wide_string_search_character_reverse(
+	                        container_name,
+	                        (wint_t) '\\',
+	                        container_name_size );
+#else
+	container_name_start = narrow_string_search_character_reverse(
+	                        container_name,
+	                        (int) '\\',
+	                        container_name_size );
+#endif
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( container_name_start != NULL )
+	{
+		/* Ignore the path separator itself
+		 */
+		container_name_start++;
 
-/* Opens a specific container
- * Returns 1 if successful or -1 on error
- */
-int libfsclfs_store_open_container_wide(
-     libfsclfs_internal_store_t *internal_store,
-     int container_index,
-     const wchar_t *filename,
-     libcerror_error_t **error )
-{
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libfsclfs_container_open_wide";
-	size_t filename_length           = 0;
+/* TODO does this work for UTF-16 ? */
+		container_name_size -= (size_t) ( container_name_start - container_name );
+	}
+	else
+	{
+		container_name_start = container_name;
+	}
+	if( internal_store->basename != NULL )
+	{
+		basename_length = internal_store->basename_size - 1;
+	}
+	container_location_size = basename_length + container_name_size;
 
-	if( internal_store == NULL )
+	*container_location = system_string_allocate(
+	                       container_location_size );
+
+	if( *container_location == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create container location.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_store->base_log_file_io_handle == NULL )
+	if( basename_length > 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( wide_string_copy(
+		     *container_location,
+		     internal_store->basename,
+		     basename_length ) == NULL )
+#else
+		if( narrow_string_copy(
+		     *container_location,
+		     internal_store->basename,
+		     basename_length ) == NULL )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy basename to container location.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( wide_string_copy(
+	     &( ( *container_location )[ basename_length ] ),
+	     container_name_start,
+	     container_name_size - 1 ) == NULL )
+#else
+	if( narrow_string_copy(
+	     &( ( *container_location )[ basename_length ] ),
+	     container_name_start,
+	     container_name_size - 1 ) == NULL )
+#endif
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing base log file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy container name to container location.",
 		 function );
 
-		return( -1 );
- 	}
-	if( filename == NULL )
+		goto on_error;
+	}
+	( *container_location )[ container_location_size - 1 ] = 0;
+
+	memory_free(
+	 container_name );
+
+	return( 1 );
+
+on_error:
+	if( *container_location != NULL )
+	{
+		memory_free(
+		 *container_location );
+
+		*container_location = NULL;
+	}
+	if( container_name != NULL )
+	{
+		memory_free(
+		 container_name );
+	}
+	return( -1 );
+}
+
+/* Opens a container and reads its first block header as a task of the scheduler
+ * The file IO handle is not added to the container file IO pool, which is done
+ * by libfsclfs_store_open_containers after all the tasks have finished
+ * A container that cannot be opened is recorded in the task result and error,
+ * so that the other tasks still run and the first failing container is reported
+ * Returns 1 if successful or if the failure was recorded in the task or -1 on error
+ */
+int libfsclfs_store_open_container_task_callback(
+     libfsclfs_store_container_open_task_t *task,
+     int worker_index LIBFSCLFS_ATTRIBUTE_UNUSED,
+     void *callback_data LIBFSCLFS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	libcerror_error_t *open_error              = NULL;
+	static char *function                      = "libfsclfs_store_open_container_task_callback";
+	int result                                 = 0;
+
+	LIBFSCLFS_UNREFERENCED_PARAMETER( worker_index )
+	LIBFSCLFS_UNREFERENCED_PARAMETER( callback_data )
+
+	if( task == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid task.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	internal_store = task->internal_store;
+
+	if( internal_store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid task - missing internal store.",
 		 function );
 
-                goto on_error;
+		return( -1 );
+	}
+	/* Skip the remaining containers if abort was signalled
+	 */
+	if( internal_store->io_handle->abort != 0 )
+	{
+		return( 1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( libcnotify_verbose != 0 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-                goto on_error;
+		libcnotify_printf(
+		 "%s: opening container: %" PRIs_SYSTEM "\n",
+		 function,
+		 task->container_location );
 	}
 #endif
-	filename_length = wide_string_length(
-	                   filename );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsclfs_store_initialize_container_file_io_handle_wide(
+	          internal_store,
+	          &( task->file_io_handle ),
+	          task->container_location,
+	          &open_error );
+#else
+	result = libfsclfs_store_initialize_container_file_io_handle(
+	          internal_store,
+	          &( task->file_io_handle ),
+	          task->container_location,
+	          &open_error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &open_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
 
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     task->file_io_handle,
+	     LIBBFIO_ACCESS_FLAG_READ,
+	     &open_error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 &open_error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
 
-                goto on_error;
+		goto on_error;
 	}
-	if( libfsclfs_store_open_container_file_io_handle(
+	if( libfsclfs_store_read_container_first_block_header(
 	     internal_store,
-	     container_index,
-	     file_io_handle,
-	     error ) != 1 )
+	     task->file_io_handle,
+	     &open_error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &open_error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open container: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read first block header.",
+		 function );
 
 		goto on_error;
 	}
+	task->result = 1;
+
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( task->file_io_handle != NULL )
 	{
+		libbfio_handle_close(
+		 task->file_io_handle,
+		 NULL );
 		libbfio_handle_free(
-		 &file_io_handle,
+		 &( task->file_io_handle ),
 		 NULL );
 	}
-	return( -1 );
-}
+	task->result = -1;
+	task->error  = open_error;
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+	return( 1 );
+}
 
-/* Opens a container using a Basic File IO (bfio) handle
+/* Creates a file IO handle of a container
+ * Make sure the value file_io_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_open_container_file_io_handle(
+int libfsclfs_store_initialize_container_file_io_handle(
      libfsclfs_internal_store_t *internal_store,
-     int container_index,
-     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t **file_io_handle,
+     const char *filename,
      libcerror_error_t **error )
 {
-	static char *function               = "libfsclfs_store_open_container_file_io_handle";
-	int bfio_access_flags               = 0;
-	int number_of_container_descriptors = 0;
+	static char *function  = "libfsclfs_store_initialize_container_file_io_handle";
+	size_t filename_length = 0;
 
 	if( internal_store == NULL )
 	{
@@ -1384,17 +1765,6 @@ int libfsclfs_store_open_container_file_io_handle(
 
 		return( -1 );
 	}
-	if( internal_store->base_log_file_io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing base log file IO handle.",
-		 function );
-
-		return( -1 );
- 	}
 	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1406,292 +1776,256 @@ int libfsclfs_store_open_container_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( *file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_WRITE ) != 0 )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_store->container_file_io_pool == NULL )
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( internal_store->use_direct_io != 0 )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_store->container_descriptors_array,
-		     &number_of_container_descriptors,
+		if( libfsclfs_store_initialize_direct_io_file_io_handle(
+		     internal_store,
+		     file_io_handle,
+		     filename,
+		     filename_length,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of container descriptors.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO file IO handle.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( libbfio_pool_initialize(
-		     &( internal_store->container_file_io_pool ),
-		     number_of_container_descriptors,
-		     internal_store->maximum_number_of_open_handles,
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create container file IO pool.",
+			 "%s: unable to create file IO handle.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     *file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
 		}
-		internal_store->container_file_io_pool_created_in_library = 1;
 	}
-	if( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	if( libbfio_handle_open(
-	     file_io_handle,
-	     bfio_access_flags,
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     *file_io_handle,
+	     1,
 	     error ) != 1 )
 	{
                 libcerror_error_set(
                  error,
-                 LIBCERROR_ERROR_DOMAIN_IO,
-                 LIBCERROR_IO_ERROR_OPEN_FAILED,
-                 "%s: unable to open file IO handle.",
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
                  function );
 
-                return( -1 );
+                goto on_error;
 	}
-	/* This function currently does not allow the file_io_handle to be set more than once
-	 */
-	if( libbfio_pool_set_handle(
-	     internal_store->container_file_io_pool,
-	     container_index,
-	     file_io_handle,
-	     bfio_access_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set file IO handle: %d in pool.",
-		 function,
-		 container_index );
+#endif
+	return( 1 );
 
-		return( -1 );
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
 	}
-	return( 1 );
+	return( -1 );
 }
 
-/* Closes a store
- * Returns 0 if successful or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Creates a file IO handle of a container
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_close(
-     libfsclfs_store_t *store,
+int libfsclfs_store_initialize_container_file_io_handle_wide(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t **file_io_handle,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
-	libfsclfs_internal_store_t *internal_store = NULL;
-	static char *function                      = "libfsclfs_store_close";
-	int result                                 = 0;
+	static char *function  = "libfsclfs_store_initialize_container_file_io_handle_wide";
+	size_t filename_length = 0;
 
-	if( store == NULL )
+	if( internal_store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid store.",
+		 "%s: invalid internal store.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store = (libfsclfs_internal_store_t *) store;
-
-	if( internal_store->io_handle == NULL )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid store - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_store->base_log_file_io_handle_created_in_library != 0 )
-		{
-			if( libfsclfs_debug_print_read_offsets(
-			     internal_store->base_log_file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-			}
-		}
-	}
-#endif
-	if( internal_store->base_log_file_io_handle_opened_in_library != 0 )
+	if( *file_io_handle != NULL )
 	{
-		if( libbfio_handle_close(
-		     internal_store->base_log_file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close base log file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
 
-			result = -1;
-		}
-		internal_store->base_log_file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_store->base_log_file_io_handle_created_in_library != 0 )
+	if( filename == NULL )
 	{
-		if( libbfio_handle_free(
-		     &( internal_store->base_log_file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free base log file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-			result = -1;
-		}
-		internal_store->base_log_file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_store->base_log_file_io_handle = NULL;
-
-	if( internal_store->container_file_io_pool_created_in_library != 0 )
+	if( internal_store->use_direct_io != 0 )
 	{
-		if( libbfio_pool_close_all(
-		     internal_store->container_file_io_pool,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close all container file IO pool handles.",
-			 function );
-
-			result = -1;
-		}
-		if( libbfio_pool_free(
-		     &( internal_store->container_file_io_pool ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free container file IO pool.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO not supported with wide character filenames.",
+		 function );
 
-			result = -1;
-		}
-		internal_store->container_file_io_pool_created_in_library = 0;
+		return( -1 );
 	}
-	internal_store->container_file_io_pool    = NULL;
-	internal_store->store_metadata_dump_count = 0;
-
-	if( libfsclfs_io_handle_clear(
-	     internal_store->io_handle,
+	if( libbfio_file_initialize(
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		result = -1;
+                goto on_error;
 	}
-	if( internal_store->basename != NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     *file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		memory_free(
-		 internal_store->basename );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
+                goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_store->container_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     *file_io_handle,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty container descriptors array.",
-		 function );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
 
-		result = -1;
+                goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_store->stream_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty stream descriptors array.",
-		 function );
+	return( 1 );
 
-		result = -1;
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
 	}
-	return( result );
+	return( -1 );
 }
 
-/* Opens a store for reading
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the first block header of a container
+ * A container that was not yet used by the log can start with data other than a block
+ * hence only a container that starts with the block signature is required to contain
+ * a valid block header
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_open_read(
+int libfsclfs_store_read_container_first_block_header(
      libfsclfs_internal_store_t *internal_store,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libcdata_array_t *block_descriptors_array      = NULL;
-	libfsclfs_block_descriptor_t *block_descriptor = NULL;
-	static char *function                          = "libfsclfs_store_open_read";
-	uint32_t block_descriptors_block_size          = 0;
-	uint32_t store_metadata_block_size             = 0;
-	int block_descriptor_index                     = 0;
-	int number_of_block_descriptors                = 0;
+	uint8_t block_header_data[ sizeof( fsclfs_block_header_t ) ];
+
+	libfsclfs_block_t *block = NULL;
+	static char *function    = "libfsclfs_store_read_container_first_block_header";
+	ssize_t read_count       = 0;
 
 	if( internal_store == NULL )
 	{
@@ -1704,186 +2038,102 @@ int libfsclfs_store_open_read(
 
 		return( -1 );
 	}
-	if( internal_store->io_handle == NULL )
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              block_header_data,
+	              sizeof( fsclfs_block_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( fsclfs_block_header_t ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid store - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block header data at offset: 0 (0x00000000).",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	block_descriptors_block_size = internal_store->io_handle->bytes_per_sector * 0x02;
-	store_metadata_block_size    = internal_store->io_handle->bytes_per_sector * 0x3d;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( block_header_data[ 0 ] != 0x15 )
+	 || ( block_header_data[ 1 ] != 0x00 ) )
 	{
-		libcnotify_printf(
-		 "Reading block descriptors\n" );
-	}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: container does not start with a block.\n",
+			 function );
+		}
 #endif
-	if( libcdata_array_initialize(
-	     &block_descriptors_array,
-	     0,
+		return( 1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block descriptors array.",
+		 "%s: unable to create block.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsclfs_store_read_block_descriptors(
-	     internal_store,
-	     file_io_handle,
-	     0,
-	     block_descriptors_block_size,
-	     block_descriptors_array,
+	if( libfsclfs_block_read_header_data(
+	     block,
+	     internal_store->io_handle,
+	     block_header_data,
+	     sizeof( fsclfs_block_header_t ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block descriptors.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_get_number_of_entries(
-	     block_descriptors_array,
-	     &number_of_block_descriptors,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of block descriptors.",
+		 "%s: unable to read block header.",
 		 function );
 
 		goto on_error;
 	}
-	internal_store->store_metadata_dump_count = 0;
-
-	for( block_descriptor_index = 0;
-	     block_descriptor_index < number_of_block_descriptors;
-	     block_descriptor_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     block_descriptors_array,
-		     block_descriptor_index,
-		     (intptr_t **) &block_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve block descriptor: %d from array.",
-			 function,
-			 block_descriptor_index );
-
-			goto on_error;
-		}
-		if( block_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing block descriptor: %d.",
-			 function,
-			 block_descriptor_index );
-
-			goto on_error;
-		}
-		if( block_descriptor->size == store_metadata_block_size )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "Reading store metadata\n" );
-			}
-#endif
-			if( libfsclfs_store_read_store_metadata(
-			     internal_store,
-			     file_io_handle,
-			     block_descriptor->offset,
-			     block_descriptor->size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read store metadata.",
-				 function );
-
-				goto on_error;
-			}
-		}
-	}
-	if( libcdata_array_free(
-	     &block_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+	if( libfsclfs_block_free(
+	     &block,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free block descriptors array.",
+		 "%s: unable to free block.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	return( 1 );
 
 on_error:
-	if( block_descriptors_array != NULL )
+	if( block != NULL )
 	{
-		libcdata_array_free(
-		 &block_descriptors_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+		libfsclfs_block_free(
+		 &block,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads the block descriptors
+/* Opens a specific container
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_read_block_descriptors(
+int libfsclfs_store_open_container(
      libfsclfs_internal_store_t *internal_store,
-     libbfio_handle_t *file_io_handle,
-     uint32_t block_offset,
-     uint32_t block_size,
-     libcdata_array_t *block_descriptors_array,
+     int container_index,
+     const char *filename,
      libcerror_error_t **error )
 {
-	libfsclfs_block_t *block                       = NULL;
-	libfsclfs_block_descriptor_t *block_descriptor = NULL;
-	uint8_t *record_data                           = NULL;
-	static char *function                          = "libfsclfs_store_read_block_descriptors";
-	size_t record_data_size                        = 0;
-	uint32_t block_descriptor_index                = 0;
-	uint32_t block_descriptors_data_size           = 0;
-	uint32_t number_of_block_descriptors           = 0;
-	uint32_t unknown2                              = 0;
-	uint32_t unknown3                              = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit                           = 0;
-	uint64_t value_64bit                           = 0;
-#endif
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfsclfs_store_open_container";
 
 	if( internal_store == NULL )
 	{
@@ -1896,1365 +2146,5584 @@ int libfsclfs_store_read_block_descriptors(
 
 		return( -1 );
 	}
-	if( libfsclfs_block_initialize(
-	     &block,
+	if( internal_store->base_log_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing base log file IO handle.",
+		 function );
+
+		return( -1 );
+ 	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_initialize_container_file_io_handle(
+	     internal_store,
+	     &file_io_handle,
+	     filename,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block.",
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsclfs_block_read(
-	     block,
-	     internal_store->io_handle,
+	if( libfsclfs_store_open_container_file_io_handle(
+	     internal_store,
+	     container_index,
 	     file_io_handle,
-	     block_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open container: %s.",
 		 function,
-		 block_offset );
+		 filename );
 
 		goto on_error;
 	}
-	if( block->size != block_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-		 "%s: mismatch in block size value.",
-		 function );
+	return( 1 );
 
-		goto on_error;
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-	if( libfsclfs_block_get_record_data(
-	     block,
-	     &record_data,
-	     &record_data_size,
-	     error ) != 1 )
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a specific container
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_open_container_wide(
+     libfsclfs_internal_store_t *internal_store,
+     int container_index,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfsclfs_container_open_wide";
+
+	if( internal_store == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve record data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( record_data == NULL )
+	if( internal_store->base_log_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing record data.",
+		 "%s: invalid handle - missing base log file IO handle.",
 		 function );
 
-		goto on_error;
-	}
-	if( record_data_size < sizeof( fsclfs_base_log_block_descriptors_header_t ) )
+		return( -1 );
+ 	}
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid record data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfsclfs_store_initialize_container_file_io_handle_wide(
+	     internal_store,
+	     &file_io_handle,
+	     filename,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: block descriptors header data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
-		libcnotify_print_data(
-		 record_data,
-		 sizeof( fsclfs_base_log_block_descriptors_header_t ),
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown2,
-	 unknown2 );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown3,
-	 unknown3 );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->number_of_block_descriptors,
-	 number_of_block_descriptors );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		goto on_error;
+	}
+	if( libfsclfs_store_open_container_file_io_handle(
+	     internal_store,
+	     container_index,
+	     file_io_handle,
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->dump_count,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: dump count\t\t\t: 0x%08" PRIx32 "\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open container: %ls.",
 		 function,
-		 value_32bit );
+		 filename );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown1,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+		goto on_error;
+	}
+	return( 1 );
 
-		libcnotify_printf(
-		 "%s: unknown2\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 unknown2 );
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		libcnotify_printf(
-		 "%s: unknown3\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 unknown3 );
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown4,
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: unknown4\t\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 value_64bit );
+/* Opens a container using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_open_container_file_io_handle(
+     libfsclfs_internal_store_t *internal_store,
+     int container_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_open_container_file_io_handle";
+	int bfio_access_flags = 0;
 
-		libcnotify_printf(
-		 "%s: unknown5:\n",
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
 		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown5,
-		 48,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-		libcnotify_printf(
-		 "%s: number of block descriptors\t: %" PRIu32 "\n",
-		 function,
-		 number_of_block_descriptors );
 
-		libcnotify_printf(
-		 "\n" );
+		return( -1 );
 	}
-#endif
-	record_data_size -= sizeof( fsclfs_base_log_block_descriptors_header_t );
-
-	if( unknown2 != 0x00005f1c )
+	if( internal_store->base_log_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-		 "%s: mismatch in unknown2 value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing base log file IO handle.",
 		 function );
 
-		goto on_error;
-	}
-	if( unknown3 != 0xc1f5c1f5 )
+		return( -1 );
+ 	}
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-		 "%s: mismatch in unknown3 value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( number_of_block_descriptors < 6 )
-	 || ( number_of_block_descriptors >= 32 ) )
+	if( ( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of block descriptors value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	block_descriptors_data_size = number_of_block_descriptors * sizeof( fsclfs_base_log_block_descriptor_t );
-
-	if( block_descriptors_data_size > record_data_size )
+	if( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid block descriptors data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	record_data += sizeof( fsclfs_base_log_block_descriptors_header_t );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( internal_store->access_flags & LIBFSCLFS_ACCESS_FLAG_READ ) != 0 )
 	{
-		libcnotify_printf(
-		 "%s: block descriptors data:\n",
-		 function );
-		libcnotify_print_data(
-		 record_data,
-		 block_descriptors_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
-#endif
-	if( libcdata_array_resize(
-	     block_descriptors_array,
-	     (int) number_of_block_descriptors,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     bfio_access_flags,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_IO,
+                 LIBCERROR_IO_ERROR_OPEN_FAILED,
+                 "%s: unable to open file IO handle.",
+                 function );
+
+                return( -1 );
+	}
+	if( libfsclfs_store_set_container_file_io_handle(
+	     internal_store,
+	     container_index,
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable resize block descriptors array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set container file IO handle: %d.",
+		 function,
+		 container_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the file IO handle of an opened container in the container file IO pool
+ * The container file IO pool is created if needed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_set_container_file_io_handle(
+     libfsclfs_internal_store_t *internal_store,
+     int container_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function               = "libfsclfs_store_set_container_file_io_handle";
+	int number_of_container_descriptors = 0;
+	int number_of_handles               = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( block_descriptor_index = 0;
-	     block_descriptor_index < number_of_block_descriptors;
-	     block_descriptor_index++ )
+	if( internal_store->container_file_io_pool == NULL )
 	{
-		if( libfsclfs_block_descriptor_initialize(
-		     &block_descriptor,
+		if( libcdata_array_get_number_of_entries(
+		     internal_store->container_descriptors_array,
+		     &number_of_container_descriptors,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create block descriptor.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of container descriptors.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: reading block descriptor %02" PRIu32 ".\n",
-			 function,
-			 block_descriptor_index );
-		}
-#endif
-/* TODO replace direct pass of sizeof() */
-		if( libfsclfs_block_descriptor_read_data(
-		     block_descriptor,
-		     record_data,
-		     sizeof( fsclfs_base_log_block_descriptor_t ),
-		     error ) != 1 )
+		if( libbfio_pool_initialize(
+		     &( internal_store->container_file_io_pool ),
+		     number_of_container_descriptors,
+		     internal_store->maximum_number_of_open_handles,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block descriptor.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create container file IO pool.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Note that this function also check if the block_number is within bounds
-		 */
-		if( libcdata_array_set_entry_by_index(
-		     block_descriptors_array,
-		     (int) block_descriptor->block_number,
-		     (intptr_t *) block_descriptor,
+		internal_store->container_file_io_pool_created_in_library = 1;
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     internal_store->container_file_io_pool,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in container file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* The pool is grown for the containers that were added by a refresh
+	 */
+	if( container_index >= number_of_handles )
+	{
+		if( libbfio_pool_resize(
+		     internal_store->container_file_io_pool,
+		     container_index + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set block descriptor: %" PRIu32 " in array.",
-			 function,
-			 block_descriptor->block_number );
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize container file IO pool.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		block_descriptor = NULL;
-
-		record_data += sizeof( fsclfs_base_log_block_descriptor_t );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* This function currently does not allow the file_io_handle to be set more than once
+	 */
+	if( libbfio_pool_set_handle(
+	     internal_store->container_file_io_pool,
+	     container_index,
+	     file_io_handle,
+	     LIBBFIO_ACCESS_FLAG_READ,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle: %d in pool.",
+		 function,
+		 container_index );
+
+		return( -1 );
 	}
-#endif
-	if( libfsclfs_block_free(
-	     &block,
+	if( libfsclfs_statistics_set_file_io_handle(
+	     internal_store->io_handle->statistics,
+	     1 + container_index,
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free block.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set container file IO handle: %d in statistics.",
+		 function,
+		 container_index );
 
 		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( block_descriptor != NULL )
-	{
-		libfsclfs_block_descriptor_free(
-		 &block_descriptor,
-		 NULL );
-	}
-	if( block != NULL )
-	{
-		libfsclfs_block_free(
-		 &block,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Reads the store metadata
- * Returns 1 if successful or -1 on error
+/* Closes a store
+ * Returns 0 if successful or -1 on error
  */
-int libfsclfs_store_read_store_metadata(
-     libfsclfs_internal_store_t *internal_store,
-     libbfio_handle_t *file_io_handle,
-     uint32_t block_offset,
-     uint32_t block_size,
+int libfsclfs_store_close(
+     libfsclfs_store_t *store,
      libcerror_error_t **error )
 {
-	libfsclfs_block_t *block                               = NULL;
-	libfsclfs_container_descriptor_t *container_descriptor = NULL;
-	libfsclfs_stream_descriptor_t *stream_descriptor       = NULL;
-	uint8_t *record_data                                   = NULL;
-	uint8_t *name_data                                     = NULL;
-	static char *function                                  = "libfsclfs_store_read_store_metadata";
-	size_t record_data_offset                              = 0;
-	size_t record_data_size                                = 0;
-	uint32_t alignment_padding_size                        = 0;
-	uint32_t block_file_attributes_offset                  = 0;
-	uint32_t block_name_offset                             = 0;
-	uint32_t dump_count                                    = 0;
-	uint32_t information_record_size                       = 0;
-	uint32_t information_record_type                       = 0;
-	uint32_t information_records_data_size                 = 0;
-	uint32_t name_data_size                                = 0;
-	int entry_index                                        = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	system_character_t guid_string[ 48 ];
-
-	system_character_t *value_string                       = NULL;
-	libfguid_identifier_t *guid                            = NULL;
-	size_t value_string_size                               = 0;
-	uint32_t value_32bit                                   = 0;
-	int result                                             = 0;
-#endif
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_close";
+	int result                                 = 0;
 
-	if( internal_store == NULL )
+	if( store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 "%s: invalid store.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsclfs_block_initialize(
-	     &block,
-	     error ) != 1 )
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsclfs_block_read(
-	     block,
-	     internal_store->io_handle,
-	     file_io_handle,
-	     block_offset,
-	     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block at offset: %" PRIu32 ".",
-		 function,
-		 block_offset );
-
-		goto on_error;
+		if( internal_store->base_log_file_io_handle_created_in_library != 0 )
+		{
+			if( libfsclfs_debug_print_read_offsets(
+			     internal_store->base_log_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+			}
+		}
 	}
-	if( block->size != block_size )
+#endif
+	if( internal_store->base_log_file_io_handle_opened_in_library != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-		 "%s: mismatch in block size value.",
-		 function );
+		if( libbfio_handle_close(
+		     internal_store->base_log_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close base log file IO handle.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
+		internal_store->base_log_file_io_handle_opened_in_library = 0;
 	}
-	if( libfsclfs_block_get_record_data(
-	     block,
-	     &record_data,
-	     &record_data_size,
-	     error ) != 1 )
+	if( internal_store->base_log_file_io_handle_created_in_library != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable retrieve record data.",
-		 function );
+		if( libbfio_handle_free(
+		     &( internal_store->base_log_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free base log file IO handle.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
+		internal_store->base_log_file_io_handle_created_in_library = 0;
 	}
-	if( record_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing record data.",
-		 function );
+	internal_store->base_log_file_io_handle = NULL;
 
-		goto on_error;
-	}
-	if( record_data_size < sizeof( fsclfs_base_log_store_metadata_header_t ) )
+	if( internal_store->container_file_io_pool_created_in_library != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid record data size value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		if( libbfio_pool_close_all(
+		     internal_store->container_file_io_pool,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close all container file IO pool handles.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_pool_free(
+		     &( internal_store->container_file_io_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free container file IO pool.",
+			 function );
+
+			result = -1;
+		}
+		internal_store->container_file_io_pool_created_in_library = 0;
+	}
+	internal_store->container_file_io_pool                 = NULL;
+	internal_store->containers_opened_in_library           = 0;
+	internal_store->number_of_opened_container_descriptors = 0;
+	internal_store->store_metadata_dump_count              = 0;
+	internal_store->is_dedicated_log                       = 0;
+	internal_store->dedicated_log_is_checked               = 0;
+
+	if( memory_set(
+	     internal_store->store_identifier,
+	     0,
+	     16 ) == NULL )
 	{
-		libcnotify_printf(
-		 "%s: store metadata header data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear store identifier.",
 		 function );
-		libcnotify_print_data(
-		 record_data,
-		 sizeof( fsclfs_base_log_store_metadata_header_t ),
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		result = -1;
 	}
-#endif
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->dump_count,
-	 dump_count );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->information_records_data_size,
-	 information_records_data_size );
+	if( libfsclfs_statistics_release_file_io_handles(
+	     internal_store->io_handle->statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release file IO handles from statistics.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		result = -1;
+	}
+
+	if( libfsclfs_io_handle_clear(
+	     internal_store->io_handle,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: dump count\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 dump_count );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown1,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+		result = -1;
+	}
+	if( internal_store->basename != NULL )
+	{
+		memory_free(
+		 internal_store->basename );
 
-		if( libfguid_identifier_initialize(
-		     &guid,
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+	}
+	if( libcdata_array_empty(
+	     internal_store->container_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty container descriptors array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_store->stream_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty stream descriptors array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_store->container_block_maps_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_owner_page_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty container block maps array.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Refreshes a store
+ * Re-reads the store metadata of the base log file and updates the stream and
+ * container descriptors in place, streams retrieved before the refresh remain valid
+ * If the containers were opened with libfsclfs_store_open_containers the containers
+ * that were added are opened as well
+ * Returns 1 if the store metadata has changed, 0 if not or -1 on error
+ */
+int libfsclfs_store_refresh(
+     libfsclfs_store_t *store,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *container_descriptors_array = NULL;
+	libcdata_array_t *stream_descriptors_array    = NULL;
+	libcdata_array_t *swap_array                  = NULL;
+	libfsclfs_internal_store_t *internal_store    = NULL;
+	static char *function                         = "libfsclfs_store_refresh";
+	uint32_t refreshed_dump_count                 = 0;
+	uint32_t store_metadata_dump_count            = 0;
+	int result                                    = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->base_log_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing base log file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &container_descriptors_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &stream_descriptors_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Read the store metadata into the refreshed descriptors arrays
+	 * the block descriptors and the store metadata blocks are small
+	 * compared to re-opening the store and scanning the containers
+	 */
+	store_metadata_dump_count = internal_store->store_metadata_dump_count;
+
+	swap_array                                  = internal_store->container_descriptors_array;
+	internal_store->container_descriptors_array = container_descriptors_array;
+	container_descriptors_array                 = swap_array;
+
+	swap_array                               = internal_store->stream_descriptors_array;
+	internal_store->stream_descriptors_array = stream_descriptors_array;
+	stream_descriptors_array                 = swap_array;
+
+	result = libfsclfs_store_open_read(
+	          internal_store,
+	          internal_store->base_log_file_io_handle,
+	          error );
+
+	swap_array                                  = internal_store->container_descriptors_array;
+	internal_store->container_descriptors_array = container_descriptors_array;
+	container_descriptors_array                 = swap_array;
+
+	swap_array                               = internal_store->stream_descriptors_array;
+	internal_store->stream_descriptors_array = stream_descriptors_array;
+	stream_descriptors_array                 = swap_array;
+
+	refreshed_dump_count                      = internal_store->store_metadata_dump_count;
+	internal_store->store_metadata_dump_count = store_metadata_dump_count;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read store metadata.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( refreshed_dump_count != store_metadata_dump_count )
+	{
+		if( libfsclfs_store_refresh_stream_descriptors(
+		     internal_store,
+		     stream_descriptors_array,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create GUID.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to refresh stream descriptors.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfguid_identifier_copy_from_byte_stream(
-		     guid,
-		     ( (fsclfs_base_log_store_metadata_header_t *) record_data )->store_identifier,
-		     16,
-		     LIBFGUID_ENDIAN_LITTLE,
+		if( libfsclfs_store_determine_log_type(
+		     internal_store,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy byte stream to GUID.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine log type.",
 			 function );
 
-			libfguid_identifier_free(
-			 &guid,
-			 NULL );
-
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfguid_identifier_copy_to_utf16_string(
-			  guid,
-			  (uint16_t *) guid_string,
-			  48,
-			  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-			  error );
-#else
-		result = libfguid_identifier_copy_to_utf8_string(
-			  guid,
-			  (uint8_t *) guid_string,
-			  48,
-			  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-			  error );
-#endif
-		if( result != 1 )
+		if( libfsclfs_store_refresh_container_descriptors(
+		     internal_store,
+		     container_descriptors_array,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy GUID to string.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to refresh container descriptors.",
 			 function );
 
-			libfguid_identifier_free(
-			 &guid,
-			 NULL );
-
 			goto on_error;
 		}
-		if( libfguid_identifier_free(
-		     &guid,
-		     error ) != 1 )
+		/* Open the containers that were added if the containers were opened
+		 * by the library, otherwise the caller is responsible for them
+		 */
+		if( internal_store->containers_opened_in_library != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free GUID.",
-			 function );
+			if( libfsclfs_store_open_containers(
+			     store,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open added containers.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		libcnotify_printf(
-		 "%s: store identifier\t\t\t: %" PRIs_SYSTEM "\n",
-		 function,
-		 guid_string );
-
-		libcnotify_printf(
-		 "%s: unknown3:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown3,
-		 44,
-		 0 );
-
-		libcnotify_printf(
-		 "%s: unknown4:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown4,
-		 44,
-		 0 );
-
-		libcnotify_printf(
-		 "%s: unknown5:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown5,
-		 44,
-		 0 );
-
-		libcnotify_printf(
-		 "%s: unknown6:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown6,
-		 44,
-		 0 );
+		internal_store->store_metadata_dump_count = refreshed_dump_count;
 
-		libcnotify_printf(
-		 "%s: unknown7:\n",
+		result = 1;
+	}
+	if( libcdata_array_free(
+	     &stream_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream descriptors array.",
 		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown7,
-		 44,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: unknown8:\n",
+		goto on_error;
+	}
+	if( libcdata_array_free(
+	     &container_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free container descriptors array.",
 		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown8,
-		 44,
-		 0 );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown9,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown9\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown10,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown10\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown11,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown11\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown12,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown12\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+		goto on_error;
+	}
+	return( result );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown13,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown13\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+on_error:
+	if( stream_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &stream_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
+		 NULL );
+	}
+	if( container_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &container_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown14,
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown14\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+/* Updates the stream descriptors from the refreshed stream descriptors
+ * The LSN values of known streams are updated in place, new streams are moved
+ * from the refreshed stream descriptors array to the stream descriptors array
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_refresh_stream_descriptors(
+     libfsclfs_internal_store_t *internal_store,
+     libcdata_array_t *refreshed_stream_descriptors_array,
+     libcerror_error_t **error )
+{
+	libfsclfs_stream_descriptor_t *refreshed_stream_descriptor = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor           = NULL;
+	static char *function                                      = "libfsclfs_store_refresh_stream_descriptors";
+	int entry_index                                            = 0;
+	int number_of_refreshed_stream_descriptors                 = 0;
+	int number_of_stream_descriptors                           = 0;
+	int refreshed_stream_descriptor_index                      = 0;
+	int stream_descriptor_index                                = 0;
 
-		libcnotify_printf(
-		 "%s: unknown15:\n",
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
 		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown15,
-		 496,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
-		libcnotify_printf(
-		 "%s: unknown16:\n",
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     refreshed_stream_descriptors_array,
+	     &number_of_refreshed_stream_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of refreshed stream descriptors.",
 		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown16,
-		 4096,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-		libcnotify_printf(
-		 "%s: information records data size\t: %" PRIu32 "\n",
-		 function,
-		 information_records_data_size );
 
-		libcnotify_printf(
-		 "%s: unknown17:\n",
-		 function );
-		libcnotify_print_data(
-		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown17,
-		 12,
-		 0 );
+		return( -1 );
 	}
-#endif
-	record_data_offset += sizeof( fsclfs_base_log_store_metadata_header_t );
-
-	if( ( record_data_offset + (size_t) information_records_data_size ) > record_data_size )
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->stream_descriptors_array,
+	     &number_of_stream_descriptors,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid information records data size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stream descriptors.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	record_data += sizeof( fsclfs_base_log_store_metadata_header_t );
-
-	if( dump_count > internal_store->store_metadata_dump_count )
+	for( refreshed_stream_descriptor_index = 0;
+	     refreshed_stream_descriptor_index < number_of_refreshed_stream_descriptors;
+	     refreshed_stream_descriptor_index++ )
 	{
-		if( libcdata_array_resize(
-		     internal_store->container_descriptors_array,
-		     0,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+		if( libcdata_array_get_entry_by_index(
+		     refreshed_stream_descriptors_array,
+		     refreshed_stream_descriptor_index,
+		     (intptr_t **) &refreshed_stream_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-			 "%s: unable resize container descriptors array.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve refreshed stream descriptor: %d.",
+			 function,
+			 refreshed_stream_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libcdata_array_resize(
-		     internal_store->stream_descriptors_array,
-		     0,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
-		     error ) != 1 )
+		if( refreshed_stream_descriptor == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-			 "%s: unable resize stream descriptors array.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	while( information_records_data_size > 0 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_information_record_header_t *) record_data )->type,
-		 information_record_type );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsclfs_base_log_information_record_header_t *) record_data )->size,
-		 information_record_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: type\t\t\t\t: 0x%08" PRIx32 "\n",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing refreshed stream descriptor: %d.",
 			 function,
-			 information_record_type );
+			 refreshed_stream_descriptor_index );
 
-			libcnotify_printf(
-			 "%s: size\t\t\t\t: %" PRIu32 "\n",
-			 function,
-			 information_record_size );
+			return( -1 );
 		}
-#endif
-		if( ( information_record_size < 8 )
-		 || ( ( record_data_offset + information_record_size ) > record_data_size ) )
+		for( stream_descriptor_index = 0;
+		     stream_descriptor_index < number_of_stream_descriptors;
+		     stream_descriptor_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid information records size value out of bounds.",
-			 function );
+			if( libcdata_array_get_entry_by_index(
+			     internal_store->stream_descriptors_array,
+			     stream_descriptor_index,
+			     (intptr_t **) &stream_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve stream descriptor: %d.",
+				 function,
+				 stream_descriptor_index );
 
-			goto on_error;
+				return( -1 );
+			}
+			if( ( stream_descriptor != NULL )
+			 && ( stream_descriptor->number == refreshed_stream_descriptor->number ) )
+			{
+				break;
+			}
 		}
-		record_data                   += 8;
-		record_data_offset            += 8;
-		information_records_data_size -= 8;
-		information_record_size       -= 8;
+		if( stream_descriptor_index < number_of_stream_descriptors )
+		{
+			stream_descriptor->base_lsn         = refreshed_stream_descriptor->base_lsn;
+			stream_descriptor->last_flushed_lsn = refreshed_stream_descriptor->last_flushed_lsn;
+			stream_descriptor->last_lsn         = refreshed_stream_descriptor->last_lsn;
+		}
+		else
+		{
+			if( libcdata_array_set_entry_by_index(
+			     refreshed_stream_descriptors_array,
+			     refreshed_stream_descriptor_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set refreshed stream descriptor: %d.",
+				 function,
+				 refreshed_stream_descriptor_index );
 
-		if( ( information_record_type != 0xc1fdf006 )
-		 && ( information_record_type != 0xc1fdf007 )
-		 && ( information_record_type != 0xc1fdf008 ) )
+				return( -1 );
+			}
+			if( libcdata_array_append_entry(
+			     internal_store->stream_descriptors_array,
+			     &entry_index,
+			     (intptr_t *) refreshed_stream_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append stream descriptor.",
+				 function );
+
+				libfsclfs_stream_descriptor_free(
+				 &refreshed_stream_descriptor,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Updates the container descriptors from the refreshed container descriptors
+ * The logical number of known containers is updated in place, if the logical number
+ * of a container changed its block map is discarded since the container was reused.
+ * New containers are moved from the refreshed container descriptors array to the
+ * container descriptors array, these containers are not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_refresh_container_descriptors(
+     libfsclfs_internal_store_t *internal_store,
+     libcdata_array_t *refreshed_container_descriptors_array,
+     libcerror_error_t **error )
+{
+	libfsclfs_container_descriptor_t *container_descriptor           = NULL;
+	libfsclfs_container_descriptor_t *refreshed_container_descriptor = NULL;
+	libfsclfs_owner_page_t *block_map                                = NULL;
+	static char *function                                            = "libfsclfs_store_refresh_container_descriptors";
+	int container_descriptor_index                                   = 0;
+	int entry_index                                                  = 0;
+	int number_of_block_maps                                         = 0;
+	int number_of_container_descriptors                              = 0;
+	int number_of_refreshed_container_descriptors                    = 0;
+	int refreshed_container_descriptor_index                         = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     refreshed_container_descriptors_array,
+	     &number_of_refreshed_container_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of refreshed container descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_descriptors_array,
+	     &number_of_container_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_block_maps_array,
+	     &number_of_block_maps,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container block maps.",
+		 function );
+
+		return( -1 );
+	}
+	for( refreshed_container_descriptor_index = 0;
+	     refreshed_container_descriptor_index < number_of_refreshed_container_descriptors;
+	     refreshed_container_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     refreshed_container_descriptors_array,
+		     refreshed_container_descriptor_index,
+		     (intptr_t **) &refreshed_container_descriptor,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported information record type: 0x%08" PRIx32 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve refreshed container descriptor: %d.",
 			 function,
-			 information_record_type );
+			 refreshed_container_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( refreshed_container_descriptor == NULL )
 		{
-			libcnotify_printf(
-			 "%s: information record data:\n",
-			 function );
-			libcnotify_print_data(
-			 record_data,
-			 information_record_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing refreshed container descriptor: %d.",
+			 function,
+			 refreshed_container_descriptor_index );
+
+			return( -1 );
 		}
-#endif
-		if( information_record_type == 0xc1fdf006 )
+		for( container_descriptor_index = 0;
+		     container_descriptor_index < number_of_container_descriptors;
+		     container_descriptor_index++ )
 		{
-			if( information_record_size != sizeof( fsclfs_base_log_file_information_record_data_t ) )
+			if( libcdata_array_get_entry_by_index(
+			     internal_store->container_descriptors_array,
+			     container_descriptor_index,
+			     (intptr_t **) &container_descriptor,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported information record size: %" PRIu32 " for type: 0x%08" PRIx32 ".",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve container descriptor: %d.",
 				 function,
-				 information_record_size,
-				 information_record_type );
+				 container_descriptor_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->block_name_offset,
-			 block_name_offset );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->block_file_attributes_offset,
-			 block_file_attributes_offset );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( ( container_descriptor != NULL )
+			 && ( container_descriptor->physical_number == refreshed_container_descriptor->physical_number ) )
 			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->checksum,
-				 value_32bit );
-				libcnotify_printf(
-				 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 value_32bit );
-
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->name_offset,
-				 value_32bit );
-				libcnotify_printf(
-				 "%s: name offset\t\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 value_32bit );
-
-				libcnotify_printf(
-				 "%s: unknown1:\n",
-				 function );
-				libcnotify_print_data(
-				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->unknown1,
-				 16,
-				 0 );
-
-				libcnotify_printf(
-				 "%s: block name offset\t\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 block_name_offset );
+				break;
+			}
+		}
+		if( container_descriptor_index < number_of_container_descriptors )
+		{
+			if( ( container_descriptor->logical_number != refreshed_container_descriptor->logical_number )
+			 && ( container_descriptor->physical_number < (uint32_t) number_of_block_maps ) )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     internal_store->container_block_maps_array,
+				     (int) container_descriptor->physical_number,
+				     (intptr_t **) &block_map,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve container block map: %" PRIu32 ".",
+					 function,
+					 container_descriptor->physical_number );
 
-				libcnotify_printf(
-				 "%s: block file attributes offset\t: 0x%08" PRIx32 "\n",
-				 function,
-				 block_file_attributes_offset );
+					return( -1 );
+				}
+				if( libcdata_array_set_entry_by_index(
+				     internal_store->container_block_maps_array,
+				     (int) container_descriptor->physical_number,
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set container block map: %" PRIu32 ".",
+					 function,
+					 container_descriptor->physical_number );
 
-				libcnotify_printf(
-				 "%s: unknown2:\n",
-				 function );
-				libcnotify_print_data(
-				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->unknown2,
-				 8,
-				 0 );
+					return( -1 );
+				}
+				if( block_map != NULL )
+				{
+					if( libfsclfs_owner_page_free(
+					     &block_map,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free container block map.",
+						 function );
+
+						return( -1 );
+					}
+				}
 			}
-#endif
-			record_data                   += sizeof( fsclfs_base_log_file_information_record_data_t );
-			record_data_offset            += sizeof( fsclfs_base_log_file_information_record_data_t );
-			information_records_data_size -= sizeof( fsclfs_base_log_file_information_record_data_t );
-			information_record_size       -= sizeof( fsclfs_base_log_file_information_record_data_t );
+			container_descriptor->logical_number = refreshed_container_descriptor->logical_number;
+			container_descriptor->file_size      = refreshed_container_descriptor->file_size;
+			container_descriptor->unknown2       = refreshed_container_descriptor->unknown2;
 		}
-		else if( information_record_type == 0xc1fdf007 )
+		else
 		{
-			if( information_record_size != sizeof( fsclfs_base_log_stream_attributes_record_data_t ) )
+			if( libcdata_array_set_entry_by_index(
+			     refreshed_container_descriptors_array,
+			     refreshed_container_descriptor_index,
+			     NULL,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported information record size: %" PRIu32 " for type: 0x%08" PRIx32 ".",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set refreshed container descriptor: %d.",
 				 function,
-				 information_record_size,
-				 information_record_type );
+				 refreshed_container_descriptor_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( libfsclfs_stream_descriptor_initialize(
-			     &stream_descriptor,
+			if( libcdata_array_append_entry(
+			     internal_store->container_descriptors_array,
+			     &entry_index,
+			     (intptr_t *) refreshed_container_descriptor,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create stream descriptor.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append container descriptor.",
 				 function );
 
-				goto on_error;
+				libfsclfs_container_descriptor_free(
+				 &refreshed_container_descriptor,
+				 NULL );
+
+				return( -1 );
 			}
-/* TODO replace direct pass of sizeof() */
-			if( libfsclfs_stream_descriptor_read_data(
-			     stream_descriptor,
-			     record_data,
-			     sizeof( fsclfs_base_log_stream_attributes_record_data_t ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read stream descriptor.",
-				 function );
+		}
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			record_data                   += sizeof( fsclfs_base_log_stream_attributes_record_data_t );
-			record_data_offset            += sizeof( fsclfs_base_log_stream_attributes_record_data_t );
-			information_records_data_size -= sizeof( fsclfs_base_log_stream_attributes_record_data_t );
-			information_record_size       -= sizeof( fsclfs_base_log_stream_attributes_record_data_t );
+/* Opens a store for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_open_read(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *block_descriptors_array      = NULL;
+	libfsclfs_block_descriptor_t *block_descriptor = NULL;
+	static char *function                          = "libfsclfs_store_open_read";
+	uint32_t block_descriptors_block_size          = 0;
+	uint32_t store_metadata_block_size             = 0;
+	int block_descriptor_index                     = 0;
+	int number_of_block_descriptors                = 0;
 
-			block_file_attributes_offset = 0;
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	block_descriptors_block_size = internal_store->io_handle->bytes_per_sector * 0x02;
+	store_metadata_block_size    = internal_store->io_handle->bytes_per_sector * 0x3d;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading block descriptors\n" );
+	}
+#endif
+	if( libcdata_array_initialize(
+	     &block_descriptors_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_store_read_block_descriptors(
+	     internal_store,
+	     file_io_handle,
+	     0,
+	     block_descriptors_block_size,
+	     block_descriptors_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     block_descriptors_array,
+	     &number_of_block_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of block descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	internal_store->store_metadata_dump_count = 0;
+
+	for( block_descriptor_index = 0;
+	     block_descriptor_index < number_of_block_descriptors;
+	     block_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     block_descriptors_array,
+		     block_descriptor_index,
+		     (intptr_t **) &block_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block descriptor: %d from array.",
+			 function,
+			 block_descriptor_index );
+
+			goto on_error;
 		}
-		else if( information_record_type == 0xc1fdf008 )
+		if( block_descriptor == NULL )
 		{
-			if( information_record_size != sizeof( fsclfs_base_log_container_attributes_record_data_t ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported information record size: %" PRIu32 " for type: 0x%08" PRIx32 ".",
-				 function,
-				 information_record_size,
-				 information_record_type );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing block descriptor: %d.",
+			 function,
+			 block_descriptor_index );
 
-				goto on_error;
+			goto on_error;
+		}
+		if( block_descriptor->size == store_metadata_block_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading store metadata\n" );
 			}
-			if( libfsclfs_container_descriptor_initialize(
-			     &container_descriptor,
-			     error ) != 1 )
+#endif
+			if( internal_store->io_handle->trace_callback != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create container descriptor.",
-				 function );
-
-				goto on_error;
+				libfsclfs_trace_event(
+				 internal_store->io_handle,
+				 LIBFSCLFS_TRACE_EVENT_READ_STORE_METADATA,
+				 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+				 (uint64_t) block_descriptor->offset );
 			}
-/* TODO replace direct pass of sizeof() */
-			if( libfsclfs_container_descriptor_read_data(
-			     container_descriptor,
-			     record_data,
-			     sizeof( fsclfs_base_log_container_attributes_record_data_t ),
+			if( libfsclfs_store_read_store_metadata(
+			     internal_store,
+			     file_io_handle,
+			     block_descriptor->offset,
+			     block_descriptor->size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read container descriptor.",
+				 "%s: unable to read store metadata.",
 				 function );
 
-				goto on_error;
-			}
-			record_data                   += sizeof( fsclfs_base_log_container_attributes_record_data_t );
-			record_data_offset            += sizeof( fsclfs_base_log_container_attributes_record_data_t );
-			information_records_data_size -= sizeof( fsclfs_base_log_container_attributes_record_data_t );
-			information_record_size       -= sizeof( fsclfs_base_log_container_attributes_record_data_t );
-
-			block_file_attributes_offset = 0;
-		}
-		if( block_name_offset == record_data_offset )
-		{
-			if( information_record_type == 0xc1fdf007 )
-			{
-				if( stream_descriptor == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing stream descriptor.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			else if( information_record_type == 0xc1fdf008 )
-			{
-				if( container_descriptor == NULL )
+				if( internal_store->io_handle->trace_callback != NULL )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing container descriptor.",
-					 function );
-
-					goto on_error;
+					libfsclfs_trace_event(
+					 internal_store->io_handle,
+					 LIBFSCLFS_TRACE_EVENT_READ_STORE_METADATA,
+					 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+					 (uint64_t) block_descriptor->offset );
 				}
-			}
-			else
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported information record type: 0x%08" PRIx32 ".",
-				 function,
-				 information_record_type );
-
 				goto on_error;
 			}
-			for( name_data_size = 0;
-			     ( name_data_size + 1 ) < information_records_data_size;
-			     name_data_size += 2 )
+			if( internal_store->io_handle->trace_callback != NULL )
 			{
-				if( ( record_data[ name_data_size ] == 0 )
-				 && ( record_data[ name_data_size + 1 ] == 0 ) )
-				{
-					break;
-				}
+				libfsclfs_trace_event(
+				 internal_store->io_handle,
+				 LIBFSCLFS_TRACE_EVENT_READ_STORE_METADATA,
+				 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+				 (uint64_t) block_descriptor->offset );
 			}
-			name_data_size += 2;
-
-			name_data = (uint8_t *) memory_allocate(
-			                         sizeof( uint8_t ) * name_data_size );
-
-			if( name_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create name string.",
-				 function );
+		}
+	}
+	if( libcdata_array_free(
+	     &block_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block descriptors array.",
+		 function );
 
-				goto on_error;
-			}
-			if( memory_copy(
-			     name_data,
-			     record_data,
-			     name_data_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy name string.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
 
-				memory_free(
-				 name_data );
+on_error:
+	if( block_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &block_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
 
-				goto on_error;
-			}
-			if( information_record_type == 0xc1fdf007 )
-			{
-				stream_descriptor->name      = name_data;
-				stream_descriptor->name_size = name_data_size;
-			}
-			else if( information_record_type == 0xc1fdf008 )
-			{
-				container_descriptor->name      = name_data;
-				container_descriptor->name_size = name_data_size;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: file name size\t\t\t: %" PRIu32 "\n",
-				 function,
-				 name_data_size );
+/* Determines if the store is a dedicated or a multiplexed log
+ * A dedicated log contains a single stream, a multiplexed log contains
+ * the physical stream (stream 0) and the streams multiplexed into it
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_determine_log_type(
+     libfsclfs_internal_store_t *internal_store,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_determine_log_type";
+	int number_of_streams = 0;
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libuna_utf16_string_size_from_utf16_stream(
-					  name_data,
-					  name_data_size,
-					  LIBUNA_ENDIAN_LITTLE,
-					  &value_string_size,
-					  error );
-#else
-				result = libuna_utf8_string_size_from_utf16_stream(
-					  name_data,
-					  name_data_size,
-					  LIBUNA_ENDIAN_LITTLE,
-					  &value_string_size,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine size of name string.",
-					 function );
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
 
-					goto on_error;
-				}
-				value_string = system_string_allocate(
-				                value_string_size );
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->stream_descriptors_array,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stream descriptors.",
+		 function );
 
-				if( value_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create name string.",
-					 function );
+		return( -1 );
+	}
+	if( number_of_streams == 1 )
+	{
+		internal_store->is_dedicated_log = 1;
+	}
+	else
+	{
+		internal_store->is_dedicated_log = 0;
+	}
+	internal_store->dedicated_log_is_checked = 0;
 
-					goto on_error;
-				}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libuna_utf16_string_copy_from_utf16_stream(
-					  (libuna_utf16_character_t *) value_string,
-					  value_string_size,
-					  name_data,
-					  name_data_size,
-					  LIBUNA_ENDIAN_LITTLE,
-					  error );
-#else
-				result = libuna_utf8_string_copy_from_utf16_stream(
-					  (libuna_utf8_character_t *) value_string,
-					  value_string_size,
-					  name_data,
-					  name_data_size,
-					  LIBUNA_ENDIAN_LITTLE,
-					  error );
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: log type\t\t\t\t: %s\n",
+		 function,
+		 ( internal_store->is_dedicated_log != 0 ) ? "dedicated" : "multiplexed" );
+	}
 #endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set name string.",
-					 function );
+	return( 1 );
+}
 
-					memory_free(
-					 value_string );
+/* Reads the block descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_read_block_descriptors(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_offset,
+     uint32_t block_size,
+     libcdata_array_t *block_descriptors_array,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_t *block                       = NULL;
+	libfsclfs_block_descriptor_t *block_descriptor = NULL;
+	uint8_t *record_data                           = NULL;
+	static char *function                          = "libfsclfs_store_read_block_descriptors";
+	size_t record_data_size                        = 0;
+	uint32_t block_descriptor_index                = 0;
+	uint32_t block_descriptors_data_size           = 0;
+	uint32_t number_of_block_descriptors           = 0;
+	uint32_t unknown2                              = 0;
+	uint32_t unknown3                              = 0;
 
-					goto on_error;
-				}
-				libcnotify_printf(
-				 "%s: name\t\t\t\t: %" PRIs_SYSTEM "\n",
-				 function,
-				 value_string );
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                           = 0;
+	uint64_t value_64bit                           = 0;
+#endif
 
-				memory_free(
-				 value_string );
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
 
-				libcnotify_printf(
-				 "\n" );
-			}
-#endif
-			record_data                   += name_data_size;
-			record_data_offset            += name_data_size;
-			information_records_data_size -= name_data_size;
+		return( -1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
 
-			if( ( record_data_offset % 8 ) != 0 )
-			{
-				alignment_padding_size = 8 - ( record_data_offset % 8 );
+		goto on_error;
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     internal_store->io_handle,
+	     file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: alignment padding:\n",
-					 function );
-					libcnotify_print_data(
-					 record_data,
-					 alignment_padding_size,
-					 0 );
-				}
+		goto on_error;
+	}
+	if( block->size != block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in block size value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_get_record_data(
+	     block,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data_size < sizeof( fsclfs_base_log_block_descriptors_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block descriptors header data:\n",
+		 function );
+		libcnotify_print_data(
+		 record_data,
+		 sizeof( fsclfs_base_log_block_descriptors_header_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
 #endif
-				record_data                   += alignment_padding_size;
-				record_data_offset            += alignment_padding_size;
-				information_records_data_size -= alignment_padding_size;
-			}
-			block_name_offset = 0;
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown2,
+	 unknown2 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown3,
+	 unknown3 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->number_of_block_descriptors,
+	 number_of_block_descriptors );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->dump_count,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: dump count\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown1,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: unknown2\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 unknown2 );
+
+		libcnotify_printf(
+		 "%s: unknown3\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 unknown3 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown4,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown4\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "%s: unknown5:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_block_descriptors_header_t *) record_data )->unknown5,
+		 48,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		libcnotify_printf(
+		 "%s: number of block descriptors\t: %" PRIu32 "\n",
+		 function,
+		 number_of_block_descriptors );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	record_data_size -= sizeof( fsclfs_base_log_block_descriptors_header_t );
+
+	if( unknown2 != 0x00005f1c )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in unknown2 value.",
+		 function );
+
+		goto on_error;
+	}
+	if( unknown3 != 0xc1f5c1f5 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in unknown3 value.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_block_descriptors < 6 )
+	 || ( number_of_block_descriptors >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of block descriptors value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	block_descriptors_data_size = number_of_block_descriptors * sizeof( fsclfs_base_log_block_descriptor_t );
+
+	if( block_descriptors_data_size > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block descriptors data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	record_data += sizeof( fsclfs_base_log_block_descriptors_header_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block descriptors data:\n",
+		 function );
+		libcnotify_print_data(
+		 record_data,
+		 block_descriptors_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( libcdata_array_resize(
+	     block_descriptors_array,
+	     (int) number_of_block_descriptors,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable resize block descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_descriptor_index = 0;
+	     block_descriptor_index < number_of_block_descriptors;
+	     block_descriptor_index++ )
+	{
+		if( libfsclfs_block_descriptor_initialize(
+		     &block_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block descriptor.",
+			 function );
+
+			goto on_error;
 		}
-		if( dump_count > internal_store->store_metadata_dump_count )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			if( information_record_type == 0xc1fdf007 )
-			{
-				if( libcdata_array_append_entry(
-				     internal_store->stream_descriptors_array,
-				     &entry_index,
-				     (intptr_t *) stream_descriptor,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable append stream descriptor.",
-					 function );
+			libcnotify_printf(
+			 "%s: reading block descriptor %02" PRIu32 ".\n",
+			 function,
+			 block_descriptor_index );
+		}
+#endif
+/* TODO replace direct pass of sizeof() */
+		if( libfsclfs_block_descriptor_read_data(
+		     block_descriptor,
+		     record_data,
+		     sizeof( fsclfs_base_log_block_descriptor_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		/* Note that this function also check if the block_number is within bounds
+		 */
+		if( libcdata_array_set_entry_by_index(
+		     block_descriptors_array,
+		     (int) block_descriptor->block_number,
+		     (intptr_t *) block_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block descriptor: %" PRIu32 " in array.",
+			 function,
+			 block_descriptor->block_number );
+
+			goto on_error;
+		}
+		block_descriptor = NULL;
+
+		record_data += sizeof( fsclfs_base_log_block_descriptor_t );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( libfsclfs_block_free(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( block_descriptor != NULL )
+	{
+		libfsclfs_block_descriptor_free(
+		 &block_descriptor,
+		 NULL );
+	}
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the store metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_read_store_metadata(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_offset,
+     uint32_t block_size,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_t *block                               = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor       = NULL;
+	uint8_t *record_data                                   = NULL;
+	uint8_t *name_data                                     = NULL;
+	static char *function                                  = "libfsclfs_store_read_store_metadata";
+	size_t record_data_offset                              = 0;
+	size_t record_data_size                                = 0;
+	uint32_t alignment_padding_size                        = 0;
+	uint32_t block_file_attributes_offset                  = 0;
+	uint32_t block_name_offset                             = 0;
+	uint32_t dump_count                                    = 0;
+	uint32_t information_record_size                       = 0;
+	uint32_t information_record_type                       = 0;
+	uint32_t information_records_data_size                 = 0;
+	uint32_t name_data_size                                = 0;
+	int entry_index                                        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	system_character_t guid_string[ 48 ];
+
+	system_character_t *value_string                       = NULL;
+	libfguid_identifier_t *guid                            = NULL;
+	size_t value_string_size                               = 0;
+	uint32_t value_32bit                                   = 0;
+	int result                                             = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     internal_store->io_handle,
+	     file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
+
+		goto on_error;
+	}
+	if( block->size != block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in block size value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_get_record_data(
+	     block,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data_size < sizeof( fsclfs_base_log_store_metadata_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: store metadata header data:\n",
+		 function );
+		libcnotify_print_data(
+		 record_data,
+		 sizeof( fsclfs_base_log_store_metadata_header_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->dump_count,
+	 dump_count );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->information_records_data_size,
+	 information_records_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: dump count\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 dump_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown1,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		if( libfguid_identifier_initialize(
+		     &guid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create GUID.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfguid_identifier_copy_from_byte_stream(
+		     guid,
+		     ( (fsclfs_base_log_store_metadata_header_t *) record_data )->store_identifier,
+		     16,
+		     LIBFGUID_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to GUID.",
+			 function );
+
+			libfguid_identifier_free(
+			 &guid,
+			 NULL );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfguid_identifier_copy_to_utf16_string(
+			  guid,
+			  (uint16_t *) guid_string,
+			  48,
+			  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+			  error );
+#else
+		result = libfguid_identifier_copy_to_utf8_string(
+			  guid,
+			  (uint8_t *) guid_string,
+			  48,
+			  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy GUID to string.",
+			 function );
+
+			libfguid_identifier_free(
+			 &guid,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libfguid_identifier_free(
+		     &guid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free GUID.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: store identifier\t\t\t: %" PRIs_SYSTEM "\n",
+		 function,
+		 guid_string );
+
+		libcnotify_printf(
+		 "%s: unknown3:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown3,
+		 44,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unknown4:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown4,
+		 44,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unknown5:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown5,
+		 44,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unknown6:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown6,
+		 44,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unknown7:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown7,
+		 44,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unknown8:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown8,
+		 44,
+		 0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown9,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown9\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown10,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown10\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown11,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown11\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown12,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown12\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown13,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown13\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown14,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown14\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: unknown15:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown15,
+		 496,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		libcnotify_printf(
+		 "%s: unknown16:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown16,
+		 4096,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		libcnotify_printf(
+		 "%s: information records data size\t: %" PRIu32 "\n",
+		 function,
+		 information_records_data_size );
+
+		libcnotify_printf(
+		 "%s: unknown17:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsclfs_base_log_store_metadata_header_t *) record_data )->unknown17,
+		 12,
+		 0 );
+	}
+#endif
+	record_data_offset += sizeof( fsclfs_base_log_store_metadata_header_t );
+
+	if( ( record_data_offset + (size_t) information_records_data_size ) > record_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid information records data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( dump_count > internal_store->store_metadata_dump_count )
+	{
+		if( libcdata_array_resize(
+		     internal_store->container_descriptors_array,
+		     0,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable resize container descriptors array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_resize(
+		     internal_store->stream_descriptors_array,
+		     0,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable resize stream descriptors array.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_store->store_identifier,
+		     ( (fsclfs_base_log_store_metadata_header_t *) record_data )->store_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy store identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	record_data += sizeof( fsclfs_base_log_store_metadata_header_t );
+
+	while( information_records_data_size > 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_information_record_header_t *) record_data )->type,
+		 information_record_type );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_base_log_information_record_header_t *) record_data )->size,
+		 information_record_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: type\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 information_record_type );
+
+			libcnotify_printf(
+			 "%s: size\t\t\t\t: %" PRIu32 "\n",
+			 function,
+			 information_record_size );
+		}
+#endif
+		if( ( information_record_size < 8 )
+		 || ( ( record_data_offset + information_record_size ) > record_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid information records size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		record_data                   += 8;
+		record_data_offset            += 8;
+		information_records_data_size -= 8;
+		information_record_size       -= 8;
+
+		if( ( information_record_type != 0xc1fdf006 )
+		 && ( information_record_type != 0xc1fdf007 )
+		 && ( information_record_type != 0xc1fdf008 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported information record type: 0x%08" PRIx32 ".",
+			 function,
+			 information_record_type );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: information record data:\n",
+			 function );
+			libcnotify_print_data(
+			 record_data,
+			 information_record_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		if( information_record_type == 0xc1fdf006 )
+		{
+			if( information_record_size != sizeof( fsclfs_base_log_file_information_record_data_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported information record size: %" PRIu32 " for type: 0x%08" PRIx32 ".",
+				 function,
+				 information_record_size,
+				 information_record_type );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->block_name_offset,
+			 block_name_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->block_file_attributes_offset,
+			 block_file_attributes_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->checksum,
+				 value_32bit );
+				libcnotify_printf(
+				 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 value_32bit );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->name_offset,
+				 value_32bit );
+				libcnotify_printf(
+				 "%s: name offset\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 value_32bit );
+
+				libcnotify_printf(
+				 "%s: unknown1:\n",
+				 function );
+				libcnotify_print_data(
+				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->unknown1,
+				 16,
+				 0 );
+
+				libcnotify_printf(
+				 "%s: block name offset\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 block_name_offset );
+
+				libcnotify_printf(
+				 "%s: block file attributes offset\t: 0x%08" PRIx32 "\n",
+				 function,
+				 block_file_attributes_offset );
+
+				libcnotify_printf(
+				 "%s: unknown2:\n",
+				 function );
+				libcnotify_print_data(
+				 ( (fsclfs_base_log_file_information_record_data_t *) record_data )->unknown2,
+				 8,
+				 0 );
+			}
+#endif
+			record_data                   += sizeof( fsclfs_base_log_file_information_record_data_t );
+			record_data_offset            += sizeof( fsclfs_base_log_file_information_record_data_t );
+			information_records_data_size -= sizeof( fsclfs_base_log_file_information_record_data_t );
+			information_record_size       -= sizeof( fsclfs_base_log_file_information_record_data_t );
+		}
+		else if( information_record_type == 0xc1fdf007 )
+		{
+			if( information_record_size != sizeof( fsclfs_base_log_stream_attributes_record_data_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported information record size: %" PRIu32 " for type: 0x%08" PRIx32 ".",
+				 function,
+				 information_record_size,
+				 information_record_type );
+
+				goto on_error;
+			}
+			if( libfsclfs_stream_descriptor_initialize(
+			     &stream_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create stream descriptor.",
+				 function );
+
+				goto on_error;
+			}
+/* TODO replace direct pass of sizeof() */
+			if( libfsclfs_stream_descriptor_read_data(
+			     stream_descriptor,
+			     record_data,
+			     sizeof( fsclfs_base_log_stream_attributes_record_data_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			record_data                   += sizeof( fsclfs_base_log_stream_attributes_record_data_t );
+			record_data_offset            += sizeof( fsclfs_base_log_stream_attributes_record_data_t );
+			information_records_data_size -= sizeof( fsclfs_base_log_stream_attributes_record_data_t );
+			information_record_size       -= sizeof( fsclfs_base_log_stream_attributes_record_data_t );
+
+			block_file_attributes_offset = 0;
+		}
+		else if( information_record_type == 0xc1fdf008 )
+		{
+			if( information_record_size != sizeof( fsclfs_base_log_container_attributes_record_data_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported information record size: %" PRIu32 " for type: 0x%08" PRIx32 ".",
+				 function,
+				 information_record_size,
+				 information_record_type );
+
+				goto on_error;
+			}
+			if( libfsclfs_container_descriptor_initialize(
+			     &container_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create container descriptor.",
+				 function );
+
+				goto on_error;
+			}
+/* TODO replace direct pass of sizeof() */
+			if( libfsclfs_container_descriptor_read_data(
+			     container_descriptor,
+			     record_data,
+			     sizeof( fsclfs_base_log_container_attributes_record_data_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read container descriptor.",
+				 function );
+
+				goto on_error;
+			}
+			record_data                   += sizeof( fsclfs_base_log_container_attributes_record_data_t );
+			record_data_offset            += sizeof( fsclfs_base_log_container_attributes_record_data_t );
+			information_records_data_size -= sizeof( fsclfs_base_log_container_attributes_record_data_t );
+			information_record_size       -= sizeof( fsclfs_base_log_container_attributes_record_data_t );
+
+			block_file_attributes_offset = 0;
+		}
+		if( block_name_offset == record_data_offset )
+		{
+			if( information_record_type == 0xc1fdf007 )
+			{
+				if( stream_descriptor == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing stream descriptor.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( information_record_type == 0xc1fdf008 )
+			{
+				if( container_descriptor == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing container descriptor.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported information record type: 0x%08" PRIx32 ".",
+				 function,
+				 information_record_type );
+
+				goto on_error;
+			}
+			for( name_data_size = 0;
+			     ( name_data_size + 1 ) < information_records_data_size;
+			     name_data_size += 2 )
+			{
+				if( ( record_data[ name_data_size ] == 0 )
+				 && ( record_data[ name_data_size + 1 ] == 0 ) )
+				{
+					break;
+				}
+			}
+			name_data_size += 2;
+
+			name_data = (uint8_t *) memory_allocate(
+			                         sizeof( uint8_t ) * name_data_size );
+
+			if( name_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name string.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     name_data,
+			     record_data,
+			     name_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name string.",
+				 function );
+
+				memory_free(
+				 name_data );
+
+				goto on_error;
+			}
+			if( information_record_type == 0xc1fdf007 )
+			{
+				stream_descriptor->name      = name_data;
+				stream_descriptor->name_size = name_data_size;
+			}
+			else if( information_record_type == 0xc1fdf008 )
+			{
+				container_descriptor->name      = name_data;
+				container_descriptor->name_size = name_data_size;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: file name size\t\t\t: %" PRIu32 "\n",
+				 function,
+				 name_data_size );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libuna_utf16_string_size_from_utf16_stream(
+					  name_data,
+					  name_data_size,
+					  LIBUNA_ENDIAN_LITTLE,
+					  &value_string_size,
+					  error );
+#else
+				result = libuna_utf8_string_size_from_utf16_stream(
+					  name_data,
+					  name_data_size,
+					  LIBUNA_ENDIAN_LITTLE,
+					  &value_string_size,
+					  error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine size of name string.",
+					 function );
+
+					goto on_error;
+				}
+				value_string = system_string_allocate(
+				                value_string_size );
+
+				if( value_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create name string.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libuna_utf16_string_copy_from_utf16_stream(
+					  (libuna_utf16_character_t *) value_string,
+					  value_string_size,
+					  name_data,
+					  name_data_size,
+					  LIBUNA_ENDIAN_LITTLE,
+					  error );
+#else
+				result = libuna_utf8_string_copy_from_utf16_stream(
+					  (libuna_utf8_character_t *) value_string,
+					  value_string_size,
+					  name_data,
+					  name_data_size,
+					  LIBUNA_ENDIAN_LITTLE,
+					  error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set name string.",
+					 function );
+
+					memory_free(
+					 value_string );
+
+					goto on_error;
+				}
+				libcnotify_printf(
+				 "%s: name\t\t\t\t: %" PRIs_SYSTEM "\n",
+				 function,
+				 value_string );
+
+				memory_free(
+				 value_string );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+			record_data                   += name_data_size;
+			record_data_offset            += name_data_size;
+			information_records_data_size -= name_data_size;
+
+			if( ( record_data_offset % 8 ) != 0 )
+			{
+				alignment_padding_size = 8 - ( record_data_offset % 8 );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: alignment padding:\n",
+					 function );
+					libcnotify_print_data(
+					 record_data,
+					 alignment_padding_size,
+					 0 );
+				}
+#endif
+				record_data                   += alignment_padding_size;
+				record_data_offset            += alignment_padding_size;
+				information_records_data_size -= alignment_padding_size;
+			}
+			block_name_offset = 0;
+		}
+		if( dump_count > internal_store->store_metadata_dump_count )
+		{
+			if( information_record_type == 0xc1fdf007 )
+			{
+				if( libcdata_array_append_entry(
+				     internal_store->stream_descriptors_array,
+				     &entry_index,
+				     (intptr_t *) stream_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable append stream descriptor.",
+					 function );
+
+					goto on_error;
+				}
+				stream_descriptor = NULL;
+			}
+			else if( information_record_type == 0xc1fdf008 )
+			{
+				if( libcdata_array_append_entry(
+				     internal_store->container_descriptors_array,
+				     &entry_index,
+				     (intptr_t *) container_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable append container descriptor.",
+					 function );
+
+					goto on_error;
+				}
+				container_descriptor = NULL;
+			}
+		}
+		else
+		{
+			if( information_record_type == 0xc1fdf007 )
+			{
+				if( libfsclfs_stream_descriptor_free(
+				     &stream_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable free stream descriptor.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( information_record_type == 0xc1fdf008 )
+			{
+				if( libfsclfs_container_descriptor_free(
+				     &container_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable free container descriptor.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	if( libfsclfs_block_free(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only keep the dump count of the most recent copy of the store metadata
+	 */
+	if( dump_count > internal_store->store_metadata_dump_count )
+	{
+		internal_store->store_metadata_dump_count = dump_count;
+	}
+
+	return( 1 );
+
+on_error:
+	libcdata_array_resize(
+	 internal_store->container_descriptors_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+	 NULL );
+
+	libcdata_array_resize(
+	 internal_store->stream_descriptors_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
+	 NULL );
+
+	if( container_descriptor != NULL )
+	{
+		libfsclfs_container_descriptor_free(
+		 &container_descriptor,
+		 NULL );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* Reads the container owner page
+ * The log ranges are read from the sector mapping array of the owner page
+ * or determined by scanning the region if the owner page is not valid
+ * or scan_region is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_read_container_owner_page(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     libfsclfs_owner_page_t *owner_page,
+     uint32_t offset,
+     uint8_t scan_region,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_read_container_owner_page";
+	int number_of_streams = 0;
+	int result            = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->stream_descriptors_array,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stream descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_OWNER_PAGE,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+		 (uint64_t) offset );
+	}
+	if( scan_region == 0 )
+	{
+		result = libfsclfs_owner_page_read(
+		          owner_page,
+		          internal_store->io_handle,
+		          container_file_io_handle,
+		          number_of_streams,
+		          offset,
+		          error );
+	}
+	/* Fall back to scanning the region when its owner page has not been written
+	 * or does not map the blocks of the region
+	 */
+	if( ( scan_region != 0 )
+	 || ( result == 0 ) )
+	{
+		result = libfsclfs_owner_page_read_scan_region(
+		          owner_page,
+		          internal_store->io_handle,
+		          container_file_io_handle,
+		          number_of_streams,
+		          offset,
+		          error );
+
+		if( ( result == 1 )
+		 && ( internal_store->io_handle->statistics != NULL ) )
+		{
+			libfsclfs_statistics_counter_add(
+			 internal_store->io_handle->statistics->number_of_region_scans,
+			 1 );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read owner page at offset: %" PRIu32 ".",
+		 function,
+		 offset );
+
+		if( internal_store->io_handle->trace_callback != NULL )
+		{
+			libfsclfs_trace_event(
+			 internal_store->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_READ_OWNER_PAGE,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+			 (uint64_t) offset );
+		}
+		return( -1 );
+	}
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_OWNER_PAGE,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+		 (uint64_t) offset );
+	}
+	if( internal_store->io_handle->statistics != NULL )
+	{
+		libfsclfs_statistics_counter_add(
+		 internal_store->io_handle->statistics->number_of_owner_pages_read,
+		 1 );
+	}
+	return( 1 );
+}
+
+/* Reads a specific container block record value
+ * Only the headers of the records that precede the record in the block are read.
+ * If a record filter is provided and the record header does not match the filter
+ * the record data is not read and the record value is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_read_record_value(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t block_offset,
+     uint16_t record_number,
+     libfsclfs_internal_record_filter_t *record_filter,
+     libfsclfs_record_value_t **record_value,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_t *block  = NULL;
+	uint8_t *record_data      = NULL;
+	static char *function     = "libfsclfs_block_read_record_value";
+	size_t record_data_offset = 0;
+	size_t record_data_size   = 0;
+	int result                = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     internal_store->io_handle,
+	     container_file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
+
+		goto on_error;
+	}
+	result = libfsclfs_block_get_record_data_by_number(
+	          block,
+	          record_number,
+	          &record_data,
+	          &record_data_size,
+	          &record_data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record: %" PRIu16 " data.",
+		 function,
+		 record_number );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record number: %" PRIu16 " value out of bounds.",
+		 function,
+		 record_number );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsclfs_container_record_header_t *) record_data )->previous_lsn,
+	 *previous_lsn );
+
+	if( record_filter != NULL )
+	{
+		result = libfsclfs_record_filter_match_record_header(
+		          record_filter,
+		          record_data,
+		          record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if record header matches filter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( internal_store->io_handle->statistics != NULL )
+		{
+			libfsclfs_statistics_counter_add(
+			 internal_store->io_handle->statistics->number_of_records_skipped,
+			 1 );
+		}
+	}
+	else
+	{
+		if( libfsclfs_record_value_initialize(
+		     record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record value.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_store->io_handle->trace_callback != NULL )
+		{
+			libfsclfs_trace_event(
+			 internal_store->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+			 (uint64_t) ( block_offset + record_data_offset ) );
+		}
+		if( libfsclfs_record_value_read_data(
+		     *record_value,
+		     record_data,
+		     record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record.",
+			 function );
+
+			if( internal_store->io_handle->trace_callback != NULL )
+			{
+				libfsclfs_trace_event(
+				 internal_store->io_handle,
+				 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+				 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+				 (uint64_t) ( block_offset + record_data_offset ) );
+			}
+			goto on_error;
+		}
+		if( internal_store->io_handle->trace_callback != NULL )
+		{
+			libfsclfs_trace_event(
+			 internal_store->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+			 (uint64_t) ( block_offset + record_data_offset ) );
+		}
+		if( internal_store->io_handle->statistics != NULL )
+		{
+			libfsclfs_statistics_counter_add(
+			 internal_store->io_handle->statistics->number_of_records_read,
+			 1 );
+		}
+	}
+	if( libfsclfs_block_free(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 record_value,
+		 NULL );
+	}
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the restart record LSNs of a specific container block
+ * Only the record headers are read. The restart record LSNs are ordered
+ * by record number and restart LSNs must be able to contain
+ * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS LSNs.
+ * The previous block LSN is set to the most recent previous LSN of the records
+ * in the block that refers to a record before the block or 0 if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_read_restart_lsns(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t block_offset,
+     uint64_t block_lsn,
+     uint64_t *restart_lsns,
+     int *number_of_restart_lsns,
+     uint64_t *previous_block_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_t *block       = NULL;
+	uint8_t *record_data           = NULL;
+	static char *function          = "libfsclfs_block_read_restart_lsns";
+	size_t alignment_padding_size  = 0;
+	size_t record_data_offset      = 0;
+	size_t record_data_size        = 0;
+	uint64_t previous_lsn          = 0;
+	uint32_t record_size           = 0;
+	uint32_t record_type           = 0;
+	uint16_t current_record_number = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_lsn & 0x01ff ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block LSN: 0x%08" PRIx64 ".",
+		 function,
+		 block_lsn );
+
+		return( -1 );
+	}
+	if( restart_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restart LSNs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_restart_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of restart LSNs.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_block_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous block LSN.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_restart_lsns = 0;
+	*previous_block_lsn     = 0;
+
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     internal_store->io_handle,
+	     container_file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_get_record_data(
+	     block,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		goto on_error;
+	}
+	record_data_offset = block->record_data_offset;
+
+	while( record_data_size > 0 )
+	{
+		if( current_record_number >= LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of records value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( record_data_size < sizeof( fsclfs_container_record_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) record_data )->size,
+		 record_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsclfs_container_record_header_t *) record_data )->record_type,
+		 record_type );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsclfs_container_record_header_t *) record_data )->previous_lsn,
+		 previous_lsn );
+
+		if( ( record_size < sizeof( fsclfs_container_record_header_t ) )
+		 || ( (size_t) record_size > record_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu16 " size value out of bounds.",
+			 function,
+			 current_record_number );
+
+			goto on_error;
+		}
+		if( ( record_type & RECORD_TYPE_FLAG_IS_RESTART ) != 0 )
+		{
+			restart_lsns[ *number_of_restart_lsns ] = block_lsn | current_record_number;
+
+			*number_of_restart_lsns += 1;
+		}
+		if( ( previous_lsn < block_lsn )
+		 && ( previous_lsn > *previous_block_lsn ) )
+		{
+			*previous_block_lsn = previous_lsn;
+		}
+		if( ( record_type & RECORD_TYPE_FLAG_IS_LAST ) != 0 )
+		{
+			break;
+		}
+		record_data        += record_size;
+		record_data_size   -= record_size;
+		record_data_offset += record_size;
+
+		if( ( record_data_offset % 8 ) != 0 )
+		{
+			alignment_padding_size = 8 - ( record_data_offset % 8 );
+
+			if( alignment_padding_size > record_data_size )
+			{
+				break;
+			}
+			record_data        += alignment_padding_size;
+			record_data_size   -= alignment_padding_size;
+			record_data_offset += alignment_padding_size;
+		}
+		current_record_number++;
+	}
+	if( libfsclfs_block_free(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the record headers of a specific container block into a record header table
+ * Only the record headers are read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_block_read_record_header_table(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t block_offset,
+     uint64_t block_lsn,
+     libfsclfs_internal_record_header_table_t *internal_record_header_table,
+     libcerror_error_t **error )
+{
+	libfsclfs_block_t *block = NULL;
+	uint8_t *record_data     = NULL;
+	static char *function    = "libfsclfs_block_read_record_header_table";
+	size_t record_data_size  = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     internal_store->io_handle,
+	     container_file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_get_record_data(
+	     block,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_record_header_table_read_data(
+	     internal_record_header_table,
+	     block_lsn,
+	     record_data,
+	     record_data_size,
+	     (size_t) block->record_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record header table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_block_free(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libfsclfs_store_get_basename_size(
+     libfsclfs_internal_store_t *internal_store,
+     size_t *basename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_get_basename_size";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	*basename_size = internal_store->basename_size;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Retrieves the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libfsclfs_store_get_basename(
+     libfsclfs_internal_store_t *internal_store,
+     char *basename,
+     size_t basename_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsclfs_store_get_basename";
+	size_t narrow_basename_size = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                  = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          &narrow_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          &narrow_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          &narrow_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          &narrow_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow basename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	narrow_basename_size = internal_store->basename_size;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	if( basename_size < narrow_basename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: basename too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) basename,
+		          basename_size,
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) basename,
+		          basename_size,
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) basename,
+		          basename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) basename,
+		          basename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( system_string_copy(
+	     basename,
+	     internal_store->basename,
+	     internal_store->basename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+	basename[ internal_store->basename_size - 1 ] = 0;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Sets the basename
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_set_basename(
+     libfsclfs_internal_store_t *internal_store,
+     const char *basename,
+     size_t basename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_set_basename";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->basename != NULL )
+	{
+		memory_free(
+		 internal_store->basename );
+
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_store->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_store->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_store->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_store->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	internal_store->basename_size = basename_length + 1;
+#endif
+	internal_store->basename = system_string_allocate(
+	                            internal_store->basename_size );
+
+	if( internal_store->basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
+		 function );
+
+		internal_store->basename_size = 0;
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_store->basename );
+
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+
+		return( -1 );
+	}
+#else
+	if( system_string_copy(
+	     internal_store->basename,
+	     basename,
+	     basename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_store->basename );
+
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+
+		return( -1 );
+	}
+	internal_store->basename[ basename_length ] = 0;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the size of the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libfsclfs_store_get_basename_size_wide(
+     libfsclfs_internal_store_t *internal_store,
+     size_t *basename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_get_basename_size_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	*basename_size = internal_store->basename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+/* Retrieves the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libfsclfs_store_get_basename_wide(
+     libfsclfs_internal_store_t *internal_store,
+     wchar_t *basename,
+     size_t basename_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsclfs_store_get_basename_wide";
+	size_t wide_basename_size = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wide_basename_size = internal_store->basename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          &wide_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          &wide_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          &wide_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          &wide_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	if( basename_size < wide_basename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: basename too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     basename,
+	     internal_store->basename,
+	     internal_store->basename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+	basename[ internal_store->basename_size - 1 ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) basename,
+		          basename_size,
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) basename,
+		          basename_size,
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) basename,
+		          basename_size,
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) basename,
+		          basename_size,
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+/* Sets the basename
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_set_basename_wide(
+     libfsclfs_internal_store_t *internal_store,
+     const wchar_t *basename,
+     size_t basename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_set_basename_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->basename != NULL )
+	{
+		memory_free(
+		 internal_store->basename );
+
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	internal_store->basename_size = basename_length + 1;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_store->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_store->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_store->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_store->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	internal_store->basename = system_string_allocate(
+	                            internal_store->basename_size );
+
+	if( internal_store->basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     internal_store->basename,
+	     basename,
+	     basename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_store->basename );
+
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+
+		return( -1 );
+	}
+	internal_store->basename[ basename_length ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) internal_store->basename,
+		          internal_store->basename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_store->basename );
+
+		internal_store->basename      = NULL;
+		internal_store->basename_size = 0;
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the number of containers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_number_of_containers(
+     libfsclfs_store_t *store,
+     int *number_of_containers,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_number_of_containers";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_descriptors_array,
+	     number_of_containers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific container
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_container(
+     libfsclfs_store_t *store,
+     int container_index,
+     libfsclfs_container_t **container,
+     libcerror_error_t **error )
+{
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	static char *function                                  = "libfsclfs_store_get_container";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	if( *container != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_store->container_descriptors_array,
+	     container_index,
+	     (intptr_t **) &container_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container descriptor: %d.",
+		 function,
+		 container_index );
+
+		return( -1 );
+	}
+	if( libfsclfs_container_initialize(
+	     container,
+	     internal_store,
+	     container_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the physical container number for a specific logical container number
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsclfs_store_get_container_physical_number(
+     libfsclfs_internal_store_t *internal_store,
+     uint32_t container_logical_number,
+     uint32_t *container_physical_number,
+     libcerror_error_t **error )
+{
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	static char *function                                  = "libfsclfs_store_set_basename_wide";
+	int container_descriptor_index                         = 0;
+	int number_of_container_descriptors                    = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( container_physical_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container physical number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_descriptors_array,
+	     &number_of_container_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_store->container_descriptors_array,
+	     container_descriptor_index,
+	     (intptr_t **) &container_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container descriptor: %d.",
+		 function,
+		 container_descriptor_index );
+
+		return( -1 );
+	}
+	if( container_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing container descriptor: %d.",
+		 function,
+		 container_descriptor_index );
+
+		return( -1 );
+	}
+	if( container_descriptor->logical_number == container_logical_number )
+	{
+		*container_physical_number = container_descriptor->physical_number;
+
+		return( 1 );
+	}
+/* TODO remove?
+	else if( container_descriptor->physical_number == container_logical_number )
+	{
+		*container_physical_number = container_descriptor->physical_number;
+
+		return( 1 );
+	}
+*/
+	else if( container_descriptor->logical_number > container_logical_number )
+	{
+		for( container_descriptor_index = 1;
+		     container_descriptor_index < number_of_container_descriptors;
+		     container_descriptor_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_store->container_descriptors_array,
+			     container_descriptor_index,
+			     (intptr_t **) &container_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve container descriptor: %d.",
+				 function,
+				 container_descriptor_index );
+
+				return( -1 );
+			}
+			if( container_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing container descriptor: %d.",
+				 function,
+				 container_descriptor_index );
+
+				return( -1 );
+			}
+/* TODO determine what unknown2 contains */
+			if( container_descriptor->unknown2 == 0 )
+			{
+				continue;
+			}
+			if( container_descriptor->logical_number == container_logical_number )
+			{
+				*container_physical_number = container_descriptor->physical_number;
+
+				return( 1 );
+			}
+/* TODO remove?
+			if( container_descriptor->physical_number == container_logical_number )
+			{
+				*container_physical_number = container_descriptor->physical_number;
+
+				return( 1 );
+			}
+*/
+		}
+	}
+	else
+	{
+		for( container_descriptor_index = number_of_container_descriptors - 1;
+		     container_descriptor_index > 0;
+		     container_descriptor_index-- )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_store->container_descriptors_array,
+			     container_descriptor_index,
+			     (intptr_t **) &container_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve container descriptor: %d.",
+				 function,
+				 container_descriptor_index );
+
+				return( -1 );
+			}
+			if( container_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing container descriptor: %d.",
+				 function,
+				 container_descriptor_index );
+
+				return( -1 );
+			}
+			if( container_descriptor->unknown2 == 0 )
+			{
+				continue;
+			}
+			if( container_descriptor->logical_number == container_logical_number )
+			{
+				*container_physical_number = container_descriptor->physical_number;
+
+				return( 1 );
+			}
+/* TODO remove?
+			if( container_descriptor->physical_number == container_logical_number )
+			{
+				*container_physical_number = container_descriptor->physical_number;
+
+				return( 1 );
+			}
+*/
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of streams
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_number_of_streams(
+     libfsclfs_store_t *store,
+     int *number_of_streams,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_number_of_streams";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->stream_descriptors_array,
+	     number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stream descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_stream(
+     libfsclfs_store_t *store,
+     int stream_index,
+     libfsclfs_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store       = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                            = "libfsclfs_store_get_stream";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_store->stream_descriptors_array,
+	     stream_index,
+	     (intptr_t **) &stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream descriptor: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( libfsclfs_stream_initialize(
+	     stream,
+	     internal_store,
+	     stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific statistics value
+ * The statistics are accumulated over the lifetime of the store until reset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_statistics(
+     libfsclfs_store_t *store,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_statistics";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_statistics_get_value(
+	     internal_store->io_handle->statistics,
+	     statistics_value,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics value: %d.",
+		 function,
+		 statistics_value );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the read statistics of the base log file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_base_log_read_statistics(
+     libfsclfs_store_t *store,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_base_log_read_statistics";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_statistics_get_file_values(
+	     internal_store->io_handle->statistics,
+	     0,
+	     number_of_reads,
+	     number_of_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve base log file statistics values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_reset_statistics(
+     libfsclfs_store_t *store,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_reset_statistics";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_statistics_reset(
+	     internal_store->io_handle->statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the trace callback function
+ * The callback function is called at the begin and end of reading the store,
+ * the store metadata, owner pages, blocks and records
+ * When the containers are scanned the callback function can be called from worker threads
+ * The timestamp is in nanoseconds relative to an unspecified starting point
+ * Set the callback function to NULL to disable tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_set_trace_callback(
+     libfsclfs_store_t *store,
+     void (*callback)(
+            int event_type,
+            int event_phase,
+            uint64_t timestamp,
+            uint64_t value,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_set_trace_callback";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Clear the callback function first so that the callback data
+	 * is never passed to a different callback function
+	 */
+	internal_store->io_handle->trace_callback      = NULL;
+	internal_store->io_handle->trace_callback_data = callback_data;
+	internal_store->io_handle->trace_callback      = callback;
+
+	return( 1 );
+}
+
+/* Retrieves the number of threads used to scan the containers and to fetch records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_number_of_threads(
+     libfsclfs_store_t *store,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_number_of_threads";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_store->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to scan the containers and to fetch records
+ * The number of threads is only used when multi-threading support is available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_set_number_of_threads(
+     libfsclfs_store_t *store,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_set_number_of_threads";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFSCLFS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Retrieves the direct IO value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_direct_io(
+     libfsclfs_store_t *store,
+     uint8_t *use_direct_io,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_direct_io";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( use_direct_io == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid use direct IO.",
+		 function );
+
+		return( -1 );
+	}
+	*use_direct_io = internal_store->use_direct_io;
+
+	return( 1 );
+}
 
-					goto on_error;
-				}
-				stream_descriptor = NULL;
-			}
-			else if( information_record_type == 0xc1fdf008 )
-			{
-				if( libcdata_array_append_entry(
-				     internal_store->container_descriptors_array,
-				     &entry_index,
-				     (intptr_t *) container_descriptor,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable append container descriptor.",
-					 function );
+/* Sets the direct IO value
+ * When set the base log and container files opened by the library bypass the page cache
+ * and are read in aligned regions, this must be set before the store is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_set_direct_io(
+     libfsclfs_store_t *store,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_set_direct_io";
 
-					goto on_error;
-				}
-				container_descriptor = NULL;
-			}
-		}
-		else
-		{
-			if( information_record_type == 0xc1fdf007 )
-			{
-				if( libfsclfs_stream_descriptor_free(
-				     &stream_descriptor,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable free stream descriptor.",
-					 function );
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
 
-					goto on_error;
-				}
-			}
-			else if( information_record_type == 0xc1fdf008 )
-			{
-				if( libfsclfs_container_descriptor_free(
-				     &container_descriptor,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable free container descriptor.",
-					 function );
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
 
-					goto on_error;
-				}
-			}
-		}
+	if( internal_store->base_log_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid store - base log file IO handle already set.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfsclfs_block_free(
-	     &block,
-	     error ) != 1 )
+#if !defined( HAVE_LIBFSCLFS_DIRECT_IO )
+	if( use_direct_io != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free block.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO not supported on this platform.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store->store_metadata_dump_count = dump_count;
+#endif
+	internal_store->use_direct_io = (uint8_t) ( use_direct_io != 0 );
 
 	return( 1 );
+}
 
-on_error:
-	libcdata_array_resize(
-	 internal_store->container_descriptors_array,
-	 0,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
-	 NULL );
+/* Creates a file IO handle that reads a file using direct IO
+ * The aligned pool is created on first use and has a buffer size of a region
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_initialize_direct_io_file_io_handle(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t **file_io_handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_store_initialize_direct_io_file_io_handle";
 
-	libcdata_array_resize(
-	 internal_store->stream_descriptors_array,
-	 0,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_stream_descriptor_free,
-	 NULL );
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
 
-	if( container_descriptor != NULL )
+		return( -1 );
+	}
+	if( internal_store->io_handle == NULL )
 	{
-		libfsclfs_container_descriptor_free(
-		 &container_descriptor,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal store - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( stream_descriptor != NULL )
+	if( internal_store->aligned_pool == NULL )
 	{
-		libfsclfs_stream_descriptor_free(
-		 &stream_descriptor,
-		 NULL );
+		if( libfsclfs_aligned_pool_initialize(
+		     &( internal_store->aligned_pool ),
+		     (size_t) internal_store->io_handle->region_size,
+		     LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create aligned pool.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( block != NULL )
+	if( libfsclfs_direct_file_io_handle_initialize(
+	     file_io_handle,
+	     internal_store->aligned_pool,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
 	{
-		libfsclfs_block_free(
-		 &block,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-
-/* Reads the container owner page
+/* Scans the containers for blocks
+ * The regions of all the containers are scanned by a work-stealing scheduler
+ * that runs the number of threads of the store when multi-threading support is available
+ * The resulting block map of every container is used to look up the physical block offset
+ * of a record instead of reading the owner page of its region
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_read_container_owner_page(
-     libfsclfs_internal_store_t *internal_store,
-     libbfio_handle_t *container_file_io_handle,
-     libfsclfs_owner_page_t *owner_page,
-     uint32_t offset,
+int libfsclfs_store_scan_containers(
+     libfsclfs_store_t *store,
      libcerror_error_t **error )
 {
-	static char *function = "libfsclfs_store_read_container_owner_page";
-	int number_of_streams = 0;
-	int result            = 0;
+	libbfio_handle_t *container_file_io_handle             = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	libfsclfs_owner_page_t *block_map                      = NULL;
+	libfsclfs_region_scanner_t **region_scanners           = NULL;
+	static char *function                                  = "libfsclfs_store_scan_containers";
+	int container_descriptor_index                         = 0;
+	int number_of_container_descriptors                    = 0;
+	int number_of_streams                                  = 0;
 
-	if( internal_store == NULL )
+	if( store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->container_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing container file IO pool.",
 		 function );
 
 		return( -1 );
@@ -3273,1375 +7742,1493 @@ int libfsclfs_store_read_container_owner_page(
 
 		return( -1 );
 	}
-#ifdef TODO
-	/* TODO determine when owner page should be valid */
-	result = libfsclfs_owner_page_read(
-	          owner_page,
-	          internal_store->io_handle,
-	          container_file_io_handle,
-	          number_of_streams,
-	          (off64_t) offset,
-	          error );
-#else
-	result = libfsclfs_owner_page_read_scan_region(
-	          owner_page,
-	          internal_store->io_handle,
-	          container_file_io_handle,
-	          number_of_streams,
-	          (off64_t) offset,
-	          error );
-#endif
-	if( result != 1 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_descriptors_array,
+	     &number_of_container_descriptors,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read owner page at offset: %" PRIu32 ".",
-		 function,
-		 offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     internal_store->container_block_maps_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_owner_page_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty container block maps array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_container_descriptors == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_container_descriptors > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_region_scanner_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of container descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     internal_store->container_block_maps_array,
+	     number_of_container_descriptors,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_owner_page_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize container block maps array.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Reads the container block record values
- * Returns 1 if successful or -1 on error
- */
-int libfsclfs_block_read_record_values(
-     libfsclfs_internal_store_t *internal_store,
-     libbfio_handle_t *container_file_io_handle,
-     uint32_t block_offset,
-     libcdata_array_t *record_values_array,
-     libcerror_error_t **error )
-{
-	libfsclfs_block_t *block               = NULL;
-	libfsclfs_record_value_t *record_value = NULL;
-	uint8_t *record_data                   = NULL;
-	static char *function                  = "libfsclfs_block_read_record_values";
-	size_t alignment_padding_size          = 0;
-	size_t record_data_offset              = 0;
-	size_t record_data_size                = 0;
-        uint32_t container_logical_number      = 0;
-	uint32_t record_type                   = 0;
-	uint16_t record_number                 = 0;
-	int entry_index                        = 0;
+	region_scanners = (libfsclfs_region_scanner_t **) memory_allocate(
+	                                                   sizeof( libfsclfs_region_scanner_t * ) * number_of_container_descriptors );
 
-	if( internal_store == NULL )
+	if( region_scanners == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create region scanners.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfsclfs_block_initialize(
-	     &block,
-	     error ) != 1 )
+	if( memory_set(
+	     region_scanners,
+	     0,
+	     sizeof( libfsclfs_region_scanner_t * ) * number_of_container_descriptors ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear region scanners.",
 		 function );
 
+		memory_free(
+		 region_scanners );
+
+		region_scanners = NULL;
+
 		goto on_error;
 	}
-	do
+	for( container_descriptor_index = 0;
+	     container_descriptor_index < number_of_container_descriptors;
+	     container_descriptor_index++ )
 	{
-		if( libfsclfs_block_read(
-		     block,
-		     internal_store->io_handle,
-		     container_file_io_handle,
-		     block_offset,
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->container_descriptors_array,
+		     container_descriptor_index,
+		     (intptr_t **) &container_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block at offset: %" PRIu32 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container descriptor: %d.",
 			 function,
-			 block_offset );
+			 container_descriptor_index );
 
 			goto on_error;
 		}
-		if( libfsclfs_block_get_record_data(
-		     block,
-		     &record_data,
-		     &record_data_size,
-		     error ) != 1 )
+		if( container_descriptor == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable retrieve record data.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing container descriptor: %d.",
+			 function,
+			 container_descriptor_index );
 
 			goto on_error;
 		}
-		if( record_data == NULL )
+		if( container_descriptor->physical_number >= (uint32_t) number_of_container_descriptors )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing record data.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid container descriptor: %d - physical number value out of bounds.",
+			 function,
+			 container_descriptor_index );
 
 			goto on_error;
 		}
-		record_data_offset = block->record_data_offset;
-
-		while( record_data_size > 0 )
+		if( region_scanners[ container_descriptor->physical_number ] != NULL )
 		{
-			if( libfsclfs_record_value_initialize(
-			     &record_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create record value.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsclfs_record_value_read_data(
-			     record_value,
-			     record_data,
-			     record_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read record.",
-				 function );
-
-				goto on_error;
-			}
-			record_type         = record_value->type;
-			record_data        += record_value->size;
-			record_data_size   -= record_value->size;
-			record_data_offset += record_value->size;
-
-			if( libcdata_array_append_entry(
-			     record_values_array,
-			     &entry_index,
-			     (intptr_t *) record_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable append block record value.",
-				 function );
-
-				goto on_error;
-			}
-			record_value = NULL;
-
-			if( ( record_data_offset % 8 ) != 0 )
-			{
-				alignment_padding_size = 8 - ( record_data_offset % 8 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid region scanner: %" PRIu32 " value already set.",
+			 function,
+			 container_descriptor->physical_number );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: alignment padding:\n",
-					 function );
-					libcnotify_print_data(
-					 record_data,
-					 alignment_padding_size,
-					 0 );
-				}
-#endif
-				record_data        += alignment_padding_size;
-				record_data_size   -= alignment_padding_size;
-				record_data_offset += alignment_padding_size;
-			}
-			if( ( record_type & RECORD_TYPE_FLAG_IS_LAST ) != 0 )
-			{
-				break;
-			}
+			goto on_error;
 		}
-		if( ( record_type & RECORD_TYPE_FLAG_IS_LAST ) != 0 )
+		if( internal_store->io_handle->trace_callback != NULL )
 		{
-			break;
+			libfsclfs_trace_event(
+			 internal_store->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_SCAN_CONTAINER,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+			 (uint64_t) container_descriptor->physical_number );
 		}
-		block_offset             = (uint32_t) ( block->next_block_lsn & 0xfffffe00UL );
-	        container_logical_number = (uint32_t) ( block->next_block_lsn >> 32 );
-		record_number            = (uint16_t) ( block->next_block_lsn & 0x01ff );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libbfio_pool_get_handle(
+		     internal_store->container_file_io_pool,
+		     (int) container_descriptor->physical_number,
+		     &container_file_io_handle,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: LSN: 0x%08" PRIx32 ", container logical number: %" PRIu32 ", record number: %" PRIu16 ", block offset: 0x%08" PRIx32 ", \n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container file IO handle: %" PRIu32 " from pool.",
 			 function,
-			 block->next_block_lsn,
-			 container_logical_number,
-			 record_number,
-			 block_offset );
+			 container_descriptor->physical_number );
+
+			goto on_error;
 		}
-#endif
-/* TODO what about block outside the container */
-		if( block->next_block_lsn != 0 )
+		if( libfsclfs_region_scanner_initialize(
+		     &( region_scanners[ container_descriptor->physical_number ] ),
+		     internal_store->io_handle,
+		     container_file_io_handle,
+		     number_of_streams,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid next block LSN value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create region scanner: %" PRIu32 ".",
+			 function,
+			 container_descriptor->physical_number );
 
 			goto on_error;
 		}
 	}
-	while( block_offset != 0 );
+	container_descriptor = NULL;
 
-	if( libfsclfs_block_free(
-	     &block,
+	/* The regions of all the containers are scanned together so that
+	 * a large container does not leave the other threads idle
+	 */
+	if( libfsclfs_region_scanner_scan_multiple(
+	     region_scanners,
+	     number_of_container_descriptors,
+	     internal_store->number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free block.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan containers.",
 		 function );
 
-		return( -1 );
-	}
-	return( 1 );
-
-on_error:
-	libcdata_array_resize(
-	 record_values_array,
-	 0,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_record_value_free,
-	 NULL );
-
-	if( record_value != NULL )
-	{
-		libfsclfs_record_value_free(
-		 &record_value,
-		 NULL );
+		goto on_error;
 	}
-	if( block != NULL )
+	for( container_descriptor_index = 0;
+	     container_descriptor_index < number_of_container_descriptors;
+	     container_descriptor_index++ )
 	{
-		libfsclfs_block_free(
-		 &block,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Retrieves the size of the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libfsclfs_store_get_basename_size(
-     libfsclfs_internal_store_t *internal_store,
-     size_t *basename_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libfsclfs_store_get_basename_size";
+		if( libfsclfs_owner_page_initialize(
+		     &block_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block map.",
+			 function );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+			goto on_error;
+		}
+		if( libfsclfs_region_scanner_merge_log_ranges(
+		     region_scanners[ container_descriptor_index ],
+		     block_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to merge log ranges of container: %d.",
+			 function,
+			 container_descriptor_index );
 
-	if( internal_store == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
-		 function );
+			goto on_error;
+		}
+		if( libfsclfs_region_scanner_free(
+		     &( region_scanners[ container_descriptor_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free region scanner: %d.",
+			 function,
+			 container_descriptor_index );
 
-		return( -1 );
-	}
-	if( basename_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename size.",
-		 function );
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_store->container_block_maps_array,
+		     container_descriptor_index,
+		     (intptr_t *) block_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set container block map: %d.",
+			 function,
+			 container_descriptor_index );
 
-		return( -1 );
-	}
-	if( internal_store->basename == NULL )
-	{
-		return( 0 );
+			goto on_error;
+		}
+		block_map = NULL;
+
+		if( internal_store->io_handle->trace_callback != NULL )
+		{
+			libfsclfs_trace_event(
+			 internal_store->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_SCAN_CONTAINER,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+			 (uint64_t) container_descriptor_index );
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	memory_free(
+	 region_scanners );
+
+	return( 1 );
+
+on_error:
+	if( ( internal_store->io_handle->trace_callback != NULL )
+	 && ( container_descriptor != NULL ) )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_SCAN_CONTAINER,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+		 (uint64_t) container_descriptor->physical_number );
 	}
-	else
+	if( block_map != NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libfsclfs_owner_page_free(
+		 &block_map,
+		 NULL );
 	}
-	if( result != 1 )
+	if( region_scanners != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
-		 function );
-
-		return( -1 );
+		for( container_descriptor_index = 0;
+		     container_descriptor_index < number_of_container_descriptors;
+		     container_descriptor_index++ )
+		{
+			if( region_scanners[ container_descriptor_index ] != NULL )
+			{
+				libfsclfs_region_scanner_free(
+				 &( region_scanners[ container_descriptor_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 region_scanners );
 	}
-#else
-	*basename_size = internal_store->basename_size;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	libcdata_array_empty(
+	 internal_store->container_block_maps_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_owner_page_free,
+	 NULL );
 
-	return( 1 );
+	return( -1 );
 }
 
-/* Retrieves the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Scans the blocks of all the containers
+ * The blocks are determined from the container block maps, if the containers
+ * were not scanned before they are scanned first
+ * Only the block and record headers are read, the blocks are scanned in parallel
+ * by the number of threads of the store when multi-threading support is available
+ * The callback is called for every block, possibly from different threads,
+ * with the index of the worker that scanned the block. The callback should
+ * return 1 if successful or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_get_basename(
-     libfsclfs_internal_store_t *internal_store,
-     char *basename,
-     size_t basename_size,
+int libfsclfs_store_scan_blocks(
+     libfsclfs_store_t *store,
+     int (*callback)(
+            int worker_index,
+            int container_index,
+            int stream_number,
+            uint32_t block_offset,
+            uint32_t block_size,
+            uint32_t used_size,
+            libfsclfs_record_header_table_t *record_header_table,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	static char *function       = "libfsclfs_store_get_basename";
-	size_t narrow_basename_size = 0;
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                  = 0;
-#endif
+	libfsclfs_block_scanner_t *block_scanner               = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	libfsclfs_log_range_t *physical_log_range              = NULL;
+	libfsclfs_log_range_t *virtual_log_range               = NULL;
+	libfsclfs_owner_page_t *block_map                      = NULL;
+	static char *function                                  = "libfsclfs_store_scan_blocks";
+	int container_descriptor_index                         = 0;
+	int log_range_index                                    = 0;
+	int number_of_block_maps                               = 0;
+	int number_of_container_descriptors                    = 0;
+	int number_of_log_ranges                               = 0;
+	int result                                             = 0;
 
-	if( internal_store == NULL )
+	if( store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 "%s: invalid store.",
 		 function );
 
 		return( -1 );
 	}
-	if( basename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
-		 function );
+	internal_store = (libfsclfs_internal_store_t *) store;
 
-		return( -1 );
-	}
-	if( internal_store->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          &narrow_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          &narrow_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          &narrow_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          &narrow_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	narrow_basename_size = internal_store->basename_size;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-	if( basename_size < narrow_basename_size )
+	if( internal_store->container_file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: basename too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing container file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) basename,
-		          basename_size,
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) basename,
-		          basename_size,
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) basename,
-		          basename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) basename,
-		          basename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	if( system_string_copy(
-	     basename,
-	     internal_store->basename,
-	     internal_store->basename_size ) == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_descriptors_array,
+	     &number_of_container_descriptors,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container descriptors.",
 		 function );
 
 		return( -1 );
 	}
-	basename[ internal_store->basename_size - 1 ] = 0;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-	return( 1 );
-}
-
-/* Sets the basename
- * Returns 1 if successful or -1 on error
- */
-int libfsclfs_store_set_basename(
-     libfsclfs_internal_store_t *internal_store,
-     const char *basename,
-     size_t basename_length,
-     libcerror_error_t **error )
-{
-	static char *function = "libfsclfs_store_set_basename";
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
-
-	if( internal_store == NULL )
+	if( number_of_container_descriptors == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	if( basename == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_block_maps_array,
+	     &number_of_block_maps,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container block maps.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_store->basename != NULL )
+	if( number_of_block_maps != number_of_container_descriptors )
 	{
-		memory_free(
-		 internal_store->basename );
+		if( libfsclfs_store_scan_containers(
+		     store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan containers.",
+			 function );
 
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
+			return( -1 );
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	if( libfsclfs_block_scanner_initialize(
+	     &block_scanner,
+	     internal_store->io_handle,
+	     internal_store->container_file_io_pool,
+	     number_of_container_descriptors,
+	     callback,
+	     callback_data,
+	     error ) != 1 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_store->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_store->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block scanner.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	for( container_descriptor_index = 0;
+	     container_descriptor_index < number_of_container_descriptors;
+	     container_descriptor_index++ )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_store->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_store->basename_size ),
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->container_descriptors_array,
+		     container_descriptor_index,
+		     (intptr_t **) &container_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container descriptor: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		if( container_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing container descriptor: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		result = libfsclfs_store_get_container_block_map(
+		          internal_store,
+		          container_descriptor->physical_number,
+		          &block_map,
 		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block map of container: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     block_map->physical_log_ranges_array,
+		     &number_of_log_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of physical log ranges of container: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		for( log_range_index = 0;
+		     log_range_index < number_of_log_ranges;
+		     log_range_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     block_map->physical_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &physical_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical log range: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     block_map->virtual_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &virtual_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve virtual log range: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+			if( ( physical_log_range == NULL )
+			 || ( virtual_log_range == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing log range: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+			if( libfsclfs_block_scanner_append_block(
+			     block_scanner,
+			     container_descriptor_index,
+			     (int) container_descriptor->physical_number,
+			     virtual_log_range->stream_number,
+			     (uint32_t) ( physical_log_range->start_lsn & 0xfffffe00UL ),
+			     (uint32_t) ( physical_log_range->end_lsn - physical_log_range->start_lsn ),
+			     virtual_log_range->start_lsn,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append block: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+		}
 	}
-	if( result != 1 )
+	if( libfsclfs_block_scanner_scan(
+	     block_scanner,
+	     internal_store->number_of_threads,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan blocks.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#else
-	internal_store->basename_size = basename_length + 1;
-#endif
-	internal_store->basename = system_string_allocate(
-	                            internal_store->basename_size );
-
-	if( internal_store->basename == NULL )
+	if( libfsclfs_block_scanner_free(
+	     &block_scanner,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block scanner.",
 		 function );
 
-		internal_store->basename_size = 0;
-
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		goto on_error;
 	}
-	else
+	return( 1 );
+
+on_error:
+	if( block_scanner != NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libfsclfs_block_scanner_free(
+		 &block_scanner,
+		 NULL );
 	}
-	if( result != 1 )
+	return( -1 );
+}
+
+/* Verifies the blocks of the base log and all the containers
+ * The blocks of the base log are determined from the block descriptors, the blocks
+ * of the containers from the container block maps, if the containers were not
+ * scanned before they are scanned first
+ * The regions are verified in parallel by the number of threads of the store
+ * when multi-threading support is available
+ * The callback is called for every region, in order of container and offset,
+ * after all the regions were verified. A container index of -1 represents the
+ * base log. The callback should return 1 if successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_verify(
+     libfsclfs_store_t *store,
+     int (*callback)(
+            int container_index,
+            uint32_t region_offset,
+            int number_of_blocks,
+            int number_of_failed_blocks,
+            int failure_type,
+            uint32_t failure_offset,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *block_descriptors_array              = NULL;
+	libfsclfs_block_descriptor_t *block_descriptor         = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	libfsclfs_log_range_t *physical_log_range              = NULL;
+	libfsclfs_log_range_t *virtual_log_range               = NULL;
+	libfsclfs_owner_page_t *block_map                      = NULL;
+	libfsclfs_verifier_t *verifier                         = NULL;
+	libfsclfs_verifier_region_t *region                    = NULL;
+	static char *function                                  = "libfsclfs_store_verify";
+	int block_descriptor_index                             = 0;
+	int container_descriptor_index                         = 0;
+	int log_range_index                                    = 0;
+	int number_of_block_descriptors                        = 0;
+	int number_of_block_maps                               = 0;
+	int number_of_container_descriptors                    = 0;
+	int number_of_log_ranges                               = 0;
+	int region_index                                       = 0;
+	int result                                             = 0;
+
+	if( store == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
 		 function );
 
-		memory_free(
-		 internal_store->basename );
-
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
-
 		return( -1 );
 	}
-#else
-	if( system_string_copy(
-	     internal_store->basename,
-	     basename,
-	     basename_length ) == NULL )
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
-		memory_free(
-		 internal_store->basename );
-
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
-
 		return( -1 );
 	}
-	internal_store->basename[ basename_length ] = 0;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-	return( 1 );
-}
-
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the size of the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libfsclfs_store_get_basename_size_wide(
-     libfsclfs_internal_store_t *internal_store,
-     size_t *basename_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libfsclfs_store_get_basename_size_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
-
-	if( internal_store == NULL )
+	if( internal_store->base_log_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing base log file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( basename_size == NULL )
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename size.",
+		 "%s: invalid callback.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_store->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	*basename_size = internal_store->basename_size;
-#else
-	if( libclocale_codepage == 0 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_descriptors_array,
+	     &number_of_container_descriptors,
+	     error ) != 1 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container descriptors.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( ( number_of_container_descriptors > 0 )
+	 && ( internal_store->container_file_io_pool == NULL ) )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing container file IO pool.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->container_block_maps_array,
+	     &number_of_block_maps,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of container block maps.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	return( 1 );
-}
-
-/* Retrieves the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libfsclfs_store_get_basename_wide(
-     libfsclfs_internal_store_t *internal_store,
-     wchar_t *basename,
-     size_t basename_size,
-     libcerror_error_t **error )
-{
-	static char *function     = "libfsclfs_store_get_basename_wide";
-	size_t wide_basename_size = 0;
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                = 0;
-#endif
+	if( number_of_block_maps != number_of_container_descriptors )
+	{
+		if( libfsclfs_store_scan_containers(
+		     store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan containers.",
+			 function );
 
-	if( internal_store == NULL )
+			return( -1 );
+		}
+	}
+	if( libfsclfs_verifier_initialize(
+	     &verifier,
+	     internal_store->io_handle,
+	     internal_store->base_log_file_io_handle,
+	     internal_store->container_file_io_pool,
+	     number_of_container_descriptors,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create verifier.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( basename == NULL )
+	if( libcdata_array_initialize(
+	     &block_descriptors_array,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block descriptors array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_store->basename == NULL )
+	if( libfsclfs_store_read_block_descriptors(
+	     internal_store,
+	     internal_store->base_log_file_io_handle,
+	     0,
+	     internal_store->io_handle->bytes_per_sector * 0x02,
+	     block_descriptors_array,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block descriptors.",
+		 function );
+
+		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	wide_basename_size = internal_store->basename_size;
-#else
-	if( libclocale_codepage == 0 )
+	if( libcdata_array_get_number_of_entries(
+	     block_descriptors_array,
+	     &number_of_block_descriptors,
+	     error ) != 1 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          &wide_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          &wide_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of block descriptors.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	for( block_descriptor_index = 0;
+	     block_descriptor_index < number_of_block_descriptors;
+	     block_descriptor_index++ )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          &wide_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          &wide_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		if( libcdata_array_get_entry_by_index(
+		     block_descriptors_array,
+		     block_descriptor_index,
+		     (intptr_t **) &block_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block descriptor: %d from array.",
+			 function,
+			 block_descriptor_index );
+
+			goto on_error;
+		}
+		if( block_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing block descriptor: %d.",
+			 function,
+			 block_descriptor_index );
+
+			goto on_error;
+		}
+		/* Unused block descriptors have no size
+		 */
+		if( block_descriptor->size == 0 )
+		{
+			continue;
+		}
+		if( libfsclfs_verifier_append_block(
+		     verifier,
+		     -1,
+		     -1,
+		     0,
+		     block_descriptor->offset,
+		     block_descriptor->size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append base log block: %d.",
+			 function,
+			 block_descriptor_index );
+
+			goto on_error;
+		}
 	}
-	if( result != 1 )
+	if( libcdata_array_free(
+	     &block_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block descriptors array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	if( basename_size < wide_basename_size )
+	for( container_descriptor_index = 0;
+	     container_descriptor_index < number_of_container_descriptors;
+	     container_descriptor_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: basename too small.",
-		 function );
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->container_descriptors_array,
+		     container_descriptor_index,
+		     (intptr_t **) &container_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container descriptor: %d.",
+			 function,
+			 container_descriptor_index );
 
-		return( -1 );
+			goto on_error;
+		}
+		if( container_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing container descriptor: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		result = libfsclfs_store_get_container_block_map(
+		          internal_store,
+		          container_descriptor->physical_number,
+		          &block_map,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block map of container: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     block_map->physical_log_ranges_array,
+		     &number_of_log_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of physical log ranges of container: %d.",
+			 function,
+			 container_descriptor_index );
+
+			goto on_error;
+		}
+		for( log_range_index = 0;
+		     log_range_index < number_of_log_ranges;
+		     log_range_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     block_map->physical_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &physical_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical log range: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     block_map->virtual_log_ranges_array,
+			     log_range_index,
+			     (intptr_t **) &virtual_log_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve virtual log range: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+			if( ( physical_log_range == NULL )
+			 || ( virtual_log_range == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing log range: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+			if( libfsclfs_verifier_append_block(
+			     verifier,
+			     container_descriptor_index,
+			     (int) container_descriptor->physical_number,
+			     virtual_log_range->stream_number,
+			     (uint32_t) ( physical_log_range->start_lsn & 0xfffffe00UL ),
+			     (uint32_t) ( physical_log_range->end_lsn - physical_log_range->start_lsn ),
+			     virtual_log_range->start_lsn,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append block: %d of container: %d.",
+				 function,
+				 log_range_index,
+				 container_descriptor_index );
+
+				goto on_error;
+			}
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     basename,
-	     internal_store->basename,
-	     internal_store->basename_size ) == NULL )
+	if( libfsclfs_verifier_verify(
+	     verifier,
+	     internal_store->number_of_threads,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify blocks.",
 		 function );
 
-		return( -1 );
-	}
-	basename[ internal_store->basename_size - 1 ] = 0;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) basename,
-		          basename_size,
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) basename,
-		          basename_size,
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		goto on_error;
 	}
-	else
+	for( region_index = 0;
+	     region_index < verifier->number_of_regions;
+	     region_index++ )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) basename,
-		          basename_size,
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) basename,
-		          basename_size,
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		region = &( verifier->regions[ region_index ] );
+
+		if( callback(
+		     region->container_index,
+		     region->offset,
+		     region->number_of_blocks,
+		     region->number_of_failed_blocks,
+		     region->failure_type,
+		     region->failure_offset,
+		     callback_data ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for region at offset: %" PRIu32 " of container: %d.",
+			 function,
+			 region->offset,
+			 region->container_index );
+
+			goto on_error;
+		}
 	}
-	if( result != 1 )
+	if( libfsclfs_verifier_free(
+	     &verifier,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free verifier.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &block_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_block_descriptor_free,
+		 NULL );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	return( 1 );
+	if( verifier != NULL )
+	{
+		libfsclfs_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Sets the basename
+/* Retrieves the region size
  * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_set_basename_wide(
-     libfsclfs_internal_store_t *internal_store,
-     const wchar_t *basename,
-     size_t basename_length,
+int libfsclfs_store_get_region_size(
+     libfsclfs_store_t *store,
+     uint32_t *region_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfsclfs_store_set_basename_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_region_size";
 
-	if( internal_store == NULL )
+	if( store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal store.",
+		 "%s: invalid store.",
 		 function );
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_store->basename != NULL )
-	{
-		memory_free(
-		 internal_store->basename );
-
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	internal_store->basename_size = basename_length + 1;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_store->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_store->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_store->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_store->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( region_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region size.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	internal_store->basename = system_string_allocate(
-	                            internal_store->basename_size );
+	*region_size = internal_store->io_handle->region_size;
 
-	if( internal_store->basename == NULL )
+	return( 1 );
+}
+
+/* Retrieves the region owner page offset
+ * The owner page offset is relative to the start of the region and
+ * is the size of the part of the region that can contain blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_store_get_region_owner_page_offset(
+     libfsclfs_store_t *store,
+     uint32_t *owner_page_offset,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	static char *function                      = "libfsclfs_store_get_region_owner_page_offset";
+
+	if( store == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create basename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     internal_store->basename,
-	     basename,
-	     basename_length ) == NULL )
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
-		memory_free(
-		 internal_store->basename );
-
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
-
 		return( -1 );
 	}
-	internal_store->basename[ basename_length ] = 0;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) internal_store->basename,
-		          internal_store->basename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( owner_page_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner page offset.",
 		 function );
 
-		memory_free(
-		 internal_store->basename );
-
-		internal_store->basename      = NULL;
-		internal_store->basename_size = 0;
-
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	*owner_page_offset = internal_store->io_handle->region_owner_page_offset;
+
 	return( 1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Retrieves the number of containers
- * Returns 1 if successful or -1 on error
+/* Retrieves the block map of a specific container
+ * Returns 1 if successful, 0 if the container was not scanned or -1 on error
  */
-int libfsclfs_store_get_number_of_containers(
-     libfsclfs_store_t *store,
-     int *number_of_containers,
+int libfsclfs_store_get_container_block_map(
+     libfsclfs_internal_store_t *internal_store,
+     uint32_t container_physical_number,
+     libfsclfs_owner_page_t **block_map,
      libcerror_error_t **error )
 {
-	libfsclfs_internal_store_t *internal_store = NULL;
-	static char *function                      = "libfsclfs_store_get_number_of_containers";
+	static char *function    = "libfsclfs_store_get_container_block_map";
+	int number_of_block_maps = 0;
 
-	if( store == NULL )
+	if( internal_store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid store.",
+		 "%s: invalid internal store.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store = (libfsclfs_internal_store_t *) store;
+	if( block_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block map.",
+		 function );
+
+		return( -1 );
+	}
+	*block_map = NULL;
 
 	if( libcdata_array_get_number_of_entries(
-	     internal_store->container_descriptors_array,
-	     number_of_containers,
+	     internal_store->container_block_maps_array,
+	     &number_of_block_maps,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of container descriptors.",
+		 "%s: unable to retrieve number of container block maps.",
 		 function );
 
 		return( -1 );
 	}
+	if( container_physical_number >= (uint32_t) number_of_block_maps )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_store->container_block_maps_array,
+	     (int) container_physical_number,
+	     (intptr_t **) block_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container block map: %" PRIu32 ".",
+		 function,
+		 container_physical_number );
+
+		return( -1 );
+	}
+	if( *block_map == NULL )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
-/* Retrieves a specific container
- * Returns 1 if successful or -1 on error
+/* Retrieves the container file IO handle and physical block offset of a block using a logical LSN
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsclfs_store_get_container(
-     libfsclfs_store_t *store,
-     int container_index,
-     libfsclfs_container_t **container,
+int libfsclfs_store_get_physical_block_by_logical_lsn(
+     libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     libbfio_handle_t **container_file_io_handle,
+     uint32_t *physical_block_offset,
      libcerror_error_t **error )
 {
-	libfsclfs_container_descriptor_t *container_descriptor = NULL;
-	libfsclfs_internal_store_t *internal_store             = NULL;
-	static char *function                                  = "libfsclfs_store_get_container";
+	static char *function              = "libfsclfs_store_get_physical_block_by_logical_lsn";
+	uint32_t container_physical_number = 0;
+	int result                         = 0;
 
-	if( store == NULL )
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid store.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store = (libfsclfs_internal_store_t *) store;
-
-	if( container == NULL )
+	if( container_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container.",
+		 "%s: invalid container file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *container != NULL )
+	if( physical_block_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical block offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_store->container_descriptors_array,
-	     container_index,
-	     (intptr_t **) &container_descriptor,
-	     error ) != 1 )
+	*container_file_io_handle = NULL;
+
+	result = libfsclfs_store_get_container_physical_number(
+	          internal_store,
+	          container_logical_number,
+	          &container_physical_number,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve container descriptor: %d.",
-		 function,
-		 container_index );
+		 "%s: unable to retrieve container physical number.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfsclfs_container_initialize(
-	     container,
-	     internal_store,
-	     container_descriptor,
-	     error ) != 1 )
+	else if( result != 0 )
+	{
+/* TODO use logical container number for index in file IO pool? */
+		if( libbfio_pool_get_handle(
+		     internal_store->container_file_io_pool,
+		     (int) container_physical_number,
+		     container_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container file IO handle: %" PRIu32 " from pool.",
+			 function,
+			 container_physical_number );
+
+			return( -1 );
+		}
+	}
+	if( *container_file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	result = libfsclfs_store_get_physical_block_offset(
+	          internal_store,
+	          stream_number,
+	          container_physical_number,
+	          container_logical_number,
+	          block_offset,
+	          *container_file_io_handle,
+	          physical_block_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical block offset.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the physical container number for a specific logical container number
+/* Retrieves the physical block offset of a block using a logical LSN
+ * The container file IO handle must be of the container with the physical number
+ * and is used to read the owner page of the region that contains the block
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsclfs_store_get_container_physical_number(
+int libfsclfs_store_get_physical_block_offset(
      libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_physical_number,
      uint32_t container_logical_number,
-     uint32_t *container_physical_number,
+     uint32_t block_offset,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t *physical_block_offset,
      libcerror_error_t **error )
 {
-	libfsclfs_container_descriptor_t *container_descriptor = NULL;
-	static char *function                                  = "libfsclfs_store_set_basename_wide";
-	int container_descriptor_index                         = 0;
-	int number_of_container_descriptors                    = 0;
+	libfsclfs_owner_page_t *block_map  = NULL;
+	libfsclfs_owner_page_t *owner_page = NULL;
+	static char *function              = "libfsclfs_store_get_physical_block_offset";
+	uint32_t owner_page_offset         = 0;
+	uint32_t region_offset             = 0;
+	int result                         = 0;
 
 	if( internal_store == NULL )
 	{
@@ -4654,328 +9241,709 @@ int libfsclfs_store_get_container_physical_number(
 
 		return( -1 );
 	}
-	if( container_physical_number == NULL )
+	if( internal_store->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container physical number.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid store - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_store->container_descriptors_array,
-	     &number_of_container_descriptors,
-	     error ) != 1 )
+	if( container_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of container descriptors.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_store->container_descriptors_array,
-	     container_descriptor_index,
-	     (intptr_t **) &container_descriptor,
-	     error ) != 1 )
+	if( physical_block_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve container descriptor: %d.",
-		 function,
-		 container_descriptor_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical block offset.",
+		 function );
 
 		return( -1 );
 	}
-	if( container_descriptor == NULL )
+	/* The blocks of the physical stream and of a dedicated log are addressed
+	 * directly, only the streams of a multiplexed log are mapped onto regions
+	 */
+	if( stream_number == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing container descriptor: %d.",
-		 function,
-		 container_descriptor_index );
-
-		return( -1 );
+		*physical_block_offset = block_offset;
+		result                 = 1;
 	}
-	if( container_descriptor->logical_number == container_logical_number )
+	else if( internal_store->is_dedicated_log != 0 )
 	{
-		*container_physical_number = container_descriptor->physical_number;
+		*physical_block_offset = block_offset;
+		result                 = 1;
 
-		return( 1 );
-	}
-/* TODO remove?
-	else if( container_descriptor->physical_number == container_logical_number )
-	{
-		*container_physical_number = container_descriptor->physical_number;
+		/* The log type is determined by the number of streams, hence the direct
+		 * addressing is checked against the header of the first block looked up.
+		 * If it does not match the stream is mapped onto regions instead
+		 */
+		if( internal_store->dedicated_log_is_checked == 0 )
+		{
+			result = libfsclfs_store_check_physical_block(
+			          internal_store,
+			          container_file_io_handle,
+			          container_logical_number,
+			          block_offset,
+			          block_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to check physical block.",
+				 function );
 
-		return( 1 );
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				internal_store->is_dedicated_log = 0;
+			}
+			internal_store->dedicated_log_is_checked = 1;
+		}
 	}
-*/
-	else if( container_descriptor->logical_number > container_logical_number )
+	if( result == 0 )
 	{
-		for( container_descriptor_index = 1;
-		     container_descriptor_index < number_of_container_descriptors;
-		     container_descriptor_index++ )
+		/* Use the block map of the container if it was scanned
+		 * otherwise read the owner page of the region that contains the block.
+		 * The owner page is also read if the block was not mapped when the container
+		 * was scanned, e.g. since it was appended after the store was refreshed
+		 */
+		if( libfsclfs_store_get_container_block_map(
+		     internal_store,
+		     container_physical_number,
+		     &block_map,
+		     error ) == -1 )
 		{
-			if( libcdata_array_get_entry_by_index(
-			     internal_store->container_descriptors_array,
-			     container_descriptor_index,
-			     (intptr_t **) &container_descriptor,
-			     error ) != 1 )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container block map.",
+			 function );
+
+			goto on_error;
+		}
+		result = 0;
+
+		if( block_map != NULL )
+		{
+			result = libfsclfs_owner_page_get_physical_block_offset(
+			          block_map,
+			          container_logical_number,
+			          block_offset,
+			          physical_block_offset,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve container descriptor: %d.",
-				 function,
-				 container_descriptor_index );
+				 "%s: unable to retrieve physical block offset from block map.",
+				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-			if( container_descriptor == NULL )
+		}
+		if( result == 0 )
+		{
+			if( internal_store->io_handle->region_size_shift != 0 )
+			{
+				region_offset = ( block_offset >> internal_store->io_handle->region_size_shift )
+					      << internal_store->io_handle->region_size_shift;
+			}
+			else
+			{
+				region_offset = ( block_offset / internal_store->io_handle->region_size )
+					      * internal_store->io_handle->region_size;
+			}
+
+			owner_page_offset = region_offset
+					  + internal_store->io_handle->region_owner_page_offset;
+
+			if( libfsclfs_owner_page_initialize(
+			     &owner_page,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing container descriptor: %d.",
-				 function,
-				 container_descriptor_index );
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create owner page.",
+				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-/* TODO determine what unknown2 contains */
-			if( container_descriptor->unknown2 == 0 )
+			if( libfsclfs_store_read_container_owner_page(
+			     internal_store,
+			     container_file_io_handle,
+			     owner_page,
+			     owner_page_offset,
+			     0,
+			     error ) != 1 )
 			{
-				continue;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read container owner page.",
+				 function );
+
+				goto on_error;
 			}
-			if( container_descriptor->logical_number == container_logical_number )
+			result = libfsclfs_owner_page_get_physical_block_offset(
+			          owner_page,
+			          container_logical_number,
+			          block_offset,
+			          physical_block_offset,
+			          error );
+
+			if( result == -1 )
 			{
-				*container_physical_number = container_descriptor->physical_number;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical block offset.",
+				 function );
 
-				return( 1 );
+				goto on_error;
 			}
-/* TODO remove?
-			if( container_descriptor->physical_number == container_logical_number )
+			/* The block mapped by the sector mapping array is only used if its header
+			 * refers to the requested block
+			 */
+			if( ( result == 1 )
+			 && ( owner_page->is_scanned == 0 ) )
 			{
-				*container_physical_number = container_descriptor->physical_number;
+				result = libfsclfs_store_check_physical_block(
+				          internal_store,
+				          container_file_io_handle,
+				          container_logical_number,
+				          block_offset,
+				          *physical_block_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to check physical block.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* The sector mapping array of the owner page does not contain the blocks
+			 * that were written to the region after the owner page was written
+			 * and can map a block that does not match the block header
+			 */
+			if( ( result == 0 )
+			 && ( owner_page->is_scanned == 0 ) )
+			{
+				if( libfsclfs_owner_page_free(
+				     &owner_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free owner page.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsclfs_owner_page_initialize(
+				     &owner_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create owner page.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsclfs_store_read_container_owner_page(
+				     internal_store,
+				     container_file_io_handle,
+				     owner_page,
+				     owner_page_offset,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to scan container region.",
+					 function );
+
+					goto on_error;
+				}
+				result = libfsclfs_owner_page_get_physical_block_offset(
+				          owner_page,
+				          container_logical_number,
+				          block_offset,
+				          physical_block_offset,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve physical block offset.",
+					 function );
 
-				return( 1 );
+					goto on_error;
+				}
 			}
-*/
 		}
-	}
-	else
-	{
-		for( container_descriptor_index = number_of_container_descriptors - 1;
-		     container_descriptor_index > 0;
-		     container_descriptor_index-- )
+		if( owner_page != NULL )
 		{
-			if( libcdata_array_get_entry_by_index(
-			     internal_store->container_descriptors_array,
-			     container_descriptor_index,
-			     (intptr_t **) &container_descriptor,
+			if( libfsclfs_owner_page_free(
+			     &owner_page,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve container descriptor: %d.",
-				 function,
-				 container_descriptor_index );
-
-				return( -1 );
-			}
-			if( container_descriptor == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing container descriptor: %d.",
-				 function,
-				 container_descriptor_index );
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free owner page.",
+				 function );
 
 				return( -1 );
 			}
-			if( container_descriptor->unknown2 == 0 )
-			{
-				continue;
-			}
-			if( container_descriptor->logical_number == container_logical_number )
-			{
-				*container_physical_number = container_descriptor->physical_number;
-
-				return( 1 );
-			}
-/* TODO remove?
-			if( container_descriptor->physical_number == container_logical_number )
-			{
-				*container_physical_number = container_descriptor->physical_number;
-
-				return( 1 );
-			}
-*/
 		}
 	}
-	return( 0 );
+	return( result );
+
+on_error:
+	if( owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &owner_page,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the number of streams
- * Returns 1 if successful or -1 on error
+/* Checks if the block at a physical block offset is the block of a logical LSN
+ * The physical LSN in the block header must match the physical block offset
+ * and the virtual LSN of the first record must be that of the block
+ * Returns 1 if the block matches, 0 if not or -1 on error
  */
-int libfsclfs_store_get_number_of_streams(
-     libfsclfs_store_t *store,
-     int *number_of_streams,
+int libfsclfs_store_check_physical_block(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     uint32_t physical_block_offset,
      libcerror_error_t **error )
 {
-	libfsclfs_internal_store_t *internal_store = NULL;
-	static char *function                      = "libfsclfs_store_get_number_of_streams";
+	libfsclfs_block_t *block    = NULL;
+	uint8_t *record_data        = NULL;
+	static char *function       = "libfsclfs_store_check_physical_block";
+	size_t record_data_size     = 0;
+	uint64_t record_virtual_lsn = 0;
+	uint64_t virtual_lsn        = 0;
+	int result                  = 0;
 
-	if( store == NULL )
+	if( internal_store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid store.",
+		 "%s: invalid internal store.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store = (libfsclfs_internal_store_t *) store;
+	if( libfsclfs_block_initialize(
+	     &block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block.",
+		 function );
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_store->stream_descriptors_array,
-	     number_of_streams,
+		goto on_error;
+	}
+	result = libfsclfs_block_probe(
+	          block,
+	          internal_store->io_handle,
+	          container_file_io_handle,
+	          physical_block_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 physical_block_offset );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		if( ( block->physical_lsn & 0xfffffe00UL ) != physical_block_offset )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libfsclfs_block_get_record_data(
+		          block,
+		          &record_data,
+		          &record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable retrieve record data.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( record_data == NULL )
+		 || ( record_data_size < 8 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 record_data,
+		 record_virtual_lsn );
+
+		virtual_lsn = ( (uint64_t) container_logical_number << 32 ) | block_offset;
+
+		if( ( virtual_lsn < record_virtual_lsn )
+		 || ( ( virtual_lsn - record_virtual_lsn ) >= (uint64_t) block->size ) )
+		{
+			result = 0;
+		}
+	}
+	if( libfsclfs_block_free(
+	     &block,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific record value using a logical LSN
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsclfs_store_get_record_value_by_logical_lsn(
+     libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     uint16_t record_number,
+     libfsclfs_internal_record_filter_t *record_filter,
+     libfsclfs_record_value_t **record_value,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *container_file_io_handle = NULL;
+	static char *function                      = "libfsclfs_store_get_record_value_by_logical_lsn";
+	uint32_t physical_block_offset             = 0;
+	int result                                 = 0;
+
+	result = libfsclfs_store_get_physical_block_by_logical_lsn(
+	          internal_store,
+	          stream_number,
+	          container_logical_number,
+	          block_offset,
+	          &container_file_io_handle,
+	          &physical_block_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of stream descriptors.",
+		 "%s: unable to retrieve physical block.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	else if( result != 0 )
+	{
+		if( libfsclfs_block_read_record_value(
+		     internal_store,
+		     container_file_io_handle,
+		     physical_block_offset,
+		     record_number,
+		     record_filter,
+		     record_value,
+		     previous_lsn,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block record value: %" PRIu16 ".",
+			 function,
+			 record_number );
+
+			return( -1 );
+		}
+	}
+	return( result );
 }
 
-/* Retrieves a specific stream
- * Returns 1 if successful or -1 on error
+/* Reads a specific record value using a logical LSN into an existing block and record value
+ * The data of the block and record value is reused and only reallocated when it grows
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsclfs_store_get_stream(
-     libfsclfs_store_t *store,
-     int stream_index,
-     libfsclfs_stream_t **stream,
+int libfsclfs_store_fill_record_value_by_logical_lsn(
+     libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     uint16_t record_number,
+     libfsclfs_block_t *block,
+     libfsclfs_record_value_t *record_value,
      libcerror_error_t **error )
 {
-	libfsclfs_internal_store_t *internal_store       = NULL;
-	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
-	static char *function                            = "libfsclfs_store_get_stream";
+	libbfio_handle_t *container_file_io_handle = NULL;
+	uint8_t *record_data                       = NULL;
+	static char *function                      = "libfsclfs_store_fill_record_value_by_logical_lsn";
+	size_t record_data_offset                  = 0;
+	size_t record_data_size                    = 0;
+	uint32_t physical_block_offset             = 0;
+	int result                                 = 0;
 
-	if( store == NULL )
+	if( internal_store == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid store.",
+		 "%s: invalid internal store.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsclfs_store_get_physical_block_by_logical_lsn(
+	          internal_store,
+	          stream_number,
+	          container_logical_number,
+	          block_offset,
+	          &container_file_io_handle,
+	          &physical_block_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical block.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store = (libfsclfs_internal_store_t *) store;
-
-	if( stream == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     internal_store->io_handle,
+	     container_file_io_handle,
+	     physical_block_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIu32 ".",
+		 function,
+		 physical_block_offset );
 
 		return( -1 );
 	}
-	if( *stream != NULL )
+	result = libfsclfs_block_get_record_data_by_number(
+	          block,
+	          record_number,
+	          &record_data,
+	          &record_data_size,
+	          &record_data_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid stream value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record: %" PRIu16 " data.",
+		 function,
+		 record_number );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_store->stream_descriptors_array,
-	     stream_index,
-	     (intptr_t **) &stream_descriptor,
-	     error ) != 1 )
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve stream descriptor: %d.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record number: %" PRIu16 " value out of bounds.",
 		 function,
-		 stream_index );
+		 record_number );
 
 		return( -1 );
 	}
-	if( libfsclfs_stream_initialize(
-	     stream,
-	     internal_store,
-	     stream_descriptor,
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+		 (uint64_t) ( physical_block_offset + record_data_offset ) );
+	}
+	if( libfsclfs_record_value_fill_data(
+	     record_value,
+	     record_data,
+	     record_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create stream.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
 		 function );
 
+		if( internal_store->io_handle->trace_callback != NULL )
+		{
+			libfsclfs_trace_event(
+			 internal_store->io_handle,
+			 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+			 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+			 (uint64_t) ( physical_block_offset + record_data_offset ) );
+		}
 		return( -1 );
 	}
+	if( internal_store->io_handle->trace_callback != NULL )
+	{
+		libfsclfs_trace_event(
+		 internal_store->io_handle,
+		 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+		 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+		 (uint64_t) ( physical_block_offset + record_data_offset ) );
+	}
+	if( internal_store->io_handle->statistics != NULL )
+	{
+		libfsclfs_statistics_counter_add(
+		 internal_store->io_handle->statistics->number_of_records_read,
+		 1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves a specific record value using a logical LSN
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Reads the restart record LSNs of a stream
+ * The blocks of the stream are read backwards from the last LSN using only the record headers
+ * until the base LSN or the block that contains the last LSN up to which the restart record LSNs
+ * were previously read. The restart record LSNs are cached in the stream descriptor
+ * Returns 1 if successful or -1 on error
  */
-int libfsclfs_store_get_record_value_by_logical_lsn(
+int libfsclfs_store_read_stream_restart_lsns(
      libfsclfs_internal_store_t *internal_store,
-     uint16_t stream_number,
-     uint32_t container_logical_number,
-     uint32_t block_offset,
-     uint16_t record_number,
-     libfsclfs_record_value_t **record_value,
+     libfsclfs_stream_descriptor_t *stream_descriptor,
      libcerror_error_t **error )
 {
 	libbfio_handle_t *container_file_io_handle = NULL;
-	libcdata_array_t *record_values_array      = NULL;
-	libfsclfs_owner_page_t *owner_page         = NULL;
-	static char *function                      = "libfsclfs_store_get_record_value_by_logical_lsn";
-	uint32_t container_physical_number         = 0;
-	uint32_t owner_page_offset                 = 0;
+	uint64_t *block_restart_lsns               = NULL;
+	uint64_t *restart_lsns                     = NULL;
+	void *reallocation                         = NULL;
+	static char *function                      = "libfsclfs_store_read_stream_restart_lsns";
+	uint64_t block_lsn                         = 0;
+	uint64_t minimum_block_lsn                 = 0;
+	uint64_t previous_block_lsn                = 0;
+	uint64_t previous_last_lsn                 = 0;
+	uint64_t restart_lsn                       = 0;
 	uint32_t physical_block_offset             = 0;
-	uint32_t region_offset                     = 0;
+	int block_restart_lsn_index                = 0;
+	int maximum_number_of_restart_lsns         = 0;
+	int number_of_block_restart_lsns           = 0;
+	int number_of_restart_lsns                 = 0;
 	int result                                 = 0;
 
 	if( internal_store == NULL )
@@ -4989,229 +9957,201 @@ int libfsclfs_store_get_record_value_by_logical_lsn(
 
 		return( -1 );
 	}
-	if( internal_store->io_handle == NULL )
+	if( stream_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid store - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfsclfs_store_get_container_physical_number(
-	          internal_store,
-	          container_logical_number,
-	          &container_physical_number,
-	          error );
-
-	if( result == -1 )
+	if( stream_descriptor->last_lsn == stream_descriptor->restart_lsns_last_lsn )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve container physical number.",
-		 function );
-
-		goto on_error;
+		return( 1 );
 	}
-	else if( result != 0 )
+	/* The stream was truncated or reset since the restart record LSNs were read
+	 */
+	if( stream_descriptor->last_lsn < stream_descriptor->restart_lsns_last_lsn )
 	{
-/* TODO use logical container number for index in file IO pool? */
-		if( libbfio_pool_get_handle(
-		     internal_store->container_file_io_pool,
-		     (int) container_physical_number,
-		     &container_file_io_handle,
+		if( libfsclfs_stream_descriptor_clear_restart_lsns(
+		     stream_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve container file IO handle: %" PRIu32 " from pool.",
-			 function,
-			 container_physical_number );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear restart LSNs.",
+			 function );
 
 			goto on_error;
 		}
 	}
-	if( container_file_io_handle == 0 )
-	{
-		return( 0 );
-	}
-	if( stream_number == 0 )
-	{
-		physical_block_offset = block_offset;
-		result                = 1;
-	}
-	else
-	{
-		region_offset = ( block_offset / internal_store->io_handle->region_size )
-			      * internal_store->io_handle->region_size;
+	previous_last_lsn = stream_descriptor->restart_lsns_last_lsn;
 
-		owner_page_offset = region_offset
-				  + internal_store->io_handle->region_owner_page_offset;
+	if( stream_descriptor->last_lsn != 0 )
+	{
+		block_restart_lsns = (uint64_t *) memory_allocate(
+		                                   sizeof( uint64_t ) * LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS );
 
-		if( libfsclfs_owner_page_initialize(
-		     &owner_page,
-		     error ) != 1 )
+		if( block_restart_lsns == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create owner page.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block restart LSNs.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsclfs_store_read_container_owner_page(
-		     internal_store,
-		     container_file_io_handle,
-		     owner_page,
-		     owner_page_offset,
-		     error ) != 1 )
+		block_lsn         = stream_descriptor->last_lsn & ~( (uint64_t) 0x01ff );
+		minimum_block_lsn = stream_descriptor->base_lsn & ~( (uint64_t) 0x01ff );
+
+		while( block_lsn >= minimum_block_lsn )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read container owner page.",
-			 function );
+			result = libfsclfs_store_get_physical_block_by_logical_lsn(
+			          internal_store,
+			          stream_descriptor->number,
+			          (uint32_t) ( block_lsn >> 32 ),
+			          (uint32_t) ( block_lsn & 0xfffffe00UL ),
+			          &container_file_io_handle,
+			          &physical_block_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical block of LSN: 0x%08" PRIx64 ".",
+				 function,
+				 block_lsn );
 
-			goto on_error;
-		}
-		result = libfsclfs_owner_page_get_physical_block_offset(
-		          owner_page,
-		          container_logical_number,
-		          block_offset,
-		          &physical_block_offset,
-		          error );
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libfsclfs_block_read_restart_lsns(
+			     internal_store,
+			     container_file_io_handle,
+			     physical_block_offset,
+			     block_lsn,
+			     block_restart_lsns,
+			     &number_of_block_restart_lsns,
+			     &previous_block_lsn,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read restart LSNs of block with LSN: 0x%08" PRIx64 ".",
+				 function,
+				 block_lsn );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve physical block offset.",
-			 function );
+				goto on_error;
+			}
+			for( block_restart_lsn_index = number_of_block_restart_lsns - 1;
+			     block_restart_lsn_index >= 0;
+			     block_restart_lsn_index-- )
+			{
+				restart_lsn = block_restart_lsns[ block_restart_lsn_index ];
 
-			goto on_error;
+				if( ( restart_lsn > stream_descriptor->last_lsn )
+				 || ( restart_lsn <= previous_last_lsn )
+				 || ( restart_lsn < stream_descriptor->base_lsn ) )
+				{
+					continue;
+				}
+				if( number_of_restart_lsns >= maximum_number_of_restart_lsns )
+				{
+					if( maximum_number_of_restart_lsns > ( INT_MAX - LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid maximum number of restart LSNs value exceeds maximum.",
+						 function );
+
+						goto on_error;
+					}
+					maximum_number_of_restart_lsns += LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS;
+
+					reallocation = memory_reallocate(
+					                restart_lsns,
+					                sizeof( uint64_t ) * maximum_number_of_restart_lsns );
+
+					if( reallocation == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to resize restart LSNs.",
+						 function );
+
+						goto on_error;
+					}
+					restart_lsns = (uint64_t *) reallocation;
+				}
+				restart_lsns[ number_of_restart_lsns++ ] = restart_lsn;
+			}
+			/* Stop at the block that contains the last LSN up to which the restart
+			 * record LSNs were previously read or if there is no preceding block
+			 */
+			if( ( block_lsn <= previous_last_lsn )
+			 || ( previous_block_lsn == 0 ) )
+			{
+				break;
+			}
+			block_lsn = previous_block_lsn & ~( (uint64_t) 0x01ff );
 		}
-/* TODO cache owner page */
-		if( libfsclfs_owner_page_free(
-		     &owner_page,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free owner page.",
-			 function );
+		memory_free(
+		 block_restart_lsns );
 
-			return( -1 );
-		}
-		owner_page = NULL;
+		block_restart_lsns = NULL;
 	}
-	if( result != 0 )
+	if( libfsclfs_stream_descriptor_insert_restart_lsns(
+	     stream_descriptor,
+	     restart_lsns,
+	     number_of_restart_lsns,
+	     stream_descriptor->last_lsn,
+	     error ) != 1 )
 	{
-		if( libcdata_array_initialize(
-		     &record_values_array,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record values array.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsclfs_block_read_record_values(
-		     internal_store,
-		     container_file_io_handle,
-		     physical_block_offset,
-		     record_values_array,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block record values.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcdata_array_get_entry_by_index(
-		     record_values_array,
-		     (int) record_number,
-		     (intptr_t **) record_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record value: %" PRIu16 ".",
-			 function,
-			 record_number );
-
-			goto on_error;
-		}
-/* TODO for now unset the record value */
-		if( libcdata_array_set_entry_by_index(
-		     record_values_array,
-		     (int) record_number,
-		     (intptr_t *) NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set record value: %" PRIu16 ".",
-			 function,
-			 record_number );
-
-			goto on_error;
-		}
-		if( libcdata_array_free(
-		     &record_values_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_record_value_free,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record values array.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert restart LSNs.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	return( result );
+	if( restart_lsns != NULL )
+	{
+		memory_free(
+		 restart_lsns );
+	}
+	return( 1 );
 
 on_error:
-	if( record_values_array != NULL )
+	if( block_restart_lsns != NULL )
 	{
-		libcdata_array_free(
-		 &record_values_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_record_value_free,
-		 NULL );
+		memory_free(
+		 block_restart_lsns );
 	}
-	if( owner_page != NULL )
+	if( restart_lsns != NULL )
 	{
-		libfsclfs_owner_page_free(
-		 &owner_page,
-		 NULL );
+		memory_free(
+		 restart_lsns );
 	}
 	return( -1 );
 }
@@ -23,15 +23,22 @@
 #define _LIBFSCLFS_INTERNAL_STORE_H
 
 #include <common.h>
+#include <system_string.h>
 #include <types.h>
 
+#include "libfsclfs_aligned_pool.h"
+#include "libfsclfs_block.h"
+#include "libfsclfs_container_descriptor.h"
 #include "libfsclfs_extern.h"
 #include "libfsclfs_io_handle.h"
 #include "libfsclfs_libbfio.h"
 #include "libfsclfs_libcdata.h"
 #include "libfsclfs_libcerror.h"
 #include "libfsclfs_owner_page.h"
+#include "libfsclfs_record_filter.h"
+#include "libfsclfs_record_header_table.h"
 #include "libfsclfs_record_value.h"
+#include "libfsclfs_stream_descriptor.h"
 #include "libfsclfs_types.h"
 
 #if defined( __cplusplus )
@@ -39,6 +46,7 @@ extern "C" {
 #endif
 
 typedef struct libfsclfs_internal_store libfsclfs_internal_store_t;
+typedef struct libfsclfs_store_container_open_task libfsclfs_store_container_open_task_t;
 
 struct libfsclfs_internal_store
 {
@@ -66,10 +74,23 @@ struct libfsclfs_internal_store
 	 */
 	uint8_t container_file_io_pool_created_in_library;
 
+	/* Value to indicate if the containers were opened inside the library
+	 */
+	uint8_t containers_opened_in_library;
+
+	/* The number of container descriptors of which the container was opened inside the library
+	 */
+	int number_of_opened_container_descriptors;
+
 	/* The store metadata dump count
 	 */
 	uint32_t store_metadata_dump_count;
 
+	/* The store identifier
+	 * Contains a GUID
+	 */
+	uint8_t store_identifier[ 16 ];
+
 	/* The container descriptors array
 	 */
 	libcdata_array_t *container_descriptors_array;
@@ -78,6 +99,23 @@ struct libfsclfs_internal_store
 	 */
 	libcdata_array_t *stream_descriptors_array;
 
+	/* The container block maps array
+	 * contains the owner pages created by scanning the containers
+	 * the entry index corresponds with the container physical number
+	 */
+	libcdata_array_t *container_block_maps_array;
+
+	/* Value to indicate the store is a dedicated log
+	 * the blocks of a dedicated log are addressed directly by their LSN
+	 * since its single stream is not multiplexed with other streams
+	 */
+	uint8_t is_dedicated_log;
+
+	/* Value to indicate the direct addressing of the dedicated log
+	 * was checked against the header of a block
+	 */
+	uint8_t dedicated_log_is_checked;
+
 	/* The basename
 	 */
 	system_character_t *basename;
@@ -93,6 +131,47 @@ struct libfsclfs_internal_store
 	/* The maximum number of open handles in the container file IO pool
 	 */
 	int maximum_number_of_open_handles;
+
+	/* The number of threads used to open and scan the containers and to fetch records
+	 */
+	int number_of_threads;
+
+	/* Value to indicate if the base log and container files are read using direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The aligned pool of the direct IO read buffers
+	 */
+	libfsclfs_aligned_pool_t *aligned_pool;
+};
+
+struct libfsclfs_store_container_open_task
+{
+	/* The internal store
+	 */
+	libfsclfs_internal_store_t *internal_store;
+
+	/* The container index
+	 */
+	int container_index;
+
+	/* The container location
+	 */
+	system_character_t *container_location;
+
+	/* The container file IO handle
+	 * set when the container was opened
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The error of the task
+	 */
+	libcerror_error_t *error;
+
+	/* The open result
+	 * 1 if the container was opened, 0 if the task did not run or -1 on error
+	 */
+	int result;
 };
 
 LIBFSCLFS_EXTERN \
@@ -148,6 +227,39 @@ int libfsclfs_store_open_containers_file_io_pool(
      libcerror_error_t **error );
 */
 
+int libfsclfs_store_get_container_location(
+     libfsclfs_internal_store_t *internal_store,
+     libfsclfs_container_descriptor_t *container_descriptor,
+     system_character_t **container_location,
+     libcerror_error_t **error );
+
+int libfsclfs_store_open_container_task_callback(
+     libfsclfs_store_container_open_task_t *task,
+     int worker_index,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsclfs_store_initialize_container_file_io_handle(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t **file_io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libfsclfs_store_initialize_container_file_io_handle_wide(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t **file_io_handle,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libfsclfs_store_read_container_first_block_header(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfsclfs_store_open_container(
      libfsclfs_internal_store_t *internal_store,
      int container_index,
@@ -170,16 +282,41 @@ int libfsclfs_store_open_container_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsclfs_store_set_container_file_io_handle(
+     libfsclfs_internal_store_t *internal_store,
+     int container_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBFSCLFS_EXTERN \
 int libfsclfs_store_close(
      libfsclfs_store_t *store,
      libcerror_error_t **error );
 
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_refresh(
+     libfsclfs_store_t *store,
+     libcerror_error_t **error );
+
+int libfsclfs_store_refresh_stream_descriptors(
+     libfsclfs_internal_store_t *internal_store,
+     libcdata_array_t *refreshed_stream_descriptors_array,
+     libcerror_error_t **error );
+
+int libfsclfs_store_refresh_container_descriptors(
+     libfsclfs_internal_store_t *internal_store,
+     libcdata_array_t *refreshed_container_descriptors_array,
+     libcerror_error_t **error );
+
 int libfsclfs_store_open_read(
      libfsclfs_internal_store_t *internal_store,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsclfs_store_determine_log_type(
+     libfsclfs_internal_store_t *internal_store,
+     libcerror_error_t **error );
+
 int libfsclfs_store_read_block_descriptors(
      libfsclfs_internal_store_t *internal_store,
      libbfio_handle_t *file_io_handle,
@@ -200,13 +337,35 @@ int libfsclfs_store_read_container_owner_page(
      libbfio_handle_t *container_file_io_handle,
      libfsclfs_owner_page_t *owner_page,
      uint32_t offset,
+     uint8_t scan_region,
      libcerror_error_t **error );
 
-int libfsclfs_block_read_record_values(
+int libfsclfs_block_read_record_value(
      libfsclfs_internal_store_t *internal_store,
      libbfio_handle_t *container_file_io_handle,
      uint32_t block_offset,
-     libcdata_array_t *record_values_array,
+     uint16_t record_number,
+     libfsclfs_internal_record_filter_t *record_filter,
+     libfsclfs_record_value_t **record_value,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error );
+
+int libfsclfs_block_read_restart_lsns(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t block_offset,
+     uint64_t block_lsn,
+     uint64_t *restart_lsns,
+     int *number_of_restart_lsns,
+     uint64_t *previous_block_lsn,
+     libcerror_error_t **error );
+
+int libfsclfs_block_read_record_header_table(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t block_offset,
+     uint64_t block_lsn,
+     libfsclfs_internal_record_header_table_t *internal_record_header_table,
      libcerror_error_t **error );
 
 int libfsclfs_store_get_basename_size(
@@ -279,13 +438,171 @@ int libfsclfs_store_get_stream(
      libfsclfs_stream_t **stream,
      libcerror_error_t **error );
 
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_get_statistics(
+     libfsclfs_store_t *store,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_get_base_log_read_statistics(
+     libfsclfs_store_t *store,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_reset_statistics(
+     libfsclfs_store_t *store,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_set_trace_callback(
+     libfsclfs_store_t *store,
+     void (*callback)(
+            int event_type,
+            int event_phase,
+            uint64_t timestamp,
+            uint64_t value,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_get_number_of_threads(
+     libfsclfs_store_t *store,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_set_number_of_threads(
+     libfsclfs_store_t *store,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_get_direct_io(
+     libfsclfs_store_t *store,
+     uint8_t *use_direct_io,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_set_direct_io(
+     libfsclfs_store_t *store,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int libfsclfs_store_initialize_direct_io_file_io_handle(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t **file_io_handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_scan_containers(
+     libfsclfs_store_t *store,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_scan_blocks(
+     libfsclfs_store_t *store,
+     int (*callback)(
+            int worker_index,
+            int container_index,
+            int stream_number,
+            uint32_t block_offset,
+            uint32_t block_size,
+            uint32_t used_size,
+            libfsclfs_record_header_table_t *record_header_table,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_verify(
+     libfsclfs_store_t *store,
+     int (*callback)(
+            int container_index,
+            uint32_t region_offset,
+            int number_of_blocks,
+            int number_of_failed_blocks,
+            int failure_type,
+            uint32_t failure_offset,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_get_region_size(
+     libfsclfs_store_t *store,
+     uint32_t *region_size,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_store_get_region_owner_page_offset(
+     libfsclfs_store_t *store,
+     uint32_t *owner_page_offset,
+     libcerror_error_t **error );
+
+int libfsclfs_store_get_container_block_map(
+     libfsclfs_internal_store_t *internal_store,
+     uint32_t container_physical_number,
+     libfsclfs_owner_page_t **block_map,
+     libcerror_error_t **error );
+
+int libfsclfs_store_get_physical_block_by_logical_lsn(
+     libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     libbfio_handle_t **container_file_io_handle,
+     uint32_t *physical_block_offset,
+     libcerror_error_t **error );
+
+int libfsclfs_store_get_physical_block_offset(
+     libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_physical_number,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t *physical_block_offset,
+     libcerror_error_t **error );
+
+int libfsclfs_store_check_physical_block(
+     libfsclfs_internal_store_t *internal_store,
+     libbfio_handle_t *container_file_io_handle,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     uint32_t physical_block_offset,
+     libcerror_error_t **error );
+
 int libfsclfs_store_get_record_value_by_logical_lsn(
      libfsclfs_internal_store_t *internal_store,
      uint16_t stream_number,
      uint32_t container_logical_number,
      uint32_t block_offset,
      uint16_t record_number,
+     libfsclfs_internal_record_filter_t *record_filter,
      libfsclfs_record_value_t **record_value,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error );
+
+int libfsclfs_store_fill_record_value_by_logical_lsn(
+     libfsclfs_internal_store_t *internal_store,
+     uint16_t stream_number,
+     uint32_t container_logical_number,
+     uint32_t block_offset,
+     uint16_t record_number,
+     libfsclfs_block_t *block,
+     libfsclfs_record_value_t *record_value,
+     libcerror_error_t **error );
+
+int libfsclfs_store_read_stream_restart_lsns(
+     libfsclfs_internal_store_t *internal_store,
+     libfsclfs_stream_descriptor_t *stream_descriptor,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -24,10 +24,16 @@
 #include <types.h>
 
 #include "libfsclfs_definitions.h"
+#include "libfsclfs_libbfio.h"
 #include "libfsclfs_libcerror.h"
 #include "libfsclfs_libcnotify.h"
+#include "libfsclfs_logical_record.h"
 #include "libfsclfs_record.h"
+#include "libfsclfs_record_header_table.h"
 #include "libfsclfs_record_value.h"
+#include "libfsclfs_record_cursor.h"
+#include "libfsclfs_record_fetcher.h"
+#include "libfsclfs_scan_cursor.h"
 #include "libfsclfs_stream.h"
 #include "libfsclfs_types.h"
 
@@ -430,13 +436,9 @@ int libfsclfs_stream_get_record_by_lsn(
      libfsclfs_record_t **record,
      libcerror_error_t **error )
 {
-	libfsclfs_internal_stream_t *internal_stream = NULL;
-	libfsclfs_record_value_t *record_value       = NULL;
-	static char *function                        = "libfsclfs_stream_get_record_by_lsn";
-        uint32_t block_offset                        = 0;
-        uint32_t container_logical_number            = 0;
-	uint16_t record_number                       = 0;
-	int result                                   = 0;
+	static char *function = "libfsclfs_stream_get_record_by_lsn";
+	uint64_t previous_lsn = 0;
+	int result            = 0;
 
 	if( stream == NULL )
 	{
@@ -449,8 +451,62 @@ int libfsclfs_stream_get_record_by_lsn(
 
 		return( -1 );
 	}
-	internal_stream = (libfsclfs_internal_stream_t *) stream;
+	result = libfsclfs_stream_get_filtered_record_by_lsn(
+	          (libfsclfs_internal_stream_t *) stream,
+	          record_lsn,
+	          NULL,
+	          record,
+	          &previous_lsn,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record by LSN: 0x%08" PRIx64 ".",
+		 function,
+		 record_lsn );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieve a record with a specific log sequence number (LSN) that matches a record filter
+ * The record filter is evaluated against the record header in the block data
+ * so that the data of a record that does not match is not read.
+ * If the record does not match the record filter, record is set to NULL
+ * and previous LSN still contains the previous LSN of the record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfsclfs_stream_get_filtered_record_by_lsn(
+     libfsclfs_internal_stream_t *internal_stream,
+     uint64_t record_lsn,
+     libfsclfs_internal_record_filter_t *record_filter,
+     libfsclfs_record_t **record,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_record_value_t *record_value = NULL;
+	static char *function                  = "libfsclfs_stream_get_filtered_record_by_lsn";
+	uint32_t block_offset                  = 0;
+	uint32_t container_logical_number      = 0;
+	uint16_t record_number                 = 0;
+	int result                             = 0;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_stream->stream_descriptor == NULL )
 	{
 		libcerror_error_set(
@@ -495,15 +551,26 @@ int libfsclfs_stream_get_record_by_lsn(
 
 		return( -1 );
 	}
+	if( previous_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous LSN.",
+		 function );
+
+		return( -1 );
+	}
 	block_offset             = (uint32_t) ( record_lsn & 0xfffffe00UL );
-        container_logical_number = (uint32_t) ( record_lsn >> 32 );
+	container_logical_number = (uint32_t) ( record_lsn >> 32 );
 	record_number            = (uint16_t) ( record_lsn & 0x01ff );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: LSN: 0x%08" PRIx32 ", container logical number: %" PRIu32 ", record number: %" PRIu16 ", block offset: 0x%08" PRIx32 ", \n",
+		 "%s: LSN: 0x%08" PRIx64 ", container logical number: %" PRIu32 ", record number: %" PRIu16 ", block offset: 0x%08" PRIx32 ", \n",
 		 function,
 		 record_lsn,
 		 container_logical_number,
@@ -521,7 +588,9 @@ int libfsclfs_stream_get_record_by_lsn(
 	          container_logical_number,
 	          block_offset,
 	          record_number,
+	          record_filter,
 	          &record_value,
+	          previous_lsn,
 	          error );
 
 	if( result == -1 )
@@ -536,20 +605,24 @@ int libfsclfs_stream_get_record_by_lsn(
 		 block_offset,
 		 record_number );
 
-		return( -1 );
+		goto on_error;
 	}
 	else if( result != 0 )
 	{
 		if( record_value == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing record value.",
-			 function );
+			if( record_filter == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing record value.",
+				 function );
 
-			return( -1 );
+				goto on_error;
+			}
+			return( 1 );
 		}
 		if( libfsclfs_record_initialize(
 		     record,
@@ -565,11 +638,712 @@ int libfsclfs_stream_get_record_by_lsn(
 			 "%s: unable to create record.",
 			 function );
 
-/* TODO is record value maintained by a cache ? */
-
-			return( -1 );
+			goto on_error;
 		}
 	}
 	return( result );
+
+on_error:
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the logical record that ends with the record with a specific log sequence number (LSN)
+ * If the record is the end fragment of a record that spans multiple fragments, the start and
+ * continuation fragments are read by following the previous LSN. Otherwise the logical record
+ * consists of the record only. The fragments are read one at a time, up to
+ * LIBFSCLFS_MAXIMUM_NUMBER_OF_LOGICAL_RECORD_FRAGMENTS fragments and
+ * LIBFSCLFS_MAXIMUM_LOGICAL_RECORD_DATA_SIZE bytes of data
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfsclfs_stream_get_logical_record_by_lsn(
+     libfsclfs_stream_t *stream,
+     uint64_t record_lsn,
+     libfsclfs_logical_record_t **logical_record,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_stream_t *internal_stream = NULL;
+	libfsclfs_record_value_t *record_value       = NULL;
+	static char *function                        = "libfsclfs_stream_get_logical_record_by_lsn";
+	uint64_t current_lsn                         = 0;
+	uint64_t previous_lsn                        = 0;
+	uint32_t record_type                         = 0;
+	int number_of_fragments                      = 0;
+	int result                                   = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfsclfs_internal_stream_t *) stream;
+
+	if( internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == (uint64_t) 0xffffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record LSN.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsclfs_logical_record_initialize(
+	     logical_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical record.",
+		 function );
+
+		goto on_error;
+	}
+	current_lsn = record_lsn;
+
+	while( current_lsn != 0 )
+	{
+		result = libfsclfs_store_get_record_value_by_logical_lsn(
+		          internal_stream->internal_store,
+		          internal_stream->stream_descriptor->number,
+		          (uint32_t) ( current_lsn >> 32 ),
+		          (uint32_t) ( current_lsn & 0xfffffe00UL ),
+		          (uint16_t) ( current_lsn & 0x01ff ),
+		          NULL,
+		          &record_value,
+		          &previous_lsn,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record value of LSN: 0x%08" PRIx64 ".",
+			 function,
+			 current_lsn );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( number_of_fragments == 0 )
+			{
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing fragment with LSN: 0x%08" PRIx64 ".",
+			 function,
+			 current_lsn );
+
+			goto on_error;
+		}
+		if( record_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record value.",
+			 function );
+
+			goto on_error;
+		}
+		record_type = record_value->type;
+
+		/* The first record read must be an end fragment or a record that is not fragmented
+		 * and every other record read must be a start or continuation fragment
+		 */
+		if( number_of_fragments == 0 )
+		{
+			if( ( ( record_type & RECORD_TYPE_FLAG_IS_END ) == 0 )
+			 && ( ( record_type & ( RECORD_TYPE_FLAG_IS_START | RECORD_TYPE_FLAG_IS_CONTINUATION ) ) != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported record type: 0x%08" PRIx32 " of LSN: 0x%08" PRIx64 " not an end fragment.",
+				 function,
+				 record_type,
+				 current_lsn );
+
+				goto on_error;
+			}
+		}
+		else if( ( record_type & ( RECORD_TYPE_FLAG_IS_START | RECORD_TYPE_FLAG_IS_CONTINUATION ) ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported record type: 0x%08" PRIx32 " of LSN: 0x%08" PRIx64 " not a start or continuation fragment.",
+			 function,
+			 record_type,
+			 current_lsn );
+
+			goto on_error;
+		}
+		if( libfsclfs_logical_record_prepend_fragment(
+		     (libfsclfs_internal_logical_record_t *) *logical_record,
+		     current_lsn,
+		     record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend fragment with LSN: 0x%08" PRIx64 " to logical record.",
+			 function,
+			 current_lsn );
+
+			goto on_error;
+		}
+		record_value = NULL;
+
+		number_of_fragments++;
+
+		if( ( ( record_type & RECORD_TYPE_FLAG_IS_START ) != 0 )
+		 || ( ( record_type & ( RECORD_TYPE_FLAG_IS_END | RECORD_TYPE_FLAG_IS_CONTINUATION ) ) == 0 ) )
+		{
+			break;
+		}
+		if( ( previous_lsn == 0 )
+		 || ( previous_lsn >= current_lsn ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid previous LSN: 0x%08" PRIx64 " of fragment with LSN: 0x%08" PRIx64 " value out of bounds.",
+			 function,
+			 previous_lsn,
+			 current_lsn );
+
+			goto on_error;
+		}
+		current_lsn = previous_lsn;
+	}
+	if( number_of_fragments == 0 )
+	{
+		if( libfsclfs_logical_record_free(
+		     logical_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical record.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	if( *logical_record != NULL )
+	{
+		libfsclfs_logical_record_free(
+		 logical_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the record headers of the block that contains the record with a specific log sequence number (LSN)
+ * The record header values of all the records in the block are stored in the record header table
+ * as separate arrays, without creating a record per record header
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libfsclfs_stream_read_record_header_table(
+     libfsclfs_stream_t *stream,
+     uint64_t record_lsn,
+     libfsclfs_record_header_table_t *record_header_table,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *container_file_io_handle   = NULL;
+	libfsclfs_internal_stream_t *internal_stream = NULL;
+	static char *function                        = "libfsclfs_stream_read_record_header_table";
+	uint64_t block_lsn                           = 0;
+	uint32_t physical_block_offset               = 0;
+	int result                                   = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfsclfs_internal_stream_t *) stream;
+
+	if( internal_stream->stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record header table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_lsn == 0 )
+	{
+		return( 0 );
+	}
+	block_lsn = record_lsn & ~( (uint64_t) 0x01ff );
+
+	result = libfsclfs_store_get_physical_block_by_logical_lsn(
+	          internal_stream->internal_store,
+	          internal_stream->stream_descriptor->number,
+	          (uint32_t) ( block_lsn >> 32 ),
+	          (uint32_t) ( block_lsn & 0xfffffe00UL ),
+	          &container_file_io_handle,
+	          &physical_block_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical block of LSN: 0x%08" PRIx64 ".",
+		 function,
+		 block_lsn );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsclfs_block_read_record_header_table(
+		     internal_stream->internal_store,
+		     container_file_io_handle,
+		     physical_block_offset,
+		     block_lsn,
+		     (libfsclfs_internal_record_header_table_t *) record_header_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record header table of block with LSN: 0x%08" PRIx64 ".",
+			 function,
+			 block_lsn );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of restart records
+ * The restart records are located by reading the record headers of the blocks
+ * of the stream backwards from the last LSN. The result is cached and only
+ * the records appended since are read when the store is refreshed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_get_number_of_restart_records(
+     libfsclfs_stream_t *stream,
+     int *number_of_restart_records,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_stream_t *internal_stream = NULL;
+	static char *function                        = "libfsclfs_stream_get_number_of_restart_records";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfsclfs_internal_stream_t *) stream;
+
+	if( libfsclfs_store_read_stream_restart_lsns(
+	     internal_stream->internal_store,
+	     internal_stream->stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read restart LSNs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+	     internal_stream->stream_descriptor,
+	     number_of_restart_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of restart LSNs from stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the log sequence number (LSN) of a specific restart record
+ * Index 0 refers to the most recent restart record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_get_restart_record_lsn_by_index(
+     libfsclfs_stream_t *stream,
+     int restart_record_index,
+     uint64_t *restart_record_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_stream_t *internal_stream = NULL;
+	static char *function                        = "libfsclfs_stream_get_restart_record_lsn_by_index";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfsclfs_internal_stream_t *) stream;
+
+	if( libfsclfs_store_read_stream_restart_lsns(
+	     internal_stream->internal_store,
+	     internal_stream->stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read restart LSNs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	     internal_stream->stream_descriptor,
+	     restart_record_index,
+	     restart_record_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve restart LSN: %d from stream descriptor.",
+		 function,
+		 restart_record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the most recent restart record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfsclfs_stream_get_last_restart_record(
+     libfsclfs_stream_t *stream,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_stream_t *internal_stream = NULL;
+	static char *function                        = "libfsclfs_stream_get_last_restart_record";
+	uint64_t previous_lsn                        = 0;
+	uint64_t restart_record_lsn                  = 0;
+	int number_of_restart_records                = 0;
+	int result                                   = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfsclfs_internal_stream_t *) stream;
+
+	if( libfsclfs_stream_get_number_of_restart_records(
+	     stream,
+	     &number_of_restart_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of restart records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_restart_records == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	     internal_stream->stream_descriptor,
+	     0,
+	     &restart_record_lsn,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve restart LSN: 0 from stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsclfs_stream_get_filtered_record_by_lsn(
+	          internal_stream,
+	          restart_record_lsn,
+	          NULL,
+	          record,
+	          &previous_lsn,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve restart record by LSN: 0x%08" PRIx64 ".",
+		 function,
+		 restart_record_lsn );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a scan cursor positioned at the last record of the stream
+ * The stream must remain available while the scan cursor is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_get_scan_cursor(
+     libfsclfs_stream_t *stream,
+     libfsclfs_scan_cursor_t **scan_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_stream_get_scan_cursor";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_scan_cursor_initialize(
+	     scan_cursor,
+	     (libfsclfs_internal_stream_t *) stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a record cursor
+ * The stream must remain available while the record cursor is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_get_record_cursor(
+     libfsclfs_stream_t *stream,
+     libfsclfs_record_cursor_t **record_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_stream_get_record_cursor";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_cursor_initialize(
+	     record_cursor,
+	     (libfsclfs_internal_stream_t *) stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a record fetcher
+ * The stream must remain available while the record fetcher is used
+ * and the store must not be changed while requests are outstanding
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_get_record_fetcher(
+     libfsclfs_stream_t *stream,
+     void (*callback)(
+            uint64_t record_lsn,
+            int result,
+            libfsclfs_record_t *record,
+            libcerror_error_t *error,
+            void *callback_data ),
+     void *callback_data,
+     libfsclfs_record_fetcher_t **record_fetcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_stream_get_record_fetcher";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_record_fetcher_initialize(
+	     record_fetcher,
+	     (libfsclfs_internal_stream_t *) stream,
+	     callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record fetcher.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
@@ -27,6 +27,7 @@
 
 #include "libfsclfs_extern.h"
 #include "libfsclfs_libcerror.h"
+#include "libfsclfs_record_filter.h"
 #include "libfsclfs_record_value.h"
 #include "libfsclfs_store.h"
 #include "libfsclfs_stream_descriptor.h"
@@ -105,6 +106,72 @@ int libfsclfs_stream_get_record_by_lsn(
      libfsclfs_record_t **record,
      libcerror_error_t **error );
 
+int libfsclfs_stream_get_filtered_record_by_lsn(
+     libfsclfs_internal_stream_t *internal_stream,
+     uint64_t record_lsn,
+     libfsclfs_internal_record_filter_t *record_filter,
+     libfsclfs_record_t **record,
+     uint64_t *previous_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_logical_record_by_lsn(
+     libfsclfs_stream_t *stream,
+     uint64_t record_lsn,
+     libfsclfs_logical_record_t **logical_record,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_read_record_header_table(
+     libfsclfs_stream_t *stream,
+     uint64_t record_lsn,
+     libfsclfs_record_header_table_t *record_header_table,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_number_of_restart_records(
+     libfsclfs_stream_t *stream,
+     int *number_of_restart_records,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_restart_record_lsn_by_index(
+     libfsclfs_stream_t *stream,
+     int restart_record_index,
+     uint64_t *restart_record_lsn,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_last_restart_record(
+     libfsclfs_stream_t *stream,
+     libfsclfs_record_t **record,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_scan_cursor(
+     libfsclfs_stream_t *stream,
+     libfsclfs_scan_cursor_t **scan_cursor,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_record_cursor(
+     libfsclfs_stream_t *stream,
+     libfsclfs_record_cursor_t **record_cursor,
+     libcerror_error_t **error );
+
+LIBFSCLFS_EXTERN \
+int libfsclfs_stream_get_record_fetcher(
+     libfsclfs_stream_t *stream,
+     void (*callback)(
+            uint64_t record_lsn,
+            int result,
+            libfsclfs_record_t *record,
+            libcerror_error_t *error,
+            void *callback_data ),
+     void *callback_data,
+     libfsclfs_record_fetcher_t **record_fetcher,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -131,6 +131,11 @@ int libfsclfs_stream_descriptor_free(
 			memory_free(
 			 ( *stream_descriptor )->name );
 		}
+		if( ( *stream_descriptor )->restart_lsns != NULL )
+		{
+			memory_free(
+			 ( *stream_descriptor )->restart_lsns );
+		}
 		memory_free(
 		 *stream_descriptor );
 
@@ -554,3 +559,278 @@ int libfsclfs_stream_descriptor_get_last_lsn(
 
 	return( 1 );
 }
+
+/* Clears the restart record LSNs
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_descriptor_clear_restart_lsns(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_stream_descriptor_clear_restart_lsns";
+
+	if( stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_descriptor->restart_lsns != NULL )
+	{
+		memory_free(
+		 stream_descriptor->restart_lsns );
+
+		stream_descriptor->restart_lsns = NULL;
+	}
+	stream_descriptor->number_of_restart_lsns = 0;
+	stream_descriptor->restart_lsns_last_lsn  = 0;
+
+	return( 1 );
+}
+
+/* Inserts restart record LSNs that are more recent than the current restart record LSNs
+ * The restart record LSNs should be ordered the most recent first
+ * The current restart record LSNs that precede the base LSN are removed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_descriptor_insert_restart_lsns(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     const uint64_t *restart_lsns,
+     int number_of_restart_lsns,
+     uint64_t last_lsn,
+     libcerror_error_t **error )
+{
+	uint64_t *new_restart_lsns      = NULL;
+	static char *function           = "libfsclfs_stream_descriptor_insert_restart_lsns";
+	size_t restart_lsns_size        = 0;
+	int number_of_kept_restart_lsns = 0;
+
+	if( stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( restart_lsns == NULL )
+	 && ( number_of_restart_lsns != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restart LSNs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_restart_lsns < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of restart LSNs value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_kept_restart_lsns = stream_descriptor->number_of_restart_lsns;
+
+	while( ( number_of_kept_restart_lsns > 0 )
+	    && ( stream_descriptor->restart_lsns[ number_of_kept_restart_lsns - 1 ] < stream_descriptor->base_lsn ) )
+	{
+		number_of_kept_restart_lsns--;
+	}
+	if( number_of_restart_lsns > ( INT_MAX - number_of_kept_restart_lsns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of restart LSNs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_restart_lsns + number_of_kept_restart_lsns ) > 0 )
+	{
+		if( (size_t) ( number_of_restart_lsns + number_of_kept_restart_lsns ) > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of restart LSNs value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		restart_lsns_size = sizeof( uint64_t ) * ( number_of_restart_lsns + number_of_kept_restart_lsns );
+
+		new_restart_lsns = (uint64_t *) memory_allocate(
+		                                 restart_lsns_size );
+
+		if( new_restart_lsns == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create restart LSNs.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_restart_lsns > 0 )
+		{
+			if( memory_copy(
+			     new_restart_lsns,
+			     restart_lsns,
+			     sizeof( uint64_t ) * number_of_restart_lsns ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy restart LSNs.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( number_of_kept_restart_lsns > 0 )
+		{
+			if( memory_copy(
+			     &( new_restart_lsns[ number_of_restart_lsns ] ),
+			     stream_descriptor->restart_lsns,
+			     sizeof( uint64_t ) * number_of_kept_restart_lsns ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy current restart LSNs.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( stream_descriptor->restart_lsns != NULL )
+	{
+		memory_free(
+		 stream_descriptor->restart_lsns );
+	}
+	stream_descriptor->restart_lsns           = new_restart_lsns;
+	stream_descriptor->number_of_restart_lsns = number_of_restart_lsns + number_of_kept_restart_lsns;
+	stream_descriptor->restart_lsns_last_lsn  = last_lsn;
+
+	return( 1 );
+
+on_error:
+	if( new_restart_lsns != NULL )
+	{
+		memory_free(
+		 new_restart_lsns );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of restart record LSNs
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     int *number_of_restart_lsns,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_stream_descriptor_get_number_of_restart_lsns";
+
+	if( stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_restart_lsns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of restart LSNs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_restart_lsns = stream_descriptor->number_of_restart_lsns;
+
+	return( 1 );
+}
+
+/* Retrieves a specific restart record LSN
+ * Index 0 refers to the most recent restart record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     int restart_lsn_index,
+     uint64_t *restart_lsn,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_stream_descriptor_get_restart_lsn_by_index";
+
+	if( stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( restart_lsn_index < 0 )
+	 || ( restart_lsn_index >= stream_descriptor->number_of_restart_lsns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid restart LSN index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( restart_lsn == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restart LSN.",
+		 function );
+
+		return( -1 );
+	}
+	*restart_lsn = stream_descriptor->restart_lsns[ restart_lsn_index ];
+
+	return( 1 );
+}
+
@@ -58,6 +58,19 @@ struct libfsclfs_stream_descriptor
 	/* The last lsn
 	 */
 	uint64_t last_lsn;
+
+	/* The restart record LSNs, the most recent first
+	 */
+	uint64_t *restart_lsns;
+
+	/* The number of restart record LSNs
+	 */
+	int number_of_restart_lsns;
+
+	/* The last LSN up to which the restart record LSNs were read
+	 * or 0 if not read
+	 */
+	uint64_t restart_lsns_last_lsn;
 };
 
 int libfsclfs_stream_descriptor_initialize(
@@ -106,6 +119,28 @@ int libfsclfs_stream_descriptor_get_last_lsn(
      uint64_t *last_lsn,
      libcerror_error_t **error );
 
+int libfsclfs_stream_descriptor_clear_restart_lsns(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     libcerror_error_t **error );
+
+int libfsclfs_stream_descriptor_insert_restart_lsns(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     const uint64_t *restart_lsns,
+     int number_of_restart_lsns,
+     uint64_t last_lsn,
+     libcerror_error_t **error );
+
+int libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     int *number_of_restart_lsns,
+     libcerror_error_t **error );
+
+int libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+     libfsclfs_stream_descriptor_t *stream_descriptor,
+     int restart_lsn_index,
+     uint64_t *restart_lsn,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,105 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_trace.h"
+
+/* Retrieves a timestamp in nanoseconds
+ * The timestamp is relative to an unspecified starting point and
+ * only meaningful to determine the time between trace events
+ * Returns the timestamp
+ */
+uint64_t libfsclfs_trace_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart == 0 ) )
+	{
+		return( (uint64_t) GetTickCount() * 1000000 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	      + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart );
+
+#elif defined( CLOCK_MONOTONIC )
+	struct timespec time_specification;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000UL ) + (uint64_t) time_specification.tv_nsec );
+
+#else
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+
+#endif
+}
+
+/* Passes a trace event to the trace callback function of the IO handle
+ * Callers are expected to check if a trace callback function was set
+ * so that tracing only costs a single comparison when disabled
+ */
+void libfsclfs_trace_event(
+      libfsclfs_io_handle_t *io_handle,
+      int event_type,
+      int event_phase,
+      uint64_t value )
+{
+	void (*trace_callback)( int event_type, int event_phase, uint64_t timestamp, uint64_t value, void *callback_data ) = NULL;
+
+	if( io_handle == NULL )
+	{
+		return;
+	}
+	/* Copy the callback function to prevent it from changing in between the check and the call
+	 */
+	trace_callback = io_handle->trace_callback;
+
+	if( trace_callback != NULL )
+	{
+		trace_callback(
+		 event_type,
+		 event_phase,
+		 libfsclfs_trace_get_timestamp(),
+		 value,
+		 io_handle->trace_callback_data );
+	}
+}
+
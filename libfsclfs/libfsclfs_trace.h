@@ -0,0 +1,48 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_TRACE_H )
+#define _LIBFSCLFS_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_io_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+uint64_t libfsclfs_trace_get_timestamp(
+          void );
+
+void libfsclfs_trace_event(
+      libfsclfs_io_handle_t *io_handle,
+      int event_type,
+      int event_phase,
+      uint64_t value );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_TRACE_H ) */
+
@@ -34,14 +34,28 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfsclfs_carver {}	libfsclfs_carver_t;
 typedef struct libfsclfs_container {}	libfsclfs_container_t;
+typedef struct libfsclfs_logical_record {}	libfsclfs_logical_record_t;
 typedef struct libfsclfs_record {}	libfsclfs_record_t;
+typedef struct libfsclfs_record_cursor {}	libfsclfs_record_cursor_t;
+typedef struct libfsclfs_record_fetcher {}	libfsclfs_record_fetcher_t;
+typedef struct libfsclfs_record_filter {}	libfsclfs_record_filter_t;
+typedef struct libfsclfs_record_header_table {}	libfsclfs_record_header_table_t;
+typedef struct libfsclfs_scan_cursor {}	libfsclfs_scan_cursor_t;
 typedef struct libfsclfs_store {}	libfsclfs_store_t;
 typedef struct libfsclfs_stream {}	libfsclfs_stream_t;
 
 #else
+typedef intptr_t libfsclfs_carver_t;
 typedef intptr_t libfsclfs_container_t;
+typedef intptr_t libfsclfs_logical_record_t;
 typedef intptr_t libfsclfs_record_t;
+typedef intptr_t libfsclfs_record_cursor_t;
+typedef intptr_t libfsclfs_record_fetcher_t;
+typedef intptr_t libfsclfs_record_filter_t;
+typedef intptr_t libfsclfs_record_header_table_t;
+typedef intptr_t libfsclfs_scan_cursor_t;
 typedef intptr_t libfsclfs_store_t;
 typedef intptr_t libfsclfs_stream_t;
 
@@ -0,0 +1,2490 @@
+/*
+ * Verifier functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsclfs_block.h"
+#include "libfsclfs_checksum.h"
+#include "libfsclfs_definitions.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcnotify.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_record_header_table.h"
+#include "libfsclfs_scheduler.h"
+#include "libfsclfs_statistics.h"
+#include "libfsclfs_unused.h"
+#include "libfsclfs_verifier.h"
+
+#include "fsclfs_block.h"
+
+/* Creates a verifier
+ * Make sure the value verifier is referencing, is set to NULL
+ * The base log file IO handle is only required when blocks of the base log are verified
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_initialize(
+     libfsclfs_verifier_t **verifier,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *base_log_file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_containers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_verifier_initialize";
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_containers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of containers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_containers > 0 )
+	 && ( file_io_pool == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	*verifier = memory_allocate_structure(
+	             libfsclfs_verifier_t );
+
+	if( *verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *verifier,
+	     0,
+	     sizeof( libfsclfs_verifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verifier.",
+		 function );
+
+		memory_free(
+		 *verifier );
+
+		*verifier = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *verifier )->file_io_pool_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *verifier )->io_handle               = io_handle;
+	( *verifier )->base_log_file_io_handle = base_log_file_io_handle;
+	( *verifier )->file_io_pool            = file_io_pool;
+	( *verifier )->number_of_containers    = number_of_containers;
+
+	return( 1 );
+
+on_error:
+	if( *verifier != NULL )
+	{
+		memory_free(
+		 *verifier );
+
+		*verifier = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_free(
+     libfsclfs_verifier_t **verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsclfs_verifier_free";
+	int result            = 1;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verifier != NULL )
+	{
+		if( libfsclfs_verifier_free_workers(
+		     *verifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *verifier )->file_io_pool_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO pool mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *verifier )->regions != NULL )
+		{
+			memory_free(
+			 ( *verifier )->regions );
+		}
+		if( ( *verifier )->blocks != NULL )
+		{
+			memory_free(
+			 ( *verifier )->blocks );
+		}
+		memory_free(
+		 *verifier );
+
+		*verifier = NULL;
+	}
+	return( result );
+}
+
+/* Appends a block to be verified
+ * A container index of -1 represents a block of the base log
+ * A block size of 0 represents that the block size is only determined by the block header
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_append_block(
+     libfsclfs_verifier_t *verifier,
+     int container_index,
+     int container_physical_number,
+     uint8_t stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint64_t block_lsn,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_block_t *blocks = NULL;
+	static char *function              = "libfsclfs_verifier_append_block";
+	int number_of_allocated_blocks     = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->regions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verifier - regions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( container_index < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid container index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( container_index == -1 )
+	{
+		if( verifier->base_log_file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verifier - missing base log file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		container_physical_number = -1;
+	}
+	else if( ( container_physical_number < 0 )
+	      || ( container_physical_number >= verifier->number_of_containers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid container physical number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->number_of_blocks >= verifier->number_of_allocated_blocks )
+	{
+		if( verifier->number_of_allocated_blocks == 0 )
+		{
+			number_of_allocated_blocks = 256;
+		}
+		else
+		{
+			if( verifier->number_of_allocated_blocks > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of blocks value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_blocks = verifier->number_of_allocated_blocks * 2;
+		}
+		if( (size_t) number_of_allocated_blocks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_verifier_block_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated blocks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		blocks = (libfsclfs_verifier_block_t *) memory_reallocate(
+		                                         verifier->blocks,
+		                                         sizeof( libfsclfs_verifier_block_t ) * number_of_allocated_blocks );
+
+		if( blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize blocks.",
+			 function );
+
+			return( -1 );
+		}
+		verifier->blocks                     = blocks;
+		verifier->number_of_allocated_blocks = number_of_allocated_blocks;
+	}
+	blocks = &( verifier->blocks[ verifier->number_of_blocks ] );
+
+	blocks->container_index           = container_index;
+	blocks->container_physical_number = container_physical_number;
+	blocks->stream_number             = stream_number;
+	blocks->offset                    = block_offset;
+	blocks->size                      = block_size;
+	blocks->lsn                       = block_lsn;
+
+	verifier->number_of_blocks += 1;
+
+	return( 1 );
+}
+
+/* Compares two verifier blocks by their container index and offset
+ * Returns a negative value, 0 or a positive value, like qsort expects
+ */
+static int libfsclfs_verifier_compare_blocks(
+            const void *first_value,
+            const void *second_value )
+{
+	const libfsclfs_verifier_block_t *first_block  = NULL;
+	const libfsclfs_verifier_block_t *second_block = NULL;
+
+	first_block  = (const libfsclfs_verifier_block_t *) first_value;
+	second_block = (const libfsclfs_verifier_block_t *) second_value;
+
+	if( first_block->container_index < second_block->container_index )
+	{
+		return( -1 );
+	}
+	if( first_block->container_index > second_block->container_index )
+	{
+		return( 1 );
+	}
+	if( first_block->offset < second_block->offset )
+	{
+		return( -1 );
+	}
+	if( first_block->offset > second_block->offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the regions of the blocks
+ * The blocks are sorted by container and offset. The blocks of a container are
+ * grouped by the region that contains the start of the block, the blocks of
+ * the base log form a single region
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_determine_regions(
+     libfsclfs_verifier_t *verifier,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_block_t *verifier_block = NULL;
+	libfsclfs_verifier_region_t *region        = NULL;
+	static char *function                      = "libfsclfs_verifier_determine_regions";
+	uint32_t region_offset                     = 0;
+	int block_index                            = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->regions != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verifier - regions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->number_of_blocks == 0 )
+	{
+		return( 1 );
+	}
+	/* Every block can be in a region of its own
+	 */
+	if( (size_t) verifier->number_of_blocks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_verifier_region_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	verifier->regions = (libfsclfs_verifier_region_t *) memory_allocate(
+	                                                     sizeof( libfsclfs_verifier_region_t ) * verifier->number_of_blocks );
+
+	if( verifier->regions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create regions.",
+		 function );
+
+		return( -1 );
+	}
+	qsort(
+	 verifier->blocks,
+	 (size_t) verifier->number_of_blocks,
+	 sizeof( libfsclfs_verifier_block_t ),
+	 &libfsclfs_verifier_compare_blocks );
+
+	verifier->number_of_regions = 0;
+
+	for( block_index = 0;
+	     block_index < verifier->number_of_blocks;
+	     block_index++ )
+	{
+		verifier_block = &( verifier->blocks[ block_index ] );
+
+		if( verifier_block->container_index == -1 )
+		{
+			region_offset = 0;
+		}
+		else if( verifier->io_handle->region_size == 0 )
+		{
+			region_offset = 0;
+		}
+		else if( verifier->io_handle->region_size_shift != 0 )
+		{
+			region_offset = ( verifier_block->offset >> verifier->io_handle->region_size_shift )
+			              << verifier->io_handle->region_size_shift;
+		}
+		else
+		{
+			region_offset = ( verifier_block->offset / verifier->io_handle->region_size )
+			              * verifier->io_handle->region_size;
+		}
+		if( ( region == NULL )
+		 || ( region->container_index != verifier_block->container_index )
+		 || ( region->offset != region_offset ) )
+		{
+			region = &( verifier->regions[ verifier->number_of_regions ] );
+
+			if( memory_set(
+			     region,
+			     0,
+			     sizeof( libfsclfs_verifier_region_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear region: %d.",
+				 function,
+				 verifier->number_of_regions );
+
+				goto on_error;
+			}
+			region->verifier                  = verifier;
+			region->container_index           = verifier_block->container_index;
+			region->container_physical_number = verifier_block->container_physical_number;
+			region->offset                    = region_offset;
+			region->first_block_index         = block_index;
+			region->failure_type              = LIBFSCLFS_VERIFICATION_FAILURE_NONE;
+
+			verifier->number_of_regions += 1;
+		}
+		region->number_of_blocks += 1;
+	}
+	return( 1 );
+
+on_error:
+	memory_free(
+	 verifier->regions );
+
+	verifier->regions           = NULL;
+	verifier->number_of_regions = 0;
+
+	return( -1 );
+}
+
+/* Creates the workers
+ * Every worker has its own block, record header table and data that are reused for every block it verifies
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_create_workers(
+     libfsclfs_verifier_t *verifier,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_worker_t *worker = NULL;
+	static char *function               = "libfsclfs_verifier_create_workers";
+	int worker_index                    = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verifier - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( (size_t) number_of_workers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsclfs_verifier_worker_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	verifier->workers = (libfsclfs_verifier_worker_t *) memory_allocate(
+	                                                     sizeof( libfsclfs_verifier_worker_t ) * number_of_workers );
+
+	if( verifier->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     verifier->workers,
+	     0,
+	     sizeof( libfsclfs_verifier_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 verifier->workers );
+
+		verifier->workers = NULL;
+
+		return( -1 );
+	}
+	verifier->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( verifier->workers[ worker_index ] );
+
+		if( libfsclfs_block_initialize(
+		     &( worker->block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libfsclfs_record_header_table_initialize(
+		     &( worker->record_header_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record header table of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+		if( ( number_of_workers > 1 )
+		 && ( verifier->number_of_containers > 0 ) )
+		{
+			if( (size_t) verifier->number_of_containers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of containers value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			worker->file_io_handles = (libbfio_handle_t **) memory_allocate(
+			                                                 sizeof( libbfio_handle_t * ) * verifier->number_of_containers );
+
+			if( worker->file_io_handles == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create file IO handles of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     worker->file_io_handles,
+			     0,
+			     sizeof( libbfio_handle_t * ) * verifier->number_of_containers ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear file IO handles of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	libfsclfs_verifier_free_workers(
+	 verifier,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the workers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_free_workers(
+     libfsclfs_verifier_t *verifier,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_worker_t *worker = NULL;
+	static char *function               = "libfsclfs_verifier_free_workers";
+	int container_index                 = 0;
+	int result                          = 1;
+	int worker_index                    = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < verifier->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( verifier->workers[ worker_index ] );
+
+			if( worker->file_io_handles != NULL )
+			{
+				for( container_index = 0;
+				     container_index < verifier->number_of_containers;
+				     container_index++ )
+				{
+					if( worker->file_io_handles[ container_index ] == NULL )
+					{
+						continue;
+					}
+					if( ( verifier->io_handle != NULL )
+					 && ( verifier->io_handle->statistics != NULL ) )
+					{
+						if( libfsclfs_statistics_remove_file_io_handle_clone(
+						     verifier->io_handle->statistics,
+						     worker->file_io_handles[ container_index ],
+						     error ) == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+							 "%s: unable to remove file IO handle: %d of worker: %d from statistics.",
+							 function,
+							 container_index,
+							 worker_index );
+
+							result = -1;
+						}
+					}
+					if( libbfio_handle_close(
+					     worker->file_io_handles[ container_index ],
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close file IO handle: %d of worker: %d.",
+						 function,
+						 container_index,
+						 worker_index );
+
+						result = -1;
+					}
+					if( libbfio_handle_free(
+					     &( worker->file_io_handles[ container_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free file IO handle: %d of worker: %d.",
+						 function,
+						 container_index,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+				memory_free(
+				 worker->file_io_handles );
+			}
+			if( worker->data != NULL )
+			{
+				memory_free(
+				 worker->data );
+			}
+			if( worker->record_header_table != NULL )
+			{
+				if( libfsclfs_record_header_table_free(
+				     &( worker->record_header_table ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record header table of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( worker->block != NULL )
+			{
+				if( libfsclfs_block_free(
+				     &( worker->block ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free block of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 verifier->workers );
+
+		verifier->workers = NULL;
+	}
+	verifier->number_of_workers = 0;
+
+	return( result );
+}
+
+/* Retrieves the file IO handle of a specific container for a specific worker
+ * A container physical number of -1 represents the base log. Since the blocks
+ * of the base log form a single region the base log file IO handle is used
+ * by one worker at a time
+ * When the worker has its own file IO handles the file IO handle is cloned from
+ * the container file IO handle in the pool on first use, otherwise the file IO
+ * handle is retrieved from the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_get_worker_file_io_handle(
+     libfsclfs_verifier_t *verifier,
+     int worker_index,
+     int container_physical_number,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *pool_file_io_handle   = NULL;
+	libbfio_handle_t *worker_file_io_handle = NULL;
+	libfsclfs_verifier_worker_t *worker     = NULL;
+	static char *function                   = "libfsclfs_verifier_get_worker_file_io_handle";
+	int result                              = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= verifier->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( container_physical_number < -1 )
+	 || ( container_physical_number >= verifier->number_of_containers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid container physical number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( container_physical_number == -1 )
+	{
+		if( verifier->base_log_file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verifier - missing base log file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		*file_io_handle = verifier->base_log_file_io_handle;
+
+		return( 1 );
+	}
+	worker = &( verifier->workers[ worker_index ] );
+
+	if( worker->file_io_handles == NULL )
+	{
+		if( libbfio_pool_get_handle(
+		     verifier->file_io_pool,
+		     container_physical_number,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve container file IO handle: %d from pool.",
+			 function,
+			 container_physical_number );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( worker->file_io_handles[ container_physical_number ] == NULL )
+	{
+		/* The file IO pool is shared by all the workers
+		 */
+		if( libcthreads_mutex_grab(
+		     verifier->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO pool mutex.",
+			 function );
+
+			return( -1 );
+		}
+		result = libbfio_pool_get_handle(
+		          verifier->file_io_pool,
+		          container_physical_number,
+		          &pool_file_io_handle,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libbfio_handle_clone(
+			          &worker_file_io_handle,
+			          pool_file_io_handle,
+			          error );
+		}
+		if( libcthreads_mutex_release(
+		     verifier->file_io_pool_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO pool mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle: %d of worker: %d.",
+			 function,
+			 container_physical_number,
+			 worker_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          worker_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d of worker: %d is open.",
+			 function,
+			 container_physical_number,
+			 worker_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     worker_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d of worker: %d.",
+				 function,
+				 container_physical_number,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( ( verifier->io_handle != NULL )
+		 && ( verifier->io_handle->statistics != NULL ) )
+		{
+			if( libfsclfs_statistics_add_file_io_handle_clone(
+			     verifier->io_handle->statistics,
+			     pool_file_io_handle,
+			     worker_file_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add file IO handle: %d of worker: %d to statistics.",
+				 function,
+				 container_physical_number,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		worker->file_io_handles[ container_physical_number ] = worker_file_io_handle;
+	}
+	*file_io_handle = worker->file_io_handles[ container_physical_number ];
+
+	return( 1 );
+
+on_error:
+	if( worker_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &worker_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported worker file IO handles.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Reads data of a block as stored on disk into the data of the worker
+ * The data offset is relative to the start of the block. If skip_owner_page
+ * is set the owner pages of the regions the block spans are skipped, like
+ * libfsclfs_block_read does
+ * Returns 1 if successful, 0 if the data could not be read or -1 on error
+ */
+int libfsclfs_verifier_read_data(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_worker_t *worker,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_offset,
+     uint32_t data_offset,
+     uint32_t read_size,
+     uint8_t skip_owner_page,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	void *reallocation            = NULL;
+	static char *function         = "libfsclfs_verifier_read_data";
+	ssize_t read_count            = 0;
+	uint64_t physical_offset      = 0;
+	uint64_t owner_page_offset    = 0;
+	uint64_t region_offset        = 0;
+	uint32_t data_size            = 0;
+	uint32_t segment_size         = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size == 0 )
+	 || ( data_offset > ( UINT32_MAX - read_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = data_offset + read_size;
+
+	if( (size_t) data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker->data == NULL )
+	 || ( data_size > worker->allocated_data_size ) )
+	{
+		reallocation = memory_reallocate(
+		                worker->data,
+		                sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		worker->data                = (uint8_t *) reallocation;
+		worker->allocated_data_size = data_size;
+	}
+	if( ( verifier->io_handle->region_size == 0 )
+	 || ( verifier->io_handle->region_owner_page_offset >= verifier->io_handle->region_size ) )
+	{
+		skip_owner_page = 0;
+	}
+	physical_offset = (uint64_t) block_offset + data_offset;
+
+	if( skip_owner_page != 0 )
+	{
+		region_offset = ( (uint64_t) block_offset / verifier->io_handle->region_size )
+		              * verifier->io_handle->region_size;
+
+		owner_page_offset = region_offset + verifier->io_handle->region_owner_page_offset;
+
+		/* Map the data offset onto the regions the block spans
+		 */
+		while( physical_offset >= owner_page_offset )
+		{
+			physical_offset   += verifier->io_handle->region_size - verifier->io_handle->region_owner_page_offset;
+			region_offset     += verifier->io_handle->region_size;
+			owner_page_offset += verifier->io_handle->region_size;
+		}
+	}
+	while( read_size > 0 )
+	{
+		segment_size = read_size;
+
+		if( ( skip_owner_page != 0 )
+		 && ( ( physical_offset + segment_size ) > owner_page_offset ) )
+		{
+			segment_size = (uint32_t) ( owner_page_offset - physical_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( ( worker->data )[ data_offset ] ),
+		              (size_t) segment_size,
+		              (off64_t) physical_offset,
+		              &read_error );
+
+		if( read_count != (ssize_t) segment_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( read_error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 read_error );
+			}
+#endif
+			libcerror_error_free(
+			 &read_error );
+
+			return( 0 );
+		}
+		data_offset     += segment_size;
+		read_size       -= segment_size;
+		physical_offset += segment_size;
+
+		if( ( skip_owner_page != 0 )
+		 && ( physical_offset == owner_page_offset ) )
+		{
+			region_offset     += verifier->io_handle->region_size;
+			owner_page_offset += verifier->io_handle->region_size;
+			physical_offset    = region_offset;
+		}
+	}
+	return( 1 );
+}
+
+/* Verifies a block
+ * The block header is validated before the rest of the block is read, the checksum
+ * is calculated over the data as stored on disk, with the checksum value itself
+ * considered 0, before the fix-up values are applied. A checksum of 0 is not verified
+ * The failure type is set to LIBFSCLFS_VERIFICATION_FAILURE_NONE if the block is valid
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_verify_block(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_worker_t *worker,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint8_t skip_owner_page,
+     int *failure_type,
+     libcerror_error_t **error )
+{
+	uint8_t empty_checksum[ 4 ]     = { 0, 0, 0, 0 };
+	fsclfs_block_header_t *header   = NULL;
+	static char *function           = "libfsclfs_verifier_verify_block";
+	uint32_t calculated_checksum    = 0;
+	uint32_t data_size              = 0;
+	uint32_t stored_checksum        = 0;
+	uint16_t number_of_sectors      = 0;
+	uint16_t number_of_sectors_copy = 0;
+	int result                      = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( failure_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid failure type.",
+		 function );
+
+		return( -1 );
+	}
+	*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_NONE;
+
+	result = libfsclfs_verifier_read_data(
+	          verifier,
+	          worker,
+	          file_io_handle,
+	          block_offset,
+	          0,
+	          (uint32_t) sizeof( fsclfs_block_header_t ),
+	          skip_owner_page,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block header data at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_READ;
+
+		return( 1 );
+	}
+	header = (fsclfs_block_header_t *) worker->data;
+
+	if( memory_compare(
+	     header->signature,
+	     fsclfs_block_signature,
+	     2 ) != 0 )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_SIGNATURE;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 header->number_of_sectors,
+	 number_of_sectors );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 header->number_of_sectors_copy,
+	 number_of_sectors_copy );
+
+	data_size = (uint32_t) number_of_sectors * verifier->io_handle->bytes_per_sector;
+
+	if( ( number_of_sectors != number_of_sectors_copy )
+	 || ( data_size < (uint32_t) sizeof( fsclfs_block_header_t ) )
+	 || ( ( block_size != 0 )
+	  &&  ( data_size != block_size ) ) )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_NUMBER_OF_SECTORS;
+
+		return( 1 );
+	}
+	if( data_size > (uint32_t) sizeof( fsclfs_block_header_t ) )
+	{
+		result = libfsclfs_verifier_read_data(
+		          verifier,
+		          worker,
+		          file_io_handle,
+		          block_offset,
+		          (uint32_t) sizeof( fsclfs_block_header_t ),
+		          data_size - (uint32_t) sizeof( fsclfs_block_header_t ),
+		          skip_owner_page,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block data at offset: %" PRIu32 ".",
+			 function,
+			 block_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_READ;
+
+			return( 1 );
+		}
+		/* The data could have been reallocated
+		 */
+		header = (fsclfs_block_header_t *) worker->data;
+	}
+	/* The signature and number of sectors were validated before
+	 * so the block header can only be rejected for its offsets
+	 */
+	if( libfsclfs_block_read_header_data(
+	     worker->block,
+	     verifier->io_handle,
+	     worker->data,
+	     (size_t) data_size,
+	     NULL ) != 1 )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_OFFSETS;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->checksum,
+	 stored_checksum );
+
+	if( stored_checksum != 0 )
+	{
+		if( libfsclfs_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     worker->data,
+		     12,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsclfs_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     empty_checksum,
+		     4,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsclfs_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     &( ( worker->data )[ 16 ] ),
+		     (size_t) data_size - 16,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_checksum != calculated_checksum )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in checksum of block at offset: 0x%08" PRIx32 " ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				 function,
+				 block_offset,
+				 stored_checksum,
+				 calculated_checksum );
+			}
+#endif
+			*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_CHECKSUM;
+
+			return( 1 );
+		}
+	}
+	result = libfsclfs_block_probe_data(
+	          worker->block,
+	          verifier->io_handle,
+	          worker->data,
+	          (size_t) data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply fix-up values of block at offset: %" PRIu32 ".",
+		 function,
+		 block_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_FIXUP;
+
+		return( 1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the records of the block of the worker
+ * The virtual LSNs of the records must be ascending and the previous LSN
+ * of a record, if set, must precede the record
+ * The failure type is set to LIBFSCLFS_VERIFICATION_FAILURE_NONE if the records are valid
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_verify_records(
+     libfsclfs_verifier_worker_t *worker,
+     uint64_t block_lsn,
+     int *failure_type,
+     libcerror_error_t **error )
+{
+	libfsclfs_internal_record_header_table_t *internal_record_header_table = NULL;
+	uint8_t *record_data                                                   = NULL;
+	static char *function                                                  = "libfsclfs_verifier_verify_records";
+	size_t record_data_size                                                = 0;
+	uint64_t previous_lsn                                                  = 0;
+	uint64_t virtual_lsn                                                   = 0;
+	int record_index                                                       = 0;
+	int result                                                             = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->record_header_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing record header table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_header_table = (libfsclfs_internal_record_header_table_t *) worker->record_header_table;
+
+	if( failure_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid failure type.",
+		 function );
+
+		return( -1 );
+	}
+	*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_NONE;
+
+	result = libfsclfs_block_get_record_data(
+	          worker->block,
+	          &record_data,
+	          &record_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable retrieve record data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( libfsclfs_record_header_table_read_data(
+	     internal_record_header_table,
+	     block_lsn & ~( (uint64_t) 0x01ff ),
+	     record_data,
+	     record_data_size,
+	     (size_t) worker->block->record_data_offset,
+	     NULL ) != 1 )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_RECORD_HEADERS;
+
+		return( 1 );
+	}
+	for( record_index = 0;
+	     record_index < internal_record_header_table->number_of_records;
+	     record_index++ )
+	{
+		virtual_lsn  = internal_record_header_table->virtual_lsns[ record_index ];
+		previous_lsn = internal_record_header_table->previous_lsns[ record_index ];
+
+		if( ( record_index > 0 )
+		 && ( virtual_lsn <= internal_record_header_table->virtual_lsns[ record_index - 1 ] ) )
+		{
+			*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_PREVIOUS_LSN;
+
+			return( 1 );
+		}
+		/* A previous LSN of 0, 0xffffffff or with all the upper 32-bits set represents no previous record
+		 */
+		if( ( previous_lsn == 0 )
+		 || ( previous_lsn == (uint64_t) 0xffffffffUL )
+		 || ( ( previous_lsn >> 32 ) == (uint64_t) 0xffffffffUL ) )
+		{
+			continue;
+		}
+		if( previous_lsn >= virtual_lsn )
+		{
+			*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_PREVIOUS_LSN;
+
+			return( 1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Verifies the owner page of a region
+ * The owner page must be a valid block and its sector mapping array must map
+ * every sector of the blocks in the region to the stream of the block and
+ * the number of the sector in the block
+ * The failure type is set to LIBFSCLFS_VERIFICATION_FAILURE_NONE if the owner page is valid
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_verify_owner_page(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_worker_t *worker,
+     libbfio_handle_t *file_io_handle,
+     libfsclfs_verifier_region_t *region,
+     int *failure_type,
+     uint32_t *failure_offset,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_block_t *verifier_block = NULL;
+	uint8_t *sector_mapping_array_data         = NULL;
+	static char *function                      = "libfsclfs_verifier_verify_owner_page";
+	size_t number_of_sector_mappings           = 0;
+	size_t sector_mapping_array_data_size      = 0;
+	uint32_t block_sector_index                = 0;
+	uint32_t number_of_block_sectors           = 0;
+	uint32_t owner_page_offset                 = 0;
+	uint32_t sector_index                      = 0;
+	int block_index                            = 0;
+	int result                                 = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid verifier - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verifier->io_handle->region_owner_page_offset == 0 )
+	 || ( verifier->io_handle->region_owner_page_offset >= verifier->io_handle->region_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid verifier - invalid IO handle - region owner page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region.",
+		 function );
+
+		return( -1 );
+	}
+	if( failure_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid failure type.",
+		 function );
+
+		return( -1 );
+	}
+	if( failure_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid failure offset.",
+		 function );
+
+		return( -1 );
+	}
+	owner_page_offset = region->offset + verifier->io_handle->region_owner_page_offset;
+
+	*failure_offset = owner_page_offset;
+
+	if( libfsclfs_verifier_verify_block(
+	     verifier,
+	     worker,
+	     file_io_handle,
+	     owner_page_offset,
+	     0,
+	     0,
+	     failure_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify owner page at offset: %" PRIu32 ".",
+		 function,
+		 owner_page_offset );
+
+		return( -1 );
+	}
+	if( *failure_type != LIBFSCLFS_VERIFICATION_FAILURE_NONE )
+	{
+		return( 1 );
+	}
+	/* The owner page must fit in the remainder of the region
+	 */
+	if( worker->block->size > ( verifier->io_handle->region_size - verifier->io_handle->region_owner_page_offset ) )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_NUMBER_OF_SECTORS;
+
+		return( 1 );
+	}
+	result = libfsclfs_block_get_sector_mapping_array_data(
+	          worker->block,
+	          &sector_mapping_array_data,
+	          &sector_mapping_array_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector mapping array data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_OWNER_PAGE;
+
+		return( 1 );
+	}
+	number_of_sector_mappings = sector_mapping_array_data_size / 2;
+
+	for( block_index = 0;
+	     block_index < region->number_of_blocks;
+	     block_index++ )
+	{
+		verifier_block = &( verifier->blocks[ region->first_block_index + block_index ] );
+
+		*failure_offset = verifier_block->offset;
+
+		sector_index            = ( verifier_block->offset - region->offset ) / verifier->io_handle->bytes_per_sector;
+		number_of_block_sectors = verifier_block->size / verifier->io_handle->bytes_per_sector;
+
+		/* The sectors of the block after the owner page are mapped by the owner page of the next region
+		 */
+		for( block_sector_index = 0;
+		     block_sector_index < number_of_block_sectors;
+		     block_sector_index++ )
+		{
+			if( ( sector_index * verifier->io_handle->bytes_per_sector ) >= verifier->io_handle->region_owner_page_offset )
+			{
+				break;
+			}
+			if( (size_t) sector_index >= number_of_sector_mappings )
+			{
+				*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_OWNER_PAGE;
+
+				return( 1 );
+			}
+			if( ( sector_mapping_array_data[ sector_index * 2 ] != verifier_block->stream_number )
+			 || ( sector_mapping_array_data[ ( sector_index * 2 ) + 1 ] != (uint8_t) ( block_sector_index & 0xff ) ) )
+			{
+				*failure_type = LIBFSCLFS_VERIFICATION_FAILURE_OWNER_PAGE;
+
+				return( 1 );
+			}
+			sector_index++;
+		}
+	}
+	*failure_offset = owner_page_offset;
+
+	return( 1 );
+}
+
+/* Verifies the blocks of a region
+ * A block that fails verification does not stop the verification of the region,
+ * only the first failure is kept
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_verify_region(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_region_t *region,
+     int worker_index,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libfsclfs_verifier_block_t *verifier_block = NULL;
+	libfsclfs_verifier_worker_t *worker        = NULL;
+	static char *function                      = "libfsclfs_verifier_verify_region";
+	uint32_t failure_offset                    = 0;
+	uint8_t is_container                       = 0;
+	int block_index                            = 0;
+	int failure_type                           = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region->first_block_index < 0 )
+	 || ( region->number_of_blocks < 0 )
+	 || ( region->first_block_index > ( verifier->number_of_blocks - region->number_of_blocks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region - blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= verifier->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	worker = &( verifier->workers[ worker_index ] );
+
+	region->result                  = -1;
+	region->number_of_failed_blocks = 0;
+	region->failure_type            = LIBFSCLFS_VERIFICATION_FAILURE_NONE;
+	region->failure_offset          = 0;
+
+	if( libfsclfs_verifier_get_worker_file_io_handle(
+	     verifier,
+	     worker_index,
+	     region->container_physical_number,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle of worker: %d.",
+		 function,
+		 worker_index );
+
+		return( -1 );
+	}
+	if( region->container_index != -1 )
+	{
+		is_container = 1;
+	}
+	for( block_index = 0;
+	     block_index < region->number_of_blocks;
+	     block_index++ )
+	{
+		if( verifier->io_handle->abort != 0 )
+		{
+			break;
+		}
+		verifier_block = &( verifier->blocks[ region->first_block_index + block_index ] );
+
+		if( libfsclfs_verifier_verify_block(
+		     verifier,
+		     worker,
+		     file_io_handle,
+		     verifier_block->offset,
+		     verifier_block->size,
+		     is_container,
+		     &failure_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify block at offset: %" PRIu32 ".",
+			 function,
+			 verifier_block->offset );
+
+			return( -1 );
+		}
+		if( ( failure_type == LIBFSCLFS_VERIFICATION_FAILURE_NONE )
+		 && ( is_container != 0 ) )
+		{
+			if( (uint32_t) ( worker->block->physical_lsn & 0xfffffe00UL ) != verifier_block->offset )
+			{
+				failure_type = LIBFSCLFS_VERIFICATION_FAILURE_OFFSETS;
+			}
+			else if( libfsclfs_verifier_verify_records(
+			          worker,
+			          verifier_block->lsn,
+			          &failure_type,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify records of block at offset: %" PRIu32 ".",
+				 function,
+				 verifier_block->offset );
+
+				return( -1 );
+			}
+		}
+		if( failure_type != LIBFSCLFS_VERIFICATION_FAILURE_NONE )
+		{
+			if( region->number_of_failed_blocks == 0 )
+			{
+				region->failure_type   = failure_type;
+				region->failure_offset = verifier_block->offset;
+			}
+			region->number_of_failed_blocks += 1;
+		}
+	}
+	if( ( is_container != 0 )
+	 && ( region->number_of_blocks > 0 )
+	 && ( verifier->io_handle->abort == 0 )
+	 && ( verifier->io_handle->region_owner_page_offset > 0 )
+	 && ( verifier->io_handle->region_owner_page_offset < verifier->io_handle->region_size ) )
+	{
+		if( libfsclfs_verifier_verify_owner_page(
+		     verifier,
+		     worker,
+		     file_io_handle,
+		     region,
+		     &failure_type,
+		     &failure_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify owner page of region at offset: %" PRIu32 ".",
+			 function,
+			 region->offset );
+
+			return( -1 );
+		}
+		/* The owner page is not counted as a block of the region
+		 */
+		if( ( failure_type != LIBFSCLFS_VERIFICATION_FAILURE_NONE )
+		 && ( region->failure_type == LIBFSCLFS_VERIFICATION_FAILURE_NONE ) )
+		{
+			region->failure_type   = failure_type;
+			region->failure_offset = failure_offset;
+		}
+	}
+	region->result = 1;
+
+	return( 1 );
+}
+
+/* Verifies a region as a task of the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_verify_region_task_callback(
+     libfsclfs_verifier_region_t *region,
+     int worker_index,
+     void *callback_data LIBFSCLFS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_t *verifier = NULL;
+	static char *function          = "libfsclfs_verifier_verify_region_task_callback";
+
+	LIBFSCLFS_UNREFERENCED_PARAMETER( callback_data )
+
+	if( region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid region.",
+		 function );
+
+		goto on_error;
+	}
+	verifier = region->verifier;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid region - missing verifier.",
+		 function );
+
+		goto on_error;
+	}
+	/* Skip the remaining regions if abort was signalled
+	 */
+	if( verifier->io_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( libfsclfs_verifier_verify_region(
+	     verifier,
+	     region,
+	     worker_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify region.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( region != NULL )
+	{
+		region->result = -1;
+	}
+	return( -1 );
+}
+
+/* Verifies all the blocks
+ * The blocks are grouped by region and the regions are verified as tasks of
+ * a work-stealing scheduler, so that the blocks of a region and its owner page
+ * are read by the same worker in ascending offset order
+ * If multi-threading support is available and number_of_threads is larger than 1
+ * every worker runs on its own thread, otherwise the regions are verified sequentially
+ * The result of the verification is stored in the regions
+ * Returns 1 if successful or -1 on error
+ */
+int libfsclfs_verifier_verify(
+     libfsclfs_verifier_t *verifier,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	uint8_t empty_data[ 1 ]          = { 0 };
+	libfsclfs_scheduler_t *scheduler = NULL;
+	static char *function            = "libfsclfs_verifier_verify";
+	uint32_t checksum                = 0;
+	int number_of_tasks_per_worker   = 0;
+	int region_index                 = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->regions == NULL )
+	{
+		if( libfsclfs_verifier_determine_regions(
+		     verifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine regions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verifier->number_of_regions == 0 )
+	{
+		return( 1 );
+	}
+	/* Calculate a checksum so that the CRC-32 table is computed before the workers share it
+	 */
+	if( libfsclfs_checksum_calculate_crc32(
+	     &checksum,
+	     empty_data,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > verifier->number_of_regions )
+	{
+		number_of_threads = verifier->number_of_regions;
+	}
+#else
+	number_of_threads = 1;
+#endif
+	number_of_tasks_per_worker = verifier->number_of_regions / number_of_threads;
+
+	if( ( verifier->number_of_regions % number_of_threads ) != 0 )
+	{
+		number_of_tasks_per_worker += 1;
+	}
+	if( libfsclfs_verifier_create_workers(
+	     verifier,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_scheduler_initialize(
+	     &scheduler,
+	     number_of_threads,
+	     number_of_tasks_per_worker,
+	     (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &libfsclfs_verifier_verify_region_task_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( region_index = 0;
+	     region_index < verifier->number_of_regions;
+	     region_index++ )
+	{
+		verifier->regions[ region_index ].result = 0;
+
+		if( libfsclfs_scheduler_push_task(
+		     scheduler,
+		     region_index / number_of_tasks_per_worker,
+		     (intptr_t *) &( verifier->regions[ region_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push region: %d onto scheduler.",
+			 function,
+			 region_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsclfs_scheduler_run(
+	     scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_scheduler_free(
+	     &scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsclfs_verifier_free_workers(
+	     verifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( verifier->io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_index = 0;
+	     region_index < verifier->number_of_regions;
+	     region_index++ )
+	{
+		if( verifier->regions[ region_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify region at offset: %" PRIu32 " of container: %d.",
+			 function,
+			 verifier->regions[ region_index ].offset,
+			 verifier->regions[ region_index ].container_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	libfsclfs_verifier_free_workers(
+	 verifier,
+	 NULL );
+
+	return( -1 );
+}
+
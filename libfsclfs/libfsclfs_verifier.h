@@ -0,0 +1,302 @@
+/*
+ * Verifier functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSCLFS_VERIFIER_H )
+#define _LIBFSCLFS_VERIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsclfs_block.h"
+#include "libfsclfs_io_handle.h"
+#include "libfsclfs_libbfio.h"
+#include "libfsclfs_libcerror.h"
+#include "libfsclfs_libcthreads.h"
+#include "libfsclfs_record_header_table.h"
+#include "libfsclfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsclfs_verifier libfsclfs_verifier_t;
+
+typedef struct libfsclfs_verifier_block libfsclfs_verifier_block_t;
+
+typedef struct libfsclfs_verifier_region libfsclfs_verifier_region_t;
+
+typedef struct libfsclfs_verifier_worker libfsclfs_verifier_worker_t;
+
+struct libfsclfs_verifier_block
+{
+	/* The container index
+	 * -1 for a block of the base log
+	 */
+	int container_index;
+
+	/* The container physical number
+	 * used as the index of the container in the file IO pool
+	 */
+	int container_physical_number;
+
+	/* The stream number
+	 */
+	uint8_t stream_number;
+
+	/* The block offset
+	 */
+	uint32_t offset;
+
+	/* The block size
+	 */
+	uint32_t size;
+
+	/* The virtual LSN of the block
+	 */
+	uint64_t lsn;
+};
+
+struct libfsclfs_verifier_region
+{
+	/* The verifier
+	 */
+	libfsclfs_verifier_t *verifier;
+
+	/* The container index
+	 * -1 for the base log
+	 */
+	int container_index;
+
+	/* The container physical number
+	 */
+	int container_physical_number;
+
+	/* The region offset
+	 */
+	uint32_t offset;
+
+	/* The index of the first block of the region
+	 */
+	int first_block_index;
+
+	/* The number of blocks of the region
+	 */
+	int number_of_blocks;
+
+	/* The number of blocks that failed verification
+	 */
+	int number_of_failed_blocks;
+
+	/* The type of the first failure
+	 */
+	int failure_type;
+
+	/* The offset of the first failure
+	 */
+	uint32_t failure_offset;
+
+	/* The verification result
+	 * 1 if the region was verified, 0 if not or -1 on error
+	 */
+	int result;
+};
+
+struct libfsclfs_verifier_worker
+{
+	/* The block
+	 * the block data is reused by subsequent reads of the worker
+	 */
+	libfsclfs_block_t *block;
+
+	/* The record header table
+	 */
+	libfsclfs_record_header_table_t *record_header_table;
+
+	/* The data as stored on disk
+	 * the checksum is calculated over the data before the fix-up values are applied
+	 */
+	uint8_t *data;
+
+	/* The allocated data size
+	 */
+	uint32_t allocated_data_size;
+
+	/* The container file IO handles
+	 * contains a clone of the file IO handle of every container when multi-threading
+	 * is used, which is created when the worker first reads a block of the container
+	 */
+	libbfio_handle_t **file_io_handles;
+};
+
+struct libfsclfs_verifier
+{
+	/* The IO handle
+	 */
+	libfsclfs_io_handle_t *io_handle;
+
+	/* The base log file IO handle
+	 */
+	libbfio_handle_t *base_log_file_io_handle;
+
+	/* The container file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The number of containers in the file IO pool
+	 */
+	int number_of_containers;
+
+	/* The blocks
+	 */
+	libfsclfs_verifier_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	int number_of_allocated_blocks;
+
+	/* The regions
+	 * the regions are determined from the blocks when verifying
+	 */
+	libfsclfs_verifier_region_t *regions;
+
+	/* The number of regions
+	 */
+	int number_of_regions;
+
+	/* The workers
+	 */
+	libfsclfs_verifier_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the container file IO pool
+	 */
+	libcthreads_mutex_t *file_io_pool_mutex;
+#endif
+};
+
+int libfsclfs_verifier_initialize(
+     libfsclfs_verifier_t **verifier,
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *base_log_file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_containers,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_free(
+     libfsclfs_verifier_t **verifier,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_append_block(
+     libfsclfs_verifier_t *verifier,
+     int container_index,
+     int container_physical_number,
+     uint8_t stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint64_t block_lsn,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_determine_regions(
+     libfsclfs_verifier_t *verifier,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_create_workers(
+     libfsclfs_verifier_t *verifier,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_free_workers(
+     libfsclfs_verifier_t *verifier,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_get_worker_file_io_handle(
+     libfsclfs_verifier_t *verifier,
+     int worker_index,
+     int container_physical_number,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_read_data(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_worker_t *worker,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_offset,
+     uint32_t data_offset,
+     uint32_t read_size,
+     uint8_t skip_owner_page,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_verify_block(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_worker_t *worker,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint8_t skip_owner_page,
+     int *failure_type,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_verify_records(
+     libfsclfs_verifier_worker_t *worker,
+     uint64_t block_lsn,
+     int *failure_type,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_verify_owner_page(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_worker_t *worker,
+     libbfio_handle_t *file_io_handle,
+     libfsclfs_verifier_region_t *region,
+     int *failure_type,
+     uint32_t *failure_offset,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_verify_region(
+     libfsclfs_verifier_t *verifier,
+     libfsclfs_verifier_region_t *region,
+     int worker_index,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_verify_region_task_callback(
+     libfsclfs_verifier_region_t *region,
+     int worker_index,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfsclfs_verifier_verify(
+     libfsclfs_verifier_t *verifier,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSCLFS_VERIFIER_H ) */
+
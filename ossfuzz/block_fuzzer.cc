@@ -0,0 +1,122 @@
+/*
+ * OSS-Fuzz target for libfsclfs block type
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libbfio.h"
+#include "ossfuzz_libfsclfs.h"
+
+#include "../libfsclfs/libfsclfs_block.h"
+#include "../libfsclfs/libfsclfs_io_handle.h"
+
+/* The IO handles are created once and reused by every input
+ * since the fuzzing engine runs the inputs in-process
+ */
+static libbfio_handle_t *block_fuzzer_file_io_handle = NULL;
+static libfsclfs_io_handle_t *block_fuzzer_io_handle = NULL;
+
+int LLVMFuzzerInitialize(
+     int *argc,
+     char ***argv )
+{
+	(void) argc;
+	(void) argv;
+
+	if( libbfio_memory_range_initialize(
+	     &block_fuzzer_file_io_handle,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_io_handle_initialize(
+	     &block_fuzzer_io_handle,
+	     NULL ) != 1 )
+	{
+		libbfio_handle_free(
+		 &block_fuzzer_file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	libfsclfs_block_t *block = NULL;
+	uint8_t *record_data     = NULL;
+	size_t record_data_size  = 0;
+
+	if( libbfio_memory_range_set(
+	     block_fuzzer_file_io_handle,
+	     (uint8_t *) data,
+	     size,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     block_fuzzer_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libfsclfs_block_initialize(
+	     &block,
+	     NULL ) != 1 )
+	{
+		goto on_error_libbfio;
+	}
+	if( libfsclfs_block_read(
+	     block,
+	     block_fuzzer_io_handle,
+	     block_fuzzer_file_io_handle,
+	     0,
+	     NULL ) == 1 )
+	{
+		libfsclfs_block_get_record_data(
+		 block,
+		 &record_data,
+		 &record_data_size,
+		 NULL );
+	}
+	libfsclfs_block_free(
+	 &block,
+	 NULL );
+
+on_error_libbfio:
+	libbfio_handle_close(
+	 block_fuzzer_file_io_handle,
+	 NULL );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
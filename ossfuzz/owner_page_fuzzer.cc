@@ -0,0 +1,139 @@
+/*
+ * OSS-Fuzz target for libfsclfs owner page type
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libbfio.h"
+#include "ossfuzz_libfsclfs.h"
+
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_owner_page.h"
+
+/* The IO handles are created once and reused by every input
+ * since the fuzzing engine runs the inputs in-process
+ */
+static libbfio_handle_t *owner_page_fuzzer_file_io_handle = NULL;
+static libfsclfs_io_handle_t *owner_page_fuzzer_io_handle = NULL;
+
+int LLVMFuzzerInitialize(
+     int *argc,
+     char ***argv )
+{
+	(void) argc;
+	(void) argv;
+
+	if( libbfio_memory_range_initialize(
+	     &owner_page_fuzzer_file_io_handle,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_io_handle_initialize(
+	     &owner_page_fuzzer_io_handle,
+	     NULL ) != 1 )
+	{
+		libbfio_handle_free(
+		 &owner_page_fuzzer_file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	libfsclfs_owner_page_t *owner_page = NULL;
+	int number_of_streams              = 0;
+
+	/* The first byte selects the number of streams
+	 */
+	if( size < 1 )
+	{
+		return( 0 );
+	}
+	number_of_streams = 1 + (int) ( data[ 0 ] & 0x0f );
+
+	if( libbfio_memory_range_set(
+	     owner_page_fuzzer_file_io_handle,
+	     (uint8_t *) &( data[ 1 ] ),
+	     size - 1,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     owner_page_fuzzer_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libfsclfs_owner_page_initialize(
+	     &owner_page,
+	     NULL ) != 1 )
+	{
+		goto on_error_libbfio;
+	}
+	/* The most significant bit of the first byte selects reading the owner page
+	 * directly or by scanning the blocks of a region
+	 */
+	if( ( data[ 0 ] & 0x80 ) == 0 )
+	{
+		libfsclfs_owner_page_read(
+		 owner_page,
+		 owner_page_fuzzer_io_handle,
+		 owner_page_fuzzer_file_io_handle,
+		 number_of_streams,
+		 owner_page_fuzzer_io_handle->region_owner_page_offset,
+		 NULL );
+	}
+	else
+	{
+		libfsclfs_owner_page_read_scan_region(
+		 owner_page,
+		 owner_page_fuzzer_io_handle,
+		 owner_page_fuzzer_file_io_handle,
+		 number_of_streams,
+		 owner_page_fuzzer_io_handle->region_owner_page_offset,
+		 NULL );
+	}
+	libfsclfs_owner_page_free(
+	 &owner_page,
+	 NULL );
+
+on_error_libbfio:
+	libbfio_handle_close(
+	 owner_page_fuzzer_file_io_handle,
+	 NULL );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
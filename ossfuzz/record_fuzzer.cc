@@ -0,0 +1,139 @@
+/*
+ * OSS-Fuzz target for libfsclfs record chain
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libbfio.h"
+#include "ossfuzz_libfsclfs.h"
+
+#include "../libfsclfs/libfsclfs_definitions.h"
+#include "../libfsclfs/libfsclfs_record_value.h"
+#include "../libfsclfs/libfsclfs_store.h"
+
+/* The store and IO handle are created once and reused by every input
+ * since the fuzzing engine runs the inputs in-process
+ * The store is not opened, only its IO handle is used to read the block
+ */
+static libbfio_handle_t *record_fuzzer_file_io_handle = NULL;
+static libfsclfs_store_t *record_fuzzer_store         = NULL;
+
+static uint64_t record_fuzzer_restart_lsns[ LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS ];
+
+int LLVMFuzzerInitialize(
+     int *argc,
+     char ***argv )
+{
+	(void) argc;
+	(void) argv;
+
+	if( libbfio_memory_range_initialize(
+	     &record_fuzzer_file_io_handle,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_store_initialize(
+	     &record_fuzzer_store,
+	     NULL ) != 1 )
+	{
+		libbfio_handle_free(
+		 &record_fuzzer_file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	libfsclfs_internal_store_t *internal_store = NULL;
+	libfsclfs_record_value_t *record_value     = NULL;
+	uint64_t previous_block_lsn                = 0;
+	uint64_t previous_lsn                      = 0;
+	uint16_t record_number                     = 0;
+	int number_of_restart_lsns                 = 0;
+
+	internal_store = (libfsclfs_internal_store_t *) record_fuzzer_store;
+
+	if( libbfio_memory_range_set(
+	     record_fuzzer_file_io_handle,
+	     (uint8_t *) data,
+	     size,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     record_fuzzer_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	libfsclfs_block_read_restart_lsns(
+	 internal_store,
+	 record_fuzzer_file_io_handle,
+	 0,
+	 ~( (uint64_t) 0x01ff ),
+	 record_fuzzer_restart_lsns,
+	 &number_of_restart_lsns,
+	 &previous_block_lsn,
+	 NULL );
+
+	/* Follow the record chain of the block until a record cannot be read
+	 */
+	for( record_number = 0;
+	     record_number < LIBFSCLFS_MAXIMUM_NUMBER_OF_BLOCK_RECORDS;
+	     record_number++ )
+	{
+		if( libfsclfs_block_read_record_value(
+		     internal_store,
+		     record_fuzzer_file_io_handle,
+		     0,
+		     record_number,
+		     NULL,
+		     &record_value,
+		     &previous_lsn,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	libbfio_handle_close(
+	 record_fuzzer_file_io_handle,
+	 NULL );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,278 @@
+/*
+ * Python bindings module for libfsclfs (pyfsclfs)
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsclfs.h"
+#include "pyfsclfs_container.h"
+#include "pyfsclfs_containers.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+#include "pyfsclfs_record.h"
+#include "pyfsclfs_records.h"
+#include "pyfsclfs_store.h"
+#include "pyfsclfs_stream.h"
+#include "pyfsclfs_streams.h"
+#include "pyfsclfs_unused.h"
+
+/* The pyfsclfs module methods
+ */
+PyMethodDef pyfsclfs_module_methods[] = {
+	{ "get_version",
+	  (PyCFunction) pyfsclfs_get_version,
+	  METH_NOARGS,
+	  "get_version() -> String\n"
+	  "\n"
+	  "Retrieves the version." },
+
+	{ "open",
+	  (PyCFunction) pyfsclfs_open_new_store,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open(filename, mode='r') -> Object\n"
+	  "\n"
+	  "Opens a store using the base log file and opens its containers." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+/* Retrieves the pyfsclfs/libfsclfs version
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_get_version(
+           PyObject *self PYFSCLFS_ATTRIBUTE_UNUSED,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	const char *errors           = NULL;
+	const char *version_string   = NULL;
+	size_t version_string_length = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( self )
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	Py_BEGIN_ALLOW_THREADS
+
+	version_string = libfsclfs_get_version();
+
+	Py_END_ALLOW_THREADS
+
+	version_string_length = narrow_string_length(
+	                         version_string );
+
+	/* Pass the string length to PyUnicode_DecodeUTF8
+	 * otherwise it makes the end of string character is part
+	 * of the string
+	 */
+	return( PyUnicode_DecodeUTF8(
+	         version_string,
+	         (Py_ssize_t) version_string_length,
+	         errors ) );
+}
+
+/* Creates a new store object and opens it
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_open_new_store(
+           PyObject *self PYFSCLFS_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PYFSCLFS_UNREFERENCED_PARAMETER( self )
+
+	return( pyfsclfs_store_new_open(
+	         self,
+	         arguments,
+	         keywords ) );
+}
+
+/* The pyfsclfs module definition
+ */
+PyModuleDef pyfsclfs_module_definition = {
+	PyModuleDef_HEAD_INIT,
+
+	/* m_name */
+	"pyfsclfs",
+	/* m_doc */
+	"Python libfsclfs module (pyfsclfs).",
+	/* m_size */
+	-1,
+	/* m_methods */
+	pyfsclfs_module_methods,
+	/* m_reload */
+	NULL,
+	/* m_traverse */
+	NULL,
+	/* m_clear */
+	NULL,
+	/* m_free */
+	NULL,
+};
+
+/* Initializes the pyfsclfs module
+ */
+PyMODINIT_FUNC PyInit_pyfsclfs(
+                void )
+{
+	PyObject *module           = NULL;
+	PyGILState_STATE gil_state = 0;
+
+	/* Create the module
+	 * This function must be called before grabbing the GIL
+	 * otherwise the module will segfault on a version mismatch
+	 */
+	module = PyModule_Create(
+	          &pyfsclfs_module_definition );
+
+	if( module == NULL )
+	{
+		return( NULL );
+	}
+#if PY_VERSION_HEX < 0x03070000
+	PyEval_InitThreads();
+#endif
+	gil_state = PyGILState_Ensure();
+
+	pyfsclfs_store_type_object.tp_new = PyType_GenericNew;
+
+	/* Setup the container type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_container_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_container_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "container",
+	 (PyObject *) &pyfsclfs_container_type_object );
+
+	/* Setup the containers sequence and iterator type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_containers_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_containers_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "containers",
+	 (PyObject *) &pyfsclfs_containers_type_object );
+
+	/* Setup the record type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_record_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_record_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "record",
+	 (PyObject *) &pyfsclfs_record_type_object );
+
+	/* Setup the records iterator type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_records_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_records_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "records",
+	 (PyObject *) &pyfsclfs_records_type_object );
+
+	/* Setup the store type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_store_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_store_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "store",
+	 (PyObject *) &pyfsclfs_store_type_object );
+
+	/* Setup the stream type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_stream_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_stream_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "stream",
+	 (PyObject *) &pyfsclfs_stream_type_object );
+
+	/* Setup the streams sequence and iterator type object
+	 */
+	if( PyType_Ready(
+	     &pyfsclfs_streams_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsclfs_streams_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "streams",
+	 (PyObject *) &pyfsclfs_streams_type_object );
+
+	PyGILState_Release(
+	 gil_state );
+
+	return( module );
+
+on_error:
+	PyGILState_Release(
+	 gil_state );
+
+	return( NULL );
+}
+
@@ -0,0 +1,51 @@
+/*
+ * Python bindings module for libfsclfs (pyfsclfs)
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_H )
+#define _PYFSCLFS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+PyObject *pyfsclfs_get_version(
+           PyObject *self,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_open_new_store(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyMODINIT_FUNC PyInit_pyfsclfs(
+                void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_H ) */
+
@@ -0,0 +1,533 @@
+/*
+ * Python object wrapper of libfsclfs_container_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsclfs_container.h"
+#include "pyfsclfs_error.h"
+#include "pyfsclfs_integer.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+#include "pyfsclfs_store.h"
+#include "pyfsclfs_unused.h"
+
+PyMethodDef pyfsclfs_container_object_methods[] = {
+
+	{ "get_name",
+	  (PyCFunction) pyfsclfs_container_get_name,
+	  METH_NOARGS,
+	  "get_name() -> Unicode string or None\n"
+	  "\n"
+	  "Retrieves the name." },
+
+	{ "get_size",
+	  (PyCFunction) pyfsclfs_container_get_size,
+	  METH_NOARGS,
+	  "get_size() -> Integer\n"
+	  "\n"
+	  "Retrieves the size." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyfsclfs_container_object_get_set_definitions[] = {
+
+	{ "name",
+	  (getter) pyfsclfs_container_get_name,
+	  (setter) 0,
+	  "The name.",
+	  NULL },
+
+	{ "size",
+	  (getter) pyfsclfs_container_get_size,
+	  (setter) 0,
+	  "The size.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyfsclfs_container_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsclfs.container",
+	/* tp_basicsize */
+	sizeof( pyfsclfs_container_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsclfs_container_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsclfs container object (wraps libfsclfs_container_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfsclfs_container_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyfsclfs_container_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsclfs_container_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0,
+	/* tp_version_tag */
+	0
+};
+
+/* Creates a new container object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_container_new(
+           libfsclfs_container_t *container,
+           PyObject *parent_object )
+{
+	pyfsclfs_container_t *pyfsclfs_container = NULL;
+	static char *function                    = "pyfsclfs_container_new";
+
+	if( container == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid container.",
+		 function );
+
+		return( NULL );
+	}
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsclfs_container = PyObject_New(
+	                      struct pyfsclfs_container,
+	                      &pyfsclfs_container_type_object );
+
+	if( pyfsclfs_container == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize container.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsclfs_container_init(
+	     pyfsclfs_container ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize container.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsclfs_container->container     = container;
+	pyfsclfs_container->parent_object = parent_object;
+	pyfsclfs_container->lock          = ( (pyfsclfs_store_t *) parent_object )->lock;
+
+	Py_IncRef(
+	 (PyObject *) pyfsclfs_container->parent_object );
+
+	return( (PyObject *) pyfsclfs_container );
+
+on_error:
+	if( pyfsclfs_container != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_container );
+	}
+	return( NULL );
+}
+
+/* Initializes a container object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsclfs_container_init(
+     pyfsclfs_container_t *pyfsclfs_container )
+{
+	static char *function = "pyfsclfs_container_init";
+
+	if( pyfsclfs_container == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libfsclfs container is set to NULL
+	 */
+	pyfsclfs_container->container     = NULL;
+	pyfsclfs_container->parent_object = NULL;
+	pyfsclfs_container->lock          = NULL;
+
+	return( 0 );
+}
+
+/* Frees a container object
+ */
+void pyfsclfs_container_free(
+      pyfsclfs_container_t *pyfsclfs_container )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsclfs_container_free";
+	int result                  = 0;
+
+	if( pyfsclfs_container == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid container.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsclfs_container );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsclfs_container->container != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsclfs_container_free(
+		          &( pyfsclfs_container->container ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsclfs_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libfsclfs container.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyfsclfs_container->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_container->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsclfs_container );
+}
+
+/* Retrieves the name
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_container_get_name(
+           pyfsclfs_container_t *pyfsclfs_container,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	const char *errors       = NULL;
+	uint8_t *utf8_string     = NULL;
+	static char *function    = "pyfsclfs_container_get_name";
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_container == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid container.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_container->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_container_get_utf8_name_size(
+	          pyfsclfs_container->container,
+	          &utf8_string_size,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_container->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	utf8_string = (uint8_t *) PyMem_Malloc(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_container->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_container_get_utf8_name(
+	          pyfsclfs_container->container,
+	          utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_container->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 errors );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	return( string_object );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( NULL );
+}
+
+/* Retrieves the size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_container_get_size(
+           pyfsclfs_container_t *pyfsclfs_container,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_container_get_size";
+	size64_t size            = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_container == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid container.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_container->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_container_get_size(
+	          pyfsclfs_container->container,
+	          &size,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_container->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsclfs_integer_unsigned_new_from_64bit(
+	                  (uint64_t) size );
+
+	return( integer_object );
+}
+
@@ -0,0 +1,82 @@
+/*
+ * Python object wrapper of libfsclfs_container_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_CONTAINER_H )
+#define _PYFSCLFS_CONTAINER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_container pyfsclfs_container_t;
+
+struct pyfsclfs_container
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libfsclfs container
+	 */
+	libfsclfs_container_t *container;
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The lock of the store
+	 */
+	PyThread_type_lock lock;
+};
+
+extern PyMethodDef pyfsclfs_container_object_methods[];
+extern PyTypeObject pyfsclfs_container_type_object;
+
+PyObject *pyfsclfs_container_new(
+           libfsclfs_container_t *container,
+           PyObject *parent_object );
+
+int pyfsclfs_container_init(
+     pyfsclfs_container_t *pyfsclfs_container );
+
+void pyfsclfs_container_free(
+      pyfsclfs_container_t *pyfsclfs_container );
+
+PyObject *pyfsclfs_container_get_name(
+           pyfsclfs_container_t *pyfsclfs_container,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_container_get_size(
+           pyfsclfs_container_t *pyfsclfs_container,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_CONTAINER_H ) */
+
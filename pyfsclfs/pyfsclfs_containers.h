@@ -0,0 +1,94 @@
+/*
+ * Python object definition of the sequence and iterator object of containers
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_CONTAINERS_H )
+#define _PYFSCLFS_CONTAINERS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_containers pyfsclfs_containers_t;
+
+struct pyfsclfs_containers
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The get item by index callback function
+	 */
+	PyObject* (*get_item_by_index)(
+	             PyObject *parent_object,
+	             int index );
+
+	/* The current index
+	 */
+	int current_index;
+
+	/* The number of items
+	 */
+	int number_of_items;
+};
+
+extern PyTypeObject pyfsclfs_containers_type_object;
+
+PyObject *pyfsclfs_containers_new(
+           PyObject *parent_object,
+           PyObject* (*get_item_by_index)(
+                        PyObject *parent_object,
+                        int index ),
+           int number_of_items );
+
+int pyfsclfs_containers_init(
+     pyfsclfs_containers_t *sequence_object );
+
+void pyfsclfs_containers_free(
+      pyfsclfs_containers_t *sequence_object );
+
+Py_ssize_t pyfsclfs_containers_len(
+            pyfsclfs_containers_t *sequence_object );
+
+PyObject *pyfsclfs_containers_getitem(
+           pyfsclfs_containers_t *sequence_object,
+           Py_ssize_t item_index );
+
+PyObject *pyfsclfs_containers_iter(
+           pyfsclfs_containers_t *sequence_object );
+
+PyObject *pyfsclfs_containers_iternext(
+           pyfsclfs_containers_t *sequence_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_CONTAINERS_H ) */
+
@@ -0,0 +1,123 @@
+/*
+ * Error functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#else
+#error Missing headers stdarg.h and varargs.h
+#endif
+
+#include "pyfsclfs_error.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_python.h"
+
+/* Raises an error
+ * The libcerror error backtrace, if available, is appended to the exception string
+ */
+void pyfsclfs_error_raise(
+      libcerror_error_t *error,
+      PyObject *exception_object,
+      const char *format_string,
+      ... )
+{
+	va_list argument_list;
+
+	char error_string[ PYFSCLFS_ERROR_STRING_SIZE ];
+	char exception_string[ PYFSCLFS_ERROR_STRING_SIZE ];
+
+	static char *function     = "pyfsclfs_error_raise";
+	size_t error_string_index = 0;
+	int print_count           = 0;
+
+	if( format_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing format string.",
+		 function );
+
+		return;
+	}
+	va_start(
+	 argument_list,
+	 format_string );
+
+	print_count = PyOS_vsnprintf(
+	               exception_string,
+	               PYFSCLFS_ERROR_STRING_SIZE,
+	               format_string,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	if( print_count < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unable to format exception string.",
+		 function );
+
+		return;
+	}
+	if( error != NULL )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYFSCLFS_ERROR_STRING_SIZE ) != -1 )
+		{
+			while( error_string_index < PYFSCLFS_ERROR_STRING_SIZE )
+			{
+				if( error_string[ error_string_index ] == 0 )
+				{
+					break;
+				}
+				if( ( error_string[ error_string_index ] == '\n' )
+				 || ( error_string[ error_string_index ] == '\r' ) )
+				{
+					error_string[ error_string_index ] = ' ';
+				}
+				error_string_index++;
+			}
+			if( error_string_index >= PYFSCLFS_ERROR_STRING_SIZE )
+			{
+				error_string[ PYFSCLFS_ERROR_STRING_SIZE - 1 ] = 0;
+			}
+			PyErr_Format(
+			 exception_object,
+			 "%s %s",
+			 exception_string,
+			 error_string );
+
+			return;
+		}
+	}
+	PyErr_Format(
+	 exception_object,
+	 "%s",
+	 exception_string );
+}
+
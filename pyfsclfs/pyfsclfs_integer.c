@@ -0,0 +1,49 @@
+/*
+ * Integer functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_integer.h"
+#include "pyfsclfs_python.h"
+
+/* Creates a new unsigned integer object from a 64-bit value
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_integer_unsigned_new_from_64bit(
+           uint64_t value_64bit )
+{
+	PyObject *integer_object = NULL;
+	static char *function    = "pyfsclfs_integer_unsigned_new_from_64bit";
+
+	integer_object = PyLong_FromUnsignedLongLong(
+	                  (unsigned long long) value_64bit );
+
+	if( integer_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create integer object.",
+		 function );
+	}
+	return( integer_object );
+}
+
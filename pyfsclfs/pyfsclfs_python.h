@@ -0,0 +1,36 @@
+/*
+ * The python header wrapper
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_PYTHON_H )
+#define _PYFSCLFS_PYTHON_H
+
+#include <common.h>
+
+/* Define PY_SSIZE_T_CLEAN to silence:
+ * DeprecationWarning: PY_SSIZE_T_CLEAN will be required for '#' formats
+ */
+#define PY_SSIZE_T_CLEAN
+
+#include <Python.h>
+#include <pythread.h>
+
+#endif /* !defined( _PYFSCLFS_PYTHON_H ) */
+
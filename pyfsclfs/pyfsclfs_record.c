@@ -0,0 +1,730 @@
+/*
+ * Python object wrapper of libfsclfs_record_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsclfs_error.h"
+#include "pyfsclfs_integer.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+#include "pyfsclfs_record.h"
+#include "pyfsclfs_unused.h"
+
+PyMethodDef pyfsclfs_record_object_methods[] = {
+
+	{ "get_lsn",
+	  (PyCFunction) pyfsclfs_record_get_lsn,
+	  METH_NOARGS,
+	  "get_lsn() -> Integer\n"
+	  "\n"
+	  "Retrieves the log sequence number (LSN)." },
+
+	{ "get_type",
+	  (PyCFunction) pyfsclfs_record_get_type,
+	  METH_NOARGS,
+	  "get_type() -> Integer\n"
+	  "\n"
+	  "Retrieves the record type." },
+
+	{ "get_flags",
+	  (PyCFunction) pyfsclfs_record_get_flags,
+	  METH_NOARGS,
+	  "get_flags() -> Integer\n"
+	  "\n"
+	  "Retrieves the record flags." },
+
+	{ "get_previous_lsn",
+	  (PyCFunction) pyfsclfs_record_get_previous_lsn,
+	  METH_NOARGS,
+	  "get_previous_lsn() -> Integer\n"
+	  "\n"
+	  "Retrieves the previous log sequence number (LSN)." },
+
+	{ "get_undo_next_lsn",
+	  (PyCFunction) pyfsclfs_record_get_undo_next_lsn,
+	  METH_NOARGS,
+	  "get_undo_next_lsn() -> Integer\n"
+	  "\n"
+	  "Retrieves the undo-next log sequence number (LSN)." },
+
+	{ "get_data",
+	  (PyCFunction) pyfsclfs_record_get_data,
+	  METH_NOARGS,
+	  "get_data() -> Memoryview\n"
+	  "\n"
+	  "Retrieves the data as a read-only memoryview without copying it." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyfsclfs_record_object_get_set_definitions[] = {
+
+	{ "lsn",
+	  (getter) pyfsclfs_record_get_lsn,
+	  (setter) 0,
+	  "The log sequence number (LSN).",
+	  NULL },
+
+	{ "type",
+	  (getter) pyfsclfs_record_get_type,
+	  (setter) 0,
+	  "The record type.",
+	  NULL },
+
+	{ "flags",
+	  (getter) pyfsclfs_record_get_flags,
+	  (setter) 0,
+	  "The record flags.",
+	  NULL },
+
+	{ "previous_lsn",
+	  (getter) pyfsclfs_record_get_previous_lsn,
+	  (setter) 0,
+	  "The previous log sequence number (LSN).",
+	  NULL },
+
+	{ "undo_next_lsn",
+	  (getter) pyfsclfs_record_get_undo_next_lsn,
+	  (setter) 0,
+	  "The undo-next log sequence number (LSN).",
+	  NULL },
+
+	{ "data",
+	  (getter) pyfsclfs_record_get_data,
+	  (setter) 0,
+	  "The data.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyBufferProcs pyfsclfs_record_buffer_procs = {
+	/* bf_getbuffer */
+	(getbufferproc) pyfsclfs_record_get_buffer,
+	/* bf_releasebuffer */
+	0
+};
+
+PyTypeObject pyfsclfs_record_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsclfs.record",
+	/* tp_basicsize */
+	sizeof( pyfsclfs_record_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsclfs_record_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	&pyfsclfs_record_buffer_procs,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsclfs record object (wraps libfsclfs_record_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfsclfs_record_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyfsclfs_record_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsclfs_record_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0,
+	/* tp_version_tag */
+	0
+};
+
+/* Creates a new record object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_new(
+           libfsclfs_record_t *record,
+           uint64_t lsn,
+           PyObject *parent_object )
+{
+	pyfsclfs_record_t *pyfsclfs_record = NULL;
+	static char *function              = "pyfsclfs_record_new";
+
+	if( record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsclfs_record = PyObject_New(
+	                   struct pyfsclfs_record,
+	                   &pyfsclfs_record_type_object );
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize record.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsclfs_record_init(
+	     pyfsclfs_record ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize record.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsclfs_record->record        = record;
+	pyfsclfs_record->lsn           = lsn;
+	pyfsclfs_record->parent_object = parent_object;
+
+	Py_IncRef(
+	 (PyObject *) pyfsclfs_record->parent_object );
+
+	return( (PyObject *) pyfsclfs_record );
+
+on_error:
+	if( pyfsclfs_record != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_record );
+	}
+	return( NULL );
+}
+
+/* Initializes a record object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsclfs_record_init(
+     pyfsclfs_record_t *pyfsclfs_record )
+{
+	static char *function = "pyfsclfs_record_init";
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libfsclfs record is set to NULL
+	 */
+	pyfsclfs_record->record        = NULL;
+	pyfsclfs_record->parent_object = NULL;
+	pyfsclfs_record->lsn           = 0;
+
+	return( 0 );
+}
+
+/* Frees a record object
+ */
+void pyfsclfs_record_free(
+      pyfsclfs_record_t *pyfsclfs_record )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsclfs_record_free";
+	int result                  = 0;
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsclfs_record );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsclfs_record->record != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsclfs_record_free(
+		          &( pyfsclfs_record->record ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsclfs_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libfsclfs record.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyfsclfs_record->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_record->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsclfs_record );
+}
+
+/* Retrieves a read-only buffer of the record data
+ * The buffer references the data of the record which is not copied
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsclfs_record_get_buffer(
+     pyfsclfs_record_t *pyfsclfs_record,
+     Py_buffer *buffer,
+     int flags )
+{
+	static uint8_t empty_data[ 1 ] = { 0 };
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	static char *function    = "pyfsclfs_record_get_buffer";
+	size_t data_size         = 0;
+	int result               = 0;
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsclfs_record_get_data(
+	          pyfsclfs_record->record,
+	          &data,
+	          &data_size,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_BufferError,
+		 "%s: unable to retrieve data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		if( buffer != NULL )
+		{
+			buffer->obj = NULL;
+		}
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		data      = empty_data;
+		data_size = 0;
+	}
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		if( buffer != NULL )
+		{
+			buffer->obj = NULL;
+		}
+		return( -1 );
+	}
+	return( PyBuffer_FillInfo(
+	         buffer,
+	         (PyObject *) pyfsclfs_record,
+	         (void *) data,
+	         (Py_ssize_t) data_size,
+	         1,
+	         flags ) );
+}
+
+/* Retrieves the log sequence number (LSN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_get_lsn(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsclfs_record_get_lsn";
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	return( pyfsclfs_integer_unsigned_new_from_64bit(
+	         pyfsclfs_record->lsn ) );
+}
+
+/* Retrieves the record type
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_get_type(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_record_get_type";
+	uint32_t record_type     = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsclfs_record_get_type(
+	          pyfsclfs_record->record,
+	          &record_type,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = PyLong_FromUnsignedLong(
+	                  (unsigned long) record_type );
+
+	return( integer_object );
+}
+
+/* Retrieves the record flags
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_get_flags(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_record_get_flags";
+	uint16_t record_flags    = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsclfs_record_get_flags(
+	          pyfsclfs_record->record,
+	          &record_flags,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record flags.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = PyLong_FromUnsignedLong(
+	                  (unsigned long) record_flags );
+
+	return( integer_object );
+}
+
+/* Retrieves the previous log sequence number (LSN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_get_previous_lsn(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_record_get_previous_lsn";
+	uint64_t previous_lsn    = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsclfs_record_get_previous_lsn(
+	          pyfsclfs_record->record,
+	          &previous_lsn,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve previous LSN.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsclfs_integer_unsigned_new_from_64bit(
+	                  previous_lsn );
+
+	return( integer_object );
+}
+
+/* Retrieves the undo-next log sequence number (LSN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_get_undo_next_lsn(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_record_get_undo_next_lsn";
+	uint64_t undo_next_lsn   = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsclfs_record_get_undo_next_lsn(
+	          pyfsclfs_record->record,
+	          &undo_next_lsn,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve undo-next LSN.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsclfs_integer_unsigned_new_from_64bit(
+	                  undo_next_lsn );
+
+	return( integer_object );
+}
+
+/* Retrieves the data
+ * The data is exposed as a read-only memoryview of the record without copying it
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_record_get_data(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsclfs_record_get_data";
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	return( PyMemoryView_FromObject(
+	         (PyObject *) pyfsclfs_record ) );
+}
+
@@ -0,0 +1,104 @@
+/*
+ * Python object wrapper of libfsclfs_record_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_RECORD_H )
+#define _PYFSCLFS_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_record pyfsclfs_record_t;
+
+struct pyfsclfs_record
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libfsclfs record
+	 */
+	libfsclfs_record_t *record;
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The log sequence number (LSN)
+	 */
+	uint64_t lsn;
+};
+
+extern PyMethodDef pyfsclfs_record_object_methods[];
+extern PyTypeObject pyfsclfs_record_type_object;
+
+PyObject *pyfsclfs_record_new(
+           libfsclfs_record_t *record,
+           uint64_t lsn,
+           PyObject *parent_object );
+
+int pyfsclfs_record_init(
+     pyfsclfs_record_t *pyfsclfs_record );
+
+void pyfsclfs_record_free(
+      pyfsclfs_record_t *pyfsclfs_record );
+
+int pyfsclfs_record_get_buffer(
+     pyfsclfs_record_t *pyfsclfs_record,
+     Py_buffer *buffer,
+     int flags );
+
+PyObject *pyfsclfs_record_get_lsn(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_record_get_type(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_record_get_flags(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_record_get_previous_lsn(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_record_get_undo_next_lsn(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_record_get_data(
+           pyfsclfs_record_t *pyfsclfs_record,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_RECORD_H ) */
+
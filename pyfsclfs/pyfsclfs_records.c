@@ -0,0 +1,423 @@
+/*
+ * Python object definition of the iterator object of records
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsclfs_error.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+#include "pyfsclfs_record.h"
+#include "pyfsclfs_records.h"
+
+PyTypeObject pyfsclfs_records_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsclfs.records",
+	/* tp_basicsize */
+	sizeof( pyfsclfs_records_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsclfs_records_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsclfs iterator object of records",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyfsclfs_records_iter,
+	/* tp_iternext */
+	(iternextfunc) pyfsclfs_records_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsclfs_records_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0,
+	/* tp_version_tag */
+	0
+};
+
+/* Creates a new records iterator object
+ * The scan cursor is owned by the records iterator object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_records_new(
+           libfsclfs_scan_cursor_t *scan_cursor,
+           PyObject *parent_object,
+           PyThread_type_lock lock )
+{
+	pyfsclfs_records_t *pyfsclfs_records = NULL;
+	static char *function                = "pyfsclfs_records_new";
+
+	if( scan_cursor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scan cursor.",
+		 function );
+
+		return( NULL );
+	}
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid lock.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsclfs_records = PyObject_New(
+	                    struct pyfsclfs_records,
+	                    &pyfsclfs_records_type_object );
+
+	if( pyfsclfs_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize records.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsclfs_records_init(
+	     pyfsclfs_records ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize records.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsclfs_records->scan_cursor   = scan_cursor;
+	pyfsclfs_records->parent_object = parent_object;
+	pyfsclfs_records->lock          = lock;
+
+	Py_IncRef(
+	 (PyObject *) pyfsclfs_records->parent_object );
+
+	return( (PyObject *) pyfsclfs_records );
+
+on_error:
+	if( pyfsclfs_records != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_records );
+	}
+	return( NULL );
+}
+
+/* Initializes a records iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsclfs_records_init(
+     pyfsclfs_records_t *pyfsclfs_records )
+{
+	static char *function = "pyfsclfs_records_init";
+
+	if( pyfsclfs_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libfsclfs scan cursor is set to NULL
+	 */
+	pyfsclfs_records->scan_cursor   = NULL;
+	pyfsclfs_records->parent_object = NULL;
+	pyfsclfs_records->lock          = NULL;
+
+	return( 0 );
+}
+
+/* Frees a records object
+ */
+void pyfsclfs_records_free(
+      pyfsclfs_records_t *pyfsclfs_records )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsclfs_records_free";
+	int result                  = 0;
+
+	if( pyfsclfs_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid records.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsclfs_records );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsclfs_records->scan_cursor != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsclfs_scan_cursor_free(
+		          &( pyfsclfs_records->scan_cursor ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsclfs_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libfsclfs scan cursor.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyfsclfs_records->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_records->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsclfs_records );
+}
+
+/* The records iter() function
+ */
+PyObject *pyfsclfs_records_iter(
+           pyfsclfs_records_t *pyfsclfs_records )
+{
+	static char *function = "pyfsclfs_records_iter";
+
+	if( pyfsclfs_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid records.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyfsclfs_records );
+
+	return( (PyObject *) pyfsclfs_records );
+}
+
+/* The records iternext() function
+ * The records are read with the GIL released
+ */
+PyObject *pyfsclfs_records_iternext(
+           pyfsclfs_records_t *pyfsclfs_records )
+{
+	PyObject *record_object    = NULL;
+	libcerror_error_t *error   = NULL;
+	libfsclfs_record_t *record = NULL;
+	static char *function      = "pyfsclfs_records_iternext";
+	uint64_t record_lsn        = 0;
+	int result                 = 0;
+
+	if( pyfsclfs_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid records.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_records->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_scan_cursor_get_current_lsn(
+	          pyfsclfs_records->scan_cursor,
+	          &record_lsn,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libfsclfs_scan_cursor_get_next_record(
+		          pyfsclfs_records->scan_cursor,
+		          &record,
+		          &error );
+	}
+
+	PyThread_release_lock(
+	 pyfsclfs_records->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve next record.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	record_object = pyfsclfs_record_new(
+	                 record,
+	                 record_lsn,
+	                 pyfsclfs_records->parent_object );
+
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record object.",
+		 function );
+
+		goto on_error;
+	}
+	return( record_object );
+
+on_error:
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,80 @@
+/*
+ * Python object definition of the iterator object of records
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_RECORDS_H )
+#define _PYFSCLFS_RECORDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_records pyfsclfs_records_t;
+
+struct pyfsclfs_records
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libfsclfs scan cursor
+	 */
+	libfsclfs_scan_cursor_t *scan_cursor;
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The lock of the store
+	 */
+	PyThread_type_lock lock;
+};
+
+extern PyTypeObject pyfsclfs_records_type_object;
+
+PyObject *pyfsclfs_records_new(
+           libfsclfs_scan_cursor_t *scan_cursor,
+           PyObject *parent_object,
+           PyThread_type_lock lock );
+
+int pyfsclfs_records_init(
+     pyfsclfs_records_t *pyfsclfs_records );
+
+void pyfsclfs_records_free(
+      pyfsclfs_records_t *pyfsclfs_records );
+
+PyObject *pyfsclfs_records_iter(
+           pyfsclfs_records_t *pyfsclfs_records );
+
+PyObject *pyfsclfs_records_iternext(
+           pyfsclfs_records_t *pyfsclfs_records );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_RECORDS_H ) */
+
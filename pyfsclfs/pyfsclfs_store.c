@@ -0,0 +1,1205 @@
+/*
+ * Python object wrapper of libfsclfs_store_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsclfs_container.h"
+#include "pyfsclfs_containers.h"
+#include "pyfsclfs_error.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+#include "pyfsclfs_store.h"
+#include "pyfsclfs_stream.h"
+#include "pyfsclfs_streams.h"
+#include "pyfsclfs_unused.h"
+
+PyMethodDef pyfsclfs_store_object_methods[] = {
+
+	{ "signal_abort",
+	  (PyCFunction) pyfsclfs_store_signal_abort,
+	  METH_NOARGS,
+	  "signal_abort() -> None\n"
+	  "\n"
+	  "Signals the store to abort the current activity." },
+
+	/* Functions to access the store */
+
+	{ "open",
+	  (PyCFunction) pyfsclfs_store_open,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open(filename, mode='r') -> None\n"
+	  "\n"
+	  "Opens a store using the base log file and opens its containers.\n"
+	  "The container files are expected in the same location as the base log file." },
+
+	{ "close",
+	  (PyCFunction) pyfsclfs_store_close,
+	  METH_NOARGS,
+	  "close() -> None\n"
+	  "\n"
+	  "Closes a store." },
+
+	/* Functions to access the containers */
+
+	{ "get_number_of_containers",
+	  (PyCFunction) pyfsclfs_store_get_number_of_containers,
+	  METH_NOARGS,
+	  "get_number_of_containers() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of containers." },
+
+	{ "get_container",
+	  (PyCFunction) pyfsclfs_store_get_container,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_container(container_index) -> Object\n"
+	  "\n"
+	  "Retrieves the container specified by the index." },
+
+	/* Functions to access the streams */
+
+	{ "get_number_of_streams",
+	  (PyCFunction) pyfsclfs_store_get_number_of_streams,
+	  METH_NOARGS,
+	  "get_number_of_streams() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of streams." },
+
+	{ "get_stream",
+	  (PyCFunction) pyfsclfs_store_get_stream,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_stream(stream_index) -> Object\n"
+	  "\n"
+	  "Retrieves the stream specified by the index." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyfsclfs_store_object_get_set_definitions[] = {
+
+	{ "number_of_containers",
+	  (getter) pyfsclfs_store_get_number_of_containers,
+	  (setter) 0,
+	  "The number of containers.",
+	  NULL },
+
+	{ "containers",
+	  (getter) pyfsclfs_store_get_containers,
+	  (setter) 0,
+	  "The containers.",
+	  NULL },
+
+	{ "number_of_streams",
+	  (getter) pyfsclfs_store_get_number_of_streams,
+	  (setter) 0,
+	  "The number of streams.",
+	  NULL },
+
+	{ "streams",
+	  (getter) pyfsclfs_store_get_streams,
+	  (setter) 0,
+	  "The streams.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyfsclfs_store_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsclfs.store",
+	/* tp_basicsize */
+	sizeof( pyfsclfs_store_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsclfs_store_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsclfs store object (wraps libfsclfs_store_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfsclfs_store_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyfsclfs_store_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsclfs_store_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0,
+	/* tp_version_tag */
+	0
+};
+
+/* Creates a new store object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_new(
+           void )
+{
+	pyfsclfs_store_t *pyfsclfs_store = NULL;
+	static char *function            = "pyfsclfs_store_new";
+
+	pyfsclfs_store = PyObject_New(
+	                  struct pyfsclfs_store,
+	                  &pyfsclfs_store_type_object );
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize store.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsclfs_store_init(
+	     pyfsclfs_store ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize store.",
+		 function );
+
+		goto on_error;
+	}
+	return( (PyObject *) pyfsclfs_store );
+
+on_error:
+	if( pyfsclfs_store != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_store );
+	}
+	return( NULL );
+}
+
+/* Creates a new store object and opens it
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_new_open(
+           PyObject *self PYFSCLFS_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *pyfsclfs_store = NULL;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( self )
+
+	pyfsclfs_store = pyfsclfs_store_new();
+
+	if( pyfsclfs_store == NULL )
+	{
+		return( NULL );
+	}
+	if( pyfsclfs_store_open(
+	     (pyfsclfs_store_t *) pyfsclfs_store,
+	     arguments,
+	     keywords ) == NULL )
+	{
+		Py_DecRef(
+		 pyfsclfs_store );
+
+		return( NULL );
+	}
+	return( pyfsclfs_store );
+}
+
+/* Initializes a store object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsclfs_store_init(
+     pyfsclfs_store_t *pyfsclfs_store )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_store_init";
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libfsclfs store is set to NULL
+	 */
+	pyfsclfs_store->store = NULL;
+	pyfsclfs_store->lock  = NULL;
+
+	if( libfsclfs_store_initialize(
+	     &( pyfsclfs_store->store ),
+	     &error ) != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to initialize store.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	pyfsclfs_store->lock = PyThread_allocate_lock();
+
+	if( pyfsclfs_store->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize lock.",
+		 function );
+
+		libfsclfs_store_free(
+		 &( pyfsclfs_store->store ),
+		 NULL );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Frees a store object
+ */
+void pyfsclfs_store_free(
+      pyfsclfs_store_t *pyfsclfs_store )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsclfs_store_free";
+	int result                  = 0;
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsclfs_store );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsclfs_store->store != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsclfs_store_free(
+		          &( pyfsclfs_store->store ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsclfs_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libfsclfs store.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyfsclfs_store->lock != NULL )
+	{
+		PyThread_free_lock(
+		 pyfsclfs_store->lock );
+
+		pyfsclfs_store->lock = NULL;
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsclfs_store );
+}
+
+/* Signals the store to abort the current activity
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_signal_abort(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_store_signal_abort";
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	/* The store lock is not taken so an activity of another thread can be aborted
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsclfs_store_signal_abort(
+	          pyfsclfs_store->store,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to signal abort.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Opens a store
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_open(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object      = NULL;
+	PyObject *utf8_string_object = NULL;
+	libcerror_error_t *error     = NULL;
+	const char *filename_narrow  = NULL;
+	static char *function        = "pyfsclfs_store_open";
+	static char *keyword_list[]  = { "filename", "mode", NULL };
+	char *mode                   = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wchar_t *filename_wide       = NULL;
+#endif
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|s",
+	     keyword_list,
+	     &string_object,
+	     &mode ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( mode != NULL )
+	 && ( mode[ 0 ] != 'r' ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported mode: %s.",
+		 function,
+		 mode );
+
+		return( NULL );
+	}
+	if( PyUnicode_Check(
+	     string_object ) != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		filename_wide = (wchar_t *) PyUnicode_AsWideCharString(
+		                             string_object,
+		                             NULL );
+
+		if( filename_wide == NULL )
+		{
+			return( NULL );
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyfsclfs_store->lock,
+		 WAIT_LOCK );
+
+		result = libfsclfs_store_open_wide(
+		          pyfsclfs_store->store,
+		          filename_wide,
+		          LIBFSCLFS_OPEN_READ,
+		          &error );
+
+		PyThread_release_lock(
+		 pyfsclfs_store->lock );
+
+		Py_END_ALLOW_THREADS
+
+		PyMem_Free(
+		 filename_wide );
+#else
+		utf8_string_object = PyUnicode_AsUTF8String(
+		                      string_object );
+
+		if( utf8_string_object == NULL )
+		{
+			return( NULL );
+		}
+		filename_narrow = PyBytes_AsString(
+		                   utf8_string_object );
+
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyfsclfs_store->lock,
+		 WAIT_LOCK );
+
+		result = libfsclfs_store_open(
+		          pyfsclfs_store->store,
+		          filename_narrow,
+		          LIBFSCLFS_OPEN_READ,
+		          &error );
+
+		PyThread_release_lock(
+		 pyfsclfs_store->lock );
+
+		Py_END_ALLOW_THREADS
+
+		Py_DecRef(
+		 utf8_string_object );
+#endif
+	}
+	else if( PyBytes_Check(
+	          string_object ) != 0 )
+	{
+		filename_narrow = PyBytes_AsString(
+		                   string_object );
+
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyfsclfs_store->lock,
+		 WAIT_LOCK );
+
+		result = libfsclfs_store_open(
+		          pyfsclfs_store->store,
+		          filename_narrow,
+		          LIBFSCLFS_OPEN_READ,
+		          &error );
+
+		PyThread_release_lock(
+		 pyfsclfs_store->lock );
+
+		Py_END_ALLOW_THREADS
+	}
+	else
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported string object type.",
+		 function );
+
+		return( NULL );
+	}
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open store.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_store->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_open_containers(
+	          pyfsclfs_store->store,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_store->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open containers.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyfsclfs_store->lock,
+		 WAIT_LOCK );
+
+		libfsclfs_store_close(
+		 pyfsclfs_store->store,
+		 NULL );
+
+		PyThread_release_lock(
+		 pyfsclfs_store->lock );
+
+		Py_END_ALLOW_THREADS
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Closes a store
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_close(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_store_close";
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_store->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_close(
+	          pyfsclfs_store->store,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_store->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 0 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to close store.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the number of containers
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_number_of_containers(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_store_get_number_of_containers";
+	int number_of_containers = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_store->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_get_number_of_containers(
+	          pyfsclfs_store->store,
+	          &number_of_containers,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_store->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of containers.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromLong(
+	         (long) number_of_containers ) );
+}
+
+/* Retrieves a specific container by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_container_by_index(
+           PyObject *pyfsclfs_store,
+           int container_index )
+{
+	PyObject *container_object       = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsclfs_container_t *container = NULL;
+	static char *function            = "pyfsclfs_store_get_container_by_index";
+	int result                       = 0;
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 ( (pyfsclfs_store_t *) pyfsclfs_store )->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_get_container(
+	          ( (pyfsclfs_store_t *) pyfsclfs_store )->store,
+	          container_index,
+	          &container,
+	          &error );
+
+	PyThread_release_lock(
+	 ( (pyfsclfs_store_t *) pyfsclfs_store )->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve container: %d.",
+		 function,
+		 container_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	container_object = pyfsclfs_container_new(
+	                    container,
+	                    pyfsclfs_store );
+
+	if( container_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create container object.",
+		 function );
+
+		goto on_error;
+	}
+	return( container_object );
+
+on_error:
+	if( container != NULL )
+	{
+		libfsclfs_container_free(
+		 &container,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific container
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_container(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *keyword_list[] = { "container_index", NULL };
+	int container_index         = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &container_index ) == 0 )
+	{
+		return( NULL );
+	}
+	return( pyfsclfs_store_get_container_by_index(
+	         (PyObject *) pyfsclfs_store,
+	         container_index ) );
+}
+
+/* Retrieves a sequence and iterator object for the containers
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_containers(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyfsclfs_store_get_containers";
+	int number_of_containers  = 0;
+	int result                = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_store->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_get_number_of_containers(
+	          pyfsclfs_store->store,
+	          &number_of_containers,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_store->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of containers.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyfsclfs_containers_new(
+	                   (PyObject *) pyfsclfs_store,
+	                   &pyfsclfs_store_get_container_by_index,
+	                   number_of_containers );
+
+	if( sequence_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
+
+/* Retrieves the number of streams
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_number_of_streams(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_store_get_number_of_streams";
+	int number_of_streams    = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_store->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_get_number_of_streams(
+	          pyfsclfs_store->store,
+	          &number_of_streams,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_store->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromLong(
+	         (long) number_of_streams ) );
+}
+
+/* Retrieves a specific stream by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_stream_by_index(
+           PyObject *pyfsclfs_store,
+           int stream_index )
+{
+	PyObject *stream_object    = NULL;
+	libcerror_error_t *error   = NULL;
+	libfsclfs_stream_t *stream = NULL;
+	static char *function      = "pyfsclfs_store_get_stream_by_index";
+	int result                 = 0;
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 ( (pyfsclfs_store_t *) pyfsclfs_store )->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_get_stream(
+	          ( (pyfsclfs_store_t *) pyfsclfs_store )->store,
+	          stream_index,
+	          &stream,
+	          &error );
+
+	PyThread_release_lock(
+	 ( (pyfsclfs_store_t *) pyfsclfs_store )->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve stream: %d.",
+		 function,
+		 stream_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	stream_object = pyfsclfs_stream_new(
+	                 stream,
+	                 pyfsclfs_store );
+
+	if( stream_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create stream object.",
+		 function );
+
+		goto on_error;
+	}
+	return( stream_object );
+
+on_error:
+	if( stream != NULL )
+	{
+		libfsclfs_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific stream
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_stream(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *keyword_list[] = { "stream_index", NULL };
+	int stream_index            = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &stream_index ) == 0 )
+	{
+		return( NULL );
+	}
+	return( pyfsclfs_store_get_stream_by_index(
+	         (PyObject *) pyfsclfs_store,
+	         stream_index ) );
+}
+
+/* Retrieves a sequence and iterator object for the streams
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_store_get_streams(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyfsclfs_store_get_streams";
+	int number_of_streams     = 0;
+	int result                = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_store->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_store_get_number_of_streams(
+	          pyfsclfs_store->store,
+	          &number_of_streams,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_store->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyfsclfs_streams_new(
+	                   (PyObject *) pyfsclfs_store,
+	                   &pyfsclfs_store_get_stream_by_index,
+	                   number_of_streams );
+
+	if( sequence_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
+
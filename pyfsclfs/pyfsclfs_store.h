@@ -0,0 +1,123 @@
+/*
+ * Python object wrapper of libfsclfs_store_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_STORE_H )
+#define _PYFSCLFS_STORE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_store pyfsclfs_store_t;
+
+struct pyfsclfs_store
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libfsclfs store
+	 */
+	libfsclfs_store_t *store;
+
+	/* The lock that serializes access to the store
+	 * the store, streams and containers are not thread-safe
+	 * while the GIL is released during I/O
+	 */
+	PyThread_type_lock lock;
+};
+
+extern PyMethodDef pyfsclfs_store_object_methods[];
+extern PyTypeObject pyfsclfs_store_type_object;
+
+PyObject *pyfsclfs_store_new(
+           void );
+
+PyObject *pyfsclfs_store_new_open(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyfsclfs_store_init(
+     pyfsclfs_store_t *pyfsclfs_store );
+
+void pyfsclfs_store_free(
+      pyfsclfs_store_t *pyfsclfs_store );
+
+PyObject *pyfsclfs_store_signal_abort(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_store_open(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsclfs_store_close(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_store_get_number_of_containers(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_store_get_container_by_index(
+           PyObject *pyfsclfs_store,
+           int container_index );
+
+PyObject *pyfsclfs_store_get_container(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsclfs_store_get_containers(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_store_get_number_of_streams(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_store_get_stream_by_index(
+           PyObject *pyfsclfs_store,
+           int stream_index );
+
+PyObject *pyfsclfs_store_get_stream(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsclfs_store_get_streams(
+           pyfsclfs_store_t *pyfsclfs_store,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_STORE_H ) */
+
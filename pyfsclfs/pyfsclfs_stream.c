@@ -0,0 +1,1264 @@
+/*
+ * Python object wrapper of libfsclfs_stream_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsclfs_error.h"
+#include "pyfsclfs_integer.h"
+#include "pyfsclfs_libcerror.h"
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+#include "pyfsclfs_record.h"
+#include "pyfsclfs_records.h"
+#include "pyfsclfs_store.h"
+#include "pyfsclfs_stream.h"
+#include "pyfsclfs_unused.h"
+
+PyMethodDef pyfsclfs_stream_object_methods[] = {
+
+	{ "get_name",
+	  (PyCFunction) pyfsclfs_stream_get_name,
+	  METH_NOARGS,
+	  "get_name() -> Unicode string or None\n"
+	  "\n"
+	  "Retrieves the name." },
+
+	{ "get_base_lsn",
+	  (PyCFunction) pyfsclfs_stream_get_base_lsn,
+	  METH_NOARGS,
+	  "get_base_lsn() -> Integer\n"
+	  "\n"
+	  "Retrieves the base log sequence number (LSN)." },
+
+	{ "get_last_lsn",
+	  (PyCFunction) pyfsclfs_stream_get_last_lsn,
+	  METH_NOARGS,
+	  "get_last_lsn() -> Integer\n"
+	  "\n"
+	  "Retrieves the last log sequence number (LSN)." },
+
+	/* Functions to access the records */
+
+	{ "get_record_by_lsn",
+	  (PyCFunction) pyfsclfs_stream_get_record_by_lsn,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_by_lsn(record_lsn) -> Object or None\n"
+	  "\n"
+	  "Retrieves the record specified by the log sequence number (LSN)." },
+
+	{ "get_records",
+	  (PyCFunction) pyfsclfs_stream_get_records,
+	  METH_NOARGS,
+	  "get_records() -> Object\n"
+	  "\n"
+	  "Retrieves an iterator of the records, starting at the last record of the stream\n"
+	  "and following the previous log sequence numbers (LSNs)." },
+
+	{ "get_record_headers",
+	  (PyCFunction) pyfsclfs_stream_get_record_headers,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_headers(record_lsn) -> Dictionary or None\n"
+	  "\n"
+	  "Retrieves the record headers of the block that contains the record specified\n"
+	  "by the log sequence number (LSN) without reading the record data.\n"
+	  "The dictionary contains the block LSN and the record header values of all\n"
+	  "the records in the block as columns of packed arrays in native byte order:\n"
+	  "virtual_lsns, previous_lsns and undo_next_lsns (array type 'Q'), sizes and\n"
+	  "record_types (array type 'I') and flags (array type 'H')." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyfsclfs_stream_object_get_set_definitions[] = {
+
+	{ "name",
+	  (getter) pyfsclfs_stream_get_name,
+	  (setter) 0,
+	  "The name.",
+	  NULL },
+
+	{ "base_lsn",
+	  (getter) pyfsclfs_stream_get_base_lsn,
+	  (setter) 0,
+	  "The base log sequence number (LSN).",
+	  NULL },
+
+	{ "last_lsn",
+	  (getter) pyfsclfs_stream_get_last_lsn,
+	  (setter) 0,
+	  "The last log sequence number (LSN).",
+	  NULL },
+
+	{ "records",
+	  (getter) pyfsclfs_stream_get_records,
+	  (setter) 0,
+	  "The records.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyfsclfs_stream_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsclfs.stream",
+	/* tp_basicsize */
+	sizeof( pyfsclfs_stream_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsclfs_stream_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsclfs stream object (wraps libfsclfs_stream_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfsclfs_stream_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyfsclfs_stream_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsclfs_stream_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0,
+	/* tp_version_tag */
+	0
+};
+
+/* Creates a new stream object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_new(
+           libfsclfs_stream_t *stream,
+           PyObject *parent_object )
+{
+	pyfsclfs_stream_t *pyfsclfs_stream = NULL;
+	static char *function              = "pyfsclfs_stream_new";
+
+	if( stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsclfs_stream = PyObject_New(
+	                   struct pyfsclfs_stream,
+	                   &pyfsclfs_stream_type_object );
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsclfs_stream_init(
+	     pyfsclfs_stream ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsclfs_stream->stream        = stream;
+	pyfsclfs_stream->parent_object = parent_object;
+	pyfsclfs_stream->lock          = ( (pyfsclfs_store_t *) parent_object )->lock;
+
+	Py_IncRef(
+	 (PyObject *) pyfsclfs_stream->parent_object );
+
+	return( (PyObject *) pyfsclfs_stream );
+
+on_error:
+	if( pyfsclfs_stream != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_stream );
+	}
+	return( NULL );
+}
+
+/* Initializes a stream object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsclfs_stream_init(
+     pyfsclfs_stream_t *pyfsclfs_stream )
+{
+	static char *function = "pyfsclfs_stream_init";
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libfsclfs stream is set to NULL
+	 */
+	pyfsclfs_stream->stream        = NULL;
+	pyfsclfs_stream->parent_object = NULL;
+	pyfsclfs_stream->lock          = NULL;
+
+	return( 0 );
+}
+
+/* Frees a stream object
+ */
+void pyfsclfs_stream_free(
+      pyfsclfs_stream_t *pyfsclfs_stream )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsclfs_stream_free";
+	int result                  = 0;
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsclfs_stream );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsclfs_stream->stream != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsclfs_stream_free(
+		          &( pyfsclfs_stream->stream ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsclfs_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libfsclfs stream.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyfsclfs_stream->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsclfs_stream->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsclfs_stream );
+}
+
+/* Retrieves the name
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_get_name(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	const char *errors       = NULL;
+	uint8_t *utf8_string     = NULL;
+	static char *function    = "pyfsclfs_stream_get_name";
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_stream->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_stream_get_utf8_name_size(
+	          pyfsclfs_stream->stream,
+	          &utf8_string_size,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_stream->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	utf8_string = (uint8_t *) PyMem_Malloc(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_stream->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_stream_get_utf8_name(
+	          pyfsclfs_stream->stream,
+	          utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_stream->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 errors );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	return( string_object );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( NULL );
+}
+
+/* Retrieves the base log sequence number (LSN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_get_base_lsn(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_stream_get_base_lsn";
+	uint64_t base_lsn        = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_stream->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_stream_get_base_lsn(
+	          pyfsclfs_stream->stream,
+	          &base_lsn,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_stream->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve base LSN.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsclfs_integer_unsigned_new_from_64bit(
+	                  base_lsn );
+
+	return( integer_object );
+}
+
+/* Retrieves the last log sequence number (LSN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_get_last_lsn(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsclfs_stream_get_last_lsn";
+	uint64_t last_lsn        = 0;
+	int result               = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_stream->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_stream_get_last_lsn(
+	          pyfsclfs_stream->stream,
+	          &last_lsn,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_stream->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve last LSN.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsclfs_integer_unsigned_new_from_64bit(
+	                  last_lsn );
+
+	return( integer_object );
+}
+
+/* Retrieves a specific record by its log sequence number (LSN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_get_record_by_lsn(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *record_object       = NULL;
+	libcerror_error_t *error      = NULL;
+	libfsclfs_record_t *record    = NULL;
+	static char *function         = "pyfsclfs_stream_get_record_by_lsn";
+	static char *keyword_list[]   = { "record_lsn", NULL };
+	unsigned long long record_lsn = 0;
+	int result                    = 0;
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &record_lsn ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_stream->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_stream_get_record_by_lsn(
+	          pyfsclfs_stream->stream,
+	          (uint64_t) record_lsn,
+	          &record,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_stream->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: 0x%08" PRIx64 ".",
+		 function,
+		 (uint64_t) record_lsn );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	record_object = pyfsclfs_record_new(
+	                 record,
+	                 (uint64_t) record_lsn,
+	                 (PyObject *) pyfsclfs_stream );
+
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record object.",
+		 function );
+
+		goto on_error;
+	}
+	return( record_object );
+
+on_error:
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves an iterator object for the records
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_get_records(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments PYFSCLFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *records_object             = NULL;
+	libcerror_error_t *error             = NULL;
+	libfsclfs_scan_cursor_t *scan_cursor = NULL;
+	static char *function                = "pyfsclfs_stream_get_records";
+	int result                           = 0;
+
+	PYFSCLFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyfsclfs_stream->lock,
+	 WAIT_LOCK );
+
+	result = libfsclfs_stream_get_scan_cursor(
+	          pyfsclfs_stream->stream,
+	          &scan_cursor,
+	          &error );
+
+	PyThread_release_lock(
+	 pyfsclfs_stream->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve scan cursor.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	records_object = pyfsclfs_records_new(
+	                  scan_cursor,
+	                  (PyObject *) pyfsclfs_stream,
+	                  pyfsclfs_stream->lock );
+
+	if( records_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create records object.",
+		 function );
+
+		goto on_error;
+	}
+	return( records_object );
+
+on_error:
+	if( scan_cursor != NULL )
+	{
+		libfsclfs_scan_cursor_free(
+		 &scan_cursor,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Creates a new array object of packed values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_new_array(
+           PyObject *array_type_object,
+           const char *type_code,
+           const void *data,
+           size_t data_size )
+{
+	PyObject *array_object = NULL;
+	PyObject *bytes_object = NULL;
+	static char *function  = "pyfsclfs_stream_new_array";
+
+	if( array_type_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid array type object.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data.",
+		 function );
+
+		return( NULL );
+	}
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	bytes_object = PyBytes_FromStringAndSize(
+	                (const char *) data,
+	                (Py_ssize_t) data_size );
+
+	if( bytes_object == NULL )
+	{
+		return( NULL );
+	}
+	array_object = PyObject_CallFunction(
+	                array_type_object,
+	                "sO",
+	                type_code,
+	                bytes_object );
+
+	Py_DecRef(
+	 bytes_object );
+
+	return( array_object );
+}
+
+/* Retrieves the record headers of the block that contains a specific record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsclfs_stream_get_record_headers(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *array_module                               = NULL;
+	PyObject *array_object                               = NULL;
+	PyObject *array_type_object                          = NULL;
+	PyObject *dictionary_object                          = NULL;
+	PyObject *integer_object                             = NULL;
+	libcerror_error_t *error                             = NULL;
+	libfsclfs_record_header_table_t *record_header_table = NULL;
+	const uint64_t *previous_lsns                        = NULL;
+	const uint64_t *undo_next_lsns                       = NULL;
+	const uint64_t *virtual_lsns                         = NULL;
+	const uint32_t *record_types                         = NULL;
+	const uint32_t *sizes                                = NULL;
+	const uint16_t *flags                                = NULL;
+	static char *function                                = "pyfsclfs_stream_get_record_headers";
+	static char *keyword_list[]                          = { "record_lsn", NULL };
+	unsigned long long record_lsn                        = 0;
+	uint64_t block_lsn                                   = 0;
+	size_t number_of_values                              = 0;
+	int number_of_records                                = 0;
+	int result                                           = 0;
+
+	if( pyfsclfs_stream == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid stream.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &record_lsn ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsclfs_record_header_table_initialize(
+	          &record_header_table,
+	          &error );
+
+	if( result == 1 )
+	{
+		PyThread_acquire_lock(
+		 pyfsclfs_stream->lock,
+		 WAIT_LOCK );
+
+		result = libfsclfs_stream_read_record_header_table(
+		          pyfsclfs_stream->stream,
+		          (uint64_t) record_lsn,
+		          record_header_table,
+		          &error );
+
+		PyThread_release_lock(
+		 pyfsclfs_stream->lock );
+	}
+	if( result == 1 )
+	{
+		if( libfsclfs_record_header_table_get_block_lsn(
+		     record_header_table,
+		     &block_lsn,
+		     &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_number_of_records(
+		          record_header_table,
+		          &number_of_records,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_virtual_lsns(
+		          record_header_table,
+		          &virtual_lsns,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_previous_lsns(
+		          record_header_table,
+		          &previous_lsns,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_undo_next_lsns(
+		          record_header_table,
+		          &undo_next_lsns,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_sizes(
+		          record_header_table,
+		          &sizes,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_record_types(
+		          record_header_table,
+		          &record_types,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( libfsclfs_record_header_table_get_flags(
+		          record_header_table,
+		          &flags,
+		          &error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsclfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read record header table of record: 0x%08" PRIx64 ".",
+		 function,
+		 (uint64_t) record_lsn );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libfsclfs_record_header_table_free(
+		 &record_header_table,
+		 NULL );
+
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	if( number_of_records < 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_values = (size_t) number_of_records;
+
+	array_module = PyImport_ImportModule(
+	                "array" );
+
+	if( array_module == NULL )
+	{
+		goto on_error;
+	}
+	array_type_object = PyObject_GetAttrString(
+	                     array_module,
+	                     "array" );
+
+	if( array_type_object == NULL )
+	{
+		goto on_error;
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		goto on_error;
+	}
+	integer_object = pyfsclfs_integer_unsigned_new_from_64bit(
+	                  block_lsn );
+
+	if( integer_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "block_lsn",
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 integer_object );
+
+	integer_object = NULL;
+
+	array_object = pyfsclfs_stream_new_array(
+	                array_type_object,
+	                "Q",
+	                (const void *) virtual_lsns,
+	                sizeof( uint64_t ) * number_of_values );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "virtual_lsns",
+	     array_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_object );
+
+	array_object = NULL;
+
+	array_object = pyfsclfs_stream_new_array(
+	                array_type_object,
+	                "Q",
+	                (const void *) previous_lsns,
+	                sizeof( uint64_t ) * number_of_values );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "previous_lsns",
+	     array_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_object );
+
+	array_object = NULL;
+
+	array_object = pyfsclfs_stream_new_array(
+	                array_type_object,
+	                "Q",
+	                (const void *) undo_next_lsns,
+	                sizeof( uint64_t ) * number_of_values );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "undo_next_lsns",
+	     array_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_object );
+
+	array_object = NULL;
+
+	array_object = pyfsclfs_stream_new_array(
+	                array_type_object,
+	                "I",
+	                (const void *) sizes,
+	                sizeof( uint32_t ) * number_of_values );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "sizes",
+	     array_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_object );
+
+	array_object = NULL;
+
+	array_object = pyfsclfs_stream_new_array(
+	                array_type_object,
+	                "I",
+	                (const void *) record_types,
+	                sizeof( uint32_t ) * number_of_values );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "record_types",
+	     array_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_object );
+
+	array_object = NULL;
+
+	array_object = pyfsclfs_stream_new_array(
+	                array_type_object,
+	                "H",
+	                (const void *) flags,
+	                sizeof( uint16_t ) * number_of_values );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "flags",
+	     array_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 array_object );
+
+	array_object = NULL;
+
+	Py_DecRef(
+	 array_type_object );
+
+	Py_DecRef(
+	 array_module );
+
+	libfsclfs_record_header_table_free(
+	 &record_header_table,
+	 NULL );
+
+	return( dictionary_object );
+
+on_error:
+	if( array_object != NULL )
+	{
+		Py_DecRef(
+		 array_object );
+	}
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	if( array_type_object != NULL )
+	{
+		Py_DecRef(
+		 array_type_object );
+	}
+	if( array_module != NULL )
+	{
+		Py_DecRef(
+		 array_module );
+	}
+	if( record_header_table != NULL )
+	{
+		libfsclfs_record_header_table_free(
+		 &record_header_table,
+		 NULL );
+	}
+	return( NULL );
+}
+
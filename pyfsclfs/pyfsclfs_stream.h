@@ -0,0 +1,106 @@
+/*
+ * Python object wrapper of libfsclfs_stream_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_STREAM_H )
+#define _PYFSCLFS_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_libfsclfs.h"
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_stream pyfsclfs_stream_t;
+
+struct pyfsclfs_stream
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libfsclfs stream
+	 */
+	libfsclfs_stream_t *stream;
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The lock of the store
+	 */
+	PyThread_type_lock lock;
+};
+
+extern PyMethodDef pyfsclfs_stream_object_methods[];
+extern PyTypeObject pyfsclfs_stream_type_object;
+
+PyObject *pyfsclfs_stream_new(
+           libfsclfs_stream_t *stream,
+           PyObject *parent_object );
+
+int pyfsclfs_stream_init(
+     pyfsclfs_stream_t *pyfsclfs_stream );
+
+void pyfsclfs_stream_free(
+      pyfsclfs_stream_t *pyfsclfs_stream );
+
+PyObject *pyfsclfs_stream_get_name(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_stream_get_base_lsn(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_stream_get_last_lsn(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_stream_get_record_by_lsn(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsclfs_stream_get_records(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments );
+
+PyObject *pyfsclfs_stream_new_array(
+           PyObject *array_type_object,
+           const char *type_code,
+           const void *data,
+           size_t data_size );
+
+PyObject *pyfsclfs_stream_get_record_headers(
+           pyfsclfs_stream_t *pyfsclfs_stream,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_STREAM_H ) */
+
@@ -0,0 +1,94 @@
+/*
+ * Python object definition of the sequence and iterator object of streams
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSCLFS_STREAMS_H )
+#define _PYFSCLFS_STREAMS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsclfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsclfs_streams pyfsclfs_streams_t;
+
+struct pyfsclfs_streams
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The get item by index callback function
+	 */
+	PyObject* (*get_item_by_index)(
+	             PyObject *parent_object,
+	             int index );
+
+	/* The current index
+	 */
+	int current_index;
+
+	/* The number of items
+	 */
+	int number_of_items;
+};
+
+extern PyTypeObject pyfsclfs_streams_type_object;
+
+PyObject *pyfsclfs_streams_new(
+           PyObject *parent_object,
+           PyObject* (*get_item_by_index)(
+                        PyObject *parent_object,
+                        int index ),
+           int number_of_items );
+
+int pyfsclfs_streams_init(
+     pyfsclfs_streams_t *sequence_object );
+
+void pyfsclfs_streams_free(
+      pyfsclfs_streams_t *sequence_object );
+
+Py_ssize_t pyfsclfs_streams_len(
+            pyfsclfs_streams_t *sequence_object );
+
+PyObject *pyfsclfs_streams_getitem(
+           pyfsclfs_streams_t *sequence_object,
+           Py_ssize_t item_index );
+
+PyObject *pyfsclfs_streams_iter(
+           pyfsclfs_streams_t *sequence_object );
+
+PyObject *pyfsclfs_streams_iternext(
+           pyfsclfs_streams_t *sequence_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSCLFS_STREAMS_H ) */
+
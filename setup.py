@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# Script to build and install Python-bindings.
+# Version: 20240622
+
+import glob
+import os
+import sys
+
+from setuptools import Extension
+from setuptools import setup
+from setuptools.command.build_ext import build_ext
+
+
+class custom_build_ext(build_ext):
+  """Custom handler for the build_ext command."""
+
+  def run(self):
+    """Runs the build extension."""
+    if not os.path.exists(os.path.join('common', 'config.h')):
+      raise RuntimeError(
+          'Missing common/config.h, run ./configure before building the '
+          'Python bindings with setup.py.')
+
+    build_ext.run(self)
+
+
+class ProjectInformation(object):
+  """Project information."""
+
+  def __init__(self):
+    """Initializes project information."""
+    super(ProjectInformation, self).__init__()
+    self.library_names = []
+    self.module_name = 'pyfsclfs'
+
+    self._ReadLibraryNames()
+
+  def _ReadLibraryNames(self):
+    """Determines the names of the local libraries from the source tree."""
+    for directory_name in sorted(glob.glob('lib*')):
+      if not os.path.isdir(directory_name):
+        continue
+
+      source_files = glob.glob(os.path.join(directory_name, '*.c'))
+      if source_files:
+        self.library_names.append(directory_name)
+
+
+project_information = ProjectInformation()
+
+define_macros = [('HAVE_CONFIG_H', '1')]
+if sys.platform == 'win32':
+  define_macros.append(('WINVER', '0x0501'))
+
+include_directories = ['include', 'common']
+source_files = []
+
+for library_name in project_information.library_names:
+  include_directories.append(library_name)
+
+  define_macros.append(
+      ('HAVE_LOCAL_{0:s}'.format(library_name.upper()), '1'))
+
+  for source_file in sorted(glob.glob(os.path.join(library_name, '*.c'))):
+    source_files.append(source_file)
+
+source_files.extend(sorted(glob.glob(
+    os.path.join(project_information.module_name, '*.c'))))
+
+setup(
+    cmdclass={'build_ext': custom_build_ext},
+    ext_modules=[
+        Extension(
+            project_information.module_name,
+            define_macros=define_macros,
+            include_dirs=include_directories,
+            libraries=[],
+            library_dirs=[],
+            sources=source_files)])
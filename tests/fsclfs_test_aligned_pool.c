@@ -0,0 +1,416 @@
+/*
+ * Library aligned_pool type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_aligned_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_aligned_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_aligned_pool_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfsclfs_aligned_pool_t *aligned_pool = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_aligned_pool_initialize(
+	          &aligned_pool,
+	          8192,
+	          LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "aligned_pool",
+	 aligned_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_aligned_pool_free(
+	          &aligned_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "aligned_pool",
+	 aligned_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_aligned_pool_initialize(
+	          NULL,
+	          8192,
+	          LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an alignment that is not a power of 2
+	 */
+	result = libfsclfs_aligned_pool_initialize(
+	          &aligned_pool,
+	          8192,
+	          3000,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "aligned_pool",
+	 aligned_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a buffer size that is not a multiple of the alignment
+	 */
+	result = libfsclfs_aligned_pool_initialize(
+	          &aligned_pool,
+	          5000,
+	          LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "aligned_pool",
+	 aligned_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( aligned_pool != NULL )
+	{
+		libfsclfs_aligned_pool_free(
+		 &aligned_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_aligned_pool_get_buffer and libfsclfs_aligned_pool_release_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_aligned_pool_get_buffer(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsclfs_aligned_buffer_t *aligned_buffer  = NULL;
+	libfsclfs_aligned_buffer_t *released_buffer = NULL;
+	libfsclfs_aligned_pool_t *aligned_pool      = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_aligned_pool_initialize(
+	          &aligned_pool,
+	          8192,
+	          LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "aligned_pool",
+	 aligned_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_aligned_pool_get_buffer(
+	          aligned_pool,
+	          &aligned_buffer,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "aligned_buffer",
+	 aligned_buffer );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "aligned_buffer->data alignment",
+	 (size_t) ( (intptr_t) aligned_buffer->data % LIBFSCLFS_ALIGNED_POOL_DEFAULT_ALIGNMENT ),
+	 (size_t) 0 );
+
+	released_buffer = aligned_buffer;
+
+	result = libfsclfs_aligned_pool_release_buffer(
+	          aligned_pool,
+	          &aligned_buffer,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "aligned_buffer",
+	 aligned_buffer );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a released buffer is reused
+	 */
+	result = libfsclfs_aligned_pool_get_buffer(
+	          aligned_pool,
+	          &aligned_buffer,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "aligned_buffer",
+	 (int) ( aligned_buffer == released_buffer ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_aligned_pool_release_buffer(
+	          aligned_pool,
+	          &aligned_buffer,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_aligned_pool_get_buffer(
+	          NULL,
+	          &aligned_buffer,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_aligned_pool_get_buffer(
+	          aligned_pool,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_aligned_pool_release_buffer(
+	          aligned_pool,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_aligned_pool_free(
+	          &aligned_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "aligned_pool",
+	 aligned_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( aligned_buffer != NULL )
+	{
+		libfsclfs_aligned_buffer_free(
+		 &aligned_buffer,
+		 NULL );
+	}
+	if( aligned_pool != NULL )
+	{
+		libfsclfs_aligned_pool_free(
+		 &aligned_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_aligned_pool_initialize",
+	 fsclfs_test_aligned_pool_initialize );
+
+	/* TODO: add tests for libfsclfs_aligned_pool_free */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_aligned_pool_get_buffer",
+	 fsclfs_test_aligned_pool_get_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
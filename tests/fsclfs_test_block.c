@@ -34,6 +34,7 @@
 #include "fsclfs_test_unused.h"
 
 #include "../libfsclfs/libfsclfs_block.h"
+#include "../libfsclfs/libfsclfs_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
 
@@ -375,6 +376,523 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsclfs_block_probe_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_probe_data(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error         = NULL;
+	libfsclfs_block_t *block         = NULL;
+	libfsclfs_io_handle_t *io_handle = NULL;
+	size_t data_offset               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		data[ data_offset ] = 0;
+	}
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_block_initialize(
+	          &block,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block",
+	 block );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not contain a block
+	 */
+	result = libfsclfs_block_probe_data(
+	          block,
+	          io_handle,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block of 1 sector with fix-up values offset 0x1f0
+	 */
+	data[ 0 ]   = 0x15;
+	data[ 4 ]   = 0x01;
+	data[ 6 ]   = 0x01;
+	data[ 104 ] = 0xf0;
+	data[ 105 ] = 0x01;
+	data[ 510 ] = 0x60;
+
+	result = libfsclfs_block_probe_data(
+	          block,
+	          io_handle,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "block->size",
+	 block->size,
+	 512 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block with an invalid fix-up value
+	 */
+	data[ 510 ] = 0x00;
+
+	result = libfsclfs_block_probe_data(
+	          block,
+	          io_handle,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that is too small to contain the block
+	 */
+	data[ 510 ] = 0x60;
+
+	result = libfsclfs_block_probe_data(
+	          block,
+	          io_handle,
+	          data,
+	          256,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_block_probe_data(
+	          NULL,
+	          io_handle,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_probe_data(
+	          block,
+	          NULL,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The read variant reports invalid data as an error
+	 */
+	result = libfsclfs_block_read_data(
+	          block,
+	          io_handle,
+	          data,
+	          256,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_block_free(
+	          &block,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block != NULL )
+	{
+		libfsclfs_block_free(
+		 &block,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_block_scan_signatures function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_scan_signatures(
+     void )
+{
+	uint8_t data[ 2048 ];
+	uint32_t candidate_offsets[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	libfsclfs_io_handle_t *io_handle = NULL;
+	size_t data_offset               = 0;
+	int number_of_candidates         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		data[ data_offset ] = 0;
+	}
+	/* A block of 2 sectors at offset 512
+	 */
+	data[ 512 ] = 0x15;
+	data[ 516 ] = 0x02;
+	data[ 518 ] = 0x02;
+
+	/* A block signature with a mismatching copy of the number of sectors at offset 1024
+	 */
+	data[ 1024 ] = 0x15;
+	data[ 1028 ] = 0x02;
+	data[ 1030 ] = 0x03;
+
+	/* A block of 1 sector at offset 1536
+	 */
+	data[ 1536 ] = 0x15;
+	data[ 1540 ] = 0x01;
+	data[ 1542 ] = 0x01;
+
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_block_scan_signatures(
+	          io_handle,
+	          data,
+	          2048,
+	          candidate_offsets,
+	          4,
+	          &number_of_candidates,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_candidates",
+	 number_of_candidates,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "candidate_offsets[ 0 ]",
+	 candidate_offsets[ 0 ],
+	 (uint32_t) 512 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "candidate_offsets[ 1 ]",
+	 candidate_offsets[ 1 ],
+	 (uint32_t) 1536 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data that is too small to contain a block header
+	 */
+	result = libfsclfs_block_scan_signatures(
+	          io_handle,
+	          &( data[ 512 ] ),
+	          8,
+	          candidate_offsets,
+	          4,
+	          &number_of_candidates,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_candidates",
+	 number_of_candidates,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_block_scan_signatures(
+	          NULL,
+	          data,
+	          2048,
+	          candidate_offsets,
+	          4,
+	          &number_of_candidates,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scan_signatures(
+	          io_handle,
+	          NULL,
+	          2048,
+	          candidate_offsets,
+	          4,
+	          &number_of_candidates,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scan_signatures(
+	          io_handle,
+	          data,
+	          2048,
+	          NULL,
+	          4,
+	          &number_of_candidates,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scan_signatures(
+	          io_handle,
+	          data,
+	          2048,
+	          candidate_offsets,
+	          1,
+	          &number_of_candidates,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scan_signatures(
+	          io_handle,
+	          data,
+	          2048,
+	          candidate_offsets,
+	          4,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 /* The main program
@@ -406,12 +924,20 @@ int main(
 	 "libfsclfs_block_read",
 	 fsclfs_test_block_read );
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_block_probe_data",
+	 fsclfs_test_block_probe_data );
+
 	/* TODO: add tests for libfsclfs_block_get_record_data */
 
 	/* TODO: add tests for libfsclfs_block_get_sector_mapping_array_data */
 
 	/* TODO: add tests for libfsclfs_block_get_virtual_log_range_array_data */
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_block_scan_signatures",
+	 fsclfs_test_block_scan_signatures );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
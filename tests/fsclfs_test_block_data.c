@@ -0,0 +1,168 @@
+/*
+ * Block data functions for testing
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "fsclfs_test_block_data.h"
+
+/* Start of a block of 1 sector that contains 2 records, the records are stored
+ * in descending virtual LSN order
+ */
+uint8_t fsclfs_test_block_data[ 208 ] = {
+	0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18 };
+
+/* Owner page of a region of 16 sectors, which maps 2 blocks of stream 1
+ * and a block of stream 2
+ */
+uint8_t fsclfs_test_owner_page_data[ 192 ] = {
+	0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Sets the data of a block of 1 sector
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_set_block_data(
+     uint8_t *data,
+     size_t data_size,
+     uint8_t stream_number )
+{
+	if( ( data == NULL )
+	 || ( data_size < 512 ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     512 ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     data,
+	     fsclfs_test_block_data,
+	     208 ) == NULL )
+	{
+		return( 0 );
+	}
+	data[ 3 ] = stream_number;
+
+	/* The fix-up of the first and last sector
+	 */
+	data[ 510 ] = 0x60;
+
+	return( 1 );
+}
+
+/* Sets the data of a region of 16 sectors with the owner page in the last sector
+ * The region contains the blocks of stream 1 at virtual LSN 0x10000 and 0x10200
+ * followed by the block of stream 2 at virtual LSN 0x30000
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_set_region_data(
+     uint8_t *data,
+     size_t data_size )
+{
+	uint64_t virtual_lsns[ 3 ] = {
+		0x00010000ULL, 0x00010200ULL, 0x00030000ULL };
+
+	uint8_t stream_numbers[ 3 ] = {
+		1, 1, 2 };
+
+	size_t block_offset = 0;
+	int block_index     = 0;
+
+	if( ( data == NULL )
+	 || ( data_size < 8192 ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     8192 ) == NULL )
+	{
+		return( 0 );
+	}
+	for( block_index = 0;
+	     block_index < 3;
+	     block_index++ )
+	{
+		block_offset = (size_t) block_index * 512;
+
+		if( fsclfs_test_set_block_data(
+		     &( data[ block_offset ] ),
+		     data_size - block_offset,
+		     stream_numbers[ block_index ] ) != 1 )
+		{
+			return( 0 );
+		}
+		/* The physical LSN of the block
+		 */
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ block_offset + 24 ] ),
+		 (uint64_t) block_offset );
+
+		/* The virtual LSN of the first record
+		 */
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ block_offset + 0x70 ] ),
+		 virtual_lsns[ block_index ] );
+	}
+	if( memory_copy(
+	     &( data[ 7680 ] ),
+	     fsclfs_test_owner_page_data,
+	     192 ) == NULL )
+	{
+		return( 0 );
+	}
+	/* The fix-up of the first and last sector
+	 */
+	data[ 8190 ] = 0x60;
+
+	return( 1 );
+}
+
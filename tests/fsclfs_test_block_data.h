@@ -0,0 +1,46 @@
+/*
+ * Block data functions for testing
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSCLFS_TEST_BLOCK_DATA_H )
+#define _FSCLFS_TEST_BLOCK_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int fsclfs_test_set_block_data(
+     uint8_t *data,
+     size_t data_size,
+     uint8_t stream_number );
+
+int fsclfs_test_set_region_data(
+     uint8_t *data,
+     size_t data_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSCLFS_TEST_BLOCK_DATA_H ) */
+
@@ -0,0 +1,1181 @@
+/*
+ * Library block_scanner type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_block_data.h"
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_block.h"
+#include "../libfsclfs/libfsclfs_block_scanner.h"
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_record_header_table.h"
+
+/* Container data of 2 blocks
+ */
+uint8_t fsclfs_test_block_scanner_data[ 1024 ];
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* The used sizes of the scanned blocks, indexed by block
+ */
+uint32_t fsclfs_test_block_scanner_used_sizes[ 2 ];
+
+/* Sets up the container data of the test
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_scanner_set_data(
+     void )
+{
+	size_t block_offset = 0;
+
+	if( memory_set(
+	     fsclfs_test_block_scanner_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		return( 0 );
+	}
+	for( block_offset = 0;
+	     block_offset < 1024;
+	     block_offset += 512 )
+	{
+		if( fsclfs_test_set_block_data(
+		     &( fsclfs_test_block_scanner_data[ block_offset ] ),
+		     1024 - block_offset,
+		     (uint8_t) ( block_offset / 512 ) ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* The block scanner callback of the test
+ * Returns 1 if successful or -1 on error
+ */
+int fsclfs_test_block_scanner_callback(
+     int worker_index FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     int container_index,
+     int stream_number,
+     uint32_t block_offset,
+     uint32_t block_size,
+     uint32_t used_size,
+     libfsclfs_record_header_table_t *record_header_table,
+     void *callback_data )
+{
+	uint32_t *used_sizes = NULL;
+
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( worker_index )
+
+	if( ( container_index != 0 )
+	 || ( record_header_table == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( block_offset >= 1024 )
+	 || ( block_size != 512 )
+	 || ( stream_number != (int) ( block_offset / 512 ) ) )
+	{
+		return( -1 );
+	}
+	used_sizes = (uint32_t *) callback_data;
+
+	used_sizes[ block_offset / 512 ] = used_size;
+
+	return( 1 );
+}
+
+/* Tests the libfsclfs_block_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_scanner_initialize(
+     void )
+{
+	libbfio_pool_t *file_io_pool             = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfsclfs_block_scanner_t *block_scanner = NULL;
+	libfsclfs_io_handle_t *io_handle         = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          file_io_pool,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_scanner",
+	 block_scanner );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "block_scanner->number_of_blocks",
+	 block_scanner->number_of_blocks,
+	 0 );
+
+	result = libfsclfs_block_scanner_free(
+	          &block_scanner,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "block_scanner",
+	 block_scanner );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_block_scanner_initialize(
+	          NULL,
+	          io_handle,
+	          file_io_pool,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_scanner = (libfsclfs_block_scanner_t *) 0x12345678UL;
+
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          file_io_pool,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	block_scanner = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          NULL,
+	          file_io_pool,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          NULL,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          file_io_pool,
+	          -1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          file_io_pool,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_block_scanner_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_block_scanner_initialize(
+		          &block_scanner,
+		          io_handle,
+		          file_io_pool,
+		          1,
+		          &fsclfs_test_block_scanner_callback,
+		          NULL,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( block_scanner != NULL )
+			{
+				libfsclfs_block_scanner_free(
+				 &block_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "block_scanner",
+			 block_scanner );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_block_scanner_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_block_scanner_initialize(
+		          &block_scanner,
+		          io_handle,
+		          file_io_pool,
+		          1,
+		          &fsclfs_test_block_scanner_callback,
+		          NULL,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( block_scanner != NULL )
+			{
+				libfsclfs_block_scanner_free(
+				 &block_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "block_scanner",
+			 block_scanner );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_scanner != NULL )
+	{
+		libfsclfs_block_scanner_free(
+		 &block_scanner,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_block_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_block_scanner_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_block_scanner_append_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_scanner_append_block(
+     void )
+{
+	libbfio_pool_t *file_io_pool             = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfsclfs_block_scanner_t *block_scanner = NULL;
+	libfsclfs_io_handle_t *io_handle         = NULL;
+	int block_index                          = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          file_io_pool,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( block_index = 0;
+	     block_index < 300;
+	     block_index++ )
+	{
+		result = libfsclfs_block_scanner_append_block(
+		          block_scanner,
+		          0,
+		          0,
+		          0,
+		          (uint32_t) block_index * 512,
+		          512,
+		          (uint64_t) block_index * 512,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "block_scanner->number_of_blocks",
+	 block_scanner->number_of_blocks,
+	 300 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "block_scanner->blocks[ 299 ].offset",
+	 block_scanner->blocks[ 299 ].offset,
+	 (uint32_t) ( 299 * 512 ) );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_block_scanner_append_block(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_append_block(
+	          block_scanner,
+	          -1,
+	          0,
+	          0,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_append_block(
+	          block_scanner,
+	          0,
+	          1,
+	          0,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_block_scanner_free(
+	          &block_scanner,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_scanner != NULL )
+	{
+		libfsclfs_block_scanner_free(
+		 &block_scanner,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_block_scanner_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_block_scanner_scan(
+     void )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libbfio_pool_t *file_io_pool             = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfsclfs_block_scanner_t *block_scanner = NULL;
+	libfsclfs_io_handle_t *io_handle         = NULL;
+	int number_of_threads                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_block_scanner_set_data();
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsclfs_test_block_scanner_data,
+	          1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          1,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_handle(
+	          file_io_pool,
+	          0,
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO handle is now managed by the pool
+	 */
+	file_io_handle = NULL;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads *= 4 )
+	{
+		fsclfs_test_block_scanner_used_sizes[ 0 ] = 0;
+		fsclfs_test_block_scanner_used_sizes[ 1 ] = 0;
+
+		result = libfsclfs_block_scanner_initialize(
+		          &block_scanner,
+		          io_handle,
+		          file_io_pool,
+		          1,
+		          &fsclfs_test_block_scanner_callback,
+		          (void *) fsclfs_test_block_scanner_used_sizes,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_block_scanner_append_block(
+		          block_scanner,
+		          0,
+		          0,
+		          0,
+		          0,
+		          512,
+		          0x00001000UL,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_block_scanner_append_block(
+		          block_scanner,
+		          0,
+		          0,
+		          1,
+		          512,
+		          512,
+		          0x00001000UL,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_block_scanner_scan(
+		          block_scanner,
+		          number_of_threads,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+		 "fsclfs_test_block_scanner_used_sizes[ 0 ]",
+		 fsclfs_test_block_scanner_used_sizes[ 0 ],
+		 (uint32_t) 208 );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+		 "fsclfs_test_block_scanner_used_sizes[ 1 ]",
+		 fsclfs_test_block_scanner_used_sizes[ 1 ],
+		 (uint32_t) 208 );
+
+		result = libfsclfs_block_scanner_free(
+		          &block_scanner,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsclfs_block_scanner_scan(
+	          NULL,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan with a block the callback rejects
+	 */
+	result = libfsclfs_block_scanner_initialize(
+	          &block_scanner,
+	          io_handle,
+	          file_io_pool,
+	          1,
+	          &fsclfs_test_block_scanner_callback,
+	          (void *) fsclfs_test_block_scanner_used_sizes,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_block_scanner_scan(
+	          block_scanner,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_block_scanner_append_block(
+	          block_scanner,
+	          0,
+	          0,
+	          1,
+	          0,
+	          512,
+	          0x00001000UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_block_scanner_scan(
+	          block_scanner,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_block_scanner_free(
+	          &block_scanner,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_scanner != NULL )
+	{
+		libfsclfs_block_scanner_free(
+		 &block_scanner,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_block_scanner_initialize",
+	 fsclfs_test_block_scanner_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_block_scanner_free",
+	 fsclfs_test_block_scanner_free );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_block_scanner_append_block",
+	 fsclfs_test_block_scanner_append_block );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_block_scanner_scan",
+	 fsclfs_test_block_scanner_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
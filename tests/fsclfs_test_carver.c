@@ -0,0 +1,929 @@
+/*
+ * Library carver type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_block_data.h"
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_carver.h"
+
+/* Tests the libfsclfs_carver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_carver_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsclfs_carver_t *carver      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_carver_initialize(
+	          &carver,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_free(
+	          &carver,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_carver_initialize(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carver = (libfsclfs_carver_t *) 0x12345678UL;
+
+	result = libfsclfs_carver_initialize(
+	          &carver,
+	          &error );
+
+	carver = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_carver_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libfsclfs_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_carver_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libfsclfs_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfsclfs_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_carver_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_carver_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_carver_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_carver_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_carver_read_block(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error                     = NULL;
+	libfsclfs_carver_t *carver                   = NULL;
+	libfsclfs_internal_carver_t *internal_carver = NULL;
+	int number_of_streams                        = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_carver_initialize(
+	          &carver,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_carver = (libfsclfs_internal_carver_t *) carver;
+
+	result = fsclfs_test_set_block_data(
+	          data,
+	          512,
+	          0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_carver_read_block(
+	          internal_carver,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_carver->number_of_blocks",
+	 internal_carver->number_of_blocks,
+	 (uint64_t) 1 );
+
+	result = libfsclfs_carver_get_number_of_streams(
+	          carver,
+	          &number_of_streams,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_streams",
+	 number_of_streams,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not contain a valid block
+	 */
+	data[ 6 ] = 0x02;
+
+	result = libfsclfs_carver_read_block(
+	          internal_carver,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_carver->number_of_blocks",
+	 internal_carver->number_of_blocks,
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_carver_read_block(
+	          NULL,
+	          data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_carver_free(
+	          &carver,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfsclfs_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_carver_carve_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_carver_carve_file_io_handle(
+     void )
+{
+	uint8_t data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsclfs_carver_t *carver       = NULL;
+	libfsclfs_record_t *record       = NULL;
+	uint64_t first_virtual_lsn       = 0;
+	uint64_t last_virtual_lsn        = 0;
+	uint64_t number_of_blocks        = 0;
+	uint64_t record_lsn              = 0;
+	size_t data_offset               = 0;
+	uint8_t stream_number            = 0;
+	int number_of_records            = 0;
+	int number_of_streams            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		data[ data_offset ] = 0;
+	}
+	/* A block of stream 2 at offset 512 and a block of stream 1 at offset 1536
+	 */
+	result = fsclfs_test_set_block_data(
+	          &( data[ 512 ] ),
+	          1536,
+	          2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fsclfs_test_set_block_data(
+	          &( data[ 1536 ] ),
+	          512,
+	          1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsclfs_carver_initialize(
+	          &carver,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          2048,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          0,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_get_number_of_blocks(
+	          carver,
+	          &number_of_blocks,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_get_number_of_streams(
+	          carver,
+	          &number_of_streams,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_streams",
+	 number_of_streams,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_get_stream_number(
+	          carver,
+	          0,
+	          &stream_number,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "stream_number",
+	 stream_number,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_get_stream_virtual_lsn_range(
+	          carver,
+	          0,
+	          &first_virtual_lsn,
+	          &last_virtual_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "first_virtual_lsn",
+	 first_virtual_lsn,
+	 (uint64_t) 0x1000 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "last_virtual_lsn",
+	 last_virtual_lsn,
+	 (uint64_t) 0x2000 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_get_number_of_records(
+	          carver,
+	          0,
+	          &number_of_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_get_record(
+	          carver,
+	          0,
+	          0,
+	          &record_lsn,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "record_lsn",
+	 record_lsn,
+	 (uint64_t) 0x1000 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_free(
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_carver_carve_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_carver_carve_file_io_handle(
+	          carver,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          -1,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_carver_carve_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          4096,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_carver_get_record(
+	          carver,
+	          0,
+	          2,
+	          &record_lsn,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_carver_get_record(
+	          carver,
+	          0,
+	          0,
+	          NULL,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_carver_free(
+	          &carver,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( carver != NULL )
+	{
+		libfsclfs_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_carver_initialize",
+	 fsclfs_test_carver_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_carver_free",
+	 fsclfs_test_carver_free );
+
+	/* TODO: add tests for libfsclfs_carver_signal_abort */
+
+	/* TODO: add tests for libfsclfs_carver_carve_file */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	/* TODO: add tests for libfsclfs_carver_carve_file_wide */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_carver_carve_file_io_handle",
+	 fsclfs_test_carver_carve_file_io_handle );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_carver_read_block",
+	 fsclfs_test_carver_read_block );
+
+	/* TODO: add tests for libfsclfs_carver_get_carved_stream_by_stream_number */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
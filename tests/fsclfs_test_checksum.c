@@ -0,0 +1,210 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_checksum.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_checksum_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_checksum_calculate_crc32(
+     void )
+{
+	uint8_t data[ 9 ] = {
+		'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_checksum_calculate_crc32(
+	          &checksum,
+	          data,
+	          9,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xcbf43926UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the checksum in parts
+	 */
+	result = libfsclfs_checksum_calculate_crc32(
+	          &checksum,
+	          data,
+	          4,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsclfs_checksum_calculate_crc32(
+	          &checksum,
+	          &( data[ 4 ] ),
+	          5,
+	          checksum,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0xcbf43926UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_checksum_calculate_crc32(
+	          NULL,
+	          data,
+	          9,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_checksum_calculate_crc32(
+	          &checksum,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_checksum_calculate_crc32(
+	          &checksum,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_checksum_calculate_crc32",
+	 fsclfs_test_checksum_calculate_crc32 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -398,6 +398,217 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsclfs_io_handle_set_geometry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_io_handle_set_geometry(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsclfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the standard geometry set by initialize
+	 */
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->bytes_per_sector_shift",
+	 io_handle->bytes_per_sector_shift,
+	 9 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->region_size_shift",
+	 io_handle->region_size_shift,
+	 19 );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          4096,
+	          1024 * 1024,
+	          1020 * 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->bytes_per_sector_shift",
+	 io_handle->bytes_per_sector_shift,
+	 12 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->region_size_shift",
+	 io_handle->region_size_shift,
+	 20 );
+
+	/* Test a geometry that is not a power of 2
+	 */
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          520,
+	          520 * 1000,
+	          520 * 992,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->bytes_per_sector_shift",
+	 io_handle->bytes_per_sector_shift,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->region_size_shift",
+	 io_handle->region_size_shift,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_io_handle_set_geometry(
+	          NULL,
+	          512,
+	          512 * 1024,
+	          ( 512 - 4 ) * 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          0,
+	          512 * 1024,
+	          ( 512 - 4 ) * 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          512,
+	          1000,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          512,
+	          512 * 1024,
+	          512 * 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +640,10 @@ int main(
 	 "libfsclfs_io_handle_clear",
 	 fsclfs_test_io_handle_clear );
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_io_handle_set_geometry",
+	 fsclfs_test_io_handle_set_geometry );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
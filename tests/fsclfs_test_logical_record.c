@@ -0,0 +1,695 @@
+/*
+ * Library logical_record type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_logical_record.h"
+#include "../libfsclfs/libfsclfs_record_value.h"
+
+/* Start fragment with LSN 0x200, previous LSN 0x100 and data "ABCD"
+ */
+uint8_t fsclfs_test_logical_record_start_fragment_data[ 48 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x42, 0x43, 0x44, 0x00, 0x00, 0x00, 0x00 };
+
+/* End fragment with LSN 0x201, previous LSN 0x200 and data "EFG"
+ */
+uint8_t fsclfs_test_logical_record_end_fragment_data[ 48 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x00, 0x09, 0x00, 0x00, 0x00, 0x45, 0x46, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_logical_record_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_logical_record_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_logical_record_t *logical_record = NULL;
+	int result                                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_logical_record_initialize(
+	          &logical_record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_record",
+	 logical_record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_free(
+	          &logical_record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "logical_record",
+	 logical_record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_logical_record_initialize(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	logical_record = (libfsclfs_logical_record_t *) 0x12345678UL;
+
+	result = libfsclfs_logical_record_initialize(
+	          &logical_record,
+	          &error );
+
+	logical_record = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_record != NULL )
+	{
+		libfsclfs_logical_record_free(
+		 &logical_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* Tests the libfsclfs_logical_record_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_logical_record_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_logical_record_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Reads a record value from fragment data
+ * Returns 1 if successful or -1 on error
+ */
+int fsclfs_test_logical_record_read_fragment(
+     libfsclfs_record_value_t **record_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libfsclfs_record_value_initialize(
+	     record_value,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsclfs_record_value_read_data(
+	     *record_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libfsclfs_record_value_free(
+		 record_value,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfsclfs_logical_record_prepend_fragment function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_logical_record_prepend_fragment(
+     void )
+{
+	uint8_t data[ 8 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_logical_record_t *logical_record = NULL;
+	libfsclfs_record_value_t *record_value     = NULL;
+	uint8_t *segment_data                      = NULL;
+	size_t data_size                           = 0;
+	size_t segment_data_size                   = 0;
+	uint64_t lsn                               = 0;
+	int number_of_segments                     = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_logical_record_initialize(
+	          &logical_record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_record",
+	 logical_record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the end fragment is added first
+	 */
+	result = fsclfs_test_logical_record_read_fragment(
+	          &record_value,
+	          fsclfs_test_logical_record_end_fragment_data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_prepend_fragment(
+	          (libfsclfs_internal_logical_record_t *) logical_record,
+	          0x00000201UL,
+	          record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_value = NULL;
+
+	result = fsclfs_test_logical_record_read_fragment(
+	          &record_value,
+	          fsclfs_test_logical_record_start_fragment_data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_prepend_fragment(
+	          (libfsclfs_internal_logical_record_t *) logical_record,
+	          0x00000200UL,
+	          record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_value = NULL;
+
+	result = libfsclfs_logical_record_get_lsn(
+	          logical_record,
+	          &lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "lsn",
+	 lsn,
+	 (uint64_t) 0x00000200UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_get_previous_lsn(
+	          logical_record,
+	          &lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "lsn",
+	 lsn,
+	 (uint64_t) 0x00000100UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_get_number_of_segments(
+	          logical_record,
+	          &number_of_segments,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_get_segment_by_index(
+	          logical_record,
+	          0,
+	          &segment_data,
+	          &segment_data_size,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_data_size",
+	 segment_data_size,
+	 (size_t) 4 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          "ABCD",
+	          4 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsclfs_logical_record_get_data_size(
+	          logical_record,
+	          &data_size,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 7 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_copy_data(
+	          logical_record,
+	          data,
+	          8,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "ABCDEFG",
+	          7 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_logical_record_prepend_fragment(
+	          NULL,
+	          0x00000200UL,
+	          record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_logical_record_prepend_fragment(
+	          (libfsclfs_internal_logical_record_t *) logical_record,
+	          0x00000200UL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data size exceeds the maximum
+	 * of 64 MiB defined by LIBFSCLFS_MAXIMUM_LOGICAL_RECORD_DATA_SIZE
+	 */
+	result = fsclfs_test_logical_record_read_fragment(
+	          &record_value,
+	          fsclfs_test_logical_record_start_fragment_data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libfsclfs_internal_logical_record_t *) logical_record )->data_size = ( 64 * 1024 * 1024 ) - 2;
+
+	result = libfsclfs_logical_record_prepend_fragment(
+	          (libfsclfs_internal_logical_record_t *) logical_record,
+	          0x00000100UL,
+	          record_value,
+	          &error );
+
+	( (libfsclfs_internal_logical_record_t *) logical_record )->data_size = 7;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_value_free(
+	          &record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_logical_record_get_segment_by_index(
+	          logical_record,
+	          2,
+	          &segment_data,
+	          &segment_data_size,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_logical_record_copy_data(
+	          logical_record,
+	          data,
+	          6,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_logical_record_copy_data(
+	          logical_record,
+	          NULL,
+	          8,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_logical_record_free(
+	          &logical_record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "logical_record",
+	 logical_record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	if( logical_record != NULL )
+	{
+		libfsclfs_logical_record_free(
+		 &logical_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_logical_record_initialize",
+	 fsclfs_test_logical_record_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_logical_record_free",
+	 fsclfs_test_logical_record_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_logical_record_prepend_fragment",
+	 fsclfs_test_logical_record_prepend_fragment );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -27,12 +27,17 @@
 #include <stdlib.h>
 #endif
 
+#include "fsclfs_test_block_data.h"
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
 #include "fsclfs_test_libcerror.h"
 #include "fsclfs_test_libfsclfs.h"
 #include "fsclfs_test_macros.h"
 #include "fsclfs_test_memory.h"
 #include "fsclfs_test_unused.h"
 
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_log_range.h"
 #include "../libfsclfs/libfsclfs_owner_page.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
@@ -377,6 +382,1166 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsclfs_owner_page_read_sector_mapping_array function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_owner_page_read_sector_mapping_array(
+     void )
+{
+	uint8_t sector_mapping_array_data[ 32 ] = {
+		0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff };
+
+	uint8_t virtual_log_range_array_data[ 48 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint8_t large_block_sector_mapping_array_data[ 600 ];
+
+	libcdata_array_t *virtual_log_ranges_array = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_io_handle_t *io_handle           = NULL;
+	libfsclfs_owner_page_t *owner_page         = NULL;
+	uint32_t physical_block_offset             = 0;
+	int number_of_entries                      = 0;
+	int result                                 = 0;
+	int sector_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          512,
+	          0x00002000UL,
+	          0x00001e00UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_initialize(
+	          &owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &virtual_log_ranges_array,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_read_virtual_log_range_array(
+	          owner_page,
+	          virtual_log_ranges_array,
+	          3,
+	          virtual_log_range_array_data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00001e00UL,
+	          sector_mapping_array_data,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          owner_page->virtual_log_ranges_array,
+	          &number_of_entries,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          0,
+	          0x00010000UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_block_offset",
+	 physical_block_offset,
+	 (uint32_t) 0x00000000UL );
+
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          0,
+	          0x00030000UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_block_offset",
+	 physical_block_offset,
+	 (uint32_t) 0x00000400UL );
+
+	/* The second block of stream 1 follows the first block in the virtual log
+	 */
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          0,
+	          0x00010400UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_block_offset",
+	 physical_block_offset,
+	 (uint32_t) 0x00000600UL );
+
+	/* Test a sector mapping array that does not start a block at sector number 0
+	 */
+	sector_mapping_array_data[ 1 ] = 0x01;
+
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00001e00UL,
+	          sector_mapping_array_data,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          owner_page->virtual_log_ranges_array,
+	          &number_of_entries,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	sector_mapping_array_data[ 1 ] = 0x00;
+
+	/* Test a sector mapping array that refers to an unsupported stream
+	 */
+	sector_mapping_array_data[ 4 ] = 0x03;
+
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00001e00UL,
+	          sector_mapping_array_data,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sector_mapping_array_data[ 4 ] = 0x02;
+
+	/* Test a sector mapping array with a block of more than 256 sectors
+	 * using sectors of 2 bytes
+	 */
+	for( sector_index = 0;
+	     sector_index < 300;
+	     sector_index++ )
+	{
+		large_block_sector_mapping_array_data[ sector_index * 2 ]         = 0x01;
+		large_block_sector_mapping_array_data[ ( sector_index * 2 ) + 1 ] = (uint8_t) sector_index;
+	}
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          2,
+	          0x00000400UL,
+	          0x000003feUL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x000003feUL,
+	          large_block_sector_mapping_array_data,
+	          600,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          NULL,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00001e00UL,
+	          sector_mapping_array_data,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          NULL,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00001e00UL,
+	          sector_mapping_array_data,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00001e00UL,
+	          NULL,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_owner_page_read_sector_mapping_array(
+	          owner_page,
+	          io_handle,
+	          virtual_log_ranges_array,
+	          3,
+	          0x00000200UL,
+	          sector_mapping_array_data,
+	          32,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &virtual_log_ranges_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_free(
+	          &owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( virtual_log_ranges_array != NULL )
+	{
+		libcdata_array_free(
+		 &virtual_log_ranges_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_log_range_free,
+		 NULL );
+	}
+	if( owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &owner_page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_owner_page_read_scan_region function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_owner_page_read_scan_region(
+     void )
+{
+	uint8_t region_data[ 8192 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_io_handle_t *io_handle           = NULL;
+	libfsclfs_log_range_t *log_range           = NULL;
+	libfsclfs_log_range_t *scanned_log_range   = NULL;
+	libfsclfs_owner_page_t *owner_page         = NULL;
+	libfsclfs_owner_page_t *scanned_owner_page = NULL;
+	int entry_index                            = 0;
+	int number_of_entries                      = 0;
+	int number_of_scanned_entries              = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_set_region_data(
+	          region_data,
+	          8192 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          512,
+	          0x00002000UL,
+	          0x00001e00UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          region_data,
+	          8192,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_initialize(
+	          &owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_initialize(
+	          &scanned_owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_owner_page_read(
+	          owner_page,
+	          io_handle,
+	          file_io_handle,
+	          3,
+	          0x00001e00UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "owner_page->is_scanned",
+	 owner_page->is_scanned,
+	 0 );
+
+	result = libfsclfs_owner_page_read_scan_region(
+	          scanned_owner_page,
+	          io_handle,
+	          file_io_handle,
+	          3,
+	          0x00001e00UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sector mapping array and the scan of the region determine the same log ranges
+	 */
+	result = libcdata_array_get_number_of_entries(
+	          owner_page->virtual_log_ranges_array,
+	          &number_of_entries,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	result = libcdata_array_get_number_of_entries(
+	          scanned_owner_page->virtual_log_ranges_array,
+	          &number_of_scanned_entries,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_scanned_entries",
+	 number_of_scanned_entries,
+	 number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libcdata_array_get_entry_by_index(
+		          owner_page->virtual_log_ranges_array,
+		          entry_index,
+		          (intptr_t **) &log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "log_range",
+		 log_range );
+
+		result = libcdata_array_get_entry_by_index(
+		          scanned_owner_page->virtual_log_ranges_array,
+		          entry_index,
+		          (intptr_t **) &scanned_log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "scanned_log_range",
+		 scanned_log_range );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+		 "log_range->stream_number",
+		 log_range->stream_number,
+		 scanned_log_range->stream_number );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+		 "log_range->start_lsn",
+		 log_range->start_lsn,
+		 scanned_log_range->start_lsn );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+		 "log_range->end_lsn",
+		 log_range->end_lsn,
+		 scanned_log_range->end_lsn );
+
+		result = libcdata_array_get_entry_by_index(
+		          owner_page->physical_log_ranges_array,
+		          entry_index,
+		          (intptr_t **) &log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "log_range",
+		 log_range );
+
+		result = libcdata_array_get_entry_by_index(
+		          scanned_owner_page->physical_log_ranges_array,
+		          entry_index,
+		          (intptr_t **) &scanned_log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "scanned_log_range",
+		 scanned_log_range );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+		 "log_range->start_lsn",
+		 log_range->start_lsn,
+		 scanned_log_range->start_lsn );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+		 "log_range->end_lsn",
+		 log_range->end_lsn,
+		 scanned_log_range->end_lsn );
+	}
+	/* Test an owner page of which the blocks of stream 1 exceed its virtual log range
+	 */
+	region_data[ 0x1e00 + 0xa9 ] = 0x03;
+
+	result = libfsclfs_owner_page_read(
+	          owner_page,
+	          io_handle,
+	          file_io_handle,
+	          3,
+	          0x00001e00UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	region_data[ 0x1e00 + 0xa9 ] = 0x04;
+
+	/* Clean up
+	 */
+	result = libfsclfs_owner_page_free(
+	          &scanned_owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_free(
+	          &owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanned_owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &scanned_owner_page,
+		 NULL );
+	}
+	if( owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &owner_page,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_owner_page_append_log_ranges and libfsclfs_owner_page_sort_log_ranges functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_owner_page_sort_log_ranges(
+     void )
+{
+	uint64_t virtual_lsns[ 3 ]                = { 0x00000300UL, 0x00000100UL, 0x00000200UL };
+
+	libcerror_error_t *error                  = NULL;
+	libfsclfs_log_range_t *physical_log_range = NULL;
+	libfsclfs_log_range_t *virtual_log_range  = NULL;
+	libfsclfs_owner_page_t *owner_page        = NULL;
+	libfsclfs_owner_page_t *source_owner_page = NULL;
+	uint32_t physical_block_offset            = 0;
+	int entry_index                           = 0;
+	int log_range_index                       = 0;
+	int number_of_entries                     = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_owner_page_initialize(
+	          &owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_initialize(
+	          &source_owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( log_range_index = 0;
+	     log_range_index < 3;
+	     log_range_index++ )
+	{
+		result = libfsclfs_log_range_initialize(
+		          &physical_log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		physical_log_range->start_lsn = (uint64_t) ( log_range_index + 1 ) * 0x1000;
+
+		result = libcdata_array_append_entry(
+		          source_owner_page->physical_log_ranges_array,
+		          &entry_index,
+		          (intptr_t *) physical_log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		physical_log_range = NULL;
+
+		result = libfsclfs_log_range_initialize(
+		          &virtual_log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		virtual_log_range->start_lsn = virtual_lsns[ log_range_index ];
+
+		result = libcdata_array_append_entry(
+		          source_owner_page->virtual_log_ranges_array,
+		          &entry_index,
+		          (intptr_t *) virtual_log_range,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		virtual_log_range = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libfsclfs_owner_page_append_log_ranges(
+	          owner_page,
+	          source_owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          source_owner_page->virtual_log_ranges_array,
+	          &number_of_entries,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	result = libcdata_array_get_number_of_entries(
+	          owner_page->virtual_log_ranges_array,
+	          &number_of_entries,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	result = libfsclfs_owner_page_sort_log_ranges(
+	          owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "owner_page->is_sorted",
+	 owner_page->is_sorted,
+	 1 );
+
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          0,
+	          0x00000100UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_block_offset",
+	 physical_block_offset,
+	 (uint32_t) 0x00002000UL );
+
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          0,
+	          0x00000300UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_block_offset",
+	 physical_block_offset,
+	 (uint32_t) 0x00001000UL );
+
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          0,
+	          0x00000250UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsclfs_owner_page_get_physical_block_offset(
+	          owner_page,
+	          1,
+	          0x00000100UL,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_owner_page_append_log_ranges(
+	          owner_page,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_owner_page_sort_log_ranges(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_owner_page_free(
+	          &source_owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_owner_page_free(
+	          &owner_page,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( virtual_log_range != NULL )
+	{
+		libfsclfs_log_range_free(
+		 &virtual_log_range,
+		 NULL );
+	}
+	if( physical_log_range != NULL )
+	{
+		libfsclfs_log_range_free(
+		 &physical_log_range,
+		 NULL );
+	}
+	if( source_owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &source_owner_page,
+		 NULL );
+	}
+	if( owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &owner_page,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 /* The main program
@@ -410,9 +1575,17 @@ int main(
 
 	/* TODO: add tests for libfsclfs_owner_page_read_virtual_log_range_array */
 
-	/* TODO: add tests for libfsclfs_owner_page_read_sector_mapping_array */
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_owner_page_read_sector_mapping_array",
+	 fsclfs_test_owner_page_read_sector_mapping_array );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_owner_page_read_scan_region",
+	 fsclfs_test_owner_page_read_scan_region );
 
-	/* TODO: add tests for libfsclfs_owner_page_read_scan_region */
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_owner_page_sort_log_ranges",
+	 fsclfs_test_owner_page_sort_log_ranges );
 
 	/* TODO: add tests for libfsclfs_owner_page_get_physical_block_offset */
 
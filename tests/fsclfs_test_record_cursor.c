@@ -0,0 +1,816 @@
+/*
+ * Library record_cursor type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_record_cursor.h"
+#include "../libfsclfs/libfsclfs_store.h"
+#include "../libfsclfs/libfsclfs_stream.h"
+#include "../libfsclfs/libfsclfs_stream_descriptor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_record_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_cursor_initialize(
+     libfsclfs_internal_stream_t *internal_stream )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsclfs_record_cursor_t *record_cursor = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 3;
+	int number_of_memset_fail_tests          = 3;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_cursor_initialize(
+	          &record_cursor,
+	          internal_stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_cursor_free(
+	          &record_cursor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_cursor_initialize(
+	          NULL,
+	          internal_stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_cursor = (libfsclfs_record_cursor_t *) 0x12345678UL;
+
+	result = libfsclfs_record_cursor_initialize(
+	          &record_cursor,
+	          internal_stream,
+	          &error );
+
+	record_cursor = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_cursor_initialize(
+	          &record_cursor,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_cursor_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_cursor_initialize(
+		          &record_cursor,
+		          internal_stream,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( record_cursor != NULL )
+			{
+				libfsclfs_record_cursor_free(
+				 &record_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_cursor",
+			 record_cursor );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_cursor_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_cursor_initialize(
+		          &record_cursor,
+		          internal_stream,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( record_cursor != NULL )
+			{
+				libfsclfs_record_cursor_free(
+				 &record_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_cursor",
+			 record_cursor );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_cursor != NULL )
+	{
+		libfsclfs_record_cursor_free(
+		 &record_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* Tests the libfsclfs_record_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_cursor_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_record_cursor_read_record_by_lsn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_cursor_read_record_by_lsn(
+     libfsclfs_record_cursor_t *record_cursor )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t record_lsn      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_cursor_read_record_by_lsn(
+	          record_cursor,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record cursor does not contain a record after an unavailable LSN
+	 */
+	result = libfsclfs_record_cursor_get_lsn(
+	          record_cursor,
+	          &record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_cursor_read_record_by_lsn(
+	          NULL,
+	          0x0000000000000201ULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_cursor_read_record_by_lsn(
+	          record_cursor,
+	          0x00000000ffffffffULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_record_cursor_get_* functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_cursor_get_values(
+     libfsclfs_record_cursor_t *record_cursor )
+{
+	uint8_t record_data[ 4 ] = {
+		0x01, 0x02, 0x03, 0x04 };
+
+	libfsclfs_internal_record_cursor_t *internal_record_cursor = NULL;
+	libcerror_error_t *error                                   = NULL;
+	uint8_t *data                                              = NULL;
+	size_t data_size                                           = 0;
+	uint64_t previous_lsn                                      = 0;
+	uint64_t record_lsn                                        = 0;
+	uint64_t undo_next_lsn                                     = 0;
+	uint32_t record_type                                       = 0;
+	uint16_t record_flags                                      = 0;
+	int result                                                 = 0;
+
+	internal_record_cursor = (libfsclfs_internal_record_cursor_t *) record_cursor;
+
+	internal_record_cursor->record_value->type          = 0x00000001UL;
+	internal_record_cursor->record_value->flags         = 0x0002;
+	internal_record_cursor->record_value->previous_lsn  = 0x0000000000000400ULL;
+	internal_record_cursor->record_value->undo_next_lsn = 0x00000000ffffffffULL;
+	internal_record_cursor->record_value->data          = record_data;
+	internal_record_cursor->record_value->data_size     = 4;
+	internal_record_cursor->record_lsn                  = 0x0000000000000601ULL;
+	internal_record_cursor->has_record                  = 1;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_cursor_get_lsn(
+	          record_cursor,
+	          &record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "record_lsn",
+	 record_lsn,
+	 (uint64_t) 0x0000000000000601ULL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_cursor_get_type(
+	          record_cursor,
+	          &record_type,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_type",
+	 record_type,
+	 (uint32_t) 0x00000001UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_cursor_get_flags(
+	          record_cursor,
+	          &record_flags,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT16(
+	 "record_flags",
+	 record_flags,
+	 (uint16_t) 0x0002 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_cursor_get_previous_lsn(
+	          record_cursor,
+	          &previous_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "previous_lsn",
+	 previous_lsn,
+	 (uint64_t) 0x0000000000000400ULL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_cursor_get_undo_next_lsn(
+	          record_cursor,
+	          &undo_next_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "undo_next_lsn",
+	 undo_next_lsn,
+	 (uint64_t) 0x00000000ffffffffULL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_cursor_get_data(
+	          record_cursor,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 4 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "data == record_data",
+	 (int) ( data == record_data ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_cursor_get_type(
+	          NULL,
+	          &record_type,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_cursor_get_data(
+	          record_cursor,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test without a record
+	 */
+	internal_record_cursor->has_record = 0;
+
+	result = libfsclfs_record_cursor_get_type(
+	          record_cursor,
+	          &record_type,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The record data is owned by the test
+	 */
+	internal_record_cursor->record_value->data      = NULL;
+	internal_record_cursor->record_value->data_size = 0;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_record_cursor != NULL )
+	{
+		internal_record_cursor->record_value->data      = NULL;
+		internal_record_cursor->record_value->data_size = 0;
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_internal_stream_t internal_stream;
+	libfsclfs_record_cursor_t *record_cursor         = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	int result                                       = 0;
+#endif
+
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_initialize(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_descriptor",
+	 stream_descriptor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream_descriptor->number   = 3;
+	stream_descriptor->base_lsn = 0x0000000000000200ULL;
+	stream_descriptor->last_lsn = 0x0000000100080402ULL;
+
+	internal_stream.internal_store    = (libfsclfs_internal_store_t *) store;
+	internal_stream.stream_descriptor = stream_descriptor;
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_cursor_initialize",
+	 fsclfs_test_record_cursor_initialize,
+	 &internal_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_cursor_free",
+	 fsclfs_test_record_cursor_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	result = libfsclfs_record_cursor_initialize(
+	          &record_cursor,
+	          &internal_stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_cursor_read_record_by_lsn",
+	 fsclfs_test_record_cursor_read_record_by_lsn,
+	 record_cursor );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_cursor_get_values",
+	 fsclfs_test_record_cursor_get_values,
+	 record_cursor );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_cursor_free(
+	          &record_cursor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_cursor",
+	 record_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_free(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_cursor != NULL )
+	{
+		libfsclfs_record_cursor_free(
+		 &record_cursor,
+		 NULL );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
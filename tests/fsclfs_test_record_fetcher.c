@@ -0,0 +1,1372 @@
+/*
+ * Library record_fetcher type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_container_descriptor.h"
+#include "../libfsclfs/libfsclfs_record_fetcher.h"
+#include "../libfsclfs/libfsclfs_store.h"
+#include "../libfsclfs/libfsclfs_stream.h"
+#include "../libfsclfs/libfsclfs_stream_descriptor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+typedef struct fsclfs_test_record_fetcher_completions fsclfs_test_record_fetcher_completions_t;
+
+struct fsclfs_test_record_fetcher_completions
+{
+	/* The number of completions
+	 */
+	int number_of_completions;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The number of completions with a lookup error
+	 */
+	int number_of_errors;
+
+	/* The result of the last completion
+	 */
+	int last_result;
+
+	/* The record LSN of the last completion
+	 */
+	uint64_t last_record_lsn;
+};
+
+/* Callback function to count the record fetcher completions
+ */
+void fsclfs_test_record_fetcher_callback(
+      uint64_t record_lsn,
+      int result,
+      libfsclfs_record_t *record,
+      libcerror_error_t *error,
+      void *callback_data )
+{
+	fsclfs_test_record_fetcher_completions_t *completions = NULL;
+
+	completions = (fsclfs_test_record_fetcher_completions_t *) callback_data;
+
+	if( completions != NULL )
+	{
+		completions->number_of_completions += 1;
+		completions->last_result            = result;
+		completions->last_record_lsn        = record_lsn;
+
+		if( record != NULL )
+		{
+			completions->number_of_records += 1;
+		}
+		if( error != NULL )
+		{
+			completions->number_of_errors += 1;
+		}
+	}
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+}
+
+/* Tests the libfsclfs_record_fetcher_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_fetcher_initialize(
+     libfsclfs_internal_stream_t *internal_stream )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_record_fetcher_t *record_fetcher = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_fetcher_initialize(
+	          &record_fetcher,
+	          internal_stream,
+	          &fsclfs_test_record_fetcher_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_fetcher",
+	 record_fetcher );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_fetcher_free(
+	          &record_fetcher,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_fetcher",
+	 record_fetcher );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_fetcher_initialize(
+	          NULL,
+	          internal_stream,
+	          &fsclfs_test_record_fetcher_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_fetcher = (libfsclfs_record_fetcher_t *) 0x12345678UL;
+
+	result = libfsclfs_record_fetcher_initialize(
+	          &record_fetcher,
+	          internal_stream,
+	          &fsclfs_test_record_fetcher_callback,
+	          NULL,
+	          &error );
+
+	record_fetcher = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_initialize(
+	          &record_fetcher,
+	          NULL,
+	          &fsclfs_test_record_fetcher_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_initialize(
+	          &record_fetcher,
+	          internal_stream,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_fetcher_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_fetcher_initialize(
+		          &record_fetcher,
+		          internal_stream,
+		          &fsclfs_test_record_fetcher_callback,
+		          NULL,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( record_fetcher != NULL )
+			{
+				libfsclfs_record_fetcher_free(
+				 &record_fetcher,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_fetcher",
+			 record_fetcher );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_fetcher_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_fetcher_initialize(
+		          &record_fetcher,
+		          internal_stream,
+		          &fsclfs_test_record_fetcher_callback,
+		          NULL,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( record_fetcher != NULL )
+			{
+				libfsclfs_record_fetcher_free(
+				 &record_fetcher,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_fetcher",
+			 record_fetcher );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_fetcher != NULL )
+	{
+		libfsclfs_record_fetcher_free(
+		 &record_fetcher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* Tests the libfsclfs_record_fetcher_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_fetcher_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_fetcher_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_record_fetcher_submit and libfsclfs_record_fetcher_wait functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_fetcher_submit(
+     libfsclfs_internal_stream_t *internal_stream )
+{
+	fsclfs_test_record_fetcher_completions_t completions;
+
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_record_fetcher_t *record_fetcher = NULL;
+	int number_of_outstanding_requests         = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	completions.number_of_completions = 0;
+	completions.number_of_records     = 0;
+	completions.number_of_errors      = 0;
+	completions.last_result           = 1;
+	completions.last_record_lsn       = 0xffffffffffffffffULL;
+
+	result = libfsclfs_record_fetcher_initialize(
+	          &record_fetcher,
+	          internal_stream,
+	          &fsclfs_test_record_fetcher_callback,
+	          &completions,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_fetcher",
+	 record_fetcher );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_fetcher_submit(
+	          record_fetcher,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_fetcher_wait(
+	          record_fetcher,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_completions",
+	 completions.number_of_completions,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_records",
+	 completions.number_of_records,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.last_result",
+	 completions.last_result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_errors",
+	 completions.number_of_errors,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "completions.last_record_lsn",
+	 completions.last_record_lsn,
+	 (uint64_t) 0 );
+
+	result = libfsclfs_record_fetcher_get_number_of_outstanding_requests(
+	          record_fetcher,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_outstanding_requests",
+	 number_of_outstanding_requests,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_fetcher_submit(
+	          NULL,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_wait(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_get_number_of_outstanding_requests(
+	          NULL,
+	          &number_of_outstanding_requests,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_get_number_of_outstanding_requests(
+	          record_fetcher,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_fetcher_free(
+	          &record_fetcher,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_fetcher",
+	 record_fetcher );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_fetcher != NULL )
+	{
+		libfsclfs_record_fetcher_free(
+		 &record_fetcher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+/* Tests the libfsclfs_record_fetcher_get_worker_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_fetcher_get_worker_file_io_handle(
+     void )
+{
+	fsclfs_test_record_fetcher_completions_t completions;
+	uint8_t container_data[ 512 ];
+
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libbfio_handle_t *source_file_io_handle                = NULL;
+	libbfio_handle_t *worker_file_io_handle                = NULL;
+	libcerror_error_t *error                               = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_record_fetcher_t *record_fetcher    = NULL;
+	libfsclfs_internal_stream_t internal_stream;
+	libfsclfs_store_t *store                               = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor       = NULL;
+	int entry_index                                        = 0;
+	int result                                             = 0;
+	int worker_index                                       = 0;
+
+	/* Initialize test
+	 */
+	completions.number_of_completions = 0;
+	completions.number_of_records     = 0;
+	completions.number_of_errors      = 0;
+	completions.last_result           = 1;
+	completions.last_record_lsn       = 0xffffffffffffffffULL;
+
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_container_descriptor_initialize(
+	          &container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          ( (libfsclfs_internal_store_t *) store )->container_descriptors_array,
+	          &entry_index,
+	          (intptr_t *) container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	container_descriptor = NULL;
+
+	result = memory_set(
+	          container_data,
+	          0,
+	          512 ) != NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_set_container_file_io_handle(
+	          (libfsclfs_internal_store_t *) store,
+	          0,
+	          file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The container file IO pool now manages the file IO handle
+	 */
+	source_file_io_handle = file_io_handle;
+	file_io_handle        = NULL;
+
+	result = libfsclfs_stream_descriptor_initialize(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_set_number_of_threads(
+	          store,
+	          2,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_stream.internal_store    = (libfsclfs_internal_store_t *) store;
+	internal_stream.stream_descriptor = stream_descriptor;
+
+	result = libfsclfs_record_fetcher_initialize(
+	          (libfsclfs_record_fetcher_t **) &record_fetcher,
+	          &internal_stream,
+	          &fsclfs_test_record_fetcher_callback,
+	          &completions,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_fetcher",
+	 record_fetcher );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "record_fetcher->number_of_workers",
+	 record_fetcher->number_of_workers,
+	 2 );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          0,
+	          0,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "worker_file_io_handle",
+	 worker_file_io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The worker reads from a clone of the container file IO handle of the store
+	 */
+	FSCLFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "worker_file_io_handle",
+	 (intptr_t) worker_file_io_handle,
+	 (intptr_t) source_file_io_handle );
+
+	file_io_handle = worker_file_io_handle;
+
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          0,
+	          0,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "worker_file_io_handle",
+	 (intptr_t) worker_file_io_handle,
+	 (intptr_t) file_io_handle );
+
+	/* Every worker has its own clone
+	 */
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          1,
+	          0,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "worker_file_io_handle",
+	 (intptr_t) worker_file_io_handle,
+	 (intptr_t) file_io_handle );
+
+	file_io_handle = NULL;
+
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          0,
+	          1,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "worker_file_io_handle",
+	 worker_file_io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_fetcher_acquire_worker(
+	          record_fetcher,
+	          &worker_index,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "worker_index",
+	 worker_index,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_fetcher_acquire_worker(
+	          record_fetcher,
+	          &worker_index,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "worker_index",
+	 worker_index,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_fetcher->workers[ 0 ].is_busy = 0;
+	record_fetcher->workers[ 1 ].is_busy = 0;
+
+	/* The record of a container that is not part of the store is not available
+	 */
+	result = libfsclfs_record_fetcher_submit(
+	          (libfsclfs_record_fetcher_t *) record_fetcher,
+	          0x0000000100000200ULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_fetcher_wait(
+	          (libfsclfs_record_fetcher_t *) record_fetcher,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_completions",
+	 completions.number_of_completions,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.last_result",
+	 completions.last_result,
+	 0 );
+
+	/* The container does not contain a valid block
+	 */
+	result = libfsclfs_record_fetcher_submit(
+	          (libfsclfs_record_fetcher_t *) record_fetcher,
+	          0x0000000000000200ULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_fetcher_wait(
+	          (libfsclfs_record_fetcher_t *) record_fetcher,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_completions",
+	 completions.number_of_completions,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_records",
+	 completions.number_of_records,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.last_result",
+	 completions.last_result,
+	 -1 );
+
+	/* The lookup error is passed to the callback function
+	 */
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "completions.number_of_errors",
+	 completions.number_of_errors,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          NULL,
+	          0,
+	          0,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          -1,
+	          0,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          record_fetcher->number_of_workers,
+	          0,
+	          &worker_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_get_worker_file_io_handle(
+	          record_fetcher,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_acquire_worker(
+	          NULL,
+	          &worker_index,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_fetcher_acquire_worker(
+	          record_fetcher,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_fetcher_free(
+	          (libfsclfs_record_fetcher_t **) &record_fetcher,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_fetcher",
+	 record_fetcher );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_free(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_fetcher != NULL )
+	{
+		libfsclfs_record_fetcher_free(
+		 (libfsclfs_record_fetcher_t **) &record_fetcher,
+		 NULL );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( container_descriptor != NULL )
+	{
+		libfsclfs_container_descriptor_free(
+		 &container_descriptor,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_internal_stream_t internal_stream;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	int result                                       = 0;
+#endif
+
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_initialize(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_descriptor",
+	 stream_descriptor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream_descriptor->number   = 3;
+	stream_descriptor->base_lsn = 0x0000000000000200ULL;
+	stream_descriptor->last_lsn = 0x0000000100080402ULL;
+
+	internal_stream.internal_store    = (libfsclfs_internal_store_t *) store;
+	internal_stream.stream_descriptor = stream_descriptor;
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_fetcher_initialize",
+	 fsclfs_test_record_fetcher_initialize,
+	 &internal_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_fetcher_free",
+	 fsclfs_test_record_fetcher_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_fetcher_submit",
+	 fsclfs_test_record_fetcher_submit,
+	 &internal_stream );
+
+#if defined( HAVE_LIBFSCLFS_MULTI_THREAD_SUPPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_fetcher_get_worker_file_io_handle",
+	 fsclfs_test_record_fetcher_get_worker_file_io_handle );
+
+#endif
+
+	/* Clean up
+	 */
+	result = libfsclfs_stream_descriptor_free(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
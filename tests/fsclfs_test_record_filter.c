@@ -0,0 +1,818 @@
+/*
+ * Library record_filter type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_record_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Record header of a data record with flags 0x0002
+ */
+uint8_t fsclfs_test_record_filter_record_header_data[ 40 ] = {
+	0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x28, 0x00, 0x21, 0x00, 0x00, 0x00 };
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* Tests the libfsclfs_record_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_filter_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsclfs_record_filter_t *record_filter = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_filter_initialize(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_filter = (libfsclfs_record_filter_t *) 0x12345678UL;
+
+	result = libfsclfs_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	record_filter = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_filter_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_filter_initialize(
+		          &record_filter,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( record_filter != NULL )
+			{
+				libfsclfs_record_filter_free(
+				 &record_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_filter",
+			 record_filter );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_filter_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_filter_initialize(
+		          &record_filter,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( record_filter != NULL )
+			{
+				libfsclfs_record_filter_free(
+				 &record_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_filter",
+			 record_filter );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libfsclfs_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_record_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_filter_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_record_filter_set_record_types function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_filter_set_record_types(
+     libfsclfs_record_filter_t *record_filter )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	int result                                                 = 0;
+
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_filter_set_record_types(
+	          record_filter,
+	          LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_record_filter->record_type_flags",
+	 internal_record_filter->record_type_flags,
+	 (uint32_t) LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_filter_set_record_types(
+	          NULL,
+	          LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_record_filter_set_record_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_filter_set_record_flags(
+     libfsclfs_record_filter_t *record_filter )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	int result                                                 = 0;
+
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_filter_set_record_flags(
+	          record_filter,
+	          0x0003,
+	          0x0002,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT16(
+	 "internal_record_filter->record_flags_mask",
+	 internal_record_filter->record_flags_mask,
+	 (uint16_t) 0x0003 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT16(
+	 "internal_record_filter->record_flags",
+	 internal_record_filter->record_flags,
+	 (uint16_t) 0x0002 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_filter_set_record_flags(
+	          NULL,
+	          0x0003,
+	          0x0002,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_filter_set_record_flags(
+	          record_filter,
+	          0x0001,
+	          0x0002,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_record_filter_set_stream_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_filter_set_stream_index(
+     libfsclfs_record_filter_t *record_filter )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsclfs_internal_record_filter_t *internal_record_filter = NULL;
+	int result                                                 = 0;
+
+	internal_record_filter = (libfsclfs_internal_record_filter_t *) record_filter;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_filter_set_stream_index(
+	          record_filter,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_record_filter->stream_index",
+	 internal_record_filter->stream_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_filter_set_stream_index(
+	          NULL,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_filter_set_stream_index(
+	          record_filter,
+	          -2,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_record_filter_match_record_header function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_filter_match_record_header(
+     void )
+{
+	libfsclfs_internal_record_filter_t internal_record_filter;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &internal_record_filter,
+	 0,
+	 sizeof( libfsclfs_internal_record_filter_t ) );
+
+	internal_record_filter.stream_index = -1;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_filter.record_type_flags = LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA;
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_filter.record_type_flags = LIBFSCLFS_RECORD_TYPE_FLAG_IS_RESTART;
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_filter.record_type_flags = 0;
+	internal_record_filter.record_flags_mask = 0x0003;
+	internal_record_filter.record_flags      = 0x0002;
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_filter.record_flags = 0x0001;
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_filter_match_record_header(
+	          NULL,
+	          fsclfs_test_record_filter_record_header_data,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          NULL,
+	          40,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          39,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_filter_match_record_header(
+	          &internal_record_filter,
+	          fsclfs_test_record_filter_record_header_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	libcerror_error_t *error                 = NULL;
+	libfsclfs_record_filter_t *record_filter = NULL;
+	int result                               = 0;
+#endif
+
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_filter_initialize",
+	 fsclfs_test_record_filter_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_filter_free",
+	 fsclfs_test_record_filter_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	result = libfsclfs_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_filter_set_record_types",
+	 fsclfs_test_record_filter_set_record_types,
+	 record_filter );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_filter_set_record_flags",
+	 fsclfs_test_record_filter_set_record_flags,
+	 record_filter );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_record_filter_set_stream_index",
+	 fsclfs_test_record_filter_set_stream_index,
+	 record_filter );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_filter_match_record_header",
+	 fsclfs_test_record_filter_match_record_header );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libfsclfs_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,654 @@
+/*
+ * Library record_header_table type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_record_header_table.h"
+
+/* Record data with 2 records, the second record is the last record in the block
+ */
+uint8_t fsclfs_test_record_header_table_data[ 96 ] = {
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x42, 0x43, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x28, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfsclfs_record_header_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_header_table_initialize(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsclfs_record_header_table_t *record_header_table = NULL;
+	int result                                           = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                      = 7;
+	int test_number                                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_header_table_initialize(
+	          &record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_header_table",
+	 record_header_table );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_free(
+	          &record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_header_table",
+	 record_header_table );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_header_table_initialize(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_header_table = (libfsclfs_record_header_table_t *) 0x12345678UL;
+
+	result = libfsclfs_record_header_table_initialize(
+	          &record_header_table,
+	          &error );
+
+	record_header_table = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_record_header_table_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_record_header_table_initialize(
+		          &record_header_table,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( record_header_table != NULL )
+			{
+				libfsclfs_record_header_table_free(
+				 &record_header_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "record_header_table",
+			 record_header_table );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_header_table != NULL )
+	{
+		libfsclfs_record_header_table_free(
+		 &record_header_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_record_header_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_header_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_header_table_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_record_header_table_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_header_table_read_data(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsclfs_record_header_table_t *record_header_table = NULL;
+	const uint64_t *previous_lsns                        = NULL;
+	const uint64_t *undo_next_lsns                       = NULL;
+	const uint64_t *virtual_lsns                         = NULL;
+	const uint32_t *record_types                         = NULL;
+	const uint32_t *sizes                                = NULL;
+	const uint16_t *flags                                = NULL;
+	uint64_t block_lsn                                   = 0;
+	int number_of_records                                = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_record_header_table_initialize(
+	          &record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_header_table",
+	 record_header_table );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_header_table_read_data(
+	          (libfsclfs_internal_record_header_table_t *) record_header_table,
+	          0x00001000UL,
+	          fsclfs_test_record_header_table_data,
+	          96,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_get_block_lsn(
+	          record_header_table,
+	          &block_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "block_lsn",
+	 block_lsn,
+	 (uint64_t) 0x00001000UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_get_number_of_records(
+	          record_header_table,
+	          &number_of_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_get_virtual_lsns(
+	          record_header_table,
+	          &virtual_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "virtual_lsns",
+	 virtual_lsns );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "virtual_lsns[ 1 ]",
+	 virtual_lsns[ 1 ],
+	 (uint64_t) 0x00001001UL );
+
+	result = libfsclfs_record_header_table_get_previous_lsns(
+	          record_header_table,
+	          &previous_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "previous_lsns",
+	 previous_lsns );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "previous_lsns[ 0 ]",
+	 previous_lsns[ 0 ],
+	 (uint64_t) 0x00000100UL );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "previous_lsns[ 1 ]",
+	 previous_lsns[ 1 ],
+	 (uint64_t) 0x00001000UL );
+
+	result = libfsclfs_record_header_table_get_undo_next_lsns(
+	          record_header_table,
+	          &undo_next_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "undo_next_lsns",
+	 undo_next_lsns );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "undo_next_lsns[ 1 ]",
+	 undo_next_lsns[ 1 ],
+	 (uint64_t) 0x00000200UL );
+
+	result = libfsclfs_record_header_table_get_sizes(
+	          record_header_table,
+	          &sizes,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sizes",
+	 sizes );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "sizes[ 0 ]",
+	 sizes[ 0 ],
+	 (uint32_t) 0x2c );
+
+	result = libfsclfs_record_header_table_get_record_types(
+	          record_header_table,
+	          &record_types,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_types",
+	 record_types );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_types[ 1 ]",
+	 record_types[ 1 ],
+	 (uint32_t) 0x21 );
+
+	result = libfsclfs_record_header_table_get_flags(
+	          record_header_table,
+	          &flags,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "flags",
+	 flags );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT16(
+	 "flags[ 0 ]",
+	 flags[ 0 ],
+	 (uint16_t) 0x0002 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_header_table_read_data(
+	          NULL,
+	          0x00001000UL,
+	          fsclfs_test_record_header_table_data,
+	          96,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_header_table_read_data(
+	          (libfsclfs_internal_record_header_table_t *) record_header_table,
+	          0x00001001UL,
+	          fsclfs_test_record_header_table_data,
+	          96,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_header_table_read_data(
+	          (libfsclfs_internal_record_header_table_t *) record_header_table,
+	          0x00001000UL,
+	          NULL,
+	          96,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a record size that exceeds the data size
+	 */
+	result = libfsclfs_record_header_table_read_data(
+	          (libfsclfs_internal_record_header_table_t *) record_header_table,
+	          0x00001000UL,
+	          fsclfs_test_record_header_table_data,
+	          40,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_header_table_get_number_of_records(
+	          record_header_table,
+	          &number_of_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_header_table_free(
+	          &record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_header_table",
+	 record_header_table );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_header_table != NULL )
+	{
+		libfsclfs_record_header_table_free(
+		 &record_header_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_header_table_initialize",
+	 fsclfs_test_record_header_table_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_header_table_free",
+	 fsclfs_test_record_header_table_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_header_table_read_data",
+	 fsclfs_test_record_header_table_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
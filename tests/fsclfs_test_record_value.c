@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -270,6 +271,177 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsclfs_record_value_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_value_read_header(
+     void )
+{
+	uint8_t data[ 48 ] = {
+		0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x00, 0x28, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+	libcerror_error_t *error               = NULL;
+	libfsclfs_record_value_t *record_value = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_record_value_initialize(
+	          &record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_value",
+	 record_value );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_value_read_header(
+	          record_value,
+	          data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->type",
+	 record_value->type,
+	 (uint32_t) 0x00000021UL );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT16(
+	 "record_value->flags",
+	 record_value->flags,
+	 (uint16_t) 0x0002 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "record_value->previous_lsn",
+	 record_value->previous_lsn,
+	 (uint64_t) 0x0000000100000000ULL );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->data_size",
+	 record_value->data_size,
+	 (uint32_t) 8 );
+
+	/* The record data is not read
+	 */
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_value->data",
+	 record_value->data );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_value_read_header(
+	          NULL,
+	          data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_value_read_header(
+	          record_value,
+	          NULL,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a record size that exceeds the data size
+	 */
+	result = libfsclfs_record_value_read_header(
+	          record_value,
+	          data,
+	          44,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_value_free(
+	          &record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_value",
+	 record_value );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsclfs_record_value_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -373,6 +545,210 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsclfs_record_value_fill_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_record_value_fill_data(
+     void )
+{
+	uint8_t data[ 48 ] = {
+		0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x00, 0x28, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+	libcerror_error_t *error               = NULL;
+	libfsclfs_record_value_t *record_value = NULL;
+	uint8_t *record_data                   = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_record_value_initialize(
+	          &record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_value",
+	 record_value );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_record_value_fill_data(
+	          record_value,
+	          data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->data_size",
+	 record_value->data_size,
+	 (uint32_t) 8 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->allocated_data_size",
+	 record_value->allocated_data_size,
+	 (uint32_t) 8 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_value->data",
+	 record_value->data );
+
+	result = memory_compare(
+	          record_value->data,
+	          &( data[ 40 ] ),
+	          8 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	record_data = record_value->data;
+
+	/* Test that a smaller record reuses the data
+	 */
+	data[ 24 ] = 0x2c;
+	data[ 40 ] = 0x11;
+
+	result = libfsclfs_record_value_fill_data(
+	          record_value,
+	          data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->data_size",
+	 record_value->data_size,
+	 (uint32_t) 4 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->allocated_data_size",
+	 record_value->allocated_data_size,
+	 (uint32_t) 8 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "record_value->data == record_data",
+	 (int) ( record_value->data == record_data ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "record_value->data[ 0 ]",
+	 record_value->data[ 0 ],
+	 (uint8_t) 0x11 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_record_value_fill_data(
+	          NULL,
+	          data,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_record_value_fill_data(
+	          record_value,
+	          NULL,
+	          48,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The data is kept for reuse after a failed read
+	 */
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->data_size",
+	 record_value->data_size,
+	 (uint32_t) 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_value->allocated_data_size",
+	 record_value->allocated_data_size,
+	 (uint32_t) 8 );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_value_free(
+	          &record_value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_value",
+	 record_value );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_value != NULL )
+	{
+		libfsclfs_record_value_free(
+		 &record_value,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 /* The main program
@@ -400,10 +776,18 @@ int main(
 	 "libfsclfs_record_value_free",
 	 fsclfs_test_record_value_free );
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_value_read_header",
+	 fsclfs_test_record_value_read_header );
+
 	FSCLFS_TEST_RUN(
 	 "libfsclfs_record_value_read_data",
 	 fsclfs_test_record_value_read_data );
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_record_value_fill_data",
+	 fsclfs_test_record_value_fill_data );
+
 	/* TODO: add tests for libfsclfs_record_value_get_data */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
@@ -0,0 +1,805 @@
+/*
+ * Library region_scanner type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_owner_page.h"
+#include "../libfsclfs/libfsclfs_region_scanner.h"
+
+/* Container data of 2 regions without blocks
+ */
+uint8_t fsclfs_test_region_scanner_data[ 2 * 512 * 1024 ];
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_region_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_region_scanner_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libfsclfs_io_handle_t *io_handle             = NULL;
+	libfsclfs_region_scanner_t *region_scanner   = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 2;
+	int number_of_memset_fail_tests              = 2;
+	int test_number                              = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsclfs_test_region_scanner_data,
+	          2 * 512 * 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_region_scanner_initialize(
+	          &region_scanner,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "region_scanner",
+	 region_scanner );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "region_scanner->number_of_regions",
+	 region_scanner->number_of_regions,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "region_scanner->regions[ 1 ].offset",
+	 region_scanner->regions[ 1 ].offset,
+	 (uint32_t) ( 512 * 1024 ) );
+
+	result = libfsclfs_region_scanner_free(
+	          &region_scanner,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "region_scanner",
+	 region_scanner );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_region_scanner_initialize(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	region_scanner = (libfsclfs_region_scanner_t *) 0x12345678UL;
+
+	result = libfsclfs_region_scanner_initialize(
+	          &region_scanner,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	region_scanner = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_region_scanner_initialize(
+	          &region_scanner,
+	          NULL,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "region_scanner",
+	 region_scanner );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_region_scanner_initialize(
+	          &region_scanner,
+	          io_handle,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "region_scanner",
+	 region_scanner );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_region_scanner_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_region_scanner_initialize(
+		          &region_scanner,
+		          io_handle,
+		          file_io_handle,
+		          2,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( region_scanner != NULL )
+			{
+				libfsclfs_region_scanner_free(
+				 &region_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "region_scanner",
+			 region_scanner );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_region_scanner_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_region_scanner_initialize(
+		          &region_scanner,
+		          io_handle,
+		          file_io_handle,
+		          2,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( region_scanner != NULL )
+			{
+				libfsclfs_region_scanner_free(
+				 &region_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "region_scanner",
+			 region_scanner );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( region_scanner != NULL )
+	{
+		libfsclfs_region_scanner_free(
+		 &region_scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_region_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_region_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_region_scanner_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_region_scanner_scan and libfsclfs_region_scanner_merge_log_ranges functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_region_scanner_scan(
+     void )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_io_handle_t *io_handle           = NULL;
+	libfsclfs_owner_page_t *owner_page         = NULL;
+	libfsclfs_region_scanner_t *region_scanner = NULL;
+	int number_of_entries                      = 0;
+	int number_of_threads                      = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsclfs_test_region_scanner_data,
+	          2 * 512 * 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads *= 4 )
+	{
+		result = libfsclfs_region_scanner_initialize(
+		          &region_scanner,
+		          io_handle,
+		          file_io_handle,
+		          2,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_region_scanner_scan(
+		          region_scanner,
+		          number_of_threads,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "region_scanner->regions[ 0 ].result",
+		 region_scanner->regions[ 0 ].result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "region_scanner->regions[ 1 ].result",
+		 region_scanner->regions[ 1 ].result,
+		 1 );
+
+		result = libfsclfs_owner_page_initialize(
+		          &owner_page,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_region_scanner_merge_log_ranges(
+		          region_scanner,
+		          owner_page,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+		 "owner_page->is_sorted",
+		 owner_page->is_sorted,
+		 1 );
+
+		result = libcdata_array_get_number_of_entries(
+		          owner_page->virtual_log_ranges_array,
+		          &number_of_entries,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_entries",
+		 number_of_entries,
+		 0 );
+
+		result = libfsclfs_owner_page_free(
+		          &owner_page,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_region_scanner_free(
+		          &region_scanner,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test scan with abort signalled
+	 */
+	result = libfsclfs_region_scanner_initialize(
+	          &region_scanner,
+	          io_handle,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->abort = 1;
+
+	result = libfsclfs_region_scanner_scan(
+	          region_scanner,
+	          1,
+	          &error );
+
+	io_handle->abort = 0;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_region_scanner_scan(
+	          NULL,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_region_scanner_scan(
+	          region_scanner,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_region_scanner_merge_log_ranges(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_region_scanner_free(
+	          &region_scanner,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner_page != NULL )
+	{
+		libfsclfs_owner_page_free(
+		 &owner_page,
+		 NULL );
+	}
+	if( region_scanner != NULL )
+	{
+		libfsclfs_region_scanner_free(
+		 &region_scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_region_scanner_initialize",
+	 fsclfs_test_region_scanner_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_region_scanner_free",
+	 fsclfs_test_region_scanner_free );
+
+	/* TODO: add tests for libfsclfs_region_scanner_scan_region */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_region_scanner_scan",
+	 fsclfs_test_region_scanner_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1193 @@
+/*
+ * Library scan_cursor type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_record_filter.h"
+#include "../libfsclfs/libfsclfs_scan_cursor.h"
+#include "../libfsclfs/libfsclfs_store.h"
+#include "../libfsclfs/libfsclfs_stream.h"
+#include "../libfsclfs/libfsclfs_stream_descriptor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+uint8_t fsclfs_test_scan_cursor_store_identifier[ 16 ] = {
+	0x3c, 0x5b, 0x8e, 0x21, 0x7a, 0x40, 0x11, 0xe4, 0x9a, 0x2b, 0x00, 0x15, 0x5d, 0x01, 0x64, 0x0d };
+
+/* Tests the libfsclfs_scan_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scan_cursor_initialize(
+     libfsclfs_internal_stream_t *internal_stream )
+{
+	libcerror_error_t *error             = NULL;
+	libfsclfs_scan_cursor_t *scan_cursor = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_scan_cursor_initialize(
+	          &scan_cursor,
+	          internal_stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_cursor",
+	 scan_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_scan_cursor_free(
+	          &scan_cursor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "scan_cursor",
+	 scan_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scan_cursor_initialize(
+	          NULL,
+	          internal_stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_cursor = (libfsclfs_scan_cursor_t *) 0x12345678UL;
+
+	result = libfsclfs_scan_cursor_initialize(
+	          &scan_cursor,
+	          internal_stream,
+	          &error );
+
+	scan_cursor = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_initialize(
+	          &scan_cursor,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_scan_cursor_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_scan_cursor_initialize(
+		          &scan_cursor,
+		          internal_stream,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( scan_cursor != NULL )
+			{
+				libfsclfs_scan_cursor_free(
+				 &scan_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "scan_cursor",
+			 scan_cursor );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_scan_cursor_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_scan_cursor_initialize(
+		          &scan_cursor,
+		          internal_stream,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( scan_cursor != NULL )
+			{
+				libfsclfs_scan_cursor_free(
+				 &scan_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "scan_cursor",
+			 scan_cursor );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_cursor != NULL )
+	{
+		libfsclfs_scan_cursor_free(
+		 &scan_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* Tests the libfsclfs_scan_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scan_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scan_cursor_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_scan_cursor_get_current_lsn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scan_cursor_get_current_lsn(
+     libfsclfs_scan_cursor_t *scan_cursor )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t current_lsn     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_scan_cursor_get_current_lsn(
+	          scan_cursor,
+	          &current_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "current_lsn",
+	 current_lsn,
+	 (uint64_t) 0x0000000100080402ULL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scan_cursor_get_current_lsn(
+	          NULL,
+	          &current_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_get_current_lsn(
+	          scan_cursor,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_scan_cursor_get_state and libfsclfs_scan_cursor_set_state functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scan_cursor_get_and_set_state(
+     libfsclfs_scan_cursor_t *scan_cursor )
+{
+	uint8_t modified_state[ 50 ];
+	uint8_t state[ 50 ];
+
+	libcerror_error_t *error                               = NULL;
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor       = NULL;
+	size_t state_size                                      = 0;
+	uint64_t last_lsn                                      = 0;
+	uint64_t number_of_records                             = 0;
+	int result                                             = 0;
+
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+	stream_descriptor    = internal_scan_cursor->internal_stream->stream_descriptor;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_scan_cursor_get_state_size(
+	          scan_cursor,
+	          &state_size,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "state_size",
+	 state_size,
+	 (size_t) 50 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scan_cursor->number_of_records = 5;
+
+	result = libfsclfs_scan_cursor_get_state(
+	          scan_cursor,
+	          state,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scan_cursor->current_lsn       = LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN;
+	internal_scan_cursor->number_of_records = 0;
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          state,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_scan_cursor->current_lsn",
+	 internal_scan_cursor->current_lsn,
+	 (uint64_t) 0x0000000100080402ULL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_scan_cursor_get_number_of_records(
+	          scan_cursor,
+	          &number_of_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_records",
+	 number_of_records,
+	 (uint64_t) 5 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scan_cursor_get_state(
+	          NULL,
+	          state,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_get_state(
+	          scan_cursor,
+	          NULL,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_get_state(
+	          scan_cursor,
+	          state,
+	          49,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          NULL,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          state,
+	          49,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set state with an invalid signature
+	 */
+	memory_copy(
+	 modified_state,
+	 state,
+	 50 );
+
+	modified_state[ 0 ] = 'X';
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          modified_state,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set state with an invalid checksum
+	 */
+	memory_copy(
+	 modified_state,
+	 state,
+	 50 );
+
+	modified_state[ 32 ] ^= 0x01;
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          modified_state,
+	          50,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set state with a mismatching stream number
+	 */
+	stream_descriptor->number = 4;
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          state,
+	          50,
+	          &error );
+
+	stream_descriptor->number = 3;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set state with a LSN that is no longer part of the stream
+	 */
+	last_lsn                    = stream_descriptor->last_lsn;
+	stream_descriptor->last_lsn = 0x0000000100000200ULL;
+
+	result = libfsclfs_scan_cursor_set_state(
+	          scan_cursor,
+	          state,
+	          50,
+	          &error );
+
+	stream_descriptor->last_lsn = last_lsn;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_scan_cursor_set_record_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scan_cursor_set_record_filter(
+     libfsclfs_scan_cursor_t *scan_cursor )
+{
+	libcerror_error_t *error                               = NULL;
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	libfsclfs_record_t *record                             = NULL;
+	libfsclfs_record_filter_t *record_filter               = NULL;
+	int result                                             = 0;
+
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_record_filter_initialize(
+	          &record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_filter_set_record_types(
+	          record_filter,
+	          LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_scan_cursor_set_record_filter(
+	          scan_cursor,
+	          record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_scan_cursor->has_record_filter",
+	 internal_scan_cursor->has_record_filter,
+	 (uint8_t) 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_scan_cursor->record_filter.record_type_flags",
+	 internal_scan_cursor->record_filter.record_type_flags,
+	 (uint32_t) LIBFSCLFS_RECORD_TYPE_FLAG_IS_DATA );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_scan_cursor->stream_is_excluded",
+	 internal_scan_cursor->stream_is_excluded,
+	 (uint8_t) 0 );
+
+	/* Test if a scan cursor of an excluded stream does not return records
+	 */
+	internal_scan_cursor->stream_is_excluded = 1;
+
+	result = libfsclfs_scan_cursor_get_next_record(
+	          scan_cursor,
+	          &record,
+	          &error );
+
+	internal_scan_cursor->stream_is_excluded = 0;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test removing the record filter
+	 */
+	result = libfsclfs_scan_cursor_set_record_filter(
+	          scan_cursor,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_scan_cursor->has_record_filter",
+	 internal_scan_cursor->has_record_filter,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scan_cursor_set_record_filter(
+	          NULL,
+	          record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a stream index that is not in the store
+	 */
+	result = libfsclfs_record_filter_set_stream_index(
+	          record_filter,
+	          99,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_scan_cursor_set_record_filter(
+	          scan_cursor,
+	          record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_filter_free(
+	          &record_filter,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_filter",
+	 record_filter );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_filter != NULL )
+	{
+		libfsclfs_record_filter_free(
+		 &record_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_scan_cursor_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scan_cursor_get_next_record(
+     libfsclfs_scan_cursor_t *scan_cursor )
+{
+	libcerror_error_t *error                               = NULL;
+	libfsclfs_internal_scan_cursor_t *internal_scan_cursor = NULL;
+	libfsclfs_record_t *record                             = NULL;
+	uint64_t current_lsn                                   = 0;
+	int result                                             = 0;
+
+	internal_scan_cursor = (libfsclfs_internal_scan_cursor_t *) scan_cursor;
+
+	current_lsn = internal_scan_cursor->current_lsn;
+
+	/* Test regular cases
+	 */
+	internal_scan_cursor->current_lsn = LIBFSCLFS_SCAN_CURSOR_END_OF_STREAM_LSN;
+
+	result = libfsclfs_scan_cursor_get_next_record(
+	          scan_cursor,
+	          &record,
+	          &error );
+
+	internal_scan_cursor->current_lsn = current_lsn;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scan_cursor_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scan_cursor_get_next_record(
+	          scan_cursor,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_internal_stream_t internal_stream;
+	libfsclfs_scan_cursor_t *scan_cursor             = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	int result                                       = 0;
+#endif
+
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 ( (libfsclfs_internal_store_t *) store )->store_identifier,
+	 fsclfs_test_scan_cursor_store_identifier,
+	 16 );
+
+	result = libfsclfs_stream_descriptor_initialize(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_descriptor",
+	 stream_descriptor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream_descriptor->number   = 3;
+	stream_descriptor->base_lsn = 0x0000000000000200ULL;
+	stream_descriptor->last_lsn = 0x0000000100080402ULL;
+
+	internal_stream.internal_store    = (libfsclfs_internal_store_t *) store;
+	internal_stream.stream_descriptor = stream_descriptor;
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_scan_cursor_initialize",
+	 fsclfs_test_scan_cursor_initialize,
+	 &internal_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_scan_cursor_free",
+	 fsclfs_test_scan_cursor_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	result = libfsclfs_scan_cursor_initialize(
+	          &scan_cursor,
+	          &internal_stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_cursor",
+	 scan_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_scan_cursor_get_current_lsn",
+	 fsclfs_test_scan_cursor_get_current_lsn,
+	 scan_cursor );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_scan_cursor_set_record_filter",
+	 fsclfs_test_scan_cursor_set_record_filter,
+	 scan_cursor );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_scan_cursor_get_next_record",
+	 fsclfs_test_scan_cursor_get_next_record,
+	 scan_cursor );
+
+	FSCLFS_TEST_RUN_WITH_ARGS(
+	 "libfsclfs_scan_cursor_get_and_set_state",
+	 fsclfs_test_scan_cursor_get_and_set_state,
+	 scan_cursor );
+
+	/* Clean up
+	 */
+	result = libfsclfs_scan_cursor_free(
+	          &scan_cursor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "scan_cursor",
+	 scan_cursor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_free(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_cursor != NULL )
+	{
+		libfsclfs_scan_cursor_free(
+		 &scan_cursor,
+		 NULL );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
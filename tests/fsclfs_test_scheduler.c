@@ -0,0 +1,1041 @@
+/*
+ * Library scheduler type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_scheduler.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+#define FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS	64
+
+typedef struct fsclfs_test_scheduler_task fsclfs_test_scheduler_task_t;
+
+struct fsclfs_test_scheduler_task
+{
+	/* The amount of work of the task
+	 */
+	int cost;
+
+	/* The number of times the task was run
+	 */
+	int number_of_runs;
+
+	/* A value derived from the work done, to prevent the work being optimized away
+	 */
+	uint32_t checksum;
+};
+
+/* Task callback function used for testing
+ * Returns 1 if successful or -1 on error
+ */
+int fsclfs_test_scheduler_task_callback(
+     fsclfs_test_scheduler_task_t *task,
+     int worker_index FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "fsclfs_test_scheduler_task_callback";
+	uint32_t checksum     = 0;
+	int iterator          = 0;
+
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( worker_index )
+
+	if( task == NULL )
+	{
+		return( -1 );
+	}
+	for( iterator = 0;
+	     iterator < task->cost;
+	     iterator++ )
+	{
+		checksum = ( checksum * 31 ) + (uint32_t) iterator;
+	}
+	task->checksum        = checksum;
+	task->number_of_runs += 1;
+
+	if( callback_data != NULL )
+	{
+		/* Fail on the task that is passed as callback data
+		 */
+		if( callback_data == (void *) task )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: failing task.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libfsclfs_scheduler_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scheduler_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsclfs_scheduler_t *scheduler = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 3;
+	int number_of_memset_fail_tests  = 2;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          4,
+	          16,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "scheduler",
+	 scheduler );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "scheduler->number_of_workers",
+	 scheduler->number_of_workers,
+	 4 );
+
+	result = libfsclfs_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scheduler_initialize(
+	          NULL,
+	          4,
+	          16,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scheduler = (libfsclfs_scheduler_t *) 0x12345678UL;
+
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          4,
+	          16,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          NULL,
+	          &error );
+
+	scheduler = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          0,
+	          16,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          4,
+	          0,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          4,
+	          16,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_scheduler_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_scheduler_initialize(
+		          &scheduler,
+		          4,
+		          16,
+		          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+		          NULL,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( scheduler != NULL )
+			{
+				libfsclfs_scheduler_free(
+				 &scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "scheduler",
+			 scheduler );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_scheduler_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_scheduler_initialize(
+		          &scheduler,
+		          4,
+		          16,
+		          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+		          NULL,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( scheduler != NULL )
+			{
+				libfsclfs_scheduler_free(
+				 &scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "scheduler",
+			 scheduler );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_scheduler_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scheduler_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scheduler_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_scheduler_push_task, libfsclfs_scheduler_pop_task and libfsclfs_scheduler_steal_task functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scheduler_push_pop_steal_task(
+     void )
+{
+	fsclfs_test_scheduler_task_t tasks[ 3 ];
+
+	fsclfs_test_scheduler_task_t *task = NULL;
+	libcerror_error_t *error           = NULL;
+	libfsclfs_scheduler_t *scheduler   = NULL;
+	int result                         = 0;
+	int task_index                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          2,
+	          3,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( task_index = 0;
+	     task_index < 3;
+	     task_index++ )
+	{
+		result = libfsclfs_scheduler_push_task(
+		          scheduler,
+		          0,
+		          (intptr_t *) &( tasks[ task_index ] ),
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The deque of worker 0 is full, since tasks are only pushed before the scheduler is run
+	 */
+	result = libfsclfs_scheduler_push_task(
+	          scheduler,
+	          0,
+	          (intptr_t *) &( tasks[ 0 ] ),
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The worker takes its tasks from the front of its deque
+	 */
+	result = libfsclfs_scheduler_pop_task(
+	          scheduler,
+	          0,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "task == &( tasks[ 0 ] )",
+	 (int) ( task == &( tasks[ 0 ] ) ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Worker 1 has no tasks of its own
+	 */
+	result = libfsclfs_scheduler_pop_task(
+	          scheduler,
+	          1,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Other workers steal tasks from the back of the deque
+	 */
+	result = libfsclfs_scheduler_steal_task(
+	          scheduler,
+	          1,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "task == &( tasks[ 2 ] )",
+	 (int) ( task == &( tasks[ 2 ] ) ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_scheduler_pop_task(
+	          scheduler,
+	          0,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "task == &( tasks[ 1 ] )",
+	 (int) ( task == &( tasks[ 1 ] ) ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_scheduler_steal_task(
+	          scheduler,
+	          1,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scheduler_push_task(
+	          NULL,
+	          0,
+	          (intptr_t *) &( tasks[ 0 ] ),
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_push_task(
+	          scheduler,
+	          2,
+	          (intptr_t *) &( tasks[ 0 ] ),
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_pop_task(
+	          NULL,
+	          0,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_pop_task(
+	          scheduler,
+	          -1,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_pop_task(
+	          scheduler,
+	          0,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_steal_task(
+	          NULL,
+	          1,
+	          (intptr_t **) &task,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_steal_task(
+	          scheduler,
+	          1,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_scheduler_run function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_scheduler_run(
+     void )
+{
+	fsclfs_test_scheduler_task_t tasks[ FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS ];
+
+	libcerror_error_t *error         = NULL;
+	libfsclfs_scheduler_t *scheduler = NULL;
+	int number_of_tasks_run          = 0;
+	int number_of_workers            = 0;
+	int result                       = 0;
+	int task_index                   = 0;
+	int worker_index                 = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_workers = 1;
+	     number_of_workers <= 4;
+	     number_of_workers++ )
+	{
+		result = libfsclfs_scheduler_initialize(
+		          &scheduler,
+		          number_of_workers,
+		          FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS,
+		          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+		          NULL,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Skew the work: all the tasks are pushed onto the deque of the first worker
+		 * and the cost of the tasks increases steeply
+		 */
+		for( task_index = 0;
+		     task_index < FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS;
+		     task_index++ )
+		{
+			tasks[ task_index ].cost           = ( task_index % 8 == 7 ) ? 100000 : 10;
+			tasks[ task_index ].number_of_runs = 0;
+			tasks[ task_index ].checksum       = 0;
+
+			result = libfsclfs_scheduler_push_task(
+			          scheduler,
+			          0,
+			          (intptr_t *) &( tasks[ task_index ] ),
+			          &error );
+
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfsclfs_scheduler_run(
+		          scheduler,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Every task must have run exactly once
+		 */
+		for( task_index = 0;
+		     task_index < FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS;
+		     task_index++ )
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "tasks[ task_index ].number_of_runs",
+			 tasks[ task_index ].number_of_runs,
+			 1 );
+		}
+		number_of_tasks_run = 0;
+
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			number_of_tasks_run += scheduler->workers[ worker_index ].number_of_tasks_run;
+		}
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_tasks_run",
+		 number_of_tasks_run,
+		 FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS );
+
+		result = libfsclfs_scheduler_free(
+		          &scheduler,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test run with a failing task
+	 */
+	result = libfsclfs_scheduler_initialize(
+	          &scheduler,
+	          2,
+	          FSCLFS_TEST_SCHEDULER_NUMBER_OF_TASKS,
+	          (int (*)(intptr_t *, int, void *, libcerror_error_t **)) &fsclfs_test_scheduler_task_callback,
+	          (void *) &( tasks[ 3 ] ),
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( task_index = 0;
+	     task_index < 8;
+	     task_index++ )
+	{
+		tasks[ task_index ].cost = 10;
+
+		result = libfsclfs_scheduler_push_task(
+		          scheduler,
+		          task_index % 2,
+		          (intptr_t *) &( tasks[ task_index ] ),
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsclfs_scheduler_run(
+	          scheduler,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	/* The error of the failing task is returned
+	 */
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_scheduler_run(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scheduler != NULL )
+	{
+		libfsclfs_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_scheduler_initialize",
+	 fsclfs_test_scheduler_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_scheduler_free",
+	 fsclfs_test_scheduler_free );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_scheduler_push_pop_steal_task",
+	 fsclfs_test_scheduler_push_pop_steal_task );
+
+	/* TODO: add tests for libfsclfs_scheduler_worker_run */
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_scheduler_run",
+	 fsclfs_test_scheduler_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1568 @@
+/*
+ * Library statistics type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libbfio.h"
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_statistics_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsclfs_statistics_t *statistics = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_initialize(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	statistics = (libfsclfs_statistics_t *) 0x12345678UL;
+
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	statistics = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_statistics_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_statistics_initialize(
+		          &statistics,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( statistics != NULL )
+			{
+				libfsclfs_statistics_free(
+				 &statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "statistics",
+			 statistics );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_statistics_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_statistics_initialize(
+		          &statistics,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( statistics != NULL )
+			{
+				libfsclfs_statistics_free(
+				 &statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "statistics",
+			 statistics );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_set_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_set_file_io_handle(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsclfs_statistics_t *statistics = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          2,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "statistics->number_of_files",
+	 statistics->number_of_files,
+	 3 );
+
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          0,
+	          (libbfio_handle_t *) 0x87654321UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "statistics->number_of_files",
+	 statistics->number_of_files,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_set_file_io_handle(
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          -1,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_add_file_io_handle_clone and libfsclfs_statistics_remove_file_io_handle_clone functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_add_file_io_handle_clone(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsclfs_statistics_t *statistics = NULL;
+	uint64_t number_of_bytes_read      = 0;
+	uint64_t number_of_reads           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          1,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A clone of a clone is added to the file statistics of the original file IO handle
+	 */
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          (libbfio_handle_t *) 0x3456789aUL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A clone of a file IO handle without file statistics is not added
+	 */
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x87654321UL,
+	          (libbfio_handle_t *) 0x456789abUL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          256,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x3456789aUL,
+	          128,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x456789abUL,
+	          64,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_get_file_values(
+	          statistics,
+	          1,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes_read",
+	 number_of_bytes_read,
+	 (uint64_t) 384 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->number_of_reads",
+	 statistics->number_of_reads,
+	 (uint64_t) 3 );
+
+	/* A read of a removed clone is only added to the totals
+	 */
+	result = libfsclfs_statistics_remove_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          256,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_get_file_values(
+	          statistics,
+	          1,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          NULL,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          NULL,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_remove_file_io_handle_clone(
+	          NULL,
+	          (libbfio_handle_t *) 0x3456789aUL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_remove_file_io_handle_clone(
+	          statistics,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_get_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_get_slot(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsclfs_file_io_handle_slot_t *slot = NULL;
+	libfsclfs_statistics_t *statistics    = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          1,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the slot of a clone refers directly to the file statistics of its source
+	 */
+	result = libfsclfs_statistics_get_slot(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &slot,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "slot",
+	 slot );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "slot->is_clone",
+	 slot->is_clone,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "slot->file_statistics",
+	 (int) ( slot->file_statistics == statistics->files[ 1 ] ),
+	 1 );
+
+	/* A slot that is no longer in use is reused
+	 */
+	result = libfsclfs_statistics_remove_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_get_slot(
+	          statistics,
+	          (libbfio_handle_t *) 0x23456789UL,
+	          &slot,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "slot",
+	 slot );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_file_io_handle_clone(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          (libbfio_handle_t *) 0x3456789aUL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "statistics->slots->file_io_handle",
+	 (int) ( statistics->slots->file_io_handle == (libbfio_handle_t *) 0x3456789aUL ),
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics->slots->next_slot",
+	 statistics->slots->next_slot );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics->slots->next_slot->next_slot",
+	 statistics->slots->next_slot->next_slot );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_get_slot(
+	          NULL,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          &slot,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_get_slot(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_add_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_add_read(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsclfs_statistics_t *statistics = NULL;
+	uint64_t number_of_bytes_read      = 0;
+	uint64_t number_of_reads           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          1,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A read of a file IO handle without file statistics is only added to the totals
+	 */
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x87654321UL,
+	          1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->number_of_reads",
+	 statistics->number_of_reads,
+	 (uint64_t) 2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->number_of_bytes_read",
+	 statistics->number_of_bytes_read,
+	 (uint64_t) 1536 );
+
+	result = libfsclfs_statistics_get_file_values(
+	          statistics,
+	          1,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes_read",
+	 number_of_bytes_read,
+	 (uint64_t) 512 );
+
+	result = libfsclfs_statistics_get_file_values(
+	          statistics,
+	          8,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_add_read(
+	          NULL,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_get_file_values(
+	          statistics,
+	          -1,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_get_value(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsclfs_statistics_t *statistics = NULL;
+	uint64_t value                     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics->number_of_blocks_read = 7;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_statistics_get_value(
+	          statistics,
+	          LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_BLOCKS_READ,
+	          &value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 7 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_get_value(
+	          NULL,
+	          LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_BLOCKS_READ,
+	          &value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_get_value(
+	          statistics,
+	          -1,
+	          &value,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_statistics_get_value(
+	          statistics,
+	          LIBFSCLFS_STATISTICS_VALUE_NUMBER_OF_BLOCKS_READ,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_statistics_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_statistics_reset(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsclfs_statistics_t *statistics = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_set_file_io_handle(
+	          statistics,
+	          0,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_statistics_add_read(
+	          statistics,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics->number_of_fixups_applied = 3;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_statistics_reset(
+	          statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->number_of_reads",
+	 statistics->number_of_reads,
+	 (uint64_t) 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->number_of_fixups_applied",
+	 statistics->number_of_fixups_applied,
+	 (uint64_t) 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics->files[ 0 ]->number_of_bytes_read",
+	 statistics->files[ 0 ]->number_of_bytes_read,
+	 (uint64_t) 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics->slots",
+	 statistics->slots );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics->slots->file_io_handle",
+	 statistics->slots->file_io_handle );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_statistics_reset(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_statistics_free(
+	          &statistics,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		libfsclfs_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_initialize",
+	 fsclfs_test_statistics_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_free",
+	 fsclfs_test_statistics_free );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_set_file_io_handle",
+	 fsclfs_test_statistics_set_file_io_handle );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_add_file_io_handle_clone",
+	 fsclfs_test_statistics_add_file_io_handle_clone );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_get_slot",
+	 fsclfs_test_statistics_get_slot );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_add_read",
+	 fsclfs_test_statistics_add_read );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_get_value",
+	 fsclfs_test_statistics_get_value );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_statistics_reset",
+	 fsclfs_test_statistics_reset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -30,7 +30,10 @@
 #include <stdlib.h>
 #endif
 
+#include "fsclfs_test_block_data.h"
+#include "fsclfs_test_functions.h"
 #include "fsclfs_test_getopt.h"
+#include "fsclfs_test_libbfio.h"
 #include "fsclfs_test_libcerror.h"
 #include "fsclfs_test_libclocale.h"
 #include "fsclfs_test_libfsclfs.h"
@@ -38,6 +41,11 @@
 #include "fsclfs_test_macros.h"
 #include "fsclfs_test_memory.h"
 
+#include "../libfsclfs/libfsclfs_container_descriptor.h"
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_store.h"
+#include "../libfsclfs/libfsclfs_stream_descriptor.h"
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
 #endif
@@ -811,35 +819,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsclfs_store_open function
+/* Tests the libfsclfs_store_get_number_of_threads and libfsclfs_store_set_number_of_threads functions
  * Returns 1 if successful or 0 if not
  */
-int fsclfs_test_store_open(
-     const system_character_t *source )
+int fsclfs_test_store_get_set_number_of_threads(
+     void )
 {
-	char narrow_source[ 256 ];
-
 	libcerror_error_t *error = NULL;
 	libfsclfs_store_t *store = NULL;
+	int number_of_threads    = 0;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = fsclfs_test_store_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
-	          &error );
-
-	FSCLFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSCLFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	result = libfsclfs_store_initialize(
 	          &store,
 	          &error );
@@ -857,12 +849,11 @@ int fsclfs_test_store_open(
 	 "error",
 	 error );
 
-	/* Test open
+	/* Test regular cases
 	 */
-	result = libfsclfs_store_open(
+	result = libfsclfs_store_get_number_of_threads(
 	          store,
-	          narrow_source,
-	          LIBFSCLFS_OPEN_READ,
+	          &number_of_threads,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
@@ -870,34 +861,32 @@ int fsclfs_test_store_open(
 	 result,
 	 1 );
 
+	FSCLFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsclfs_store_open(
+	result = libfsclfs_store_set_number_of_threads(
 	          store,
-	          narrow_source,
-	          LIBFSCLFS_OPEN_READ,
+	          2,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfsclfs_store_free(
-	          &store,
+	result = libfsclfs_store_get_number_of_threads(
+	          store,
+	          &number_of_threads,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
@@ -905,102 +894,71 @@ int fsclfs_test_store_open(
 	 result,
 	 1 );
 
-	FSCLFS_TEST_ASSERT_IS_NULL(
-	 "store",
-	 store );
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 2 );
 
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( store != NULL )
-	{
-		libfsclfs_store_free(
-		 &store,
-		 NULL );
-	}
-	return( 0 );
-}
-
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libfsclfs_store_open_wide function
- * Returns 1 if successful or 0 if not
- */
-int fsclfs_test_store_open_wide(
-     const system_character_t *source )
-{
-	wchar_t wide_source[ 256 ];
-
-	libcerror_error_t *error = NULL;
-	libfsclfs_store_t *store = NULL;
-	int result               = 0;
-
-	/* Initialize test
+	/* Test error cases
 	 */
-	result = fsclfs_test_store_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
+	result = libfsclfs_store_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSCLFS_TEST_ASSERT_IS_NULL(
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfsclfs_store_initialize(
-	          &store,
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_store_get_number_of_threads(
+	          store,
+	          NULL,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
-	 "store",
-	 store );
-
-	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open
-	 */
-	result = libfsclfs_store_open_wide(
-	          store,
-	          wide_source,
-	          LIBFSCLFS_OPEN_READ,
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_store_set_number_of_threads(
+	          NULL,
+	          2,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSCLFS_TEST_ASSERT_IS_NULL(
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsclfs_store_open_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_store_set_number_of_threads(
 	          store,
-	          wide_source,
-	          LIBFSCLFS_OPEN_READ,
+	          0,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
@@ -1051,60 +1009,42 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libfsclfs_store_close function
+/* Tests the libfsclfs_store_get_direct_io and libfsclfs_store_set_direct_io functions
  * Returns 1 if successful or 0 if not
  */
-int fsclfs_test_store_close(
+int fsclfs_test_store_get_set_direct_io(
      void )
 {
 	libcerror_error_t *error = NULL;
+	libfsclfs_store_t *store = NULL;
+	uint8_t use_direct_io    = 0;
 	int result               = 0;
+	int set_result           = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libfsclfs_store_close(
-	          NULL,
+	result = libfsclfs_store_initialize(
+	          &store,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfsclfs_store_open and libfsclfs_store_close functions
- * Returns 1 if successful or 0 if not
- */
-int fsclfs_test_store_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error = NULL;
-	libfsclfs_store_t *store = NULL;
-	int result               = 0;
-
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libfsclfs_store_initialize(
-	          &store,
+	result = libfsclfs_store_get_direct_io(
+	          store,
+	          &use_direct_io,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
@@ -1112,87 +1052,553 @@ int fsclfs_test_store_open_close(
 	 result,
 	 1 );
 
-	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
-	 "store",
-	 store );
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_direct_io",
+	 use_direct_io,
+	 0 );
 
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
+	set_result = libfsclfs_store_set_direct_io(
+	              store,
+	              1,
+	              &error );
+
+#if defined( __linux__ ) || defined( __APPLE__ )
+	/* Direct IO is supported using O_DIRECT on Linux and F_NOCACHE on Mac OS X
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsclfs_store_open_wide(
-	          store,
-	          source,
-	          LIBFSCLFS_OPEN_READ,
-	          &error );
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "set_result",
+	 set_result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 #else
-	result = libfsclfs_store_open(
+	/* Direct IO is not supported on every platform
+	 */
+	FSCLFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "set_result",
+	 set_result,
+	 0 );
+
+	if( set_result == -1 )
+	{
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif
+	result = libfsclfs_store_get_direct_io(
 	          store,
-	          source,
-	          LIBFSCLFS_OPEN_READ,
+	          &use_direct_io,
 	          &error );
-#endif
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "use_direct_io",
+	 use_direct_io,
+	 (uint8_t) ( set_result == 1 ) );
+
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsclfs_store_close(
+	result = libfsclfs_store_set_direct_io(
 	          store,
+	          0,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsclfs_store_open_wide(
-	          store,
-	          source,
-	          LIBFSCLFS_OPEN_READ,
+	result = libfsclfs_store_get_direct_io(
+	          NULL,
+	          &use_direct_io,
 	          &error );
-#else
-	result = libfsclfs_store_open(
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_store_get_direct_io(
 	          store,
-	          source,
-	          LIBFSCLFS_OPEN_READ,
+	          NULL,
 	          &error );
-#endif
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSCLFS_TEST_ASSERT_IS_NULL(
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfsclfs_store_close(
-	          store,
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_store_set_direct_io(
+	          NULL,
+	          0,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	FSCLFS_TEST_ASSERT_IS_NULL(
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libfsclfs_store_t *store = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_store_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfsclfs_store_open(
+	          store,
+	          narrow_source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_open(
+	          store,
+	          narrow_source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libfsclfs_store_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libfsclfs_store_t *store = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_store_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfsclfs_store_open_wide(
+	          store,
+	          wide_source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_open_wide(
+	          store,
+	          wide_source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libfsclfs_store_close function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_close(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_open and libfsclfs_store_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libfsclfs_store_t *store = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsclfs_store_open_wide(
+	          store,
+	          source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsclfs_store_open(
+	          store,
+	          source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_close(
+	          store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsclfs_store_open_wide(
+	          store,
+	          source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsclfs_store_open(
+	          store,
+	          source,
+	          LIBFSCLFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_close(
+	          store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
@@ -1235,115 +1641,1649 @@ on_error:
 /* Tests the libfsclfs_store_get_number_of_containers function
  * Returns 1 if successful or 0 if not
  */
-int fsclfs_test_store_get_number_of_containers(
-     libfsclfs_store_t *store )
+int fsclfs_test_store_get_number_of_containers(
+     libfsclfs_store_t *store )
+{
+	libcerror_error_t *error        = NULL;
+	int number_of_containers        = 0;
+	int number_of_containers_is_set = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_store_get_number_of_containers(
+	          store,
+	          &number_of_containers,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_containers_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_get_number_of_containers(
+	          NULL,
+	          &number_of_containers,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_containers_is_set != 0 )
+	{
+		result = libfsclfs_store_get_number_of_containers(
+		          store,
+		          NULL,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_get_number_of_streams function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_get_number_of_streams(
+     libfsclfs_store_t *store )
+{
+	libcerror_error_t *error     = NULL;
+	int number_of_streams        = 0;
+	int number_of_streams_is_set = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_store_get_number_of_streams(
+	          store,
+	          &number_of_streams,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_streams_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_get_number_of_streams(
+	          NULL,
+	          &number_of_streams,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_streams_is_set != 0 )
+	{
+		result = libfsclfs_store_get_number_of_streams(
+		          store,
+		          NULL,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_refresh(
+     libfsclfs_store_t *store )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_store_refresh(
+	          store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A refresh without changes to the store metadata
+	 */
+	result = libfsclfs_store_refresh(
+	          store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_refresh(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Tests the libfsclfs_store_read_container_first_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_read_container_first_block_header(
+     void )
+{
+	uint8_t container_data[ 512 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_internal_store_t *internal_store = NULL;
+	libfsclfs_store_t *store                   = NULL;
+	size_t data_offset                         = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	result = libfsclfs_io_handle_set_geometry(
+	          internal_store->io_handle,
+	          512,
+	          512 * 1024,
+	          ( 512 * 1024 ) - 1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a container that does not start with a block
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		container_data[ data_offset ] = 0;
+	}
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_read_container_first_block_header(
+	          internal_store,
+	          file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a container that starts with a block of 1 sector
+	 */
+	container_data[ 0 ]   = 0x15;
+	container_data[ 4 ]   = 0x01;
+	container_data[ 6 ]   = 0x01;
+	container_data[ 104 ] = 0xf8;
+	container_data[ 105 ] = 0x01;
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_read_container_first_block_header(
+	          internal_store,
+	          file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_read_container_first_block_header(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a container that starts with a block with a mismatching number of sectors copy
+	 */
+	container_data[ 6 ] = 0x02;
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_read_container_first_block_header(
+	          internal_store,
+	          file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a container that is smaller than a block header
+	 */
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          64,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_read_container_first_block_header(
+	          internal_store,
+	          file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_determine_log_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_determine_log_type(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_internal_store_t *internal_store       = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	int entry_index                                  = 0;
+	int result                                       = 0;
+	int stream_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	/* Test regular cases
+	 */
+	for( stream_index = 0;
+	     stream_index < 2;
+	     stream_index++ )
+	{
+		result = libfsclfs_stream_descriptor_initialize(
+		          &stream_descriptor,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		stream_descriptor->number = (uint16_t) stream_index;
+
+		result = libcdata_array_append_entry(
+		          internal_store->stream_descriptors_array,
+		          &entry_index,
+		          (intptr_t *) stream_descriptor,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		stream_descriptor = NULL;
+
+		result = libfsclfs_store_determine_log_type(
+		          internal_store,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A single stream is a dedicated log, the physical stream
+		 * and a logical stream are a multiplexed log
+		 */
+		FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+		 "internal_store->is_dedicated_log",
+		 internal_store->is_dedicated_log,
+		 (uint8_t) ( stream_index == 0 ) );
+	}
+	/* Test error cases
+	 */
+	result = libfsclfs_store_determine_log_type(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_open_containers function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_open_containers(
+     void )
+{
+	char error_string[ 4096 ];
+	uint8_t container_data[ 512 ];
+
+	uint8_t container_names[ 2 ][ 18 ] = {
+		{ 'f', 0, 'i', 0, 'r', 0, 's', 0, 't', 0, '.', 0, 'b', 0, 'l', 0, 'f', 0 },
+		{ 'o', 0, 't', 0, 'h', 0, 'e', 0, 'r', 0, '.', 0, 'b', 0, 'l', 0, 'f', 0 } };
+
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libcerror_error_t *error                               = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	libfsclfs_store_t *store                               = NULL;
+	char *error_string_match                               = NULL;
+	int container_index                                    = 0;
+	int entry_index                                        = 0;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsclfs_store_set_basename_wide(
+	          internal_store,
+	          L"fsclfs_test_missing_",
+	          20,
+	          &error );
+#else
+	result = libfsclfs_store_set_basename(
+	          internal_store,
+	          "fsclfs_test_missing_",
+	          20,
+	          &error );
+#endif
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Both containers do not exist
+	 */
+	for( container_index = 0;
+	     container_index < 2;
+	     container_index++ )
+	{
+		result = libfsclfs_container_descriptor_initialize(
+		          &container_descriptor,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		container_descriptor->name = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * 18 );
+
+		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+		 "container_descriptor->name",
+		 container_descriptor->name );
+
+		memory_copy(
+		 container_descriptor->name,
+		 container_names[ container_index ],
+		 18 );
+
+		container_descriptor->name_size       = 18;
+		container_descriptor->physical_number = (uint32_t) container_index;
+		container_descriptor->logical_number  = (uint32_t) container_index;
+
+		result = libcdata_array_append_entry(
+		          internal_store->container_descriptors_array,
+		          &entry_index,
+		          (intptr_t *) container_descriptor,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		container_descriptor = NULL;
+	}
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_store->base_log_file_io_handle = file_io_handle;
+	internal_store->access_flags            = LIBFSCLFS_ACCESS_FLAG_READ;
+
+	/* Test error cases
+	 * the error names the first container that could not be opened
+	 */
+	result = libfsclfs_store_open_containers(
+	          store,
+	          &error );
+
+	internal_store->base_log_file_io_handle = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_backtrace_sprint(
+	          error,
+	          error_string,
+	          4096 );
+
+	FSCLFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	libcerror_error_free(
+	 &error );
+
+	error_string_match = narrow_string_search_string(
+	                      error_string,
+	                      "fsclfs_test_missing_first.blf",
+	                      4096 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error_string_match",
+	 error_string_match );
+
+	error_string_match = narrow_string_search_string(
+	                      error_string,
+	                      "fsclfs_test_missing_other.blf",
+	                      4096 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error_string_match",
+	 error_string_match );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_store->number_of_opened_container_descriptors",
+	 internal_store->number_of_opened_container_descriptors,
+	 0 );
+
+	result = libfsclfs_store_open_containers(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( container_descriptor != NULL )
+	{
+		libfsclfs_container_descriptor_free(
+		 &container_descriptor,
+		 NULL );
+	}
+	if( internal_store != NULL )
+	{
+		internal_store->base_log_file_io_handle = NULL;
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_refresh_container_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_refresh_container_descriptors(
+     void )
+{
+	libcdata_array_t *refreshed_container_descriptors_array = NULL;
+	libcerror_error_t *error                                = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor  = NULL;
+	libfsclfs_internal_store_t *internal_store              = NULL;
+	libfsclfs_store_t *store                                = NULL;
+	int entry_index                                         = 0;
+	int number_of_container_descriptors                     = 0;
+	int physical_number                                     = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	result = libfsclfs_container_descriptor_initialize(
+	          &container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	container_descriptor->file_size = 512 * 1024;
+
+	result = libcdata_array_append_entry(
+	          internal_store->container_descriptors_array,
+	          &entry_index,
+	          (intptr_t *) container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	container_descriptor = NULL;
+
+	result = libcdata_array_initialize(
+	          &refreshed_container_descriptors_array,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The refreshed store metadata contains the known container with a new size
+	 * and a container that was added
+	 */
+	for( physical_number = 0;
+	     physical_number < 2;
+	     physical_number++ )
+	{
+		result = libfsclfs_container_descriptor_initialize(
+		          &container_descriptor,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		container_descriptor->file_size       = 1024 * 1024;
+		container_descriptor->physical_number = (uint32_t) physical_number;
+		container_descriptor->logical_number  = (uint32_t) physical_number;
+
+		result = libcdata_array_append_entry(
+		          refreshed_container_descriptors_array,
+		          &entry_index,
+		          (intptr_t *) container_descriptor,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		container_descriptor = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libfsclfs_store_refresh_container_descriptors(
+	          internal_store,
+	          refreshed_container_descriptors_array,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          internal_store->container_descriptors_array,
+	          &number_of_container_descriptors,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_container_descriptors",
+	 number_of_container_descriptors,
+	 2 );
+
+	/* The known container is updated in place
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          internal_store->container_descriptors_array,
+	          0,
+	          (intptr_t **) &container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "container_descriptor->file_size",
+	 container_descriptor->file_size,
+	 (uint32_t) ( 1024 * 1024 ) );
+
+	/* The added container is moved from the refreshed container descriptors
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          internal_store->container_descriptors_array,
+	          1,
+	          (intptr_t **) &container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "container_descriptor->physical_number",
+	 container_descriptor->physical_number,
+	 (uint32_t) 1 );
+
+	result = libcdata_array_get_entry_by_index(
+	          refreshed_container_descriptors_array,
+	          1,
+	          (intptr_t **) &container_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "container_descriptor",
+	 container_descriptor );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_refresh_container_descriptors(
+	          NULL,
+	          refreshed_container_descriptors_array,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &refreshed_container_descriptors_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( refreshed_container_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &refreshed_container_descriptors_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsclfs_container_descriptor_free,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_set_container_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_set_container_file_io_handle(
+     void )
+{
+	uint8_t container_data[ 512 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsclfs_internal_store_t *internal_store = NULL;
+	libfsclfs_store_t *store                   = NULL;
+	int container_index                        = 0;
+	int number_of_handles                      = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_store_initialize(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_store = (libfsclfs_internal_store_t *) store;
+
+	/* Test regular cases
+	 * the container file IO pool is created for the 0 known containers
+	 * and grown for the containers that are added
+	 */
+	for( container_index = 0;
+	     container_index < 2;
+	     container_index++ )
+	{
+		result = fsclfs_test_open_file_io_handle(
+		          &file_io_handle,
+		          container_data,
+		          512,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsclfs_store_set_container_file_io_handle(
+		          internal_store,
+		          container_index,
+		          file_io_handle,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The container file IO pool now manages the file IO handle
+		 */
+		file_io_handle = NULL;
+
+		result = libbfio_pool_get_number_of_handles(
+		          internal_store->container_file_io_pool,
+		          &number_of_handles,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_handles",
+		 number_of_handles,
+		 container_index + 1 );
+	}
+	/* Test error cases
+	 */
+	result = libfsclfs_store_set_container_file_io_handle(
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_get_physical_block_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_get_physical_block_offset(
+     void )
 {
-	libcerror_error_t *error        = NULL;
-	int number_of_containers        = 0;
-	int number_of_containers_is_set = 0;
-	int result                      = 0;
+	uint8_t container_data[ 8192 ];
 
-	/* Test regular cases
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_internal_store_t *internal_store       = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	uint32_t physical_block_offset                   = 0;
+	int entry_index                                  = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 * the block of stream 2 at offset 1024 is addressed directly
 	 */
-	result = libfsclfs_store_get_number_of_containers(
-	          store,
-	          &number_of_containers,
+	result = fsclfs_test_set_region_data(
+	          container_data,
+	          8192 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	container_data[ 0x0400 + 0x70 ] = 0x00;
+	container_data[ 0x0400 + 0x71 ] = 0x04;
+	container_data[ 0x0400 + 0x72 ] = 0x00;
+
+	result = libfsclfs_store_initialize(
+	          &store,
 	          &error );
 
-	FSCLFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
 
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_containers_is_set = result;
+	internal_store = (libfsclfs_internal_store_t *) store;
 
-	/* Test error cases
+	result = libfsclfs_io_handle_set_geometry(
+	          internal_store->io_handle,
+	          512,
+	          0x00002000UL,
+	          0x00001e00UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A dedicated log with a single stream that is not stream 0
 	 */
-	result = libfsclfs_store_get_number_of_containers(
-	          NULL,
-	          &number_of_containers,
+	result = libfsclfs_stream_descriptor_initialize(
+	          &stream_descriptor,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	stream_descriptor->number = 2;
 
-	if( number_of_containers_is_set != 0 )
-	{
-		result = libfsclfs_store_get_number_of_containers(
-		          store,
-		          NULL,
-		          &error );
+	result = libcdata_array_append_entry(
+	          internal_store->stream_descriptors_array,
+	          &entry_index,
+	          (intptr_t *) stream_descriptor,
+	          &error );
 
-		FSCLFS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	stream_descriptor = NULL;
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	result = libfsclfs_store_determine_log_type(
+	          internal_store,
+	          &error );
 
-/* Tests the libfsclfs_store_get_number_of_streams function
- * Returns 1 if successful or 0 if not
- */
-int fsclfs_test_store_get_number_of_streams(
-     libfsclfs_store_t *store )
-{
-	libcerror_error_t *error     = NULL;
-	int number_of_streams        = 0;
-	int number_of_streams_is_set = 0;
-	int result                   = 0;
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_store->is_dedicated_log",
+	 internal_store->is_dedicated_log,
+	 1 );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          container_data,
+	          8192,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libfsclfs_store_get_number_of_streams(
-	          store,
-	          &number_of_streams,
+	result = libfsclfs_store_get_physical_block_offset(
+	          internal_store,
+	          2,
+	          0,
+	          0,
+	          0x00000400UL,
+	          file_io_handle,
+	          &physical_block_offset,
 	          &error );
 
-	FSCLFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_block_offset",
+	 physical_block_offset,
+	 (uint32_t) 0x00000400UL );
 
 	FSCLFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_streams_is_set = result;
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_store->is_dedicated_log",
+	 internal_store->is_dedicated_log,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_store->dedicated_log_is_checked",
+	 internal_store->dedicated_log_is_checked,
+	 1 );
+
+	/* Test a block of which the header does not match the direct addressing
+	 * the virtual LSN of the block at offset 512 is 0x10200, hence the stream
+	 * is mapped onto the region of which the owner page refers to streams
+	 * that are not in the store
+	 */
+	result = libfsclfs_store_determine_log_type(
+	          internal_store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_get_physical_block_offset(
+	          internal_store,
+	          2,
+	          0,
+	          0,
+	          0x00000200UL,
+	          file_io_handle,
+	          &physical_block_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_store->is_dedicated_log",
+	 internal_store->is_dedicated_log,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_store->dedicated_log_is_checked",
+	 internal_store->dedicated_log_is_checked,
+	 1 );
 
 	/* Test error cases
 	 */
-	result = libfsclfs_store_get_number_of_streams(
+	result = libfsclfs_store_get_physical_block_offset(
+	          internal_store,
+	          2,
+	          0,
+	          0,
+	          0x00000400UL,
+	          file_io_handle,
 	          NULL,
-	          &number_of_streams,
 	          &error );
 
 	FSCLFS_TEST_ASSERT_EQUAL_INT(
@@ -1358,25 +3298,38 @@ int fsclfs_test_store_get_number_of_streams(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_streams_is_set != 0 )
-	{
-		result = libfsclfs_store_get_number_of_streams(
-		          store,
-		          NULL,
-		          &error );
+	/* Clean up
+	 */
+	result = fsclfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
 
-		FSCLFS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		FSCLFS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1385,9 +3338,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1443,6 +3416,42 @@ int main(
 	 "libfsclfs_store_free",
 	 fsclfs_test_store_free );
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_get_set_number_of_threads",
+	 fsclfs_test_store_get_set_number_of_threads );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_get_set_direct_io",
+	 fsclfs_test_store_get_set_direct_io );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_read_container_first_block_header",
+	 fsclfs_test_store_read_container_first_block_header );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_determine_log_type",
+	 fsclfs_test_store_determine_log_type );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_open_containers",
+	 fsclfs_test_store_open_containers );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_refresh_container_descriptors",
+	 fsclfs_test_store_refresh_container_descriptors );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_set_container_file_io_handle",
+	 fsclfs_test_store_set_container_file_io_handle );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_get_physical_block_offset",
+	 fsclfs_test_store_get_physical_block_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1547,6 +3556,11 @@ int main(
 		 fsclfs_test_store_get_number_of_streams,
 		 store );
 
+		FSCLFS_TEST_RUN_WITH_ARGS(
+		 "libfsclfs_store_refresh",
+		 fsclfs_test_store_refresh,
+		 store );
+
 		/* TODO: add tests for libfsclfs_store_get_stream */
 
 #if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
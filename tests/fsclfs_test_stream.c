@@ -21,19 +21,27 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsclfs_test_block_data.h"
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
 #include "fsclfs_test_libcerror.h"
 #include "fsclfs_test_libfsclfs.h"
 #include "fsclfs_test_macros.h"
 #include "fsclfs_test_memory.h"
 #include "fsclfs_test_unused.h"
 
+#include "../libfsclfs/libfsclfs_container_descriptor.h"
+#include "../libfsclfs/libfsclfs_record_header_table.h"
+#include "../libfsclfs/libfsclfs_store.h"
 #include "../libfsclfs/libfsclfs_stream.h"
+#include "../libfsclfs/libfsclfs_stream_descriptor.h"
 
 /* Tests the libfsclfs_stream_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +83,1475 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
 
+/* Container data of 3 blocks, the blocks of the stream are at LSN 0x200 and 0x400
+ */
+uint8_t fsclfs_test_stream_data[ 1536 ];
+
+/* Sets up the container data of the test
+ * The block at LSN 0x200 contains restart record 0x200 and the block at LSN 0x400
+ * contains restart record 0x401, which refer to the preceding records of the stream
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_stream_set_data(
+     void )
+{
+	size_t block_offset = 0;
+
+	if( memory_set(
+	     fsclfs_test_stream_data,
+	     0,
+	     1536 ) == NULL )
+	{
+		return( 0 );
+	}
+	for( block_offset = 512;
+	     block_offset < 1536;
+	     block_offset += 512 )
+	{
+		if( fsclfs_test_set_block_data(
+		     &( fsclfs_test_stream_data[ block_offset ] ),
+		     1536 - block_offset,
+		     0 ) != 1 )
+		{
+			return( 0 );
+		}
+		/* The previous LSN of the first record
+		 */
+		fsclfs_test_stream_data[ block_offset + 0x80 ] = 0x00;
+		fsclfs_test_stream_data[ block_offset + 0x81 ] = 0x00;
+	}
+	/* The first record of the block at LSN 0x200 is a restart record
+	 */
+	fsclfs_test_stream_data[ 512 + 0x94 ] = 0x03;
+	fsclfs_test_stream_data[ 512 + 0xb1 ] = 0x02;
+
+	/* The first record of the block at LSN 0x400 refers to record 0x201
+	 * and the last record is a restart record
+	 */
+	fsclfs_test_stream_data[ 1024 + 0x80 ] = 0x01;
+	fsclfs_test_stream_data[ 1024 + 0x81 ] = 0x02;
+	fsclfs_test_stream_data[ 1024 + 0xb1 ] = 0x04;
+	fsclfs_test_stream_data[ 1024 + 0xc4 ] = 0x23;
+
+	return( 1 );
+}
+
+/* Creates a store of which the first container contains the test data
+ * The stream descriptor is managed by the store
+ * Returns 1 if successful or -1 on error
+ */
+int fsclfs_test_stream_initialize_store(
+     libfsclfs_store_t **store,
+     libfsclfs_stream_descriptor_t **stream_descriptor,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libfsclfs_container_descriptor_t *container_descriptor = NULL;
+	libfsclfs_internal_store_t *internal_store             = NULL;
+	static char *function                                  = "fsclfs_test_stream_initialize_store";
+	int entry_index                                        = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsclfs_test_stream_set_data() != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set container data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsclfs_store_initialize(
+	     store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create store.",
+		 function );
+
+		goto on_error;
+	}
+	internal_store = (libfsclfs_internal_store_t *) *store;
+
+	if( libfsclfs_container_descriptor_initialize(
+	     &container_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_store->container_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) container_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append container descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	container_descriptor = NULL;
+
+	if( fsclfs_test_open_file_io_handle(
+	     &file_io_handle,
+	     fsclfs_test_stream_data,
+	     1536,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_initialize(
+	     &( internal_store->container_file_io_pool ),
+	     1,
+	     internal_store->maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	internal_store->container_file_io_pool_created_in_library = 1;
+
+	if( libbfio_pool_set_handle(
+	     internal_store->container_file_io_pool,
+	     0,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set container file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The container file IO pool now manages the file IO handle
+	 */
+	file_io_handle = NULL;
+
+	if( libfsclfs_stream_descriptor_initialize(
+	     stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream_descriptor )->base_lsn = 0x200;
+	( *stream_descriptor )->last_lsn = 0x401;
+
+	if( libcdata_array_append_entry(
+	     internal_store->stream_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) *stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append stream descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 stream_descriptor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		fsclfs_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( container_descriptor != NULL )
+	{
+		libfsclfs_container_descriptor_free(
+		 &container_descriptor,
+		 NULL );
+	}
+	if( *store != NULL )
+	{
+		libfsclfs_store_free(
+		 store,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsclfs_stream_read_record_header_table function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_stream_read_record_header_table(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfsclfs_record_header_table_t *record_header_table = NULL;
+	libfsclfs_store_t *store                             = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor     = NULL;
+	libfsclfs_stream_t *stream                           = NULL;
+	const uint64_t *previous_lsns                        = NULL;
+	const uint32_t *record_types                         = NULL;
+	uint64_t block_lsn                                   = 0;
+	int number_of_records                                = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_stream_initialize_store(
+	          &store,
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_initialize(
+	          &stream,
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_initialize(
+	          &record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_header_table",
+	 record_header_table );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the record headers of the block that contains record 0x401 are read
+	 */
+	result = libfsclfs_stream_read_record_header_table(
+	          stream,
+	          0x401,
+	          record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_get_block_lsn(
+	          record_header_table,
+	          &block_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "block_lsn",
+	 block_lsn,
+	 (uint64_t) 0x400 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_get_number_of_records(
+	          record_header_table,
+	          &number_of_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_header_table_get_previous_lsns(
+	          record_header_table,
+	          &previous_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "previous_lsns",
+	 previous_lsns );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "previous_lsns[ 0 ]",
+	 previous_lsns[ 0 ],
+	 (uint64_t) 0x201 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "previous_lsns[ 1 ]",
+	 previous_lsns[ 1 ],
+	 (uint64_t) 0x400 );
+
+	result = libfsclfs_record_header_table_get_record_types(
+	          record_header_table,
+	          &record_types,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record_types",
+	 record_types );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_types[ 1 ]",
+	 record_types[ 1 ],
+	 (uint32_t) 0x23 );
+
+	/* Test a record in a block that is not stored in the container
+	 */
+	result = libfsclfs_stream_read_record_header_table(
+	          stream,
+	          0x0000000100000200ULL,
+	          record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_stream_read_record_header_table(
+	          NULL,
+	          0x401,
+	          record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_read_record_header_table(
+	          stream,
+	          0x401,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_record_header_table_free(
+	          &record_header_table,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record_header_table",
+	 record_header_table );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_free(
+	          &stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_header_table != NULL )
+	{
+		libfsclfs_record_header_table_free(
+		 &record_header_table,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		libfsclfs_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_stream_get_number_of_restart_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_stream_get_number_of_restart_records(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	libfsclfs_stream_t *stream                       = NULL;
+	int number_of_restart_records                    = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_stream_initialize_store(
+	          &store,
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_initialize(
+	          &stream,
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_stream_get_number_of_restart_records(
+	          stream,
+	          &number_of_restart_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_restart_records",
+	 number_of_restart_records,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_stream_get_number_of_restart_records(
+	          NULL,
+	          &number_of_restart_records,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_get_number_of_restart_records(
+	          stream,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_stream_free(
+	          &stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfsclfs_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_stream_get_restart_record_lsn_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_stream_get_restart_record_lsn_by_index(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	libfsclfs_stream_t *stream                       = NULL;
+	uint64_t restart_record_lsn                      = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_stream_initialize_store(
+	          &store,
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_initialize(
+	          &stream,
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * index 0 refers to the most recent restart record
+	 */
+	result = libfsclfs_stream_get_restart_record_lsn_by_index(
+	          stream,
+	          0,
+	          &restart_record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_record_lsn",
+	 restart_record_lsn,
+	 (uint64_t) 0x401 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_get_restart_record_lsn_by_index(
+	          stream,
+	          1,
+	          &restart_record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_record_lsn",
+	 restart_record_lsn,
+	 (uint64_t) 0x200 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_stream_get_restart_record_lsn_by_index(
+	          NULL,
+	          0,
+	          &restart_record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_get_restart_record_lsn_by_index(
+	          stream,
+	          -1,
+	          &restart_record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_get_restart_record_lsn_by_index(
+	          stream,
+	          2,
+	          &restart_record_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_get_restart_record_lsn_by_index(
+	          stream,
+	          0,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_stream_free(
+	          &stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfsclfs_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_stream_get_last_restart_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_stream_get_last_restart_record(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_record_t *record                       = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	libfsclfs_stream_t *stream                       = NULL;
+	uint64_t previous_lsn                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_stream_initialize_store(
+	          &store,
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_initialize(
+	          &stream,
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_stream_get_last_restart_record(
+	          stream,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The most recent restart record is the last record of the block at LSN 0x400
+	 */
+	result = libfsclfs_record_get_previous_lsn(
+	          record,
+	          &previous_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "previous_lsn",
+	 previous_lsn,
+	 (uint64_t) 0x400 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_record_free(
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream without restart records
+	 */
+	stream_descriptor->last_lsn = 0x201;
+	stream_descriptor->base_lsn = 0x201;
+
+	result = libfsclfs_stream_get_last_restart_record(
+	          stream,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_stream_get_last_restart_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_stream_free(
+	          &stream,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfsclfs_record_free(
+		 &record,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		libfsclfs_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_store_read_stream_restart_lsns function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_store_read_stream_restart_lsns(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_store_t *store                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	uint64_t restart_lsn                             = 0;
+	int number_of_restart_lsns                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_stream_initialize_store(
+	          &store,
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the last LSN refers to the last record of the block at LSN 0x200
+	 */
+	stream_descriptor->last_lsn = 0x201;
+
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "stream_descriptor->number_of_restart_lsns",
+	 stream_descriptor->number_of_restart_lsns,
+	 1 );
+
+	/* The stream was appended with the first record of the block at LSN 0x400
+	 * the block at LSN 0x200 is read again but restart record 0x200 was read
+	 * before the previous last LSN and is not added again
+	 */
+	stream_descriptor->last_lsn = 0x400;
+
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "stream_descriptor->number_of_restart_lsns",
+	 stream_descriptor->number_of_restart_lsns,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stream_descriptor->restart_lsns_last_lsn",
+	 stream_descriptor->restart_lsns_last_lsn,
+	 (uint64_t) 0x400 );
+
+	/* The stream was appended with restart record 0x401, only the block
+	 * at LSN 0x400 that contains the previous last LSN is read again
+	 */
+	stream_descriptor->last_lsn = 0x401;
+
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+	          stream_descriptor,
+	          &number_of_restart_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_restart_lsns",
+	 number_of_restart_lsns,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          0,
+	          &restart_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_lsn",
+	 restart_lsn,
+	 (uint64_t) 0x401 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          1,
+	          &restart_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_lsn",
+	 restart_lsn,
+	 (uint64_t) 0x200 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The stream was truncated, the restart record LSNs are cleared and read again
+	 */
+	stream_descriptor->last_lsn = 0x201;
+
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+	          stream_descriptor,
+	          &number_of_restart_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_restart_lsns",
+	 number_of_restart_lsns,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          0,
+	          &restart_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_lsn",
+	 restart_lsn,
+	 (uint64_t) 0x200 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stream_descriptor->restart_lsns_last_lsn",
+	 stream_descriptor->restart_lsns_last_lsn,
+	 (uint64_t) 0x201 );
+
+	/* The stream was reset
+	 */
+	stream_descriptor->base_lsn = 0;
+	stream_descriptor->last_lsn = 0;
+
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          (libfsclfs_internal_store_t *) store,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "stream_descriptor->number_of_restart_lsns",
+	 stream_descriptor->number_of_restart_lsns,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          NULL,
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_store_read_stream_restart_lsns(
+	          (libfsclfs_internal_store_t *) store,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_store_free(
+	          &store,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfsclfs_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 /* The main program
@@ -118,6 +1595,28 @@ int main(
 
 	/* TODO: add tests for libfsclfs_stream_get_record_by_lsn */
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_stream_read_record_header_table",
+	 fsclfs_test_stream_read_record_header_table );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_stream_get_number_of_restart_records",
+	 fsclfs_test_stream_get_number_of_restart_records );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_stream_get_restart_record_lsn_by_index",
+	 fsclfs_test_stream_get_restart_record_lsn_by_index );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_stream_get_last_restart_record",
+	 fsclfs_test_stream_get_last_restart_record );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_store_read_stream_restart_lsns",
+	 fsclfs_test_store_read_stream_restart_lsns );
+
+	/* TODO: add tests for libfsclfs_stream_get_scan_cursor */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -270,6 +270,331 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsclfs_stream_descriptor_insert_restart_lsns function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_stream_descriptor_insert_restart_lsns(
+     void )
+{
+	uint64_t newer_restart_lsns[ 2 ]                 = { 0x0000000100000402UL, 0x0000000100000200UL };
+	uint64_t restart_lsns[ 2 ]                       = { 0x0000000000000c01UL, 0x0000000000000400UL };
+	libcerror_error_t *error                         = NULL;
+	libfsclfs_stream_descriptor_t *stream_descriptor = NULL;
+	uint64_t restart_lsn                             = 0;
+	int number_of_restart_lsns                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_stream_descriptor_initialize(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_descriptor",
+	 stream_descriptor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_stream_descriptor_insert_restart_lsns(
+	          stream_descriptor,
+	          restart_lsns,
+	          2,
+	          0x0000000000000c01UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if restart LSNs that precede the base LSN are removed
+	 * and more recent restart LSNs are inserted at the start
+	 */
+	stream_descriptor->base_lsn = 0x0000000000000800UL;
+
+	result = libfsclfs_stream_descriptor_insert_restart_lsns(
+	          stream_descriptor,
+	          newer_restart_lsns,
+	          2,
+	          0x0000000100000402UL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+	          stream_descriptor,
+	          &number_of_restart_lsns,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_restart_lsns",
+	 number_of_restart_lsns,
+	 3 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          0,
+	          &restart_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_lsn",
+	 restart_lsn,
+	 (uint64_t) 0x0000000100000402UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          2,
+	          &restart_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "restart_lsn",
+	 restart_lsn,
+	 (uint64_t) 0x0000000000000c01UL );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stream_descriptor->restart_lsns_last_lsn",
+	 stream_descriptor->restart_lsns_last_lsn,
+	 (uint64_t) 0x0000000100000402UL );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_stream_descriptor_insert_restart_lsns(
+	          NULL,
+	          restart_lsns,
+	          2,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_descriptor_insert_restart_lsns(
+	          stream_descriptor,
+	          NULL,
+	          2,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_descriptor_insert_restart_lsns(
+	          stream_descriptor,
+	          restart_lsns,
+	          -1,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          3,
+	          &restart_lsn,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_descriptor_get_restart_lsn_by_index(
+	          stream_descriptor,
+	          0,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_stream_descriptor_get_number_of_restart_lsns(
+	          stream_descriptor,
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfsclfs_stream_descriptor_clear_restart_lsns
+	 */
+	result = libfsclfs_stream_descriptor_clear_restart_lsns(
+	          stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "stream_descriptor->number_of_restart_lsns",
+	 stream_descriptor->number_of_restart_lsns,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "stream_descriptor->restart_lsns_last_lsn",
+	 stream_descriptor->restart_lsns_last_lsn,
+	 (uint64_t) 0 );
+
+	result = libfsclfs_stream_descriptor_clear_restart_lsns(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_stream_descriptor_free(
+	          &stream_descriptor,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "stream_descriptor",
+	 stream_descriptor );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_descriptor != NULL )
+	{
+		libfsclfs_stream_descriptor_free(
+		 &stream_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +622,10 @@ int main(
 	 "libfsclfs_stream_descriptor_free",
 	 fsclfs_test_stream_descriptor_free );
 
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_stream_descriptor_insert_restart_lsns",
+	 fsclfs_test_stream_descriptor_insert_restart_lsns );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,643 @@
+/*
+ * Tools export_handle type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../fsclfstools/export_handle.h"
+
+/* Tests the export_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_tools_export_handle_initialize(
+     void )
+{
+	export_handle_t *export_handle  = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_initialize(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	export_handle = (export_handle_t *) 0x12345678UL;
+
+	result = export_handle_initialize(
+	          &export_handle,
+	          &error );
+
+	export_handle = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test export_handle_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = export_handle_initialize(
+		          &export_handle,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( export_handle != NULL )
+			{
+				export_handle_free(
+				 &export_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "export_handle",
+			 export_handle );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test export_handle_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = export_handle_initialize(
+		          &export_handle,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( export_handle != NULL )
+			{
+				export_handle_free(
+				 &export_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "export_handle",
+			 export_handle );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_tools_export_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = export_handle_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_tools_export_handle_write_data(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	export_handle_t *export_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	FILE *output_stream            = NULL;
+	long output_size               = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	output_stream = tmpfile();
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "output_stream",
+	 output_stream );
+
+	export_handle->output_stream = output_stream;
+
+	memory_set(
+	 data,
+	 0x5a,
+	 64 );
+
+	/* Test regular cases
+	 */
+	result = export_handle_write_data(
+	          export_handle,
+	          data,
+	          64,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "export_handle->buffer_offset",
+	 export_handle->buffer_offset,
+	 (size_t) 64 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "export_handle->output_offset",
+	 export_handle->output_offset,
+	 (uint64_t) 64 );
+
+	result = export_handle_flush_buffer(
+	          export_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_SIZE(
+	 "export_handle->buffer_offset",
+	 export_handle->buffer_offset,
+	 (size_t) 0 );
+
+	output_size = ftell(
+	               output_stream );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "output_size",
+	 (int) output_size,
+	 64 );
+
+	/* Test error cases
+	 */
+	result = export_handle_write_data(
+	          NULL,
+	          data,
+	          64,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_write_data(
+	          export_handle,
+	          NULL,
+	          64,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	export_handle->output_stream = NULL;
+
+	file_stream_close(
+	 output_stream );
+
+	output_stream = NULL;
+
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle->output_stream = NULL;
+
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	return( 0 );
+}
+
+/* Tests the export_handle_system_string_copy_from_64_bit_in_decimal function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_tools_export_handle_system_string_copy_from_64_bit_in_decimal(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          _SYSTEM_STRING( "1048576" ),
+	          &value_64bit,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 1048576 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          _SYSTEM_STRING( "18446744073709551615" ),
+	          &value_64bit,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) UINT64_MAX );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          NULL,
+	          &value_64bit,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          _SYSTEM_STRING( "1048576" ),
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          _SYSTEM_STRING( "" ),
+	          &value_64bit,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          _SYSTEM_STRING( "0x1000" ),
+	          &value_64bit,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_handle_system_string_copy_from_64_bit_in_decimal(
+	          _SYSTEM_STRING( "18446744073709551616" ),
+	          &value_64bit,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSCLFS_TEST_RUN(
+	 "export_handle_initialize",
+	 fsclfs_test_tools_export_handle_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "export_handle_free",
+	 fsclfs_test_tools_export_handle_free );
+
+	FSCLFS_TEST_RUN(
+	 "export_handle_write_data",
+	 fsclfs_test_tools_export_handle_write_data );
+
+	FSCLFS_TEST_RUN(
+	 "export_handle_system_string_copy_from_64_bit_in_decimal",
+	 fsclfs_test_tools_export_handle_system_string_copy_from_64_bit_in_decimal );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,310 @@
+/*
+ * Library trace functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_trace.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+typedef struct fsclfs_test_trace_values fsclfs_test_trace_values_t;
+
+struct fsclfs_test_trace_values
+{
+	/* The number of events
+	 */
+	int number_of_events;
+
+	/* The last event type
+	 */
+	int event_type;
+
+	/* The last event phase
+	 */
+	int event_phase;
+
+	/* The last timestamp
+	 */
+	uint64_t timestamp;
+
+	/* The last value
+	 */
+	uint64_t value;
+};
+
+/* Trace callback function used for testing
+ */
+void fsclfs_test_trace_callback(
+      int event_type,
+      int event_phase,
+      uint64_t timestamp,
+      uint64_t value,
+      void *callback_data )
+{
+	fsclfs_test_trace_values_t *trace_values = NULL;
+
+	if( callback_data == NULL )
+	{
+		return;
+	}
+	trace_values = (fsclfs_test_trace_values_t *) callback_data;
+
+	trace_values->number_of_events += 1;
+	trace_values->event_type        = event_type;
+	trace_values->event_phase       = event_phase;
+	trace_values->timestamp         = timestamp;
+	trace_values->value             = value;
+}
+
+/* Tests the libfsclfs_trace_get_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_trace_get_timestamp(
+     void )
+{
+	uint64_t first_timestamp  = 0;
+	uint64_t second_timestamp = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	first_timestamp  = libfsclfs_trace_get_timestamp();
+	second_timestamp = libfsclfs_trace_get_timestamp();
+
+	result = ( second_timestamp >= first_timestamp ) ? 1 : 0;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsclfs_trace_event function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_trace_event(
+     void )
+{
+	fsclfs_test_trace_values_t trace_values;
+
+	libcerror_error_t *error         = NULL;
+	libfsclfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	trace_values.number_of_events = 0;
+	trace_values.event_type       = 0;
+	trace_values.event_phase      = 0;
+	trace_values.timestamp        = 0;
+	trace_values.value            = 0;
+
+	/* Test regular cases
+	 */
+	libfsclfs_trace_event(
+	 io_handle,
+	 LIBFSCLFS_TRACE_EVENT_READ_BLOCK,
+	 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+	 0x1000 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_events",
+	 trace_values.number_of_events,
+	 0 );
+
+	io_handle->trace_callback      = &fsclfs_test_trace_callback;
+	io_handle->trace_callback_data = (void *) &trace_values;
+
+	libfsclfs_trace_event(
+	 io_handle,
+	 LIBFSCLFS_TRACE_EVENT_READ_BLOCK,
+	 LIBFSCLFS_TRACE_EVENT_PHASE_END,
+	 0x1000 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_events",
+	 trace_values.number_of_events,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.event_type",
+	 trace_values.event_type,
+	 LIBFSCLFS_TRACE_EVENT_READ_BLOCK );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.event_phase",
+	 trace_values.event_phase,
+	 LIBFSCLFS_TRACE_EVENT_PHASE_END );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT64(
+	 "trace_values.value",
+	 trace_values.value,
+	 (uint64_t) 0x1000 );
+
+	/* Test that the trace callback is preserved when the IO handle is cleared
+	 */
+	result = libfsclfs_io_handle_clear(
+	          io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfsclfs_trace_event(
+	 io_handle,
+	 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+	 LIBFSCLFS_TRACE_EVENT_PHASE_FAILED,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_events",
+	 trace_values.number_of_events,
+	 2 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.event_type",
+	 trace_values.event_type,
+	 LIBFSCLFS_TRACE_EVENT_READ_RECORD );
+
+	/* Test error cases
+	 */
+	libfsclfs_trace_event(
+	 NULL,
+	 LIBFSCLFS_TRACE_EVENT_READ_RECORD,
+	 LIBFSCLFS_TRACE_EVENT_PHASE_BEGIN,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "trace_values.number_of_events",
+	 trace_values.number_of_events,
+	 2 );
+
+	/* Clean up
+	 */
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_trace_get_timestamp",
+	 fsclfs_test_trace_get_timestamp );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_trace_event",
+	 fsclfs_test_trace_event );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
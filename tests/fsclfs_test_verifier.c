@@ -0,0 +1,1399 @@
+/*
+ * Library verifier type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsclfs_test_block_data.h"
+#include "fsclfs_test_functions.h"
+#include "fsclfs_test_libbfio.h"
+#include "fsclfs_test_libcerror.h"
+#include "fsclfs_test_libfsclfs.h"
+#include "fsclfs_test_macros.h"
+#include "fsclfs_test_memory.h"
+#include "fsclfs_test_unused.h"
+
+#include "../libfsclfs/libfsclfs_block.h"
+#include "../libfsclfs/libfsclfs_checksum.h"
+#include "../libfsclfs/libfsclfs_io_handle.h"
+#include "../libfsclfs/libfsclfs_verifier.h"
+
+uint8_t fsclfs_test_verifier_owner_page_data[ 120 ] = {
+	0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 };
+
+/* Container data of a single region with a block and the owner page
+ */
+uint8_t fsclfs_test_verifier_data[ 1024 ];
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+/* Sets up the container data of the test
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_verifier_set_data(
+     void )
+{
+	if( memory_set(
+	     fsclfs_test_verifier_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		return( 0 );
+	}
+	if( fsclfs_test_set_block_data(
+	     fsclfs_test_verifier_data,
+	     1024,
+	     1 ) != 1 )
+	{
+		return( 0 );
+	}
+	/* The first record of the block is at virtual LSN 0x1000 and the second
+	 * record at virtual LSN 0x1040 refers to the first record
+	 */
+	fsclfs_test_verifier_data[ 0x71 ] = 0x10;
+	fsclfs_test_verifier_data[ 0x81 ] = 0x00;
+	fsclfs_test_verifier_data[ 0xa0 ] = 0x40;
+	fsclfs_test_verifier_data[ 0xb1 ] = 0x10;
+
+	if( memory_copy(
+	     &( fsclfs_test_verifier_data[ 512 ] ),
+	     fsclfs_test_verifier_owner_page_data,
+	     120 ) == NULL )
+	{
+		return( 0 );
+	}
+	/* The fix-up of the first and last sector
+	 */
+	fsclfs_test_verifier_data[ 1022 ] = 0x60;
+
+	return( 1 );
+}
+
+/* Verifies the base log block and the container block of the test data
+ * Returns 1 if successful or -1 on error
+ */
+int fsclfs_test_verifier_verify_data(
+     libfsclfs_io_handle_t *io_handle,
+     libbfio_handle_t *base_log_file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_threads,
+     int *base_log_failure_type,
+     int *failure_type,
+     uint32_t *failure_offset,
+     libcerror_error_t **error )
+{
+	libfsclfs_verifier_t *verifier = NULL;
+
+	if( libfsclfs_verifier_initialize(
+	     &verifier,
+	     io_handle,
+	     base_log_file_io_handle,
+	     file_io_pool,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsclfs_verifier_append_block(
+	     verifier,
+	     0,
+	     0,
+	     1,
+	     0,
+	     512,
+	     0x00001000UL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsclfs_verifier_append_block(
+	     verifier,
+	     -1,
+	     -1,
+	     0,
+	     0,
+	     512,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsclfs_verifier_verify(
+	     verifier,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The base log region is sorted before the container region
+	 */
+	if( ( verifier->number_of_regions != 2 )
+	 || ( verifier->regions[ 0 ].container_index != -1 )
+	 || ( verifier->regions[ 1 ].container_index != 0 )
+	 || ( verifier->regions[ 1 ].number_of_blocks != 1 ) )
+	{
+		goto on_error;
+	}
+	*base_log_failure_type = verifier->regions[ 0 ].failure_type;
+	*failure_type          = verifier->regions[ 1 ].failure_type;
+	*failure_offset        = verifier->regions[ 1 ].failure_offset;
+
+	if( libfsclfs_verifier_free(
+	     &verifier,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( verifier != NULL )
+	{
+		libfsclfs_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsclfs_verifier_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_verifier_initialize(
+     void )
+{
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsclfs_io_handle_t *io_handle = NULL;
+	libfsclfs_verifier_t *verifier   = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          io_handle,
+	          NULL,
+	          file_io_pool,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "verifier",
+	 verifier );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "verifier->number_of_blocks",
+	 verifier->number_of_blocks,
+	 0 );
+
+	result = libfsclfs_verifier_free(
+	          &verifier,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "verifier",
+	 verifier );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_verifier_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          file_io_pool,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	verifier = (libfsclfs_verifier_t *) 0x12345678UL;
+
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          io_handle,
+	          NULL,
+	          file_io_pool,
+	          1,
+	          &error );
+
+	verifier = NULL;
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          NULL,
+	          NULL,
+	          file_io_pool,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          io_handle,
+	          NULL,
+	          file_io_pool,
+	          -1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSCLFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_verifier_initialize with malloc failing
+		 */
+		fsclfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsclfs_verifier_initialize(
+		          &verifier,
+		          io_handle,
+		          NULL,
+		          file_io_pool,
+		          1,
+		          &error );
+
+		if( fsclfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsclfs_test_malloc_attempts_before_fail = -1;
+
+			if( verifier != NULL )
+			{
+				libfsclfs_verifier_free(
+				 &verifier,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "verifier",
+			 verifier );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsclfs_verifier_initialize with memset failing
+		 */
+		fsclfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsclfs_verifier_initialize(
+		          &verifier,
+		          io_handle,
+		          NULL,
+		          file_io_pool,
+		          1,
+		          &error );
+
+		if( fsclfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsclfs_test_memset_attempts_before_fail = -1;
+
+			if( verifier != NULL )
+			{
+				libfsclfs_verifier_free(
+				 &verifier,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSCLFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSCLFS_TEST_ASSERT_IS_NULL(
+			 "verifier",
+			 verifier );
+
+			FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSCLFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verifier != NULL )
+	{
+		libfsclfs_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_verifier_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_verifier_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsclfs_verifier_free(
+	          NULL,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_verifier_append_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_verifier_append_block(
+     void )
+{
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsclfs_io_handle_t *io_handle = NULL;
+	libfsclfs_verifier_t *verifier   = NULL;
+	int block_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          io_handle,
+	          NULL,
+	          file_io_pool,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( block_index = 0;
+	     block_index < 300;
+	     block_index++ )
+	{
+		result = libfsclfs_verifier_append_block(
+		          verifier,
+		          0,
+		          0,
+		          1,
+		          (uint32_t) block_index * 512,
+		          512,
+		          (uint64_t) block_index * 512,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "verifier->number_of_blocks",
+	 verifier->number_of_blocks,
+	 300 );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "verifier->blocks[ 299 ].offset",
+	 verifier->blocks[ 299 ].offset,
+	 (uint32_t) ( 299 * 512 ) );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_verifier_append_block(
+	          NULL,
+	          0,
+	          0,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_verifier_append_block(
+	          verifier,
+	          -2,
+	          0,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a block of the base log without a base log file IO handle
+	 */
+	result = libfsclfs_verifier_append_block(
+	          verifier,
+	          -1,
+	          -1,
+	          0,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_verifier_append_block(
+	          verifier,
+	          0,
+	          1,
+	          1,
+	          0,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_verifier_free(
+	          &verifier,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verifier != NULL )
+	{
+		libfsclfs_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsclfs_verifier_verify function
+ * Returns 1 if successful or 0 if not
+ */
+int fsclfs_test_verifier_verify(
+     void )
+{
+	libbfio_handle_t *base_log_file_io_handle = NULL;
+	libbfio_handle_t *file_io_handle          = NULL;
+	libbfio_pool_t *file_io_pool              = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsclfs_io_handle_t *io_handle          = NULL;
+	libfsclfs_verifier_t *verifier            = NULL;
+	uint32_t calculated_checksum              = 0;
+	uint32_t failure_offset                   = 0;
+	int base_log_failure_type                 = 0;
+	int failure_type                          = 0;
+	int number_of_threads                     = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = fsclfs_test_verifier_set_data();
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsclfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_set_geometry(
+	          io_handle,
+	          512,
+	          1024,
+	          512,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &base_log_file_io_handle,
+	          fsclfs_test_verifier_data,
+	          1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsclfs_test_verifier_data,
+	          1024,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          1,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_handle(
+	          file_io_pool,
+	          0,
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO handle is now managed by the pool
+	 */
+	file_io_handle = NULL;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads *= 4 )
+	{
+		result = fsclfs_test_verifier_verify_data(
+		          io_handle,
+		          base_log_file_io_handle,
+		          file_io_pool,
+		          number_of_threads,
+		          &base_log_failure_type,
+		          &failure_type,
+		          &failure_offset,
+		          &error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSCLFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "base_log_failure_type",
+		 base_log_failure_type,
+		 LIBFSCLFS_VERIFICATION_FAILURE_NONE );
+
+		FSCLFS_TEST_ASSERT_EQUAL_INT(
+		 "failure_type",
+		 failure_type,
+		 LIBFSCLFS_VERIFICATION_FAILURE_NONE );
+	}
+	/* Test a block with a stored checksum
+	 */
+	result = libfsclfs_checksum_calculate_crc32(
+	          &calculated_checksum,
+	          fsclfs_test_verifier_data,
+	          512,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fsclfs_test_verifier_data[ 12 ] = (uint8_t) ( calculated_checksum & 0xff );
+	fsclfs_test_verifier_data[ 13 ] = (uint8_t) ( ( calculated_checksum >> 8 ) & 0xff );
+	fsclfs_test_verifier_data[ 14 ] = (uint8_t) ( ( calculated_checksum >> 16 ) & 0xff );
+	fsclfs_test_verifier_data[ 15 ] = (uint8_t) ( ( calculated_checksum >> 24 ) & 0xff );
+
+	result = fsclfs_test_verifier_verify_data(
+	          io_handle,
+	          base_log_file_io_handle,
+	          file_io_pool,
+	          2,
+	          &base_log_failure_type,
+	          &failure_type,
+	          &failure_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "failure_type",
+	 failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_NONE );
+
+	/* Test a block with a mismatching checksum
+	 */
+	fsclfs_test_verifier_data[ 12 ] ^= 0xff;
+
+	result = fsclfs_test_verifier_verify_data(
+	          io_handle,
+	          base_log_file_io_handle,
+	          file_io_pool,
+	          2,
+	          &base_log_failure_type,
+	          &failure_type,
+	          &failure_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "base_log_failure_type",
+	 base_log_failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_CHECKSUM );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "failure_type",
+	 failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_CHECKSUM );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "failure_offset",
+	 failure_offset,
+	 (uint32_t) 0 );
+
+	/* Test a block with an invalid signature
+	 */
+	result = fsclfs_test_verifier_set_data();
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fsclfs_test_verifier_data[ 0 ] = 0xff;
+
+	result = fsclfs_test_verifier_verify_data(
+	          io_handle,
+	          base_log_file_io_handle,
+	          file_io_pool,
+	          2,
+	          &base_log_failure_type,
+	          &failure_type,
+	          &failure_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "failure_type",
+	 failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_SIGNATURE );
+
+	/* Test a record with a previous LSN beyond its own LSN
+	 */
+	result = fsclfs_test_verifier_set_data();
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fsclfs_test_verifier_data[ 177 ] = 0x20;
+
+	result = fsclfs_test_verifier_verify_data(
+	          io_handle,
+	          base_log_file_io_handle,
+	          file_io_pool,
+	          2,
+	          &base_log_failure_type,
+	          &failure_type,
+	          &failure_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records of the base log are not verified
+	 */
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "base_log_failure_type",
+	 base_log_failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_NONE );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "failure_type",
+	 failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_PREVIOUS_LSN );
+
+	/* Test an owner page that maps the block to another stream
+	 */
+	result = fsclfs_test_verifier_set_data();
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	fsclfs_test_verifier_data[ 512 + 0x70 ] = 0x02;
+
+	result = fsclfs_test_verifier_verify_data(
+	          io_handle,
+	          base_log_file_io_handle,
+	          file_io_pool,
+	          2,
+	          &base_log_failure_type,
+	          &failure_type,
+	          &failure_offset,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "failure_type",
+	 failure_type,
+	 LIBFSCLFS_VERIFICATION_FAILURE_OWNER_PAGE );
+
+	FSCLFS_TEST_ASSERT_EQUAL_UINT32(
+	 "failure_offset",
+	 failure_offset,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsclfs_verifier_verify(
+	          NULL,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsclfs_verifier_initialize(
+	          &verifier,
+	          io_handle,
+	          base_log_file_io_handle,
+	          file_io_pool,
+	          1,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_verifier_verify(
+	          verifier,
+	          0,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSCLFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsclfs_verifier_free(
+	          &verifier,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsclfs_test_close_file_io_handle(
+	          &base_log_file_io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsclfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSCLFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSCLFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verifier != NULL )
+	{
+		libfsclfs_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( base_log_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &base_log_file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsclfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSCLFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSCLFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSCLFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_verifier_initialize",
+	 fsclfs_test_verifier_initialize );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_verifier_free",
+	 fsclfs_test_verifier_free );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_verifier_append_block",
+	 fsclfs_test_verifier_append_block );
+
+	FSCLFS_TEST_RUN(
+	 "libfsclfs_verifier_verify",
+	 fsclfs_test_verifier_verify );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSCLFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+#
+# Python-bindings store type test script
+#
+# Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import argparse
+import array
+import sys
+import unittest
+
+import pyfsclfs
+
+
+class StoreTypeTests(unittest.TestCase):
+  """Tests the store type."""
+
+  def test_signal_abort(self):
+    """Tests the signal_abort function."""
+    fsclfs_store = pyfsclfs.store()
+
+    fsclfs_store.signal_abort()
+
+  def test_open(self):
+    """Tests the open function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    fsclfs_store = pyfsclfs.store()
+
+    fsclfs_store.open(test_source)
+
+    fsclfs_store.close()
+
+    with self.assertRaises(TypeError):
+      fsclfs_store.open(None)
+
+    with self.assertRaises(ValueError):
+      fsclfs_store.open(test_source, mode="w")
+
+  def test_close(self):
+    """Tests the close function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    fsclfs_store = pyfsclfs.store()
+
+    fsclfs_store.open(test_source)
+
+    fsclfs_store.close()
+
+  def test_get_streams(self):
+    """Tests the get_streams function and streams property."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    fsclfs_store = pyfsclfs.store()
+
+    fsclfs_store.open(test_source)
+
+    try:
+      number_of_streams = fsclfs_store.get_number_of_streams()
+      self.assertIsNotNone(number_of_streams)
+
+      self.assertEqual(len(fsclfs_store.streams), number_of_streams)
+
+      for fsclfs_stream in fsclfs_store.streams:
+        self.assertIsNotNone(fsclfs_stream.base_lsn)
+        self.assertIsNotNone(fsclfs_stream.last_lsn)
+
+    finally:
+      fsclfs_store.close()
+
+  def test_get_records(self):
+    """Tests the get_records and get_record_headers functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    fsclfs_store = pyfsclfs.store()
+
+    fsclfs_store.open(test_source)
+
+    try:
+      if fsclfs_store.number_of_streams == 0:
+        raise unittest.SkipTest("missing streams")
+
+      fsclfs_stream = fsclfs_store.get_stream(0)
+
+      for fsclfs_record in fsclfs_stream.records:
+        record_data = fsclfs_record.data
+        self.assertIsInstance(record_data, memoryview)
+        self.assertTrue(record_data.readonly)
+
+        record_headers = fsclfs_stream.get_record_headers(fsclfs_record.lsn)
+        self.assertIsNotNone(record_headers)
+
+        virtual_lsns = record_headers["virtual_lsns"]
+        self.assertIsInstance(virtual_lsns, array.array)
+        self.assertIn(fsclfs_record.lsn, virtual_lsns)
+
+        number_of_records = len(virtual_lsns)
+        for column_name in (
+            "previous_lsns", "undo_next_lsns", "sizes", "record_types",
+            "flags"):
+          self.assertEqual(
+              len(record_headers[column_name]), number_of_records)
+
+        break
+
+    finally:
+      fsclfs_store.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
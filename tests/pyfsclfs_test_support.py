@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+#
+# Python-bindings support functions test script
+#
+# Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import sys
+import unittest
+
+import pyfsclfs
+
+
+class SupportFunctionsTests(unittest.TestCase):
+  """Tests the support functions."""
+
+  def test_get_version(self):
+    """Tests the get_version function."""
+    version = pyfsclfs.get_version()
+    self.assertIsNotNone(version)
+
+  def test_open(self):
+    """Tests the open function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    fsclfs_store = pyfsclfs.open(test_source)
+    self.assertIsNotNone(fsclfs_store)
+
+    fsclfs_store.close()
+
+    with self.assertRaises(TypeError):
+      pyfsclfs.open(None)
+
+    with self.assertRaises(ValueError):
+      pyfsclfs.open(test_source, mode="w")
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
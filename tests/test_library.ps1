@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "block block_descriptor container container_descriptor error io_handle log_range notify owner_page record record_value stream stream_descriptor support"
+$LibraryTests = "--help aligned_pool block block_descriptor block_scanner carver checksum container container_descriptor error io_handle log_range logical_record notify owner_page record record_cursor record_fetcher record_filter record_header_table record_value region_scanner scan_cursor scheduler statistics stream stream_descriptor support trace verifier"
 $LibraryTestsWithInput = "store"
 $OptionSets = ""
 
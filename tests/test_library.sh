@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="block block_descriptor container container_descriptor error io_handle log_range notify owner_page record record_value stream stream_descriptor support";
+LIBRARY_TESTS="--help aligned_pool block block_descriptor block_scanner carver checksum container container_descriptor error io_handle log_range logical_record notify owner_page record record_cursor record_fetcher record_filter record_header_table record_value region_scanner scan_cursor scheduler statistics stream stream_descriptor support trace verifier";
 LIBRARY_TESTS_WITH_INPUT="store";
 OPTION_SETS=();
 
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$ToolsTests = "info_handle output signal"
+$ToolsTests = "export_handle info_handle output signal"
 $ToolsTestsWithInput = ""
 
 $InputGlob = "*"